@@ -32,6 +32,10 @@
 /* source management */
 #define TOUCH_DRIVER_C
 
+/* sampling */
+#define TOUCH_SAMPLES    7         /* samples per position (odd number) */
+#define TOUCH_WINDOW     64        /* max. spread of inner samples (raw) */
+
 
 /*
  *  include header files
@@ -45,6 +49,42 @@
 #include "ADS7843.h"          /* ADS7843 specifics */
 
 
+/*
+ *  local constants (depending on header files)
+ */
+
+/* /PEN_IRQ: pin change interrupt */
+#define TOUCH_PC_BIT     (TOUCH_PCINT % 8)   /* bit in mask register */
+
+#if (TOUCH_PCINT >= 0) && (TOUCH_PCINT <= 7)
+  #define TOUCH_PC_IRQ         PCIE0      /* Pin Change Interrupt Enable 0 */
+  #define TOUCH_PC_FLAG        PCIF0      /* Pin Change Interrupt Flag 0 */
+  #define TOUCH_PC_MASK        PCMSK0     /* Pin Change Mask Register 0 */
+  #define ISR_TOUCH_PINCHANGE  PCINT0_vect     /* ISR */
+#endif
+
+#if (TOUCH_PCINT >= 8) && (TOUCH_PCINT <= 15)
+  #define TOUCH_PC_IRQ         PCIE1      /* Pin Change Interrupt Enable 1 */
+  #define TOUCH_PC_FLAG        PCIF1      /* Pin Change Interrupt Flag 1 */
+  #define TOUCH_PC_MASK        PCMSK1     /* Pin Change Mask Register 1 */
+  #define ISR_TOUCH_PINCHANGE  PCINT1_vect     /* ISR */
+#endif
+
+#if (TOUCH_PCINT >= 16) && (TOUCH_PCINT <= 23)
+  #define TOUCH_PC_IRQ         PCIE2      /* Pin Change Interrupt Enable 2 */
+  #define TOUCH_PC_FLAG        PCIF2      /* Pin Change Interrupt Flag 2 */
+  #define TOUCH_PC_MASK        PCMSK2     /* Pin Change Mask Register 2 */
+  #define ISR_TOUCH_PINCHANGE  PCINT2_vect     /* ISR */
+#endif
+
+#if (TOUCH_PCINT >= 24) && (TOUCH_PCINT <= 31)
+  #define TOUCH_PC_IRQ         PCIE3      /* Pin Change Interrupt Enable 3 */
+  #define TOUCH_PC_FLAG        PCIF3      /* Pin Change Interrupt Flag 3 */
+  #define TOUCH_PC_MASK        PCMSK3     /* Pin Change Mask Register 3 */
+  #define ISR_TOUCH_PINCHANGE  PCINT3_vect     /* ISR */
+#endif
+
+
 /*
  *  local variables
  */
@@ -125,29 +165,38 @@ void Touch_BusSetup(void)
 
 /*
  *  send control byte and return result of conversion
+ *  - 16 clocks per conversion: the control byte of the next
+ *    conversion is sent with the last byte of the current one
  *
  *  required:
- *  - byte value to send
+ *  - Command: control byte to start conversion
+ *    0 if conversion was already started by the prior xfer
+ *  - Next: control byte for next conversion
+ *    0 for none
  */
 
-uint16_t Touch_Xfer(uint8_t Command)
+uint16_t Touch_Xfer(uint8_t Command, uint8_t Next)
 {
   uint16_t          Value;    /* return value */
   uint8_t           Byte;     /* */
 
   /* send control byte */
-  SPI_Write_Byte(Command);              /* write control byte */
+  if (Command)                          /* not chained */
+  {
+    SPI_Write_Byte(Command);            /* write control byte */
+  }
 
   /*
-   *  send two dummy bytes and read conversion value (12 bits)
+   *  send two bytes and read conversion value (12 bits)
    *  - first byte: 0 followed by first 7 bits
    *  - second byte: last 5 bits followed by 0s
+   *  - the second byte sent is the next control byte (or 0)
    */ 
 
-  Value = SPI_WriteRead_Byte(0);        /* write dummy byte #1 */
+  Value = SPI_WriteRead_Byte(0);        /* write dummy byte */
   Value <<= 5;                          /* shift to MSB position */
 
-  Byte = SPI_WriteRead_Byte(0);         /* write dummy byte #2 */
+  Byte = SPI_WriteRead_Byte(Next);      /* write next control byte */
   Byte >>= 3;                           /* remove padding */
 
   Value |= Byte;                        /* combine bytes */
@@ -196,61 +245,135 @@ void Touch_DeselectChip(void)
 
 
 
+/*
+ *  filter samples
+ *  - sort samples and check spread of inner samples
+ *  - average the three samples around the median
+ *
+ *  requires:
+ *  - Data: array of TOUCH_SAMPLES raw values (will be sorted)
+ *  - Value: pointer to result
+ *
+ *  returns:
+ *  - 0 on noisy samples
+ *  - 1 on valid result
+ */
+
+uint8_t Touch_Filter(uint16_t *Data, uint16_t *Value)
+{
+  uint8_t           Flag = 0;      /* return value */
+  uint8_t           n, m;          /* counters */
+  uint16_t          Temp;          /* sample */
+
+  /* insertion sort (ascending) */
+  n = 1;
+  while (n < TOUCH_SAMPLES)
+  {
+    Temp = Data[n];
+    m = n;
+
+    while ((m > 0) && (Data[m - 1] > Temp))
+    {
+      Data[m] = Data[m - 1];       /* move up */
+      m--;
+    }
+
+    Data[m] = Temp;
+    n++;                           /* next sample */
+  }
+
+  /* spread of inner samples (ignoring min and max) */
+  Temp = Data[TOUCH_SAMPLES - 2] - Data[1];
+
+  if (Temp <= TOUCH_WINDOW)        /* within window */
+  {
+    /* average of median and its neighbours */
+    n = TOUCH_SAMPLES / 2;         /* index of median */
+    Temp = Data[n - 1] + Data[n] + Data[n + 1];
+    *Value = Temp / 3;
+
+    Flag = 1;                      /* signal valid result */
+  }
+
+  return Flag;
+}
+
+
+
 /*
  *  get X and Y values from controller
+ *
+ *  returns:
+ *  - 0 on noisy samples
+ *  - 1 on valid position
  */
 
-void Touch_Read_XY(void)
+uint8_t Touch_Read_XY(void)
 {
-  uint8_t           n = 1;    /* counter */
-  uint16_t          X = 0;    /* raw X position */
-  uint16_t          Y = 0;    /* raw Y position */
+  uint8_t           Flag;          /* return value */
+  uint8_t           n = 0;         /* counter */
+  uint8_t           Next;          /* next control byte */
+  uint16_t          X[TOUCH_SAMPLES];   /* raw X positions */
+  uint16_t          Y[TOUCH_SAMPLES];   /* raw Y positions */
+
+  /* control bytes */
+  #define CMD_X     (FLAG_STARTBIT | FLAG_CHAN_X | FLAG_DFR | FLAG_PWR_ALWAYS)
+  #define CMD_Y     (FLAG_STARTBIT | FLAG_CHAN_Y | FLAG_DFR | FLAG_PWR_ALWAYS)
+  #define CMD_PD    (FLAG_STARTBIT | FLAG_CHAN_X | FLAG_SER | FLAG_PWR_DOWN_1)
 
   /*
    *  We use the differential reference and 12 bit resolution
    *  - hint: power mode "always on" disables /PEN_IRQ
+   *  - /PEN_IRQ toggles during conversions, so we mask the
+   *    pin change interrupt meanwhile
    */
 
+  TOUCH_PC_MASK &= ~(1 << TOUCH_PC_BIT);     /* disable pin change */
+
   Touch_SelectChip();                   /* select chip */
 
   /*
-   *  todo: optimize SPI communication
-   *  - send next control byte as third byte of current xfer
-   *  - Touch_Xfer(Cmd1, Cmd2)
-   *    - send startbyte if Cmd1 != 0
-   *      Cmd1 = 0 creates 2 byte xfer for last run
-   *    - send Cmd2 in third byte
+   *  chain conversions: X Y X Y ... X Y PD
+   *  - first xfer sends control byte, the following ones
+   *    send the next control byte with their second byte
    */
 
-  /*
-   *  todo:
-   *  - don't just average 4 samples
-   *  - check if positions are within some margin window
-   *  - add return value (flag)?
-   */
+  X[0] = Touch_Xfer(CMD_X, CMD_Y);      /* first X */
 
-  while (n <= 4)              /* take 4 samples */
+  while (n < TOUCH_SAMPLES)
   {
-    /* get raw X value */
-    X += Touch_Xfer(FLAG_STARTBIT | FLAG_CHAN_X | FLAG_DFR | FLAG_PWR_ALWAYS);
+    if (n > 0)                     /* not first run */
+    {
+      X[n] = Touch_Xfer(0, CMD_Y);      /* get raw X value */
+    }
+
+    /* last run: dummy conversion to enable /PEN_IRQ again */
+    Next = CMD_X;
+    if (n == TOUCH_SAMPLES - 1) Next = CMD_PD;
 
-    /* get raw Y value */
-    Y += Touch_Xfer(FLAG_STARTBIT | FLAG_CHAN_Y | FLAG_DFR | FLAG_PWR_ALWAYS);
+    Y[n] = Touch_Xfer(0, Next);         /* get raw Y value */
 
     n++;            /* next round */
   }
 
-  X /= 4;           /* calculate average */
-  Y /= 4;           /* calculate average */
-
-  /* dummy conversion to enable /PEN_IRQ again */
-  Touch_Xfer(FLAG_STARTBIT | FLAG_CHAN_X | FLAG_SER | FLAG_PWR_DOWN_1);
+  Touch_Xfer(0, 0);                     /* finish dummy conversion */
 
   Touch_DeselectChip();                 /* disable chip */
 
-  /* update global variables */
-  UI.TouchRaw_X = X;
-  UI.TouchRaw_Y = Y;
+  /* clear pending pin change and enable interrupt again */
+  PCIFR = (1 << TOUCH_PC_FLAG);         /* clear flag */
+  TOUCH_PC_MASK |= (1 << TOUCH_PC_BIT);      /* enable pin change */
+
+  /* filter samples and update global variables */
+  Flag = Touch_Filter(X, &UI.TouchRaw_X);
+  Flag &= Touch_Filter(Y, &UI.TouchRaw_Y);
+
+  /* clean up */
+  #undef CMD_X
+  #undef CMD_Y
+  #undef CMD_PD
+
+  return Flag;
 }
 
 
@@ -447,18 +570,26 @@ void Touch_Init(void)
   Touch_SelectChip();                   /* select chip */
 
   /* dummy conversion to enable /PEN_IRQ */
-  Touch_Xfer(FLAG_STARTBIT | FLAG_CHAN_X | FLAG_SER| FLAG_PWR_DOWN_1);
+  Touch_Xfer(FLAG_STARTBIT | FLAG_CHAN_X | FLAG_SER| FLAG_PWR_DOWN_1, 0);
 
   Touch_DeselectChip();                 /* disable chip */
+
+  /* enable pin change interrupt for /PEN_IRQ */
+  TOUCH_PC_MASK |= (1 << TOUCH_PC_BIT);      /* enable pin */
+  PCICR |= (1 << TOUCH_PC_IRQ);         /* enable interrupt */
+
+  TouchEvent = 1;                  /* check for pen already down */
 }
 
 
 
 /*
  *  check touch screen and get position when touched
+ *  - the controller is read only after a pen-down event
+ *    signaled by the ISR for /PEN_IRQ
  *
  *  returns:
- *  - 0 not touched
+ *  - 0 not touched (or noisy samples)
  *  - 1 touched
  */
 
@@ -466,6 +597,9 @@ uint8_t Touch_Check(void)
 {
   uint8_t           Flag = 0;      /* return value */
   uint8_t           Test;
+  uint8_t           Old_SREG;      /* copy of SREG */
+
+  if (TouchEvent == 0) return Flag;     /* no pen-down event */
 
   /* check for /PEN_IRQ */
   Test = TOUCH_PIN;                /* read port */
@@ -473,10 +607,26 @@ uint8_t Touch_Check(void)
   if (Test == 0)                   /* /PEN_IRQ low */
   {
     /* touch event */
-    Touch_Read_XY();          /* read raw position */
-    Touch_CharPos();          /* and convert to char position */
+    Flag = Touch_Read_XY();        /* read raw position */
+
+    /* check /PEN_IRQ again to catch pen lifted while sampling */
+    Test = TOUCH_PIN;              /* read port */
+    Test &= (1 << TOUCH_PEN);      /* filter /PEN_IRQ */
+    if (Test) Flag = 0;            /* /PEN_IRQ high: reject */
 
-    Flag = 1;                 /* signal touch event */
+    if (Flag)                      /* valid position */
+    {
+      Touch_CharPos();        /* convert to char position */
+    }
+  }
+  else                             /* /PEN_IRQ high: pen up */
+  {
+    /* wait for next pen-down event (mind the ISR) */
+    Old_SREG = SREG;               /* save SREG */
+    cli();                         /* disable interrupts */
+    Test = TOUCH_PIN & (1 << TOUCH_PEN);
+    if (Test) TouchEvent = 0;      /* still pen up: reset flag */
+    SREG = Old_SREG;               /* restore SREG */
   }
 
   return Flag;
@@ -484,6 +634,23 @@ uint8_t Touch_Check(void)
 
 
 
+/*
+ *  ISR for pin change of /PEN_IRQ
+ *  - signals pen-down event (/PEN_IRQ low)
+ *  - also wakes up MCU from sleep mode
+ */
+
+ISR(ISR_TOUCH_PINCHANGE, ISR_BLOCK)
+{
+  /* check for /PEN_IRQ low */
+  if (! (TOUCH_PIN & (1 << TOUCH_PEN)))
+  {
+    TouchEvent = 1;           /* signal pen-down event */
+  }
+}
+
+
+
 /*
  *  touch screen adjustment for a specific character position
  *
@@ -684,6 +851,17 @@ uint8_t Touch_Adjust(void)
 /* source management */
 #undef TOUCH_DRIVER_C
 
+/* sampling */
+#undef TOUCH_SAMPLES
+#undef TOUCH_WINDOW
+
+/* /PEN_IRQ: pin change interrupt */
+#undef TOUCH_PC_BIT
+#undef TOUCH_PC_IRQ
+#undef TOUCH_PC_FLAG
+#undef TOUCH_PC_MASK
+#undef ISR_TOUCH_PINCHANGE
+
 #endif
 
 /* ************************************************************************
@@ -58,6 +58,11 @@
 #include "symbols_24x24_hf.h"
 #include "symbols_30x32_hf.h"
 
+/* run-length encoded fonts and symbols */
+#include "font_10x16_hf_rle.h"
+#include "symbols_24x24_hf_rle.h"
+#include "symbols_30x32_hf_rle.h"
+
 
 
 /*
@@ -77,6 +82,9 @@
 #define LCD_CHAR_X            (LCD_PIXELS_X / FONT_SIZE_X)
 #define LCD_CHAR_Y            (LCD_PIXELS_Y / FONT_SIZE_Y)
 
+/* number of managed text lines (plus partial line at bottom) */
+#define LCD_LINES             (LCD_CHAR_Y + 1)
+
 /* component symbols */
 #ifdef SW_SYMBOLS
   /* resize symbols by a factor of 1 */
@@ -105,7 +113,7 @@ uint16_t            Y_Start;       /* start position Y (row) */
 uint16_t            Y_End;         /* end position Y (row) */
 
 /* text line management */
-uint16_t            LineMask;      /* bit mask for up to 16 lines */
+uint8_t             LineExtent[LCD_LINES];   /* rightmost char position used */
 
 
 
@@ -239,8 +247,6 @@ void LCD_Data(uint8_t Data)
 
 void LCD_Data2(uint16_t Data)
 {
-  uint8_t           Byte;     /* data byte */
-
   /* indicate data mode */
   LCD_PORT |= (1 << LCD_DC);       /* set D/CX high */
 
@@ -249,11 +255,36 @@ void LCD_Data2(uint16_t Data)
     LCD_PORT &= ~(1 << LCD_CS);    /* set /CSX low */
   #endif
 
-  Byte = (uint8_t)Data;            /* save LSB */
-  Data >>= 8;                      /* get MSB */
+  SPI_Write_Word(Data);            /* write data (MSB first) */
+
+  /* deselect chip, if pin available */
+  #ifdef LCD_CS
+    LCD_PORT |= (1 << LCD_CS);     /* set /CSX high */
+  #endif
+}
+
+
+
+/*
+ *  send the same data several times to the LCD
+ *  - for filling areas with a color
+ *
+ *  requires:
+ *  - Data: 2-byte value to send
+ *  - Count: number of times to send Data
+ */
+
+void LCD_Data2_Fill(uint16_t Data, uint16_t Count)
+{
+  /* indicate data mode */
+  LCD_PORT |= (1 << LCD_DC);       /* set D/CX high */
 
-  SPI_Write_Byte((uint8_t)Data);   /* write MSB of data */
-  SPI_Write_Byte(Byte);            /* write LSB of data */
+  /* select chip, if pin available */
+  #ifdef LCD_CS
+    LCD_PORT &= ~(1 << LCD_CS);    /* set /CSX low */
+  #endif
+
+  SPI_Repeat_Word(Data, Count);    /* write data Count times */
 
   /* deselect chip, if pin available */
   #ifdef LCD_CS
@@ -290,6 +321,89 @@ void LCD_AddressWindow(void)
 
 
 
+#if defined (FONT_RLE) || defined (SYMBOLS_RLE)
+
+/*
+ *  send run-length encoded bitmap (see bitmap_rle.py)
+ *  - address window has to be set and memory write started
+ *  - runs are sent as color fills
+ *
+ *  requires:
+ *  - Table: address of bitmap data
+ *  - Size_X: width of bitmap (in dots)
+ *  - Size_Y: height of bitmap (in dots)
+ *  - Factor: resize factor (1 for original size)
+ */
+
+void LCD_BitmapRLE(uint8_t *Table, uint8_t Size_X, uint8_t Size_Y, uint8_t Factor)
+{
+  uint8_t           *Row;          /* start of row */
+  uint8_t           Back = 0;      /* background dots left */
+  uint8_t           Fore = 0;      /* foreground dots left */
+  uint8_t           Row_Back;      /* background dots at start of row */
+  uint8_t           Row_Fore;      /* foreground dots at start of row */
+  uint8_t           x;             /* dots left in row */
+  uint8_t           n;             /* dots to send */
+  uint8_t           f;             /* resize counter */
+  uint8_t           Data;          /* pair of runs */
+  uint16_t          Color;         /* pen color */
+
+  Color = UI.PenColor;             /* get pen color */
+
+  while (Size_Y > 0)               /* all rows */
+  {
+    /* save decoder state, required for resizing */
+    Row = Table;
+    Row_Back = Back;
+    Row_Fore = Fore;
+    f = Factor;
+
+    while (f > 0)                  /* resize row */
+    {
+      /* restore decoder state */
+      Table = Row;
+      Back = Row_Back;
+      Fore = Row_Fore;
+
+      x = Size_X;                  /* dots per row */
+      while (x > 0)
+      {
+        if (Back > 0)                   /* background run */
+        {
+          n = Back;
+          if (n > x) n = x;             /* limit to row */
+          Back -= n;
+          x -= n;
+          LCD_Data2_Fill(COLOR_BACKGROUND, (uint16_t)n * Factor);
+        }
+        else if (Fore > 0)              /* foreground run */
+        {
+          n = Fore;
+          if (n > x) n = x;             /* limit to row */
+          Fore -= n;
+          x -= n;
+          LCD_Data2_Fill(Color, (uint16_t)n * Factor);
+        }
+        else                            /* get next pair of runs */
+        {
+          Data = pgm_read_byte(Table);  /* read pair */
+          Table++;                      /* next pair */
+          Back = Data >> 3;             /* bits 7-3: background */
+          Fore = Data & 0b00000111;     /* bits 2-0: foreground */
+        }
+      }
+
+      f--;                         /* next part */
+    }
+
+    Size_Y--;                      /* next row */
+  }
+}
+
+#endif
+
+
+
 /*
  *  set LCD character position
  *
@@ -300,7 +414,7 @@ void LCD_AddressWindow(void)
 
 void LCD_CharPos(uint8_t x, uint8_t y)
 {
-  uint16_t          Mask = 1;  
+  uint16_t          Mask;
 
   /* update UI */
   UI.CharPos_X = x;
@@ -308,13 +422,6 @@ void LCD_CharPos(uint8_t x, uint8_t y)
 
   y--;                        /* rows start at zero */
 
-  /* mark text line as used */
-  if (y < 16)                 /* prevent overflow */
-  {
-    Mask <<= y;               /* shift to bit position for line */
-    LineMask |= Mask;         /* set bit for line */
-  }
-
   /* horizontal position (column) */
   x--;                        /* columns starts at 0 */
   Mask = x;                   /* expand to 16 bit */
@@ -332,6 +439,31 @@ void LCD_CharPos(uint8_t x, uint8_t y)
 
 
 
+/*
+ *  update extent of text line
+ *  - tracks rightmost character position used, which limits the area
+ *    to be cleared by LCD_ClearLine()
+ *
+ *  requires:
+ *  - Line: text line (1-)
+ *  - Pos: rightmost character position used (1-)
+ */
+
+void LCD_MarkLine(uint8_t Line, uint8_t Pos)
+{
+  Line--;                          /* index starts at zero */
+
+  if (Line < LCD_LINES)            /* prevent overflow */
+  {
+    if (Pos > LineExtent[Line])    /* beyond current extent */
+    {
+      LineExtent[Line] = Pos;      /* update extent */
+    }
+  }
+}
+
+
+
 /*
  *  clear one single character line
  *
@@ -342,9 +474,10 @@ void LCD_CharPos(uint8_t x, uint8_t y)
 
 void LCD_ClearLine(uint8_t Line)
 {
-  uint16_t          x = 0;         /* x position */
+  uint16_t          x;             /* x position */
   uint8_t           y;             /* y position */
   uint8_t           Pos = 1;       /* character position */
+  uint8_t           Extent;        /* rightmost character position used */
 
   wdt_reset();                /* reset watchdog */
 
@@ -355,28 +488,15 @@ void LCD_ClearLine(uint8_t Line)
   }
 
   /* have we to clear this line? */
-  if (Line <= 16)                  /* prevent overflow */
-  {
-    y = Line - 1;                  /* bitmask starts at zero */
-    x = 1;                         /* set start bit */
-    x <<= y;                       /* bit for this line */
-
-    if (! (LineMask & x))          /* bit not set */
-    {
-      return;                      /* nothing do to */
-    }
-  }
+  y = Line - 1;                    /* index starts at zero */
+  if (y >= LCD_LINES) return;      /* prevent overflow */
+  Extent = LineExtent[y];          /* get extent of line */
+  if (Pos > Extent) return;        /* nothing to do */
+  LineExtent[y] = Pos - 1;         /* new extent */
 
   /* manage address window */
   LCD_CharPos(Pos, Line);         /* update character position */
                                   /* also updates X_Start and Y_Start */
-  if (Pos == 1)                   /* complete line */
-  {
-    if (x > 0)                    /* got line bit */
-    {
-      LineMask &= ~x;             /* clear bit */
-    }
-  }
 
   #ifdef LCD_OFFSET_X
     /* last column considering x offset */
@@ -385,6 +505,14 @@ void LCD_ClearLine(uint8_t Line)
     X_End = LCD_PIXELS_X - 1;           /* last column */
   #endif
 
+  /* limit to used part of line */
+  if (Extent < LCD_CHAR_X)              /* not full width */
+  {
+    x = Extent - Pos + 1;               /* number of characters */
+    x *= FONT_SIZE_X;                   /* number of columns */
+    X_End = X_Start + x - 1;            /* last column */
+  }
+
   Y_End = Y_Start + FONT_SIZE_Y - 1;    /* last row */
   y = FONT_SIZE_Y;                      /* set default */
 
@@ -398,26 +526,13 @@ void LCD_ClearLine(uint8_t Line)
 
   LCD_AddressWindow();                  /* set window */
 
+  /* number of pixels */
+  x = X_End - X_Start + 1;              /* pixels per row */
+  x *= y;                               /* pixels for all rows */
+
   /* send background color */
   LCD_Cmd(CMD_MEM_WRITE);          /* start writing */
-
-  while (y > 0)                    /* character height (pages) */
-  {
-    x = X_Start;                   /* reset start position */
-    #ifdef LCD_OFFSET_X
-    x -= LCD_OFFSET_X;             /* additional X offset */
-    #endif
-
-    while (x < LCD_PIXELS_X)       /* all columns */
-    {
-      /* send background color */
-      LCD_Data2(COLOR_BACKGROUND);
-
-      x++;                         /* next column */
-    }
-
-    y--;                           /* next page */
-  }
+  LCD_Data2_Fill(COLOR_BACKGROUND, x);
 }
 
 
@@ -431,9 +546,10 @@ void LCD_Clear(void)
   uint8_t           n = 1;         /* counter */
 
   /* we have to clear all dots manually :-( */
-  while (n <= (LCD_CHAR_Y + 1))    /* for all text lines */
+  /* but just the used part of each text line (see LCD_MarkLine()) */
+  while (n <= LCD_LINES)           /* for all text lines */
   {
-    /* +1 is for a possible partial line at the bottom */
+    /* includes a possible partial line at the bottom */
 
     LCD_ClearLine(n);              /* clear line */
     n++;                           /* next line */
@@ -451,6 +567,7 @@ void LCD_Clear(void)
 void LCD_Init(void)
 {
   uint8_t           Bits;
+  uint8_t           n;             /* counter */
 
   /* hardware reset */
   #ifdef LCD_RES
@@ -515,7 +632,14 @@ void LCD_Init(void)
     UI.PenColor = COLOR_PEN;       /* set pen color */
   #endif
 
-  LineMask = 0xffff;               /* clear all lines by default */
+  /* clear all lines by default */
+  n = 0;
+  while (n < LCD_LINES)
+  {
+    LineExtent[n] = LCD_CHAR_X;    /* full width */
+    n++;                           /* next line */
+  }
+
   LCD_Clear();                     /* clear display */
   #ifdef LCD_LATE_ON
     /* turn on display after clearing it */
@@ -537,11 +661,13 @@ void LCD_Char(unsigned char Char)
   uint8_t           *Table;        /* pointer to table */
   uint8_t           Index;         /* font index */
   uint16_t          Offset;        /* address offset */
+  #ifndef FONT_RLE
   uint8_t           Pixels;        /* pixels in y direction */
   uint8_t           x;             /* bitmap x byte counter */
   uint8_t           y = 1;         /* bitmap y byte counter */
   uint8_t           Bits;          /* number of bits to be sent */
   uint8_t           n;             /* bitmap bit counter */
+  #endif
 
   /* prevent x overflow */
   if (UI.CharPos_X > LCD_CHAR_X) return;
@@ -554,7 +680,11 @@ void LCD_Char(unsigned char Char)
 
   /* calculate start address of character bitmap */
   Table = (uint8_t *)&FontData;        /* start address of font data */
+  #ifdef FONT_RLE
+  Offset = pgm_read_word(&FontIndex[Index]);  /* offset for character */
+  #else
   Offset = FONT_BYTES_N * Index;       /* offset for character */
+  #endif
   Table += Offset;                     /* address of character data */
 
   /* LCD's address window */
@@ -564,6 +694,12 @@ void LCD_Char(unsigned char Char)
   Y_End = Y_Start + FONT_SIZE_Y - 1;   /* offset for end */
   LCD_AddressWindow();                 /* set address window */
 
+  #ifdef FONT_RLE
+  LCD_Cmd(CMD_MEM_WRITE);              /* start writing */
+
+  /* decode character bitmap and send it to display */
+  LCD_BitmapRLE(Table, FONT_SIZE_X, FONT_SIZE_Y, 1);
+  #else
   Offset = UI.PenColor;                /* get pen color */
   LCD_Cmd(CMD_MEM_WRITE);              /* start writing */
 
@@ -606,7 +742,9 @@ void LCD_Char(unsigned char Char)
 
     y++;                                /* next row */
   }
+  #endif
 
+  LCD_MarkLine(UI.CharPos_Y, UI.CharPos_X);  /* update extent of line */
   UI.CharPos_X++;             /* update character position */
 }
 
@@ -654,19 +792,25 @@ void LCD_Cursor(uint8_t Mode)
 void LCD_Symbol(uint8_t ID)
 {
   uint8_t           *Table;        /* pointer to symbol table */
+  uint16_t          Offset;        /* address offset */
+  uint8_t           x;             /* bitmap x byte counter */
+  uint8_t           n;             /* bitmap bit counter */
+  #ifndef SYMBOLS_RLE
   uint8_t           *Table2;       /* pointer */
   uint8_t           Data;          /* symbol data */
-  uint16_t          Offset;        /* address offset */
   uint8_t           Pixels;        /* pixels in y direction */
-  uint8_t           x;             /* bitmap x byte counter */
   uint8_t           y = 1;         /* bitmap y byte counter */
   uint8_t           Bits;          /* number of bits to be sent */
-  uint8_t           n;             /* bitmap bit counter */
   uint8_t           factor = SYMBOL_RESIZE;  /* resize factor */
+  #endif
 
   /* calculate start address of character bitmap */
   Table = (uint8_t *)&SymbolData;       /* start address of symbol data */
+  #ifdef SYMBOLS_RLE
+  Offset = pgm_read_word(&SymbolIndex[ID]);  /* offset for symbol */
+  #else
   Offset = SYMBOL_BYTES_N * ID;         /* offset for symbol */
+  #endif
   Table += Offset;                      /* address of symbol data */
 
   /* LCD's address window */
@@ -676,6 +820,12 @@ void LCD_Symbol(uint8_t ID)
   Y_End = Y_Start + (SYMBOL_SIZE_Y * SYMBOL_RESIZE) - 1;  /* offset for end */
   LCD_AddressWindow();                  /* set address window */
 
+  #ifdef SYMBOLS_RLE
+  LCD_Cmd(CMD_MEM_WRITE);               /* start writing */
+
+  /* decode symbol bitmap and send it to display */
+  LCD_BitmapRLE(Table, SYMBOL_SIZE_X, SYMBOL_SIZE_Y, SYMBOL_RESIZE);
+  #else
   Offset = UI.PenColor;                 /* get pen color */
   LCD_Cmd(CMD_MEM_WRITE);               /* start writing */
 
@@ -737,14 +887,16 @@ void LCD_Symbol(uint8_t ID)
       y++;                         /* next row */
     }              
   }
+  #endif
 
   /* mark text lines as used */
   n = LCD_SYMBOL_CHAR_Y;           /* set line counter */
   x = UI.SymbolPos_Y;              /* start line */
-  while (n > 1)                    /* first line already set */
+  while (n > 0)
   {
+    LCD_CharPos(1, x);             /* move to line */
+    LCD_MarkLine(x, UI.SymbolPos_X + LCD_SYMBOL_CHAR_X - 1);
     x++;                           /* next line */
-    LCD_CharPos(1, x);             /* mark line */
     n--;                           /* next line */
   }
 }
@@ -34,20 +34,6 @@
 #define IR_SAMPLE_PERIOD         50     /* 50 s */
 #define IR_CODE_BYTES             6     /* 6 bytes = 48 bit */
 
-/* code bit mode */
-#define IR_LSB                    1     /* LSB */
-#define IR_MSB                    2     /* MSB */
-
-/* bi-phase modes (bitmask) */
-#define IR_IEEE          0b00000001     /* IEEE bit encoding */
-#define IR_THOMAS        0b00000010     /* Thomas bit encoding */
-#define IR_PRE_PAUSE     0b00000100     /* heading pause */
-
-/* timing control flags (bitmask) */
-#define IR_STD_TOLER     0b00000000     /* use default tolerance */
-#define IR_RELAX_SHORT   0b00000001     /* relax short pulses */
-#define IR_RELAX_LONG    0b00000010     /* relax long pulses */
-
 /* signal types */
 #define IR_PAUSE         0b00000001     /* pause */
 #define IR_PULSE         0b00000010     /* pulse */
@@ -77,6 +63,62 @@
   #define IR_PROTO_MAX           15     /* number of all protocols */  
 #endif
 
+/* receiver: ring buffer for pulse/pause durations */
+#define IR_RX_SIZE              128     /* entries (power of 2) */
+#define IR_RX_MASK     (IR_RX_SIZE - 1) /* mask for ring buffer */
+#define IR_RX_END                 0     /* marker: end of packet */
+#define IR_RX_BROKEN         0xFFFF     /* marker: packet with lost data */
+
+/* receiver: Timer1 as time base (prescaler 64) */
+#define IR_RX_PRESCALER          64     /* Timer1 prescaler */
+#define IR_RX_TIMEOUT  (12000UL * MCU_CYCLES_PER_US / IR_RX_PRESCALER)
+
+/* receiver: state (bitmask) */
+#define IR_RX_PACKET     0b00000001     /* receiving packet */
+#define IR_RX_DROP       0b00000010     /* lost data of current packet */
+
+/* transmitter: pulse train (mark/space durations in carrier periods) */
+#define IR_TX_SIZE              104     /* entries (Kaseikyo needs 100) */
+#define IR_TX_MARK           0x8000     /* flag: pulse (carrier on) */
+#define IR_TX_TIME           0x7FFF     /* mask: number of carrier periods */
+
+/* receiver: data signal (inverted by module) */
+#ifdef SW_IR_RECEIVER
+  #define IR_RX_LEVEL    (ADC_PIN & (1 << TP3))      /* probe #3 */
+#endif
+#ifdef HW_IR_RECEIVER
+  #define IR_RX_LEVEL    (IR_PIN & (1 << IR_DATA))   /* dedicated pin */
+#endif
+
+/* receiver: pin change interrupt */
+#ifdef IR_RX_PCINT
+  #define IR_PC_BIT      (IR_RX_PCINT % 8)   /* bit in mask register */
+
+  #if (IR_RX_PCINT >= 0) && (IR_RX_PCINT <= 7)
+    #define IR_PC_IRQ         PCIE0          /* Pin Change Interrupt Enable 0 */
+    #define IR_PC_MASK        PCMSK0         /* Pin Change Mask Register 0 */
+    #define ISR_IR_PINCHANGE  PCINT0_vect    /* ISR */
+  #endif
+
+  #if (IR_RX_PCINT >= 8) && (IR_RX_PCINT <= 15)
+    #define IR_PC_IRQ         PCIE1          /* Pin Change Interrupt Enable 1 */
+    #define IR_PC_MASK        PCMSK1         /* Pin Change Mask Register 1 */
+    #define ISR_IR_PINCHANGE  PCINT1_vect    /* ISR */
+  #endif
+
+  #if (IR_RX_PCINT >= 16) && (IR_RX_PCINT <= 23)
+    #define IR_PC_IRQ         PCIE2          /* Pin Change Interrupt Enable 2 */
+    #define IR_PC_MASK        PCMSK2         /* Pin Change Mask Register 2 */
+    #define ISR_IR_PINCHANGE  PCINT2_vect    /* ISR */
+  #endif
+
+  #if (IR_RX_PCINT >= 24) && (IR_RX_PCINT <= 31)
+    #define IR_PC_IRQ         PCIE3          /* Pin Change Interrupt Enable 3 */
+    #define IR_PC_MASK        PCMSK3         /* Pin Change Mask Register 3 */
+    #define ISR_IR_PINCHANGE  PCINT3_vect    /* ISR */
+  #endif
+#endif
+
 
 /*
  *  local variables
@@ -93,11 +135,30 @@ uint8_t             IR_State = 0;            /* multi packet protocol state */
 
 /* multi packet data fields */
 uint8_t             IR_Data_1;               /* data field #1 */
+
+/* receiver */
+uint16_t            *IR_RX_Buffer;           /* ring buffer (IR_Detector) */
+volatile uint8_t    IR_RX_Head;              /* write position */
+volatile uint8_t    IR_RX_Tail;              /* read position */
+volatile uint8_t    IR_RX_State;             /* receiver state */
+volatile uint16_t   IR_RX_Last;              /* timestamp of last edge */
 #endif
 
 #ifdef SW_IR_TRANSMITTER
 /* key toggle feature */
 uint8_t             IR_Toggle = 0;           /* key toggle flag */
+
+/* pulse train */
+uint16_t            *IR_TX_Buffer;           /* pulse train (IR_RemoteControl) */
+uint8_t             IR_TX_Items;             /* number of items */
+uint16_t            IR_TX_Top;               /* cycles per carrier period */
+uint16_t            IR_TX_Rest;              /* remaining cycles of last item */
+
+/* player */
+volatile uint8_t    IR_TX_Pos;               /* position of next item */
+volatile uint16_t   IR_TX_Count;             /* periods left for current item */
+volatile uint8_t    IR_TX_Repeat;            /* frames left to send */
+volatile uint8_t    IR_TX_Busy = 0;          /* sending flag */
 #endif
 
 
@@ -789,998 +850,782 @@ uint8_t GetBits(uint8_t StartBit, uint8_t Bits, uint8_t Mode)
 
 
 /*
- *  detect and decode IR protocol
- *  - uses IR_State to keep track of multi-packet protocols
- *
- *  requires:
- *  - pointer to array of pulse/pause duration data
- *  - number of pulses/pauses
+ *  supported protocols
+ *  - see IR_Proto_Table in variables.h for the decoder settings
  */
 
-void IR_Decode(uint8_t *PulseData, uint8_t Pulses)
-{
-  uint8_t           Flag = 0;      /* control flag */
-  uint8_t           *Pulse;        /* pointer to pause/pulse data */
-  uint8_t           PulsesLeft;    /* remaining pulses/pauses */
-  uint8_t           Time1;         /* time units #1 */
-  uint8_t           Time2;         /* time units #2 */
-  uint8_t           Bits = 0;      /* number of bits received */
-  uint8_t           Address;       /* RC address */
-  uint8_t           Command;       /* RC command */
-  uint8_t           Extras = 0;    /* RC extra stuff */
-  uint8_t           Temp;          /* temporary value */
+/*
+ *  NEC (PD6121/PD6122)
+ *  - start: pulse 9ms, pause 4.5ms
+ *  - PDM: pulse 560s, pause 0=560s 1=1690s
+ *  - bit mode: LSB
+ *  - stop: pulse 560s
+ *  - standard format: 
+ *    <start><address:8><inverted address:8><command:8><inverted command:8><stop>
+ *  - extended format:
+ *    <start><low address:8><high address:8><command:8><inverted command:8><stop>
+ *  - repeat sequence:
+ *    <pulse 9ms><pause 2.25ms><stop>
+ *  - repeat delay is 108ms (start to start)
+ */
 
-  /* local constants for Flag */
-  #define PROTO_UNKNOWN       0    /* unknown protocol */
-  #define PROTO_DETECTED      1    /* protocol detected */
-  #define PACKET_OK           2    /* valid packet */
-  #define PACKET_DISPLAY      3    /* valid packet & display standard values */
-  #define PACKET_MULTI        4    /* multi packet (more to follow) */
+/*
+ *  Sanyo (LC7461)
+ *  - start: pulse 9ms, pause 4.5ms
+ *  - PDM: pulse 560s, pause 0=560s 1=1690s
+ *  - bit mode: LSB
+ *  - stop: pulse 560s
+ *  - format: 
+ *    <start><custom code:13><inverted custom code:13><key data:8><inverted key data:8><stop>
+ *  - repeat sequence:
+ *    <start><stop>
+ *  - repeat delay is 108ms (start to start) or 23.6ms (end to start)
+ *  - carrier 38kHz (455kHz/12), duty cycle 1/3
+ */
 
-  if (Pulses < 2) return;     /* not enough pulses */
+/*
+ *  Proton
+ *  - also: Mitsubishi (M50560)
+ *  - start: pulse 8ms, pause 4ms
+ *  - sync/separator between address and command: pause 4ms
+ *  - PDM: pulse 500s, pause 0=500s 1=1500s
+ *  - bit mode: LSB
+ *  - stop: pulse 500s
+ *  - format: <start><address:8><stop><sync><command:8><stop>
+ *  - code repeat delay is 60ms (start to start)
+ */
 
+/*
+ *  JVC C8D8
+ *  - start: pulse 8.44ms, pause 4.22ms
+ *  - PDM: pulse 525s, pause 0=525s 1=1575s
+ *  - bit mode: LSB
+ *  - stop: pulse 525s
+ *  - format: <start><address:8><command:8><stop>
+ *  - repeat sequence format: <address:8><command:8><stop>
+ *  - repeat sequence delay is <start> + 46.42ms (start to start)
+ *  - alternative timings:
+ *    - start: pulse 9.4ms, pause 4.05ms (188/81)
+ *      PDM: pulse 560s, pause 0:600s 1:1620s 
+ *    - start: pulse 9ms, pause 4.2ms (180/84)
+ *      PDM: pulse 550s, pause 0:550s 1:1580s
+ */
 
-  /*
-   *  figure out the IR protocol by checking the first pulse-pause pair,
-   *  number of pulses/pauses and other features
-   */
+/*
+ *  Matsushita (Panasonic, MN6014)
+ *  - start: pulse 3.5ms, pause 3.5ms
+ *  - PDM: pulse 872s, pause 0=872s 1=2616s
+ *  - bit mode: LSB
+ *  - stop: pulse 872s
+ *  - format 12 bits / C6D6:
+ *    <start><custom code:6><data code:6><inverted custom code:6><inverted data code:6><stop>
+ *  - format 11 bits / C5D6:
+ *    <start><custom code:5><data code:6><inverted custom code:5><inverted data code:6><stop>
+ *  - repeat delay is 104.7ms (start to start), or 34ms (end to start) for 12 bit format
+ *    and 39.24ms (end to start) for 11 bit format
+ */
 
-  /* get first pulse-pause pair */
-  Pulse = PulseData;          /* first pulse */
-  Time1 = *Pulse;             /* duration of first pulse */
-  Pulse++;                    /* first pause */
-  Time2 = *Pulse;             /* duration of first pause */
-  Pulse++;                    /* second pulse (skip start pair) */
-  PulsesLeft = Pulses - 2;    /* start pair done */
+/*
+ *  Kaseikyo (Japanese Code)
+ *  - start: pulse 3456s, pause 1728s
+ *  - PDM: pulse 432s, pause 0=432s 1=1296s
+ *  - bit mode: LSB
+ *  - stop: pulse 432s
+ *  - format (48 bits):
+ *    <start><manufacturer code:16><parity:4><system:4><product:8><function:8><check:8><stop>
+ *  - parity: 0000
+ *    ?: <mc 0-3> ^ <mc 4-7> ^ <mc 8-11> ^ <mc 12-15>                 
+ *  - check: <system:4><parity:4> ^ <product:8> ^ <function:8>
+ *    ?: <system 0-3> + <product 0-3> + <product 4-7> + <function 0-3> + <function 4-7>
+ *  - code becomes valid after sending it 2 (or 3) times
+ *    code delay is 74.62ms (end to start)
+ *  - repeat sequence format: <pulse 3456s><pause 3456s><pulse 432s>
+ *  - repeat delay is 42.2ms (end to start)
+ */
 
+/*
+ *  RCA
+ *  - start: pulse 4ms, pause 4ms
+ *  - PDM: pulse 500s, pause 0=1ms 1=2ms
+ *  - stop: pulse 500s
+ *  - bit mode: MSB
+ *  - format: <start><address:4><command:8><inverted address:4><inverted command:8><stop>
+ *  - repeat delay is 64ms (start to start) or 8ms (end to start)
+ *  - alternative timing:
+ *    - start: pulse 3.75ms, pause 3.9ms
+ *    - PDM: pulse 560s, pause 0:1ms 1:2ms
+ *    - repeat delay 10ms (end to start)
+ *  - carrier 56kHz or 38.7kHz, duty cycle 1/3
+ */
 
-  /*
-   *  NEC (PD6121/PD6122)
-   *  - start: pulse 9ms, pause 4.5ms
-   *  - PDM: pulse 560s, pause 0=560s 1=1690s
-   *  - bit mode: LSB
-   *  - stop: pulse 560s
-   *  - standard format: 
-   *    <start><address:8><inverted address:8><command:8><inverted command:8><stop>
-   *  - extended format:
-   *    <start><low address:8><high address:8><command:8><inverted command:8><stop>
-   *  - repeat sequence:
-   *    <pulse 9ms><pause 2.25ms><stop>
-   *  - repeat delay is 108ms (start to start)
-   */
+/*
+ *  Motorola
+ *  - start: pulse 512s, pause 2560s
+ *  - Bi-Phase (Thomas):
+ *    0: pause 512s, pulse 512s
+ *    1: pulse 512s, pause 512s 
+ *  - bit mode: LSB
+ *  - a valid code consists of a start packet, one or more command packets
+ *    and an end packet
+ *  - command packets are repeated as long as key is pressed
+ *  - start/end packet format: <start><start "1":1><all 1s:9>
+ *  - command packet format: <start><start "1":1><command:9>
+ *  - packet delay is 32.8ms (start to start) between command packets
+ *    and 131ms (start to start) for start-command and command-end
+ */
 
-  /*
-   *  Sanyo (LC7461)
-   *  - start: pulse 9ms, pause 4.5ms
-   *  - PDM: pulse 560s, pause 0=560s 1=1690s
-   *  - bit mode: LSB
-   *  - stop: pulse 560s
-   *  - format: 
-   *    <start><custom code:13><inverted custom code:13><key data:8><inverted key data:8><stop>
-   *  - repeat sequence:
-   *    <start><stop>
-   *  - repeat delay is 108ms (start to start) or 23.6ms (end to start)
-   *  - carrier 38kHz (455kHz/12), duty cycle 1/3
-   */
+/*
+ *  IR60 (SDA2008/MC14497)
+ *  - start: pulse 550s, pause 2.5ms
+ *  - Bi-Phase (Thomas):
+ *    0: pause 550s, pulse 550s
+ *    1: pulse 550s, pause 550s
+ *  - bit mode: LSB
+ *  - a valid code consists of a start packet, one or more command packets
+ *    and an end packet
+ *  - packet delay is 34ms (start to start) or 24ms (end to start) between
+ *    start packet and first command packet
+ *  - packet delay is 120ms (end to start) for all other packets following the
+ *    first command packet
+ *  - start/end packet format: <start><start "1":1><command "62":6>
+ *  - command packet format: <start><start "1":1><command:6>
+ *  - carrier 31kHz, duty cycle 1/4
+ */
 
-  if (PulseCheck(Time1, 179, IR_RELAX_LONG))      /* pulse 9ms */
-  {
-    if (PulseCheck(Time2, 89, IR_RELAX_LONG))     /* pause 4.5ms */
-    {
-      /* try to demodulate NEC */
-      Bits = PxM_Demod(Pulse, PulsesLeft, 11, 11, 33, IR_STD_TOLER);
+/*
+ *  Thomson
+ *  - no start / AGC burst
+ *  - PDM: pulse 500s, pause 0:2ms 1:4.5ms
+ *  - stop: pulse 500s
+ *  - bit mode: LSB
+ *  - a valid code consists of at least 2 packets
+ *  - format: <device:4><toggle:1><function:7><stop>
+ *  - toggle: inverted each time a key is pressed
+ *            stays the same when key is still pressed
+ *  - packet repeat delay is 80ms (start to start)
+ *  - alternative timing:
+ *    PDM: pulse 470s, pause 0:2.05ms 1:4.6ms
+ *    stop: pulse 470s
+ */
 
-      if (Bits == 32)              /* we expect 32 bits for NEC */
-      {
-        Display_NL_EEString_Space(IR_NEC_str);    /* display protocol */
+/*
+ *  Samsung / Toshiba  (TC9012)
+ *  - start: pulse 4.5ms, pause 4.5ms
+ *  - PDM: pulse 560s, pause 0=560s 1=1690s
+ *  - bit mode: LSB
+ *  - stop: pulse 560s
+ *  - old format: <start><manufacturer code:12><command:8><stop>
+ *  - format:
+ *    <start><custom:8><copy of custom:8><data:8><inverted data:8><stop>
+ *  - repeat sequence format:
+ *    <start><inverted bit #0 of custom><stop>
+ *  - repeat delay is 108ms (start to start)
+ */
 
-        Address = GetBits(1, 8, IR_LSB);     /* get address */
-        Extras = GetBits(9, 8, IR_LSB);      /* get inverted address */
-        Command = GetBits(17, 8, IR_LSB);    /* get command */
+/*
+ *  Sony SIRC
+ *  - start: pulse 2.4ms (pause 600s)
+ *  - PWM: pause 600s, pulse 0=600s 1=1200s
+ *  - bit mode: LSB
+ *  - 12 bit format: <start><command:7><address:5>
+ *  - 15 bit format: <start><command:7><address:8>
+ *  - 20 bit format: <start><command:7><address:5><extended:8>
+ *  - code becomes valid after receiving it 3 times at least
+ *    code delay is 45ms (start to start)
+ */
 
-        /* determine protocol version */
-        Temp = ~Extras;                 /* invert */
-        if (Address != Temp)            /* address is not inverted */
-        {
-          /* extended format with 16 bit address */
-          Display_HexByte(Extras);      /* display high address */
-        }
+/*
+ *  RECS80 Standard (SAA3008, M3004)
+ *  - no start / AGC burst
+ *  - PDM: pulse 140.8s, pause 0:5060s 1:7590ms
+ *  - stop: pulse 140.8s
+ *  - bit mode: MSB
+ *  - format: <reference "1":1><toggle:1><address:3><command:6><stop>
+ *  - toggle: inverted each time a key is pressed
+ *            stays the same when key is still pressed
+ *  - packet repeat delay is 121.44ms (start to start)
+ *  - alternative timing:
+ *    PDM: pulse 180s, pause 0:4850s 1:7.4ms
+ *  - carrier 38kHz (455kHz/12), duty cycle 1/3
+ */
 
-        Flag = PACKET_DISPLAY;          /* packet ok & default output */
-        goto result;                    /* skip other checks */
-      }
-      #ifdef SW_IR_RX_EXTRA
-      else if (Bits == 42)         /* we expect 42 bits for Sanyo */
-      {
-        Display_NL_EEString_Space(IR_Sanyo_str);  /* display protocol */
+/*
+ *  RECS80 Extended (SAA3008)
+ *  - start: pulse 140.8s, pause 3659.2s, pulse 140.8s, pause 3659.2s
+ *  - PDM: pulse 140.8s, pause 0=4919.2s 1=7459.2s
+ *  - bit mode: MSB
+ *  - stop: pulse 140.8s
+ *  - format: <start><toggle:1><address:4><command:6><stop>
+ *  - toggle: inverted each time a key is pressed
+ *            stays same when key is still pressed
+ *  - repeat delay is 132.56ms (start to start)
+ *  - carrier 38kHz (455kHz/12), duty cycle 1/3
+ */
 
-        Address = GetBits(1, 8, IR_LSB);     /* get custom code LSB */
-        Extras = GetBits(9, 5, IR_LSB);      /* get custom code MSB */
-        Command = GetBits(27, 8, IR_LSB);    /* get key data */
+/*
+ *  Sharp (LR3715M)
+ *  - also: Denon
+ *  - no start / AGC burst
+ *  - PDM: pulse 264s, pause 0=786s 1=1836s
+ *  - bit mode: LSB
+ *  - stop: pulse 320s
+ *  - a valid code consists of two packets (#1 and #2)
+ *  - format packet #1:
+ *    <address:5><command:8><mask:1><type:1><stop>
+ *  - format packet #2:
+ *    <address:5><inverted command:8><inverted mask:1><inverted type:1><stop>
+ *  - mask: 0, but also seen 1
+ *  - type: indicater for packet (0 for first packet, 1 for second packet)
+ *  - delay for second packet is 67.5ms (start to start),
+ *    40ms (end to start) could work too
+ *  - alternative timing:
+ *    - pulse 320s, pause 0=680s 1=1680s
+ */
 
-        Display_HexByte(Extras);        /* display custom code MSB */
-        Flag = PACKET_DISPLAY;          /* packet ok & default output */
-        goto result;                    /* skip other checks */
-      }
-      #endif
-    }
-    else if (PulseCheck(Time2, 45, IR_STD_TOLER))      /* pause 2.25ms */
-    {
-      /* check for NEC repeat sequence */
-      if (Pulses == 3)                       /* just 3 pulses */
-      {
-        if (PulseCheck(*Pulse, 11, IR_STD_TOLER))      /* pulse 560s */
-        {
-          Display_NL_EEString_Space(IR_NEC_str);       /* display protocol */
-          Display_Char('R');                 /* display: R (for repeat) */
-          Flag = PACKET_OK;                  /* packet ok */
-          goto result;                       /* skip other checks */
-        }
-      }
-    }
-  }
+/*
+ *  Philips RC-5 Standard 
+ *  - 2 start bits: (889s L) 889s H, 889s L (889s H)
+ *  - Bi-Phase (IEEE 802.3):
+ *    0: pulse 889s, pause 889s
+ *    1: pause 889s, pulse 889s
+ *  - bit mode: MSB
+ *  - format: <s1 "1":1><s2 "1":1><toggle:1><address:5><command:6>
+ *  - toggle: inverted each time a key is pressed
+ *            stays the same when key is still pressed
+ *  - repeat delay is 114ms (start to start) or 89ms (end to start)
+ */
 
+/*
+ *  Philips RC-5 Extended
+ *  - 2 start bits: (889s L) 889s H + 889s H (889s L)
+ *  - Bi-Phase (IEEE 802.3):
+ *    0: pulse 889s, pause 889s
+ *    1: pause 889s, pulse 889s
+ *  - bit mode: MSB
+ *  - format: <s1 "1":1><s2 "0":1><toggle:1><address:5><command:6>
+ *  - s2: 0 to indicate RC-5 Extended
+ *        inverted s2 becomes bit #6 of command (| 0b1000000)
+ *  - toggle: inverted each time a key is pressed
+ *            stays the same when key is still pressed
+ *  - repeat delay is 114ms (start to start) or 89ms (end to start)
+ */
 
-  /*
-   *  Proton
-   *  - also: Mitsubishi (M50560)
-   *  - start: pulse 8ms, pause 4ms
-   *  - sync/separator between address and command: pause 4ms
-   *  - PDM: pulse 500s, pause 0=500s 1=1500s
-   *  - bit mode: LSB
-   *  - stop: pulse 500s
-   *  - format: <start><address:8><stop><sync><command:8><stop>
-   *  - code repeat delay is 60ms (start to start)
-   */
+/*
+ *  NEC PD1986C (NTE1758)
+ *  - no start / AGC burst
+ *  - PPM: 1120s, 0:pause 1:pulse
+ *  - bit mode: LSB
+ *  - 2 packets (original plus one repeat)
+ *  - format: <header "101":3><data:5>
+ *  - repeat delay is 36ms (start to start)
+ *  - carrier 38kHz (455kHz/12), duty cycle 1/2
+ *  - alternative timing:
+ *    PPM: 0:pause 1:pulse 1590s
+ *    packet delay 51,2ms (start to start)
+ *    carrier 26.7kHz (320kHz/12)
+ */
 
-  if (PulseCheck(Time1, 162, IR_RELAX_LONG))      /* pulse 8ms */
-  {
-    if (PulseCheck(Time2, 80, IR_STD_TOLER))      /* pause 4ms */
-    {
-      if (PulsesLeft == 35)        /* correct number of pulses/pauses */
-      {
-        /* check if we got the sync pause */
-        Pulse += 17;          /* 16 pulses for first part + terminating pulse */
-        if (PulseCheck(*Pulse, 80, IR_STD_TOLER))    /* pause 4ms */
-        {
-          *Pulse = 11;                  /* change sync into "0" */
-          Pulse -= 17;                  /* back to second pulse */
+/*
+ *  Philips RC-6 Standard (RC6-0-16)
+ *  - start: pulse 2664s, pause 888s
+ *  - Bi-Phase (Thomas):
+ *    normal bit 0: pause 444s, pulse 444s
+ *    normal bit 1: pulse 444s, pause 444s
+ *    toggle bit 0: pause 888s, pulse 888s
+ *    toggle bit 1: pulse 888s, pause 888s
+ *  - bit mode: MSB
+ *  - format (Mode 0, 16 bit):
+ *    <start><start bit "1":1><mode:3><toggle:1><address:8><command:8>
+ *  - mode: 000 for Mode 0
+ *  - toggle: inverted each time a key is pressed
+ *            stays the same when key is still pressed
+ *  - delay between codes is 2.666ms (end to start)
+ */
 
-          Display_NL_EEString_Space(IR_Proton_str);    /* display protocol */
-          Flag = PROTO_DETECTED;                  /* detected protocol */
 
-          Bits = PxM_Demod(Pulse, PulsesLeft, 11, 11, 30, IR_STD_TOLER);
-          if (Bits == 17)               /* we expect 8 + 1 + 8 bits */
-          {
-            Address = GetBits(1, 8, IR_LSB);      /* get address */
-            Command = GetBits(10, 8, IR_LSB);     /* get command */
-            Flag = PACKET_DISPLAY;                /* packet ok & default output */
-          }
 
-          goto result;                       /* skip other checks */
-        }
-      }
-    }
-  }
+/*
+ *  get data field from IR code
+ *
+ *  requires:
+ *  - start bit in IR code (1-...)
+ *  - number of bits (1-16)
+ *  - bit mode
+ *    IR_LSB - LSB
+ *    IR_MSB - MSB
+ *
+ *  returns:
+ *  - field value
+ */
 
+uint16_t GetField(uint8_t StartBit, uint8_t Bits, uint8_t Mode)
+{
+  uint16_t          Value = 0;     /* return value */
+  uint8_t           Low;           /* start bit of low byte */
 
-  /*
-   *  JVC C8D8
-   *  - start: pulse 8.44ms, pause 4.22ms
-   *  - PDM: pulse 525s, pause 0=525s 1=1575s
-   *  - bit mode: LSB
-   *  - stop: pulse 525s
-   *  - format: <start><address:8><command:8><stop>
-   *  - repeat sequence format: <address:8><command:8><stop>
-   *  - repeat sequence delay is <start> + 46.42ms (start to start)
-   *  - alternative timings:
-   *    - start: pulse 9.4ms, pause 4.05ms (188/81)
-   *      PDM: pulse 560s, pause 0:600s 1:1620s 
-   *    - start: pulse 9ms, pause 4.2ms (180/84)
-   *      PDM: pulse 550s, pause 0:550s 1:1580s
-   */
+  Low = StartBit;                  /* low byte starts at first bit */
 
-  if ((PulseCheck(Time1, 168, IR_STD_TOLER)) ||   /* pulse 8.44ms */
-      (PulseCheck(Time1, 184, IR_RELAX_LONG)))    /* 9 - 9.5ms */
+  if (Bits > 8)                    /* two bytes */
   {
-    if (PulseCheck(Time2, 84, IR_STD_TOLER))      /* pause 4.22ms */
-    {
-      /* try to demodulate JVC */
-      Bits = PxM_Demod(Pulse, PulsesLeft, 11, 11, 32, IR_STD_TOLER);
-
-      if (Bits == 16)              /* we expect 16 bits */
-      {
-        Display_NL_EEString_Space(IR_JVC_str);    /* display protocol */
-
-        Address = GetBits(1, 8, IR_LSB);     /* get address */
-        Command = GetBits(9, 8, IR_LSB);     /* get command */
-
-        Flag = PACKET_DISPLAY;               /* packet ok & default output */
-        goto result;                         /* skip other checks */
-      }
-    }
-  }
-
-
-  /*
-   *  Matsushita (Panasonic, MN6014)
-   *  - start: pulse 3.5ms, pause 3.5ms
-   *  - PDM: pulse 872s, pause 0=872s 1=2616s
-   *  - bit mode: LSB
-   *  - stop: pulse 872s
-   *  - format 12 bits / C6D6:
-   *    <start><custom code:6><data code:6><inverted custom code:6><inverted data code:6><stop>
-   *  - format 11 bits / C5D6:
-   *    <start><custom code:5><data code:6><inverted custom code:5><inverted data code:6><stop>
-   *  - repeat delay is 104.7ms (start to start), or 34ms (end to start) for 12 bit format
-   *    and 39.24ms (end to start) for 11 bit format
-   */
-
-  /*
-   *  Kaseikyo (Japanese Code)
-   *  - start: pulse 3456s, pause 1728s
-   *  - PDM: pulse 432s, pause 0=432s 1=1296s
-   *  - bit mode: LSB
-   *  - stop: pulse 432s
-   *  - format (48 bits):
-   *    <start><manufacturer code:16><parity:4><system:4><product:8><function:8><check:8><stop>
-   *  - parity: 0000
-   *    ?: <mc 0-3> ^ <mc 4-7> ^ <mc 8-11> ^ <mc 12-15>                 
-   *  - check: <system:4><parity:4> ^ <product:8> ^ <function:8>
-   *    ?: <system 0-3> + <product 0-3> + <product 4-7> + <function 0-3> + <function 4-7>
-   *  - code becomes valid after sending it 2 (or 3) times
-   *    code delay is 74.62ms (end to start)
-   *  - repeat sequence format: <pulse 3456s><pause 3456s><pulse 432s>
-   *  - repeat delay is 42.2ms (end to start)
-   */
+    Bits -= 8;                     /* bits of high byte */
 
-  if (PulseCheck(Time1, 70, IR_STD_TOLER))        /* pulse 3.5ms */
-  {
-    /* Matsushita (Panasonic) */ 
-    if (PulseCheck(Time2, 70, IR_STD_TOLER))      /* pause 3.5ms */
+    if (Mode == IR_LSB)            /* LSB: high byte follows low byte */
     {
-      Display_NextLine();                         /* new line */
-      Display_EEString(IR_Matsushita_str);        /* display protocol */
-      Flag = PROTO_DETECTED;                      /* detected protocol */
-
-      /* try to demodulate Matsushita */
-      Bits = PxM_Demod(Pulse, PulsesLeft, 17, 17, 52, IR_RELAX_LONG);
-      Temp = 0;
-
-      if (Bits == 24)              /* we expect 24 bits for C6D6 */
-      {
-        Temp = '6';                /* char 6 */
-
-        Address = GetBits(1, 6, IR_LSB);     /* get address */
-        Command = GetBits(7, 6, IR_LSB);     /* get command */
-        /* todo: check inverted address and command */
-
-        Flag = PACKET_DISPLAY;     /* packet ok & default output */
-      }
-      #ifdef SW_IR_RX_EXTRA
-      else if (Bits == 22)         /* we expect 22 bits for C5D6 */
-      {
-        Temp = '5';                /* char 5 */
-
-        Address = GetBits(1, 5, IR_LSB);     /* get address */
-        Command = GetBits(6, 6, IR_LSB);     /* get command */
-        /* todo: check inverted address and command */
-
-        Flag = PACKET_DISPLAY;     /* packet ok & default output */
-      }
-      #endif
-
-      if (Temp > 0)                /* display version */
-      {
-        Display_Char('-');         /* display: - */
-        Display_Char(Temp);        /* display: 5 or 6 */
-      }
-
-      Display_Space();             /* display space */
-      goto result;                 /* skip other checks */
+      StartBit += 8;               /* start of high byte */
     }
-
-    /* Kaseikyo */
-    if (PulseCheck(Time2, 34, IR_STD_TOLER))      /* pause 1728s */
+    else                           /* MSB: low byte follows high byte */
     {
-      Display_NL_EEString_Space(IR_Kaseikyo_str);      /* display protocol */
-      Flag = PROTO_DETECTED;                      /* detected protocol */
-
-      /* try to demodulate Kaseikyo */
-      Bits = PxM_Demod(Pulse, PulsesLeft, 8, 8, 26, IR_RELAX_SHORT);
+      Low += Bits;                 /* start of low byte */
+    }
 
-      if (Bits == 48)              /* we expect 48 bits */
-      {
-        Address = GetBits(1, 8, IR_LSB);     /* get manufacturer LSB */
-        Extras = GetBits(9, 8, IR_LSB);      /* get manufacturer MSB */
+    Value = GetBits(StartBit, Bits, Mode);  /* get high byte */
+    Value <<= 8;                   /* move to MSB */
+    Bits = 8;                      /* full low byte */
+  }
 
-        Display_HexByte(Extras);        /* display manufacturer MSB */
-        Display_HexByte(Address);       /* display manufacturer LSB */
-        Display_Char(':');              /* display: : */
+  Value |= GetBits(Low, Bits, Mode);        /* get low byte */
 
-        Extras = GetBits(21, 4, IR_LSB);     /* get system */
-        Address = GetBits(25, 8, IR_LSB);    /* get product (address) */
-        Command = GetBits(33, 8, IR_LSB);    /* get function (command) */      
+  return Value;
+}
 
-        Display_HexDigit(Extras);  /* display system */
-        Display_Char('-');         /* display: - */
-        Display_HexByte(Address);  /* display product */
-        Display_Char(':');         /* display: : */
-        Display_HexByte(Command);  /* display function */
 
-        Flag = PACKET_OK;          /* packet ok */
-      }
 
-      goto result;                 /* skip other checks */
-    }
-  }
+/*
+ *  display data field of IR code
+ *  - high part of a field with more than 8 bits is displayed as single
+ *    hex digit if it has 4 bits at most
+ *
+ *  requires:
+ *  - start bit in IR code (1-...)
+ *  - number of bits (1-16)
+ *  - bit mode
+ *    IR_LSB - LSB
+ *    IR_MSB - MSB
+ */
 
+void Display_IR_Field(uint8_t StartBit, uint8_t Bits, uint8_t Mode)
+{
+  uint16_t          Value;         /* field value */
 
-  /*
-   *  RCA
-   *  - start: pulse 4ms, pause 4ms
-   *  - PDM: pulse 500s, pause 0=1ms 1=2ms
-   *  - stop: pulse 500s
-   *  - bit mode: MSB
-   *  - format: <start><address:4><command:8><inverted address:4><inverted command:8><stop>
-   *  - repeat delay is 64ms (start to start) or 8ms (end to start)
-   *  - alternative timing:
-   *    - start: pulse 3.75ms, pause 3.9ms
-   *    - PDM: pulse 560s, pause 0:1ms 1:2ms
-   *    - repeat delay 10ms (end to start)
-   *  - carrier 56kHz or 38.7kHz, duty cycle 1/3
-   */
+  Value = GetField(StartBit, Bits, Mode);
 
-  #ifdef SW_IR_RX_EXTRA
-  if (PulseCheck(Time1, 79, IR_RELAX_LONG))       /* pulse 4ms */
+  if (Bits > 12)                   /* high byte */
   {
-    if (PulseCheck(Time2, 79, IR_RELAX_LONG))     /* pause 4ms */
-    {
-      /*
-       *  Packet repeat delay is shorter than sample timeout. So the sample
-       *  data could include a partial second packet.
-       */
+    Display_HexByte(Value >> 8);   /* display high byte */
+  }
+  else if (Bits > 8)               /* high nibble */
+  {
+    Display_HexDigit(Value >> 8);  /* display high nibble */
+  }
 
-      if (PulsesLeft > 49)         /* more pulses than we need */
-      {
-        /* check for repeat delay */
-        Pulse += 49;               /* 24 bits + stop */
+  Display_HexByte((uint8_t)Value); /* display low byte */
+}
 
-        if (*Pulse >= 158)         /* longer than 7.9ms */
-        {
-          PulsesLeft = 49;         /* hide second packet */
-        } 
 
-        Pulse -=  49;              /* back to second pulse */
-      }
 
-      /* try to demodulate RCA */
-      Bits = PxM_Demod(Pulse, PulsesLeft, 10, 20, 40, IR_RELAX_SHORT);
+/*
+ *  detect and decode IR protocol
+ *  - uses IR_Proto_Table to identify protocol
+ *  - uses IR_State to keep track of multi-packet protocols
+ *
+ *  requires:
+ *  - pointer to array of pulse/pause duration data
+ *  - number of pulses/pauses
+ */
 
-      if (Bits == 24)              /* we expect 24 bits */
-      {
-        Display_NL_EEString_Space(IR_RCA_str);    /* display protocol */  
+void IR_Decode(uint8_t *PulseData, uint8_t Pulses)
+{
+  uint8_t           Flag = 0;      /* control flag */
+  uint8_t           *Pulse;        /* pointer to pause/pulse data */
+  uint8_t           *Sync = NULL;  /* pointer to changed sync pause */
+  uint8_t           SyncTime = 0;  /* original duration of sync pause */
+  uint8_t           PulsesLeft;    /* remaining pulses/pauses */
+  uint8_t           Time1;         /* time units #1 */
+  uint8_t           Time2;         /* time units #2 */
+  uint8_t           Bits = 0;      /* number of bits received */
+  uint8_t           Temp;          /* temporary value */
+  uint8_t           Mode;          /* code bit mode */
+  uint8_t           Byte;          /* inverted byte */
+  uint8_t           n;             /* counter */
+  const IR_Proto_Type    *Table;        /* pointer to protocol table */
+  const unsigned char    *Detected = NULL;   /* detected protocol */
+  IR_Proto_Type     Proto;         /* current protocol */
+  IR_Demod_Type     Demod;         /* settings of last demodulation */
+
+  /* local constants for Flag */
+  #define PROTO_UNKNOWN       0    /* unknown protocol */
+  #define PROTO_DETECTED      1    /* protocol detected */
+  #define PACKET_OK           2    /* valid packet */
+  #define PACKET_MULTI        3    /* multi packet (more to follow) */
 
-        Address = GetBits(1, 4, IR_MSB);     /* get address */
-        Command = GetBits(5, 8, IR_MSB);     /* get command */
+  if (Pulses < 2) return;     /* not enough pulses */
 
-        /* todo: check inverted address and command? */
+  /* get first pulse-pause pair */
+  Pulse = PulseData;          /* first pulse */
+  Time1 = *Pulse;             /* duration of first pulse */
+  Pulse++;                    /* first pause */
+  Time2 = *Pulse;             /* duration of first pause */
 
-        Flag = PACKET_DISPLAY;               /* packet ok & default output */
-        goto result;                         /* skip other checks */
-      }
-    }
-  }
-  #endif
+  Demod.Mode = IR_MOD_MASK;   /* no demodulation yet */
 
 
   /*
-   *  Motorola
-   *  - start: pulse 512s, pause 2560s
-   *  - Bi-Phase (Thomas):
-   *    0: pause 512s, pulse 512s
-   *    1: pulse 512s, pause 512s 
-   *  - bit mode: LSB
-   *  - a valid code consists of a start packet, one or more command packets
-   *    and an end packet
-   *  - command packets are repeated as long as key is pressed
-   *  - start/end packet format: <start><start "1":1><all 1s:9>
-   *  - command packet format: <start><start "1":1><command:9>
-   *  - packet delay is 32.8ms (start to start) between command packets
-   *    and 131ms (start to start) for start-command and command-end
+   *  find protocol
+   *  - check first pulse-pause pair and number of pulses/pauses
+   *  - demodulate and check number of bits
    */
 
-  /*
-   *  IR60 (SDA2008/MC14497)
-   *  - start: pulse 550s, pause 2.5ms
-   *  - Bi-Phase (Thomas):
-   *    0: pause 550s, pulse 550s
-   *    1: pulse 550s, pause 550s
-   *  - bit mode: LSB
-   *  - a valid code consists of a start packet, one or more command packets
-   *    and an end packet
-   *  - packet delay is 34ms (start to start) or 24ms (end to start) between
-   *    start packet and first command packet
-   *  - packet delay is 120ms (end to start) for all other packets following the
-   *    first command packet
-   *  - start/end packet format: <start><start "1":1><command "62":6>
-   *  - command packet format: <start><start "1":1><command:6>
-   *  - carrier 31kHz, duty cycle 1/4
-   */
+  Table = &IR_Proto_Table[0];      /* first protocol */
 
-  if (PulseCheck(Time1, 11, IR_STD_TOLER))        /* pulse 512s */
+  while (Flag == PROTO_UNKNOWN)
   {
-    if (PulseCheck(Time2, 52, IR_STD_TOLER))      /* pause 2560s */
+    /* undo sync pause change of previous protocol */
+    if (Sync)                      /* changed */
     {
-      /* try to demodulate Motorola or IR60 */
-      Bits = BiPhase_Demod(Pulse, PulsesLeft, IR_THOMAS, 11, IR_STD_TOLER);
-
-      if (Bits == 10)              /* we expect 10 bits for Motorola */
-      {
-        /* todo: check start bit? */
-        Command = GetBits(2, 8, IR_LSB);     /* get command LSB */
-        Extras = GetBits(10, 1, IR_LSB);     /* get command MSB */
-
-        /*
-         *  multi packet logic
-         */
+      *Sync = SyncTime;            /* restore duration */
+      Sync = NULL;                 /* reset pointer */
+    }
 
-        Flag = PACKET_MULTI;       /* multi packet protocol */
+    memcpy_P(&Proto, Table, sizeof(IR_Proto_Type));   /* read protocol */
+    if (Proto.Pulse == 0) break;   /* end of table */
+    Table++;                       /* next protocol */
 
-        /* check for packet type */
-        if ((Command == 0b11111111) && (Extras == 0b00000001))
-        {
-          /* start or end packet: all 1s */
-          if (IR_State == 0)            /* no packet yet */
-          {
-            IR_State = 1;               /* we have a start packet */
-          }
-          else if (IR_State == 2)       /* command packet */
-          {
-                                        /* we have a stop packet */
-            Flag = PACKET_OK;           /* packet ok */
-          }
-          /* else: packet missing/broken */
-        }
-        else                            /* command packet */
-        {
-          /* command packet */
-          Display_NL_EEString_Space(IR_Motorola_str);  /* display protocol */
-          Display_HexDigit(Extras);     /* display command MSB */
-          Display_HexByte(Command);     /* display command LSB */
+    /* check start pulse */
+    if (! PulseCheck(Time1, Proto.Pulse, Proto.Start & IR_START_PULSE)) continue;
 
-          IR_State = 2;                 /* we have a command packet */
-        }
-
-        goto result;               /* skip other checks */
-      }
-      #ifdef SW_IR_RX_EXTRA
-      else if (Bits == 7)               /* we expect 7 bits for IR60 */
+    /* check start pause or alternative pause */
+    Temp = Proto.Start >> 2;                 /* timing control */
+    if (! PulseCheck(Time2, Proto.Pause, Temp))
+    {
+      if ((Proto.Pause2 == 0) || (! PulseCheck(Time2, Proto.Pause2, Temp)))
       {
-        /* todo: check start bit? */
-        Command = GetBits(2, 6, IR_LSB);     /* get command */
-
-        /*
-         *  multi packet logic
-         */
-
-        Flag = PACKET_MULTI;       /* multi packet protocol */
-
-        /* check for packet type */
-        if (Command == 62)              /* start/end packet (command 62) */
-        {
-          if (IR_State == 0)            /* no packet yet */
-          {
-            IR_State = 1;               /* we have a start packet */
-          }
-          else if (IR_State == 2)       /* command packet */
-          {
-                                        /* we have a stop packet */
-            Flag = PACKET_OK;           /* packet ok */
-          }
-        }
-        else                            /* command packet */
-        {
-          Display_NL_EEString_Space(IR_IR60_str);   /* display protocol */
-          Display_HexByte(Command);                 /* display command */
-
-          IR_State = 2;                 /* we have a command packet */
-        }
-
-        goto result;               /* skip other checks */
+        continue;             /* no match */
       }
-      #endif
     }
-  }
 
+    /* check number of pulses/pauses */
+    if ((Proto.Items > 0) && (Proto.Items != Pulses)) continue;
 
-  /*
-   *  Thomson
-   *  - no start / AGC burst
-   *  - PDM: pulse 500s, pause 0:2ms 1:4.5ms
-   *  - stop: pulse 500s
-   *  - bit mode: LSB
-   *  - a valid code consists of at least 2 packets
-   *  - format: <device:4><toggle:1><function:7><stop>
-   *  - toggle: inverted each time a key is pressed
-   *            stays the same when key is still pressed
-   *  - packet repeat delay is 80ms (start to start)
-   *  - alternative timing:
-   *    PDM: pulse 470s, pause 0:2.05ms 1:4.6ms
-   *    stop: pulse 470s
-   */
+    /* data */
+    Pulse = PulseData + Proto.Demod.Skip;    /* first data item */
+    PulsesLeft = Pulses - Proto.Demod.Skip;  /* data items */
 
-  #ifdef SW_IR_RX_EXTRA
-  if (PulseCheck(Time1, 10, IR_STD_TOLER))        /* pulse 500s */
-  {
-    if ((PulseCheck(Time2, 40, IR_STD_TOLER)) ||  /* pause 2ms */
-        (PulseCheck(Time2, 90, IR_STD_TOLER)))    /* pause 4.5ms */
+    /* special processing before lock */
+    if (Proto.Special == IR_SPEC_SYNC)       /* sync pause */
     {
-      /* try to demodulate Thomson */
-      Bits = PxM_Demod(PulseData, Pulses, 10, 40, 90, IR_RELAX_SHORT);
-
-      if (Bits == 12)                   /* we expect 12 bits */
+      /* check for sync pause and change it into "0" */
+      Temp = (uint8_t)Proto.Param;           /* position of sync pause */
+      if (! PulseCheck(Pulse[Temp], Proto.Pause, IR_STD_TOLER)) continue;
+      Sync = &Pulse[Temp];                   /* keep in mind */
+      SyncTime = *Sync;                      /* save duration */
+      *Sync = Proto.Demod.t0;
+    }
+    else if (Proto.Special == IR_SPEC_TRUNC) /* partial second packet */
+    {
+      /* hide second packet after long pause */
+      Temp = (uint8_t)Proto.Param;           /* position of pause */
+      if ((PulsesLeft > Temp) && (Pulse[Temp] >= 2 * Proto.Pause))
       {
-        Display_NL_EEString_Space(IR_Thomson_str);     /* display protocol */
-
-        Address = GetBits(1, 4, IR_LSB);     /* get device (address) */
-        Command = GetBits(6, 7, IR_LSB);     /* get function (command) */
-
-        Flag = PACKET_DISPLAY;     /* packet ok & default output */
-        goto result;               /* skip other checks */
+        PulsesLeft = Temp;
       }
     }
-  }
-  #endif
-
 
-  /*
-   *  Samsung / Toshiba  (TC9012)
-   *  - start: pulse 4.5ms, pause 4.5ms
-   *  - PDM: pulse 560s, pause 0=560s 1=1690s
-   *  - bit mode: LSB
-   *  - stop: pulse 560s
-   *  - old format: <start><manufacturer code:12><command:8><stop>
-   *  - format:
-   *    <start><custom:8><copy of custom:8><data:8><inverted data:8><stop>
-   *  - repeat sequence format:
-   *    <start><inverted bit #0 of custom><stop>
-   *  - repeat delay is 108ms (start to start)
-   */
-
-  if (PulseCheck(Time1, 89, IR_STD_TOLER))        /* pulse 4.5ms */
-  {
-    if (PulseCheck(Time2, 89, IR_STD_TOLER))      /* pause 4.5ms */
+    /* protocol with unique start */
+    if ((Proto.Flags & IR_LOCK) && (Detected == NULL))
     {
-      Display_NL_EEString_Space(IR_Samsung_str);  /* display protocol */
-      Flag = PROTO_DETECTED;                      /* detected protocol */
+      Detected = Proto.Name;       /* report bad packet */
+    }
 
-      /* try to demodulate Samsung */
-      Bits = PxM_Demod(Pulse, PulsesLeft, 11, 11, 34, IR_STD_TOLER);
+    if (Proto.Special == IR_SPEC_TOGGLE)     /* toggle bit */
+    {
+      /* convert toggle bit to standard timing (1 bit = 2 pulses) */
+      Temp = SpecialBiPhasePulse(Pulse, PulsesLeft, (uint8_t)Proto.Param, Proto.Demod.tS, Proto.Pause);
+      if (Temp != 2) continue;
+    }
 
-      if (Bits == 32)              /* we expect 32 bits */
+    /* demodulate (skip if previous protocol used same settings) */
+    if ((Proto.Special > IR_SPEC_TOGGLE) || (Proto.Special == IR_SPEC_NONE))
+    {
+      /* check settings of last demodulation */
+      if (memcmp(&Demod, &Proto.Demod, sizeof(IR_Demod_Type)) == 0)
       {
-        Address = GetBits(1, 8, IR_LSB);     /* get address */
-        Command = GetBits(17, 8, IR_LSB);    /* get command */
-        /* todo: check copy of address and inverted command */
-
-        Flag = PACKET_DISPLAY;     /* packet ok & default output */
+        Temp = 0;                  /* skip demodulation */
+      }
+      else                         /* different settings */
+      {
+        Demod = Proto.Demod;       /* save settings */
+        Temp = 1;                  /* demodulate */
       }
-
-      goto result;                 /* skip other checks */
     }
-  }
-
-
-  /*
-   *  Sony SIRC
-   *  - start: pulse 2.4ms (pause 600s)
-   *  - PWM: pause 600s, pulse 0=600s 1=1200s
-   *  - bit mode: LSB
-   *  - 12 bit format: <start><command:7><address:5>
-   *  - 15 bit format: <start><command:7><address:8>
-   *  - 20 bit format: <start><command:7><address:5><extended:8>
-   *  - code becomes valid after receiving it 3 times at least
-   *    code delay is 45ms (start to start)
-   */
-
-  if (PulseCheck(Time1, 48, IR_STD_TOLER))        /* pulse 2.4ms */
-  {
-    if (PulseCheck(Time2, 12, IR_STD_TOLER))      /* pause 600s */
+    else                           /* pulse data modified */
     {
-      Display_NextLine();               /* new line */
-      Display_EEString(IR_SIRC_str);    /* display protocol */
-      Flag = PROTO_DETECTED;            /* detected protocol */
+      Demod.Mode = IR_MOD_MASK;    /* invalidate settings */
+      Temp = 1;                    /* demodulate */
+    }
 
-      /* try to demodulate SIRC */
-      Pulse--;                          /* back to first pause */
-      PulsesLeft++;                     /* undo first pause */
-      Bits = PxM_Demod(Pulse, PulsesLeft, 12, 12, 24, IR_STD_TOLER);
+    if (Temp)                      /* demodulate */
+    {
+      Temp = Proto.Demod.Mode & IR_MOD_MASK;      /* modulation */
 
-      /* 12, 15 or 20 bit format */
-      Temp = 5;                    /* 5 bit address */
-      if (Bits == 12)              /* SIRC-12 */
+      if (Temp == IR_MOD_PXM)                     /* PDM/PWM */
       {
-        Flag = PACKET_OK;          /* packet ok */
+        Bits = PxM_Demod(Pulse, PulsesLeft, Proto.Demod.tS, Proto.Demod.t0, Proto.Demod.t1, Proto.Demod.Timing);
       }
-      else if (Bits == 15)         /* SIRC-15 */
+      else if (Temp == IR_MOD_BIPHASE)            /* Bi-Phase */
       {
-        Flag = PACKET_OK;          /* packet ok */
-        Temp = 8;                  /* 8 bit address */
+        Temp = Proto.Demod.Mode & ~IR_MOD_MASK;   /* bi-phase mode */
+        Bits = BiPhase_Demod(Pulse, PulsesLeft, Temp, Proto.Demod.tS, Proto.Demod.Timing);
       }
-      else if (Bits == 20)         /* SIRC-20 */
-      {
-        Flag = PACKET_OK;          /* packet ok */
-      }
-
-      Command = GetBits(1, 7, IR_LSB);       /* get command */
-      Address = GetBits(8, Temp, IR_LSB);    /* get address */
-
-      /* display format */
-      if (Flag == PACKET_OK)       /* valid packet */
+      #ifdef SW_IR_RX_EXTRA
+      else if (Temp == IR_MOD_PPM)                /* PPM */
       {
-        Display_Value(Bits, 0, 0); /* display number of bits */
+        Bits = PPM_Demod(Pulse, PulsesLeft, Proto.Demod.tS, Proto.Demod.t0, Proto.Demod.Timing);
       }
-
-      /* we accept the first code and don't wait for another 2 repeats */
-
-      Display_Space();             /* display space */
-
-      /* display data */
-      if (Flag == PACKET_OK)       /* valid packet */
+      #endif
+      else                                        /* no data */
       {
-        Display_HexByte(Command);  /* display command */
-        Display_Char(':');         /* display: : */
-        Display_HexByte(Address);  /* display address */
+        Bits = 0;                                 /* no bits */
 
-        if (Bits == 20)            /* 20 bit format */
+        /* just a stop pulse */
+        if (! PulseCheck(*Pulse, Proto.Demod.tS, Proto.Demod.Timing))
         {
-          Display_Char(':');                 /* display: : */
-          Extras = GetBits(13, 8, IR_LSB);   /* get extended */
-          Display_HexByte(Extras);           /* display extended data */
+          Bits = 255;                             /* signal error */
         }
       }
+    }
 
-      goto result;                 /* skip other checks */
+    if (Bits == Proto.Bits)        /* expected number of bits */
+    {
+      Flag = PACKET_OK;            /* valid packet */
     }
   }
 
 
   /*
-   *  RECS80 Standard (SAA3008, M3004)
-   *  - no start / AGC burst
-   *  - PDM: pulse 140.8s, pause 0:5060s 1:7590ms
-   *  - stop: pulse 140.8s
-   *  - bit mode: MSB
-   *  - format: <reference "1":1><toggle:1><address:3><command:6><stop>
-   *  - toggle: inverted each time a key is pressed
-   *            stays the same when key is still pressed
-   *  - packet repeat delay is 121.44ms (start to start)
-   *  - alternative timing:
-   *    PDM: pulse 180s, pause 0:4850s 1:7.4ms
-   *  - carrier 38kHz (455kHz/12), duty cycle 1/3
+   *  process packet
    */
 
-  /*
-   *  RECS80 Extended (SAA3008)
-   *  - start: pulse 140.8s, pause 3659.2s, pulse 140.8s, pause 3659.2s
-   *  - PDM: pulse 140.8s, pause 0=4919.2s 1=7459.2s
-   *  - bit mode: MSB
-   *  - stop: pulse 140.8s
-   *  - format: <start><toggle:1><address:4><command:6><stop>
-   *  - toggle: inverted each time a key is pressed
-   *            stays same when key is still pressed
-   *  - repeat delay is 132.56ms (start to start)
-   *  - carrier 38kHz (455kHz/12), duty cycle 1/3
-   */
-
-  #ifdef SW_IR_RX_EXTRA
-  if (PulseCheck(Time1, 4, IR_STD_TOLER))         /* pulse 141s */
+  if (Flag == PACKET_OK)           /* valid packet */
   {
-    if (PulseCheck(Time2, 149, IR_RELAX_LONG))    /* pause 7.6ms (for 1) */
-    {
-      /* try to demodulate RECS80 Standard */
-      Bits = PxM_Demod(PulseData, Pulses, 4, 98, 149, IR_RELAX_SHORT | IR_RELAX_LONG);
+    Temp = 1;                      /* display packet */
+    Mode = Proto.Flags & IR_BIT_MODE;        /* code bit mode */
 
-      if (Bits == 11)                   /* we expect 11 bits */
+    if (Proto.Special == IR_SPEC_INV)        /* 16 bit address */
+    {
+      /* standard format: high byte is inverted low byte */
+      n = Proto.Field[0];                    /* start bit */
+      Byte = ~GetBits(n + 8, 8, Mode);      /* inverted high byte */
+      if (Byte == GetBits(n, 8, Mode))
       {
-        Display_NL_EEString_Space(IR_RECS80_str);      /* display protocol */
-
-        Address = GetBits(3, 3, IR_MSB);     /* get subsystem address */
-        Command = GetBits(6, 6, IR_MSB);     /* get command */
-
-        Flag = PACKET_DISPLAY;     /* packet ok & default output */
-        goto result;               /* skip other checks */
+        Proto.Field[1] = 8;        /* just low byte */
       }
     }
-    else if (PulseCheck(Time2, 173, IR_RELAX_LONG))  /* pause 3659s */
+    else if (Proto.Special == IR_SPEC_FRAME) /* start/command/end packets */
     {
-      /* todo: check timing for second half of start? */
+      Flag = PACKET_MULTI;         /* multi packet protocol */
 
-      if (PulsesLeft == 25)        /* 2 + 22 + 1 */
+      /* check for packet type */
+      if (GetField(Proto.Field[0], Proto.Field[1], Mode) == Proto.Param)
       {
-        /* skip second half of start */
-        Pulse += 2;
-        PulsesLeft -= 2;
-
-        /* try to demodulate RECS80 Extended */
-        Bits = PxM_Demod(Pulse, PulsesLeft, 4, 98, 149, IR_RELAX_SHORT | IR_RELAX_LONG);
+        /* start or end packet */
+        Temp = 0;                  /* don't display */
 
-        if (Bits == 11)                   /* we expect 11 bits */
+        if (IR_State == 0)         /* no packet yet */
         {
-          Display_NL_EEString_Space(IR_RECS80_str);    /* display protocol */
-          Display_Char('x');                           /* display: x */
-          Display_Space();
-
-          Address = GetBits(2, 4, IR_MSB);        /* get subsystem address */
-          Command = GetBits(6, 6, IR_MSB);        /* get command */
-
-          Flag = PACKET_DISPLAY;     /* packet ok & default output */
-          goto result;               /* skip other checks */
+          IR_State = 1;            /* we have a start packet */
+        }
+        else if (IR_State == 2)    /* command packet */
+        {
+                                   /* we have a stop packet */
+          Flag = PACKET_OK;        /* packet ok */
         }
+        /* else: packet missing/broken */
+      }
+      else                         /* command packet */
+      {
+        IR_State = 2;              /* we have a command packet */
       }
     }
-  }
-  #endif
-
-
-  /*
-   *  Sharp (LR3715M)
-   *  - also: Denon
-   *  - no start / AGC burst
-   *  - PDM: pulse 264s, pause 0=786s 1=1836s
-   *  - bit mode: LSB
-   *  - stop: pulse 320s
-   *  - a valid code consists of two packets (#1 and #2)
-   *  - format packet #1:
-   *    <address:5><command:8><mask:1><type:1><stop>
-   *  - format packet #2:
-   *    <address:5><inverted command:8><inverted mask:1><inverted type:1><stop>
-   *  - mask: 0, but also seen 1
-   *  - type: indicater for packet (0 for first packet, 1 for second packet)
-   *  - delay for second packet is 67.5ms (start to start),
-   *    40ms (end to start) could work too
-   *  - alternative timing:
-   *    - pulse 320s, pause 0=680s 1=1680s
-   */
-
-  if (PulseCheck(Time1, 6, IR_STD_TOLER))    /* pulse 320s */
-  {
-    /* pause 680s or 1680s */
-    if ((PulseCheck(Time2, 14, IR_STD_TOLER)) ||
-        (PulseCheck(Time2, 35, IR_STD_TOLER)))
+    else if (Proto.Special == IR_SPEC_PAIR)  /* two packets */
     {
-      Flag = PROTO_DETECTED;       /* detected protocol */
-
-      /* try to demodulate Sharp */
-      Bits = PxM_Demod(PulseData, Pulses, 6, 14, 35, IR_STD_TOLER);
-
-      if (Bits == 15)              /* we expect 15 bits */
+      if (IR_State == 0)           /* packet #1 */
       {
-        if (IR_State == 0)         /* packet #1 */
-        {
-          Address = GetBits(1, 5, IR_LSB);     /* get address */
-          Command = GetBits(6, 8, IR_LSB);     /* get command */
-          /* todo: mask & type bits */
-
-          Display_NL_EEString_Space(IR_Sharp_str);  /* display protocol */
-          Display_HexByte(Address);                 /* display address */
-          Display_Char(':');                        /* display: : */
-          Display_HexByte(Command);                 /* display command */
-
-          IR_State = 1;                 /* got packet #1 */
-          Flag = PACKET_MULTI;          /* multi packet */
-        }
-        else                       /* packet #2 */
-        {
-          /* we don't check the inverted command and extra bits */
-          Flag = PACKET_OK;             /* packet ok */
-        }
+        IR_State = 1;              /* got packet #1 */
+        Flag = PACKET_MULTI;       /* multi packet */
+      }
+      else                         /* packet #2 */
+      {
+        /* we don't check the inverted packet */
+        Temp = 0;                  /* don't display */
       }
-
-      goto result;                 /* skip other checks */
     }
-  }
 
-
-  /*
-   *  Philips RC-5 Standard 
-   *  - 2 start bits: (889s L) 889s H, 889s L (889s H)
-   *  - Bi-Phase (IEEE 802.3):
-   *    0: pulse 889s, pause 889s
-   *    1: pause 889s, pulse 889s
-   *  - bit mode: MSB
-   *  - format: <s1 "1":1><s2 "1":1><toggle:1><address:5><command:6>
-   *  - toggle: inverted each time a key is pressed
-   *            stays the same when key is still pressed
-   *  - repeat delay is 114ms (start to start) or 89ms (end to start)
-   */
-
-  /*
-   *  Philips RC-5 Extended
-   *  - 2 start bits: (889s L) 889s H + 889s H (889s L)
-   *  - Bi-Phase (IEEE 802.3):
-   *    0: pulse 889s, pause 889s
-   *    1: pause 889s, pulse 889s
-   *  - bit mode: MSB
-   *  - format: <s1 "1":1><s2 "0":1><toggle:1><address:5><command:6>
-   *  - s2: 0 to indicate RC-5 Extended
-   *        inverted s2 becomes bit #6 of command (| 0b1000000)
-   *  - toggle: inverted each time a key is pressed
-   *            stays the same when key is still pressed
-   *  - repeat delay is 114ms (start to start) or 89ms (end to start)
-   */
-
-  if (PulseCheck(Time1, 17, IR_STD_TOLER))        /* pulse 889s */
-  {
-    if (PulseCheck(Time2, 17, IR_STD_TOLER))      /* pause 889s */
+    if (Temp)                      /* display packet */
     {
-      Display_NL_EEString_Space(IR_RC5_str);      /* display protocol */
-      Flag = PROTO_DETECTED;                 /* detected protocol */
+      Display_NextLine();                    /* new line */
+      Display_EEString(Proto.Name);          /* display protocol */
+
+      /* display tag */
+      if (Proto.Flags & IR_TAG_BITS)    /* number of bits */
+      {
+        Display_Value(Bits, 0, 0);      /* display number of bits */
+      }
+      else if (Proto.Tag)               /* tag char */
+      {
+        Display_Char('-');              /* display: - */
+        Display_Char(Proto.Tag);        /* display tag */
+      }
 
-      /* try to demodulate RC-5 */
-      Bits = BiPhase_Demod(PulseData, Pulses, IR_IEEE | IR_PRE_PAUSE, 17, IR_STD_TOLER);
+      Display_Space();                  /* display space */
 
-      if (Bits == 14)              /* we expect 14 bits */
+      /* display data fields */
+      n = 0;
+      while ((n < IR_FIELDS * 2) && (Proto.Field[n + 1] > 0))
       {
-        Address = GetBits(4, 5, IR_MSB);     /* get address */
-        Command = GetBits(9, 6, IR_MSB);     /* get command */
+        if (n > 0)                 /* not first field */
+        {
+          Display_Char(':');       /* display: : */
 
-        Flag = PACKET_DISPLAY;     /* packet ok & default ouput */
-      }
+          if ((n == 2) && (Proto.Special == IR_SPEC_NIBBLE))
+          {
+            Temp = GetBits((uint8_t)Proto.Param, 4, Mode);
+            Display_HexDigit(Temp);     /* display nibble */
+            Display_Char('-');          /* display: - */
+          }
+        }
 
-      goto result;                 /* skip other checks */
+        Display_IR_Field(Proto.Field[n], Proto.Field[n + 1], Mode);
+        n += 2;                    /* next field */
+      }
     }
   }
 
 
   /*
-   *  NEC PD1986C (NTE1758)
-   *  - no start / AGC burst
-   *  - PPM: 1120s, 0:pause 1:pulse
-   *  - bit mode: LSB
-   *  - 2 packets (original plus one repeat)
-   *  - format: <header "101":3><data:5>
-   *  - repeat delay is 36ms (start to start)
-   *  - carrier 38kHz (455kHz/12), duty cycle 1/2
-   *  - alternative timing:
-   *    PPM: 0:pause 1:pulse 1590s
-   *    packet delay 51,2ms (start to start)
-   *    carrier 26.7kHz (320kHz/12)
+   *  process result
    */
 
-  #ifdef SW_IR_RX_EXTRA
-  if (PulseCheck(Time1, 22, IR_STD_TOLER))        /* pulse 1120s (for 1) */
+  if (Flag == PROTO_UNKNOWN)       /* no valid packet */
   {
-    if (PulseCheck(Time2, 22, IR_STD_TOLER))      /* pause 1120s (for 0) */
+    if (Detected)                  /* but unique start */
     {
-      /* try to demodulate */
-      Bits = PPM_Demod(PulseData, Pulses, 22, 8, IR_STD_TOLER);
-
-      if (Bits == 8)                    /* we expect 8 bits */
-      {
-        Display_NL_EEString_Space(IR_uPD1986C_str);    /* display protocol */
-
-        /* todo: check header? */
-        Command = GetBits(4, 5, IR_LSB);     /* get command */
-        Display_HexByte(Command);            /* display command */
+      Flag = PROTO_DETECTED;       /* detected protocol */
 
-        Flag = PACKET_OK;          /* packet ok */
-        goto result;               /* skip other checks */
-      }
+      Display_NL_EEString_Space(Detected);   /* display protocol */
+      Display_Char('?');                     /* display: ? */
+    }
+    else                           /* unknown protocol */
+    {
+      Display_NextLine();            /* new line */
+      Display_Value(Pulses, 0, 0);   /* display number of pulses */
+      Display_Char(':');             /* display: : */
+      Display_Value(Time1, 0, 0);    /* display time units of first pulse */
+      Display_Char('-');             /* display: - */
+      Display_Value(Time2, 0, 0);    /* display time units of first pause */
     }
   }
-  #endif
 
+  if (Flag < PACKET_MULTI)         /* no packets to follow (protocol done) */
+  {
+    IR_State = 0;                  /* reset multi packet state */
+  }
 
-  /*
-   *  Philips RC-6 Standard (RC6-0-16)
-   *  - start: pulse 2664s, pause 888s
-   *  - Bi-Phase (Thomas):
-   *    normal bit 0: pause 444s, pulse 444s
-   *    normal bit 1: pulse 444s, pause 444s
-   *    toggle bit 0: pause 888s, pulse 888s
-   *    toggle bit 1: pulse 888s, pause 888s
-   *  - bit mode: MSB
-   *  - format (Mode 0, 16 bit):
-   *    <start><start bit "1":1><mode:3><toggle:1><address:8><command:8>
-   *  - mode: 000 for Mode 0
-   *  - toggle: inverted each time a key is pressed
-   *            stays the same when key is still pressed
-   *  - delay between codes is 2.666ms (end to start)
-   */
+  /* clean up local constants */
+  #undef PROTO_UNKNOWN
+  #undef PROTO_DETECTED
+  #undef PACKET_OK
+  #undef PACKET_MULTI
+} 
 
-  if (PulseCheck(Time1, 53, IR_STD_TOLER))        /* pulse 2664s */
-  {
-    if (PulseCheck(Time2, 17, IR_STD_TOLER))      /* pause 888s */
-    {
-      Display_NL_EEString_Space(IR_RC6_str);      /* display protocol */
-      Flag = PROTO_DETECTED;                 /* detected protocol */
 
-      /* convert toggle bit to standard timing */
-      Temp = SpecialBiPhasePulse(Pulse, PulsesLeft, 8, 8, 17);
 
-      if (Temp == 2)               /* we expect 1 special bit (= 2 pulses) */
-      {
-        /* try to demodulate */
-        Bits = BiPhase_Demod(Pulse, PulsesLeft, IR_THOMAS, 8, IR_RELAX_SHORT);
+/*
+ *  store item in RX ring buffer
+ *  - keeps one entry free for the end marker of a packet
+ *  - interrupts have to be disabled
+ *
+ *  requires:
+ *  - duration in Timer1 ticks or IR_RX_END
+ */
 
-        if (Bits == 21)       /* we expect 21 bits */
-        {
-          Address = GetBits(6, 8, IR_MSB);   /* get address */
-          Command = GetBits(14, 8, IR_MSB);  /* get command */
+void IR_RX_Store(uint16_t Item)
+{
+  uint8_t           Free;          /* free entries */
 
-          Flag = PACKET_DISPLAY;   /* packet ok & default ouput */
-        }
-      }
+  Free = IR_RX_Tail - IR_RX_Head - 1;
+  Free &= IR_RX_MASK;              /* free entries in ring buffer */
 
-      /* don't need to "goto" - this is the last protocol */
+  if (Item == IR_RX_END)           /* end of packet */
+  {
+    if (IR_RX_State & IR_RX_DROP)  /* lost some data */
+    {
+      Item = IR_RX_BROKEN;         /* mark packet as broken */
+    }
+
+    IR_RX_State = 0;               /* packet done */
+
+    /* no free entry: no data stored for this packet */
+    if (Free == 0) return;
+  }
+  else                             /* duration */
+  {
+    if (Free < 2)                  /* keep entry for end marker */
+    {
+      IR_RX_State |= IR_RX_DROP;   /* lost data */
+      return;
     }
   }
 
+  IR_RX_Buffer[IR_RX_Head] = Item;           /* save item */
+  IR_RX_Head = (IR_RX_Head + 1) & IR_RX_MASK;     /* next position */
+}
+
+
+
+/*
+ *  ISR for pin change of IR receiver's data signal
+ *  - logs duration between edges based on Timer1
+ */
+
+ISR(ISR_IR_PINCHANGE, ISR_BLOCK)
+{
+  uint16_t          Time;          /* timestamp */
+  uint16_t          Duration;      /* pulse/pause duration */
 
   /*
-   *  process result
+   *  hints:
+   *  - the PCIFn interrupt flag is cleared automatically
+   *  - interrupt processing is disabled while this ISR runs
+   *    (no nested interrupts)
    */
 
-result:
-
-  if (Flag == PROTO_UNKNOWN)       /* unknown protocol */
-  {
-    Display_NextLine();            /* new line */
-    Display_Value(Pulses, 0, 0);   /* display number of pulses */
-    Display_Char(':');             /* display: : */
-    Display_Value(Time1, 0, 0);    /* display time units of first pulse */
-    Display_Char('-');             /* display: - */
-    Display_Value(Time2, 0, 0);    /* display time units of first pause */
-
-    #if 0
-    /* debugging output */
-    Display_NextLine();
-    Pulse++;
-    Display_Value(*Pulse, 0, 0);
-    Display_Space();
-    Pulse++;
-    Display_Value(*Pulse, 0, 0);
-    Display_Space();
-    Pulse++;
-    Display_Value(*Pulse, 0, 0);
-    Display_Space();
-    Pulse++;
-    Display_Value(*Pulse, 0, 0);
-    Display_Space();
-    Pulse++;
-    Display_Value(*Pulse, 0, 0);
-    #endif
-  }
+  Time = TCNT1;                    /* get timestamp */
 
-  if (Flag == PROTO_DETECTED)      /* bad packet */
+  if (IR_RX_State & IR_RX_PACKET)  /* receiving packet */
   {
-    Display_Char('?');             /* display: ? */
-  }
+    Duration = Time - IR_RX_Last;  /* time since last edge */
 
-  if (Flag == PACKET_DISPLAY)      /* known protocol & standard output */
-  {
-    Display_HexByte(Address);      /* display address */
-    Display_Char(':');             /* display: : */
-    Display_HexByte(Command);      /* display command */
+    if (Duration > IR_RX_TIMEOUT)  /* missed end of packet */
+    {
+      IR_RX_Store(IR_RX_END);      /* end packet */
+    }
+    else                           /* pulse/pause */
+    {
+      if (Duration == IR_RX_END) Duration++;    /* prevent marker */
+      IR_RX_Store(Duration);       /* save duration */
+    }
   }
 
-  if (Flag < PACKET_MULTI)         /* no packets to follow (protocol done) */
+  if (! (IR_RX_State & IR_RX_PACKET))   /* waiting for packet */
   {
-    IR_State = 0;                  /* reset multi packet state */
-
-    /* slow down display updates and try to skip early repeats */
-    MilliSleep(200);               /* don't proceed too soon */
+    if (! IR_RX_LEVEL)             /* IR signal (inverted) */
+    {
+      IR_RX_State = IR_RX_PACKET;  /* first pulse of new packet */
+    }
   }
 
-  /* clean up local constants */
-  #undef PROTO_UNKNOWN
-  #undef PROTO_DETECTED
-  #undef PACKET_OK
-  #undef PACKET_DISPLAY
-  #undef PACKET_MULTI
-} 
+  IR_RX_Last = Time;               /* save timestamp */
+}
 
 
 
@@ -1798,21 +1643,13 @@ void IR_Detector(void)
   /* maximum number of pauses/pulses: 2 start + (2 * 48) data + 1 stop */
   #define MAX_PULSES          100
 
-  /* processing modes */
-  #define MODE_WAIT           1         /* wait for next packet */
-  #define MODE_SAMPLE         2         /* sample */
-  #define MODE_DECODE         3         /* decode packet */
-  #define MODE_KEY            4         /* check test button */
-
-  uint8_t           Run = MODE_WAIT;    /* loop control */
-  uint8_t           Flag;               /* IR signal */
-  uint8_t           OldFlag = 0;        /* former IR signal */
-  uint8_t           Cycles;             /* delay loop */
-  uint8_t           n;                  /* counter */
+  uint8_t           Run = 1;            /* loop control */
+  uint8_t           Flag;               /* status flag */
   uint8_t           Pulses = 0;         /* pulse counter */
-  uint8_t           Period = 0;         /* pulse duration */
-  uint8_t           *Pulse = NULL;      /* pointer to pulse data */
-  uint8_t           PulseData[MAX_PULSES];  /* pulse duration data */     
+  uint16_t          Item;               /* item from ring buffer */
+  uint32_t          Value;              /* duration */
+  uint8_t           PulseData[MAX_PULSES];   /* pulse duration data */     
+  uint16_t          RingBuffer[IR_RX_SIZE];  /* ring buffer for ISR */
 
   /* inform user */
   ShortCircuit(0);                      /* make sure probes are not shorted */
@@ -1855,16 +1692,11 @@ void IR_Detector(void)
   #endif
 
   /* wait for IR receiver module or key press */
-  n = 1;
-  while (n)
+  while (Run == 1)
   {
-    #ifdef SW_IR_RECEIVER
-    if (ADC_PIN & (1 << TP3))      /* check for high level */
-    #else
-    if (IR_PIN & (1 << IR_DATA))   /* check for high level */
-    #endif
+    if (IR_RX_LEVEL)               /* check for high level */
     {
-      n = 0;                            /* end this loop */
+      Run = 2;                          /* end this loop */
     }
     else                           /* check test key */
     {
@@ -1875,7 +1707,6 @@ void IR_Detector(void)
       if (Flag)                         /* key pressed */
       {
         Run = 0;                        /* skip decoder loop */
-        n = 0;                          /* end this loop */
       }
     }
   }
@@ -1885,142 +1716,108 @@ void IR_Detector(void)
 
 
   /*
-   *  adaptive sampling delay for 10s considering processing loop
-   *  - processing loop needs about 24 MCU cycles (3s@8MHz)
+   *  set up receiver
+   *  - Timer1 runs freely as time base (prescaler 64)
+   *  - pin change interrupt logs duration between edges in ring buffer
+   *  - a pulse/pause exceeding 12ms ends the packet
    */
 
-  Cycles = MCU_CYCLES_PER_US;           /* MCU cycles per s */
-  Cycles *= 10;                         /* cycles for 10s */
-  Cycles -= 24;                         /* consider loop */
-  Cycles /= 4;                          /* delay loop is 4 cycles */
+  /* ring buffer */
+  IR_RX_Buffer = &RingBuffer[0];   /* set buffer */
+  IR_RX_Head = 0;                  /* reset write position */
+  IR_RX_Tail = 0;                  /* reset read position */
+  IR_RX_State = 0;                 /* wait for packet */
+
+  /* Timer1: normal mode, prescaler 64 */
+  TCCR1B = 0;                      /* stop timer */
+  TCCR1A = 0;                      /* normal mode */
+  TCNT1 = 0;                       /* reset counter */
+  TCCR1B = (1 << CS11) | (1 << CS10);   /* start timer, prescaler 64 */
+
+  /* pin change interrupt */
+  IR_PC_MASK |= (1 << IR_PC_BIT);  /* enable data pin */
+  PCICR |= (1 << IR_PC_IRQ);       /* enable pin change interrupt */
 
 
   /*
-   *  Since we deal with data pulses in the range of 0.5 up to 10ms,
-   *  we sample IR data every 50s and log how long each pulse or pause
-   *  lasts. A pulse/pause exceeding 12ms triggers a timeout and won't
-   *  be logged.
+   *  Since the ISR logs the data, we simply wait for complete packets
+   *  and decode them. The next packet is logged while we are busy
+   *  with decoding and display output.
    */
 
   while (Run > 0)             /* processing loop */
   {
-    /*
-     *  read IR receiver module
-     *  - data logic is inverted by IR receiver
-     *    High: no IR signal / pause
-     *    Low: IR signal / pulse
-     */
-   
-    #ifdef SW_IR_RECEIVER
-      /* IR receiver connected to probes */
-      Flag = ADC_PIN & (1 << TP3);       /* poll data pin */
-    #else
-      /* fixed IR receiver */
-      Flag = IR_PIN & (1 << IR_DATA);    /* poll data pin */
-    #endif
-
-    /*
-     *  control logic for sampling
-     *  - wait for new packet and sample
-     */
-
-    if (Run == MODE_WAIT)     /* wait for IR data */
+    /* check for end of packet */
+    Flag = SREG;                        /* save status */
+    cli();                              /* disable interrupts */
+    if (IR_RX_State & IR_RX_PACKET)     /* receiving packet */
     {
-      if (!Flag)              /* got IR signal */
-      {
-        Run = MODE_SAMPLE;         /* start sampling */
-        OldFlag = Flag;            /* first one is always a pulse */
-        Pulses = 0;                /* reset pulse counter */
-        Period = 0;                /* reset duration */
-        Pulse = &PulseData[0];     /* set start address */
-      }
-      else                    /* no IR signal */
+      Item = TCNT1 - IR_RX_Last;        /* time since last edge */
+      if (Item > IR_RX_TIMEOUT)         /* timeout */
       {
-        Run = MODE_KEY;            /* check for test key */
+        IR_RX_Store(IR_RX_END);         /* end packet */
       }
     }
-    else                      /* sample IR data */
-    {
-      if (Flag == OldFlag)    /* same pause/pulse */
-      {
-        Period++;             /* increase period */
+    SREG = Flag;                        /* restore status */
 
-        if (Period > 240)     /* 12ms timeout */
-        {
-          Run = MODE_DECODE;       /* switch to decoding mode */
+    /* process logged data */
+    while (IR_RX_Tail != IR_RX_Head)
+    {
+      Item = IR_RX_Buffer[IR_RX_Tail];       /* get item */
+      IR_RX_Tail = (IR_RX_Tail + 1) & IR_RX_MASK;     /* next position */
 
-          if (!Flag)               /* removed receiver module */
-          {
-            Run = MODE_KEY;        /* check for test key */
-          }
-        }
+      if (Item == IR_RX_END)             /* end of packet */
+      {
+        IR_Decode(&PulseData[0], Pulses);    /* try to decode */
+        Pulses = 0;                          /* reset pulse counter */
       }
-      else                    /* new pause/pulse */
+      else if (Item == IR_RX_BROKEN)     /* broken packet */
       {
-        OldFlag = Flag;       /* update flag */
-
-        if (Pulses < MAX_PULSES)   /* prevent buffer overflow */
-        {
-          Pulses++;                /* got another one */
-          *Pulse = Period;         /* save duration */
-          Pulse++;                 /* next one */
-          Period = 0;              /* reset duration */
-        }
-        else                  /* max number of pulses exceeded */
-        {
-          Run = MODE_DECODE;       /* switch to decoding mode */
-        }
+        Pulses = 0;                          /* discard packet */
       }
-    }
-
-    /*
-     *  manage tasks
-     */
-
-    if (Run == MODE_SAMPLE)             /* sampling mode */
-    {
-      wait40us();             /* wait sampling period */
+      else if (Pulses < MAX_PULSES)      /* prevent buffer overflow */
+      {
+        /* convert Timer1 ticks into units of IR_SAMPLE_PERIOD */
+        Value = Item;
+        Value *= IR_RX_PRESCALER;            /* MCU cycles */
+        Value /= MCU_CYCLES_PER_US * IR_SAMPLE_PERIOD;
 
-      /*
-       *  adaptive delay for 10s considering processing loop
-       *  - a loop run needs 4 cycles, the last loop run just 3
-       *  - time delay: 10s - 1 MCU cycle
-       */
+        if (Value > 255) Value = 255;        /* limit to 8 bits */
 
-      n = Cycles;             /* number loop runs */
-      while (n > 0)           /* waiting loop */
-      {
-        n--;
-        asm volatile("nop\n\t"::);
+        PulseData[Pulses] = (uint8_t)Value;  /* save duration */
+        Pulses++;                            /* got another one */
       }
+      /* else: ignore excess pulses/pauses */
+
+      wdt_reset();                       /* reset watchdog */
     }
-    else if (Run == MODE_DECODE)        /* decoding mode */
+
+    /* check test button */
+    while (!(BUTTON_PIN & (1 << TEST_BUTTON)))  /* key pressed */
     {
-      IR_Decode(&PulseData[0], Pulses);    /* try to decode */
-      Run = MODE_WAIT;                     /* switch back to waiting mode */
+      MilliSleep(50);              /* take a nap */
+      Run = 0;                     /* end loop */
     }
-    else if (Run == MODE_KEY)           /* check for test key */
-    {
-      Run = MODE_WAIT;                     /* switch back to waiting mode */
 
-      /* check test button */
-      while (!(BUTTON_PIN & (1 << TEST_BUTTON)))  /* key pressed */
-      {
-        MilliSleep(50);            /* take a nap */
-        Run = 0;                   /* end loop */
-      }
+    if (Run)                       /* wait for more data */
+    {
+      MilliSleep(5);               /* take a short nap */
     }
 
     wdt_reset();                   /* reset watchdog */
   }
 
+
+  /*
+   *  clean up
+   */
+
+  PCICR &= ~(1 << IR_PC_IRQ);      /* disable pin change interrupt */
+  IR_PC_MASK &= ~(1 << IR_PC_BIT); /* disable data pin */
+  TCCR1B = 0;                      /* stop Timer1 */
+
   /* clean up local constants */
   #undef MAX_PULSES
-
-  #undef MODE_WAIT
-  #undef MODE_SAMPLE
-  #undef MODE_DECODE
-  #undef MODE_KEY
 }
 
 #endif
@@ -2035,121 +1832,177 @@ void IR_Detector(void)
 #ifdef SW_IR_TRANSMITTER
 
 /*
- *  send single pause/pulse
- *
- *  requires:
- *  - type: IR_PAUSE or IR_PULSE
- *  - time: duration in s
+ *  ISR for overflow of Timer1 (end of carrier period)
+ *  - plays pulse train in IR_TX_Buffer
+ *  - pulse: OC1B outputs carrier
+ *  - pause: OC1B disconnected (pin low)
  */
 
-void IR_Send_Pulse(uint8_t Type, uint16_t Time)
+ISR(TIMER1_OVF_vect, ISR_BLOCK)
 {
-  if (Type & IR_PULSE)        /* create pulse */
-  {
-    /* enable output via OC1B pin */
-    TCCR1A = (1 << WGM11) | (1 << WGM10) | (1 << COM1B1);
-
-    /* start Timer1 for carrier frequency */
-    TCNT1 = 0;                     /* set counter to 0 */
-    /* enable Timer1 by setting prescaler 1:1 */
-    TCCR1B = (1 << WGM13) | (1 << WGM12) | (1 << CS10);
-  }
-
+  uint16_t          Item;          /* pulse train item */
 
   /*
-   *  wait (delay loop)
-   *  - loop (without NOPs) burns 7 cycles per run and 4 cycles for last run
-   *  - total (without NOPs): 7 cycles * Time + 4 cycles
-   *  - add NOPs for 1s
-   *  - don't care about missing cycles of last run
+   *  hints:
+   *  - the ISR is called once per carrier period
+   *  - keep it short and simple
+   *  - global interrupts are disabled automatically
    */
 
-  #ifndef SW_IR_TX_ALTDELAY
+  if (IR_TX_Count > 1)             /* current item not done yet */
+  {
+    IR_TX_Count--;                 /* one carrier period less */
+    return;
+  }
 
-  while (Time > 0)
+  if (IR_TX_Pos >= IR_TX_Items)    /* end of frame */
   {
-    #if CPU_FREQ == 8000000
-      /* add 1 cycle */
-      asm volatile("nop");
-    #endif
+    IR_TX_Repeat--;                /* one frame less */
 
-    #if CPU_FREQ == 16000000
-      /* add 9 cycles */
-      asm volatile(
-        "nop\n\t"
-        "nop\n\t"
-        "nop\n\t"
-        "nop\n\t"
-        "nop\n\t"
-        "nop\n\t"
-        "nop\n\t"
-        "nop\n\t"
-        "nop\n\t"
-        ::
-      );
-    #endif
+    if (IR_TX_Repeat == 0)         /* all frames sent */
+    {
+      /* stop Timer1 and disable output via OC1B pin */
+      TIMSK1 = 0;                                /* disable interrupt */
+      TCCR1B = (1 << WGM13) | (1 << WGM12);      /* clear prescaler */
+      TCCR1A = (1 << WGM11) | (1 << WGM10);      /* disconnect OC1B */
 
-    #if CPU_FREQ == 20000000
-      /* add 13 cycles */
-      asm volatile(
-        "nop\n\t"
-        "nop\n\t"
-        "nop\n\t"
-        "nop\n\t"
-        "nop\n\t"
-        "nop\n\t"
-        "nop\n\t"
-        "nop\n\t"
-        "nop\n\t"
-        "nop\n\t"
-        "nop\n\t"
-        "nop\n\t"
-        "nop\n\t"
-        ::
-      );
-    #endif
+      IR_TX_Busy = 0;              /* signal end of transmission */
+      return;
+    }
 
-    Time--;
+    IR_TX_Pos = 0;                 /* send frame again */
   }
-  #endif
-
-
-  /*
-   *  alternative delay loop
-   *  - provided by Vitaliy
-   */
-
-  #ifdef SW_IR_TX_ALTDELAY
 
-  #include <util/delay.h>
+  /* get next item */
+  Item = IR_TX_Buffer[IR_TX_Pos];
+  IR_TX_Pos++;                     /* next position */
+  IR_TX_Count = Item & IR_TX_TIME; /* number of carrier periods */
 
-  while (Time >= 100)         /* 100s chunks */
+  if (Item & IR_TX_MARK)           /* pulse */
   {
-    _delay_us(100);
-    Time -= 100;
+    /* enable output via OC1B pin */
+    TCCR1A = (1 << WGM11) | (1 << WGM10) | (1 << COM1B1);
   }
-
-  while (Time >= 10)          /* 10s chunks */
+  else                             /* pause */
   {
-    _delay_us(10);
-    Time -= 10;
+    /* disable output via OC1B pin */
+    TCCR1A = (1 << WGM11) | (1 << WGM10);
   }
+}
 
-  while (Time > 0)            /* 1s chunks */
+
+
+/*
+ *  wait until pulse train is sent
+ */
+
+void IR_TX_Wait(void)
+{
+  while (IR_TX_Busy)          /* transmission in progress */
   {
-    _delay_us(1);
-    Time--;
+    MilliSleep(1);            /* timer keeps running in idle mode */
   }
-  #endif
+}
+
+
+
+/*
+ *  start new pulse train
+ *  - uses current carrier frequency (Timer1's top value)
+ */
+
+void IR_TX_Reset(void)
+{
+  IR_TX_Wait();               /* wait for last transmission to finish */
+
+  IR_TX_Items = 0;            /* empty pulse train */
+  IR_TX_Top = OCR1A + 1;      /* MCU cycles per carrier period */
+  IR_TX_Rest = IR_TX_Top / 2; /* round to nearest carrier period */
+}
+
+
+
+/*
+ *  send pulse train
+ *  - playback is done by Timer1's overflow ISR
+ *
+ *  requires:
+ *  - Frames: number of times to send the pulse train (1-255)
+ */
+
+void IR_TX_Start(uint8_t Frames)
+{
+  if (IR_TX_Items == 0) return;      /* nothing to send */
+
+  IR_TX_Pos = 0;                     /* start with first item */
+  IR_TX_Count = 0;                   /* get first item with next overflow */
+  IR_TX_Repeat = Frames;             /* number of frames */
+  IR_TX_Busy = 1;                    /* signal transmission */
+
+  /* start Timer1 for carrier frequency */
+  TCCR1A = (1 << WGM11) | (1 << WGM10);     /* OC1B disconnected */
+  TCNT1 = 0;                         /* set counter to 0 */
+  TIFR1 = (1 << TOV1);               /* clear overflow flag */
+  TIMSK1 = (1 << TOIE1);             /* enable overflow interrupt */
+  /* enable Timer1 by setting prescaler 1:1 */
+  TCCR1B = (1 << WGM13) | (1 << WGM12) | (1 << CS10);
+}
+
+
+
+/*
+ *  add single pause/pulse to pulse train
+ *  - converts time into carrier periods and keeps the remaining
+ *    MCU cycles for the next item, so the timing doesn't drift
+ *  - merges consecutive items of the same type
+ *  - max. 65ms per call (less than 4000 carrier periods at 56kHz)
+ *
+ *  requires:
+ *  - type: IR_PAUSE or IR_PULSE
+ *  - time: duration in s
+ */
+
+void IR_Send_Pulse(uint8_t Type, uint16_t Time)
+{
+  uint32_t          Cycles;        /* MCU cycles */
+  uint16_t          Periods;       /* carrier periods */
+  uint16_t          Item;          /* pulse train item */
+  uint16_t          Last;          /* last item */
+
+  /* convert time into carrier periods */
+  Cycles = Time;
+  Cycles *= MCU_CYCLES_PER_US;     /* time in MCU cycles */
+  Cycles += IR_TX_Rest;            /* add rest of last item */
+  Periods = Cycles / IR_TX_Top;    /* carrier periods */
+  IR_TX_Rest = Cycles % IR_TX_Top; /* keep rest for next item */
 
+  if (Periods == 0) return;        /* nothing to add */
 
-  if (Type & IR_PULSE)        /* create pulse */
+  if (Type & IR_PULSE) Item = IR_TX_MARK;    /* pulse */
+  else Item = 0;                             /* pause */
+
+  /* try to merge with last item */
+  if (IR_TX_Items > 0)             /* pulse train not empty */
   {
-    /* stop Timer1 */
-    TCCR1B = (1 << WGM13) | (1 << WGM12);    /* clear prescaler */
+    Last = IR_TX_Buffer[IR_TX_Items - 1];    /* get last item */
 
-    /* disable output via OC1B pin */
-    TCCR1A = (1 << WGM11) | (1 << WGM10);
+    if ((Last & IR_TX_MARK) == Item)         /* same type */
+    {
+      Time = Last & IR_TX_TIME;              /* periods of last item */
+
+      if (Time <= (IR_TX_TIME - Periods))    /* no overflow */
+      {
+        IR_TX_Buffer[IR_TX_Items - 1] = Last + Periods;     /* update */
+        return;
+      }
+    }
+  }
+
+  /* add new item */
+  if (IR_TX_Items < IR_TX_SIZE)    /* free slot */
+  {
+    IR_TX_Buffer[IR_TX_Items] = Item | Periods;
+    IR_TX_Items++;                 /* one item more */
   }
 }
 
@@ -2481,6 +2334,8 @@ void PutBits(uint16_t Data, uint8_t Bits, uint8_t StartBit, uint8_t Mode)
 
 /*
  *  send IR code
+ *  - compiles code into pulse train and starts sending it
+ *  - returns while code is sent, use IR_TX_Wait() to wait for the end
  *
  *  required:
  *  - Proto: protocol ID
@@ -2491,6 +2346,9 @@ void IR_Send_Code(uint8_t Proto, uint16_t *Data)
 {
   uint16_t          Temp;          /* temporary value */
   uint8_t           n;             /* counter */
+  uint8_t           Frames = 1;    /* number of frames to send */
+
+  IR_TX_Reset();                   /* new pulse train */
 
 
   /*
@@ -2567,18 +2425,12 @@ void IR_Send_Code(uint8_t Proto, uint16_t *Data)
     PutBits(n, 8, 41, IR_LSB);          /* check, 8 bits */
 
     /* send code three times */
-    n = 3;
-
-    while (n > 0)
-    {
-      IR_Send_Pulse(IR_PULSE, 3456);      /* start */
-      IR_Send_Pulse(IR_PAUSE, 1728);
-      IR_Send_PDM(&IR_Code[0], 48, 432, 432, 1296);
-
-      MilliSleep(74);         /* delay for next packet */
-
-      n--;                    /* next run */
-    }
+    IR_Send_Pulse(IR_PULSE, 3456);      /* start */
+    IR_Send_Pulse(IR_PAUSE, 1728);
+    IR_Send_PDM(&IR_Code[0], 48, 432, 432, 1296);
+    IR_Send_Pulse(IR_PAUSE, 37000);     /* delay for next packet (74ms) */
+    IR_Send_Pulse(IR_PAUSE, 37000);
+    Frames = 3;
   }
 
 
@@ -2647,9 +2499,11 @@ void IR_Send_Code(uint8_t Proto, uint16_t *Data)
     IR_Send_Pulse(IR_PULSE, 512);       /* start */
     IR_Send_Pulse(IR_PAUSE, 2560);
     IR_Send_BiPhase(&IR_Code[2], 10, IR_THOMAS, 512);  /* start packet */
-    MilliSleep(118);                                   /* delay */
+    IR_Send_Pulse(IR_PAUSE, 59000);                    /* delay (118ms) */
+    IR_Send_Pulse(IR_PAUSE, 59000);
     IR_Send_BiPhase(&IR_Code[0], 10, IR_THOMAS, 512);  /* command packet */
-    MilliSleep(118);                                   /* delay */
+    IR_Send_Pulse(IR_PAUSE, 59000);                    /* delay (118ms) */
+    IR_Send_Pulse(IR_PAUSE, 59000);
     IR_Send_BiPhase(&IR_Code[2], 10, IR_THOMAS, 512);  /* end packet */ 
   }
 
@@ -2897,7 +2751,7 @@ void IR_Send_Code(uint8_t Proto, uint16_t *Data)
 
     /* send code */
     IR_Send_PDM(&IR_Code[0], 15, 264, 786, 1836);      /* packet #1 */
-    MilliSleep(40);                                    /* delay */
+    IR_Send_Pulse(IR_PAUSE, 40000);                    /* delay */
     IR_Send_PDM(&IR_Code[2], 15, 264, 786, 1836);      /* packet #2 */
   }
 
@@ -2927,15 +2781,10 @@ void IR_Send_Code(uint8_t Proto, uint16_t *Data)
     Temp -= CodeTime(&IR_Code[0], 12, 600, 600, 1200);
 
     /* send code three times */
-    n = 3;
-    while (n > 0)
-    {
-      IR_Send_Pulse(IR_PULSE, 2400);    /* start */
-      IR_Send_PWM(&IR_Code[0], 12, 600, 600, 1200);
-      IR_Send_Pulse(IR_PAUSE, Temp);    /* delay for next packet */
-
-      n--;               /* next run */
-    }
+    IR_Send_Pulse(IR_PULSE, 2400);      /* start */
+    IR_Send_PWM(&IR_Code[0], 12, 600, 600, 1200);
+    IR_Send_Pulse(IR_PAUSE, Temp);      /* delay for next packet */
+    Frames = 3;
   }
 
 
@@ -2964,15 +2813,10 @@ void IR_Send_Code(uint8_t Proto, uint16_t *Data)
     Temp -= CodeTime(&IR_Code[0], 15, 600, 600, 1200);
 
     /* send code three times */
-    n = 3;
-    while (n > 0)
-    {
-      IR_Send_Pulse(IR_PULSE, 2400);    /* start */
-      IR_Send_PWM(&IR_Code[0], 15, 600, 600, 1200);
-      IR_Send_Pulse(IR_PAUSE, Temp);    /* delay for next packet */
-
-      n--;               /* next run */
-    }
+    IR_Send_Pulse(IR_PULSE, 2400);      /* start */
+    IR_Send_PWM(&IR_Code[0], 15, 600, 600, 1200);
+    IR_Send_Pulse(IR_PAUSE, Temp);      /* delay for next packet */
+    Frames = 3;
   }
 
 
@@ -3005,15 +2849,10 @@ void IR_Send_Code(uint8_t Proto, uint16_t *Data)
     Temp -= CodeTime(&IR_Code[0], 20, 600, 600, 1200);
 
     /* send code three times */
-    n = 3;
-    while (n > 0)
-    {
-      IR_Send_Pulse(IR_PULSE, 2400);    /* start */
-      IR_Send_PWM(&IR_Code[0], 20, 600, 600, 1200);
-      IR_Send_Pulse(IR_PAUSE, Temp);    /* delay for next packet */
-
-      n--;               /* next run */
-    }
+    IR_Send_Pulse(IR_PULSE, 2400);      /* start */
+    IR_Send_PWM(&IR_Code[0], 20, 600, 600, 1200);
+    IR_Send_Pulse(IR_PAUSE, Temp);      /* delay for next packet */
+    Frames = 3;
   }
 
 
@@ -3050,18 +2889,17 @@ void IR_Send_Code(uint8_t Proto, uint16_t *Data)
     Temp *= 2;                          /* double for real time */
 
     /* send code two times */
-    n = 2;
-    while (n > 0)
-    {
-      IR_Send_PDM(&IR_Code[0], 12, 500, 2000, 4500);
-      IR_Send_Pulse(IR_PAUSE, Temp);    /* delay for next packet */
-
-      n--;               /* next run */
-    }
+    IR_Send_PDM(&IR_Code[0], 12, 500, 2000, 4500);
+    IR_Send_Pulse(IR_PAUSE, Temp);      /* delay for next packet */
+    Frames = 2;
   }
   #endif
 
 
+  /* start sending */
+  IR_TX_Start(Frames);
+
+
   #if 0
   /* debugging */
   LCD_ClearLine(6);
@@ -3101,6 +2939,7 @@ void IR_RemoteControl(void)
   unsigned char     *ProtoStr = NULL;   /* string pointer (EEPROM) */
   uint16_t          Step = 0;           /* step size */
   uint16_t          Temp;               /* temporary value */
+  uint16_t          PulseTrain[IR_TX_SIZE];  /* mark/space durations */
   /* data fields for IR code */
   #define FIELDS                  4     /* number of data fields */
   uint16_t          Data[FIELDS];       /* data fields */
@@ -3163,12 +3002,12 @@ void IR_RemoteControl(void)
    */
 
   /* enable OC1B pin and set timer mode */
-  /* TCCR1A is set by IR_Send_Pulse() */
-  /* TCCR1A = (1 << WGM11) | (1 << WGM10) | (1 << COM1B1); */
+  /* TCCR1A is managed by IR_TX_Start() and the overflow ISR */
   TCCR1B = (1 << WGM13) | (1 << WGM12);
 
 
   /* set start values */
+  IR_TX_Buffer = &PulseTrain[0];        /* set buffer for pulse train */
   Proto_ID = IR_NEC_STD;                /* NEC Standard */
   Carrier = 38;                         /* 38 kHz */
   DutyCycle = 3;                        /* 1/3 */
@@ -3567,20 +3406,21 @@ void IR_RemoteControl(void)
         LCD_CharPos(1, 5);              /* line #5 */
         Display_EEString(IR_Send_str);  /* display: sending... */
 
-        IR_Send_Code(Proto_ID, &Data[0]);
-
-        LCD_ClearLine(5);               /* clear line #5 */
+        IR_Send_Code(Proto_ID, &Data[0]);    /* start sending */
         n = 0;
 
         IR_Toggle ^= 0b00000001;        /* toggle flag */
 
-        /* check if we should repeat sending */
+        /* check if we should repeat sending (while code is sent) */
         Test = TestKey(100, CHECK_BAT); /* get user feedback */
         if (Test == KEY_LONG)           /* long key press */
         {
           n = 2;                        /* repeat code */
         }
 
+        IR_TX_Wait();                   /* wait until code is sent */
+        LCD_ClearLine(5);               /* clear line #5 */
+
         /* smooth UI or delay repeated code */
         MilliSleep(200);           /* take a short nap */
       }
@@ -20,6 +20,8 @@
  *    ONEWIRE_DQ    pin for DQ
  *  - standard-speed (accurate 1s delay)
  *  - external power for clients (no parasite power)
+ *  - time slots are run by an ISR based on Timer1 (slot engine),
+ *    so other interrupts are able to keep running during bus traffic
  */
 
 
@@ -36,6 +38,17 @@
 /* source management */
 #define ONEWIRE_C
 
+/* slot engine: states */
+#define OW_IDLE               0    /* bus idle */
+#define OW_RESET_LOW          1    /* reset pulse */
+#define OW_RESET_SAMPLE       2    /* wait for presence pulse */
+#define OW_RESET_END          3    /* end of time slot */
+#define OW_SLOT               4    /* start of bit slot */
+#define OW_SLOT_RELEASE       5    /* end of low pulse for "0" */
+
+/* slot engine: Timer1's top value for delay in s (prescaler 1) */
+#define OW_TOP(t)             ((t) * MCU_CYCLES_PER_US - 1)
+
 
 /*
  *  include header files
@@ -48,6 +61,23 @@
 #include "OneWire.h"          /* OneWire specifics */
 
 
+/*
+ *  DQ line
+ */
+
+#ifdef ONEWIRE_IO_PIN
+  #define OW_DQ_DDR           ONEWIRE_DDR    /* data direction register */
+  #define OW_DQ_PIN           ONEWIRE_PIN    /* input pins register */
+  #define OW_DQ               ONEWIRE_DQ     /* pin for DQ */
+#endif
+
+#ifdef ONEWIRE_PROBES
+  #define OW_DQ_DDR           ADC_DDR        /* data direction register */
+  #define OW_DQ_PIN           ADC_PIN        /* input pins register */
+  #define OW_DQ               TP3            /* probe-3 */
+#endif
+
+
 /*
  *  local variables
  */
@@ -55,6 +85,12 @@
 /* CRC */
 uint8_t        CRC8;          /* current CRC-8 */
 
+/* slot engine */
+volatile uint8_t    OW_State = OW_IDLE; /* engine state */
+volatile uint8_t    OW_Data;            /* data bits or presence flag */
+volatile uint8_t    OW_Mask;            /* mask of current bit */
+volatile uint8_t    OW_Count;           /* number of bits left */
+
 
 
 /* ************************************************************************
@@ -153,242 +189,288 @@ uint8_t OneWire_Probes(const unsigned char *String)
 
 
 
+/* ************************************************************************
+ *   slot engine
+ * ************************************************************************ */
+
+
 /*
- *  reset bus and check for presence pulse from client(s)
- *
- *  returns:
- *  - 0: no presence pulse from client
- *  - 1: presence pulse from client
+ *  ISR for match of Timer1's top value (ICR1)
+ *  - runs the reset and bit time slots as a state machine
  */
 
-uint8_t OneWire_ResetBus(void)
+ISR(TIMER1_CAPT_vect, ISR_BLOCK)
 {
-  uint8_t           Flag = 0;      /* return value */
-
   /*
-   *  pull down DQ for >=480s and release it again
+   *  hints:
+   *  - Timer1 runs in CTC mode with ICR1 as top value, so this ISR is
+   *    called at the end of each delay
+   *  - delays start at the previous match and not when entering the
+   *    ISR, so the interrupt latency doesn't add up
+   *  - the time critical part of a read slot (low pulse and sampling
+   *    within 15s) is done here with disabled interrupts
+   *  - global interrupts are disabled automatically
    */
 
-  #ifdef ONEWIRE_IO_PIN
-  /* change DQ to output mode (port pin is low) */
-  ONEWIRE_DDR |= (1 << ONEWIRE_DQ);          /* set bit */
-  #endif
+  switch (OW_State)
+  {
+    case OW_RESET_LOW:        /* end of reset pulse */
+      ICR1 = OW_TOP(70);           /* delay of 70s */
 
-  #ifdef ONEWIRE_PROBES
-  /* change probe-3 (DQ) to output mode (port pin is low) */
-  ADC_DDR |= (1 << TP3);                     /* set bit */
-  #endif
+      /* change DQ back to input mode */
+      OW_DQ_DDR &= ~(1 << OW_DQ);       /* clear bit */
 
-  wait500us();                /* delay of 500s */
+      OW_State = OW_RESET_SAMPLE;
+      break;
 
-  #ifdef ONEWIRE_IO_PIN
-  /* change DQ back to input mode */
-  ONEWIRE_DDR &= ~(1 << ONEWIRE_DQ);         /* clear bit */
-  #endif
+    case OW_RESET_SAMPLE:     /* check for presence pulse */
+      /*
+       *  - client responds after 15-60s with a low pulse of 60-240s
+       */
 
-  #ifdef ONEWIRE_PROBES
-  /* change probe-3 (DQ) back to input mode */
-  ADC_DDR &= ~(1 << TP3);                    /* clear bit */
-  #endif
+      ICR1 = OW_TOP(430);          /* end of time slot (500s - 70s) */
 
+      /* read DQ */
+      if (! (OW_DQ_PIN & (1 << OW_DQ)))      /* low */
+      {
+        OW_Data = 1;               /* presence pulse */
+      }
 
-  /*
-   *  check for presence pulse from client(s)
-   *  - time slot >=480s
-   *  - client responds after 15-60s with a low pulse of 60-240s
-   *  - we check DQ after 70s
-   */
+      OW_State = OW_RESET_END;
+      break;
 
-  wait50us();                 /* read delay of 70s */
-  wait20us();
+    case OW_RESET_END:        /* end of reset time slot */
+      OW_State = OW_IDLE;          /* done */
+      break;
 
-  #ifdef ONEWIRE_IO_PIN
-  /* read DQ */
-  if (! (ONEWIRE_PIN & (1 << ONEWIRE_DQ)))   /* low */
-  {
-    Flag = 1;                 /* signal ok */
+    case OW_SLOT:             /* start of next bit slot */
+      if (OW_Count == 0)           /* all bits done */
+      {
+        OW_State = OW_IDLE;        /* done */
+        break;
+      }
+
+      OW_Count--;                  /* one bit less */
+
+      /* change DQ to output mode (port pin is low) */
+      OW_DQ_DDR |= (1 << OW_DQ);        /* set bit */
+
+      if (OW_Data & OW_Mask)       /* write "1" or read */
+      {
+        /*
+         *  - pull down DQ for 5s and release it again
+         *  - data bit of client valid for 15s starting with master's
+         *    low pulse, we read DQ after 13s
+         */
+
+        ICR1 = OW_TOP(70);         /* time slot + recovery time */
+
+        wait5us();                 /* pulse delay of 5s */
+
+        /* change DQ back to input mode */
+        OW_DQ_DDR &= ~(1 << OW_DQ);     /* clear bit */
+
+        wait5us();                 /* read delay of 8s */
+        wait3us();
+
+        /* read DQ */
+        if (! (OW_DQ_PIN & (1 << OW_DQ)))    /* low */
+        {
+          OW_Data &= ~OW_Mask;     /* client sends "0" */
+        }
+
+        OW_Mask <<= 1;             /* next bit */
+      }
+      else                         /* write "0" */
+      {
+        /* pull down DQ for 60s (complete time slot) */
+        ICR1 = OW_TOP(60);         /* pulse delay of 60s */
+        OW_State = OW_SLOT_RELEASE;
+      }
+      break;
+
+    case OW_SLOT_RELEASE:     /* end of low pulse for "0" */
+      ICR1 = OW_TOP(10);           /* recovery time of 10s */
+
+      /* change DQ back to input mode */
+      OW_DQ_DDR &= ~(1 << OW_DQ);       /* clear bit */
+
+      OW_Mask <<= 1;               /* next bit */
+      OW_State = OW_SLOT;
+      break;
   }
-  #endif
 
-  #ifdef ONEWIRE_PROBES
-  /* read DQ */
-  if (! (ADC_PIN & (1 << TP3)))              /* low */
+  if (OW_State == OW_IDLE)         /* end of operation */
   {
-    Flag = 1;                 /* signal ok */
+    /* stop Timer1 */
+    TCCR1B = 0;                    /* clear prescaler */
+    TIMSK1 = 0;                    /* disable interrupt */
   }
-  #endif
-
-  /* end the time slot */
-  wait400us();                /* delay of 430s (500s - 70s) */
-  wait30us();
-
-  return Flag;
 }
 
 
 
 /*
- *  send bit
+ *  start Timer1 for slot engine
+ *  - CTC mode with ICR1 as top value, prescaler 1
  *
  *  requires:
- *  - Bit: 0/1
+ *  - Top: top value for first delay
  */
 
-void OneWire_SendBit(uint8_t Bit)
+void OneWire_StartTimer(uint16_t Top)
 {
-  /*
-   *  - write time slot: 60-120s
-   *  - recovery time after write: >=1s
-   *  - write "1":
-   *    - 1-15s low pulse
-   *    - release DQ and wait until end of time slot
-   *  - write "0":
-   *    - 60-120s low pulse (complete time slot)
-   *    - release DQ
-   */
+  TCCR1B = 0;                      /* stop timer */
+  TCCR1A = 0;                      /* no output */
+  TCNT1 = 0;                       /* reset counter */
+  ICR1 = Top;                      /* set top value */
+  TIFR1 = (1 << ICF1);             /* clear flag */
+  TIMSK1 = (1 << ICIE1);           /* enable interrupt */
+
+  /* start timer: CTC mode (top: ICR1), prescaler 1 */
+  TCCR1B = (1 << WGM13) | (1 << WGM12) | (1 << CS10);
+}
+
+
+
+/*
+ *  start reset of bus and check for presence pulse from client(s)
+ *  - returns immediately, see OneWire_Ready() and OneWire_Result()
+ *  - result: 1 for presence pulse, 0 for none
+ */
+
+void OneWire_StartReset(void)
+{
+  OW_Data = 0;                     /* no presence pulse yet */
+  OW_State = OW_RESET_LOW;
 
   /*
-   *  pull down DQ
+   *  pull down DQ for >=480s and release it again
    */
 
-  #ifdef ONEWIRE_IO_PIN
   /* change DQ to output mode (port pin is low) */
-  ONEWIRE_DDR |= (1 << ONEWIRE_DQ);     /* set bit */
-  #endif    
+  OW_DQ_DDR |= (1 << OW_DQ);            /* set bit */
+
+  OneWire_StartTimer(OW_TOP(500));      /* delay of 500s */
+}
 
-  #ifdef ONEWIRE_PROBES
-  /* change probe-3 (DQ) to output mode (port pin is low) */
-  ADC_DDR |= (1 << TP3);                /* set bit */
-  #endif
 
 
-  if (Bit)          /* 1 */
-  {
-    /*
-     *  pull down DQ for 5s and release it again
-     */
+/*
+ *  start transfer of 1-8 bits
+ *  - bit order: LSB first
+ *  - returns immediately, see OneWire_Ready() and OneWire_Result()
+ *  - a "1" creates a read slot, so sending 0xFF reads a byte
+ *  - result: bits read (bits sent as "0" are returned as "0")
+ *
+ *  requires:
+ *  - Data: data bits
+ *  - Count: number of bits (1-8)
+ */
 
-    wait5us();                /* pulse delay of 5s */
-
-    #ifdef ONEWIRE_IO_PIN
-    /* change DQ back to input mode */
-    ONEWIRE_DDR &= ~(1 << ONEWIRE_DQ);       /* clear bit */
-    #endif
-
-    #ifdef ONEWIRE_PROBES
-    /* change probe-3 (DQ) back to input mode */
-    ADC_DDR &= ~(1 << TP3);                  /* clear bit */
-    #endif
- 
-    /* end the time slot + recovery time */
-    wait50us();               /* delay of 65s */
-    wait5us();
-    wait10us();
-  }
-  else              /* 0 */
-  {
-    /*
-     *  pull down DQ for 60s and release it again
-     */
+void OneWire_StartBits(uint8_t Data, uint8_t Count)
+{
+  OW_Data = Data;                  /* data bits */
+  OW_Mask = 0b00000001;            /* start with LSB */
+  OW_Count = Count;                /* number of bits */
+  OW_State = OW_SLOT;
 
-    wait50us();               /* pulse delay of 60s */
-    wait10us();
+  OneWire_StartTimer(OW_TOP(2));        /* start first slot */
+}
 
-    #ifdef ONEWIRE_IO_PIN
-    /* change DQ back to input mode */
-    ONEWIRE_DDR &= ~(1 << ONEWIRE_DQ);       /* clear bit */
-    #endif
 
-    #ifdef ONEWIRE_PROBES
-    /* change probe-3 (DQ) back to input mode */
-    ADC_DDR &= ~(1 << TP3);                  /* clear bit */
-    #endif
 
-    /* recovery time */
-    wait10us();               /* delay of 10s */
-  }
+/*
+ *  check if current operation is finished
+ *
+ *  returns:
+ *  - 1 when finished (bus idle)
+ *  - 0 when still busy
+ */
+
+uint8_t OneWire_Ready(void)
+{
+  uint8_t           Flag = 0;      /* return value */
+
+  if (OW_State == OW_IDLE) Flag = 1;    /* done */
+
+  return Flag;
 }
 
 
 
 /*
- *  read bit
+ *  get result of last operation
+ *  - wait until the operation is finished
  *
  *  returns:
- *  - Bit: 0/1
+ *  - presence flag for reset
+ *  - data bits read for bit transfer
  */
 
-uint8_t OneWire_ReadBit(void)
+uint8_t OneWire_Result(void)
 {
-  uint8_t           Bit = 0;       /* return value */
+  while (OW_State != OW_IDLE)      /* operation in progress */
+  {
+    /* wait */
+  }
 
-  /*
-   *  - read time slot: 60-120s
-   *  - recovery time after read: >=1s
-   *  - master starts read process by a low pulse >=1s
-   *  - client's response is valid for 15s after falling edge of
-   *    the master's low pulse
-   *  - we read DQ after 13s
-   */
+  return OW_Data;
+}
 
 
-  /*
-   *  pull down DQ for 5s and release it again
-   */
 
-  #ifdef ONEWIRE_IO_PIN
-  /* change DQ to output mode (port pin is low) */
-  ONEWIRE_DDR |= (1 << ONEWIRE_DQ);     /* set bit */
-  #endif    
+/* ************************************************************************
+ *   blocking bus access
+ * ************************************************************************ */
+
 
-  #ifdef ONEWIRE_PROBES
-  /* change probe-3 (DQ) to output mode (port pin is low) */
-  ADC_DDR |= (1 << TP3);                /* set bit */
-  #endif
+/*
+ *  reset bus and check for presence pulse from client(s)
+ *
+ *  returns:
+ *  - 0: no presence pulse from client
+ *  - 1: presence pulse from client
+ */
 
-  wait5us();                  /* pulse delay of 5s */
+uint8_t OneWire_ResetBus(void)
+{
+  OneWire_StartReset();            /* start reset */
 
-  #ifdef ONEWIRE_IO_PIN
-  /* change DQ back to input mode */
-  ONEWIRE_DDR &= ~(1 << ONEWIRE_DQ);    /* clear bit */
-  #endif
+  return OneWire_Result();         /* wait for presence flag */
+}
 
-  #ifdef ONEWIRE_PROBES
-  /* change probe-3 (DQ) back to input mode */
-  ADC_DDR &= ~(1 << TP3);               /* clear bit */
-  #endif
 
 
-  /*
-   *  read client's response
-   *  - data bit valid for 15s starting with master's read pulse
-   *  - high -> 1
-   *  - low  -> 0
-   */
+/*
+ *  send bit
+ *
+ *  requires:
+ *  - Bit: 0/1
+ */
 
-  wait5us();                /* read delay of 8s */
-  wait3us();
+void OneWire_SendBit(uint8_t Bit)
+{
+  OneWire_StartBits(Bit, 1);       /* one time slot */
+  OneWire_Result();                /* wait until done */
+}
 
-  #ifdef ONEWIRE_IO_PIN
-  /* read DQ */
-  if (ONEWIRE_PIN & (1 << ONEWIRE_DQ))  /* high */
-  {
-    Bit = 1;                /* 1 */
-  }
-  #endif
 
-  #ifdef ONEWIRE_PROBES
-  /* read DQ */
-  if (ADC_PIN & (1 << TP3))             /* high */
-  {
-    Bit = 1;                /* 1 */
-  }
-  #endif
 
-  /* end the time slot + recovery time */
-  wait50us();               /* delay of 57s */
-  wait5us();
-  wait2us();
+/*
+ *  read bit
+ *
+ *  returns:
+ *  - Bit: 0/1
+ */
+
+uint8_t OneWire_ReadBit(void)
+{
+  uint8_t           Bit;           /* return value */
+
+  OneWire_StartBits(1, 1);         /* one read slot */
+  Bit = OneWire_Result();          /* get bit */
+  Bit &= 0b00000001;               /* filter bit */
 
   return Bit;
 }
@@ -405,14 +487,8 @@ uint8_t OneWire_ReadBit(void)
 
 void OneWire_SendByte(uint8_t Byte)
 {
-  uint8_t           n = 0;         /* counter */
-
-  while (n < 8)          /* 8 bits */
-  {
-    OneWire_SendBit(Byte & 0x01);       /* send LSB */
-    Byte >>= 1;                         /* shift to right */
-    n++;                                /* next bit */
-  }
+  OneWire_StartBits(Byte, 8);      /* 8 bits */
+  OneWire_Result();                /* wait until done */
 }
 
 
@@ -427,32 +503,69 @@ void OneWire_SendByte(uint8_t Byte)
 
 uint8_t OneWire_ReadByte(void)
 {
-  uint8_t           Byte = 0;      /* return value */
+  OneWire_StartBits(0xFF, 8);      /* 8 read slots */
+
+  return OneWire_Result();         /* get byte */
+}
+
+
+
+/* ************************************************************************
+ *   high level functions
+ * ************************************************************************ */
+
+
+/*
+ *  calculate CRC-8
+ *  - CRC = X^8 + X^5 + X^4 + 1
+ *  - start value: 0x00
+ *  - uses variable CRC8 to track current CRC
+ *
+ *  requires:
+ *  - Byte: new input byte
+ */
+
+void OneWire_CRC8(uint8_t Byte)
+{
   uint8_t           n = 0;         /* counter */
+  uint8_t           Bit;           /* LSB */ 
 
   while (n < 8)          /* 8 bits */
   {
-    Byte >>= 1;                         /* shift to right */
+    /* XOR current LSB of input with CRC8's current X^8 */
+    Bit = CRC8 ^ Byte;        /* XOR */
+    Bit &= 0b00000001;        /* filter LSB */
+
+    /* shift CRC right */
+    CRC8 >>= 1;               /* for next bit */
 
-    if (OneWire_ReadBit())              /* read "1" */
+    if (Bit)                  /* XORed LSB is 1 */
     {
-      Byte |= 0b10000000;               /* set bit */
+      /*
+       *  XOR CRC's X^5 and X^4 with 1
+       *  - XOR with 0b00011000
+       *  - since CRC is already shifted right: XOR with 0b00001100
+       *  - since we have to feed the XORed LSB back into the CRC
+       *    and the MSB is 0 after shifting: XOR with 0b10001100
+       */
+
+      CRC8 ^= 0b10001100;     /* XOR */
     }
+    /*  when 0:
+     *  - XOR would keep the original bits
+     *  - MSB will be 0 after a right shift anyway
+     */
 
-    n++;                                /* next bit */
-  }
+    /* shift input right */
+    Byte >>= 1;               /* for next input bit */
 
-  return Byte;
+    n++;                      /* next bit */
+  }
 }
 
 
 
-/* ************************************************************************
- *   high level functions
- * ************************************************************************ */
-
-
-#if 0
+#ifdef SW_DS18B20
 
 /*
  *  address client
@@ -460,10 +573,11 @@ uint8_t OneWire_ReadByte(void)
  *
  *  requires:
  *  - ROM_Code: pointer to ROM code stored in an array of 8 bytes
+ *    or NULL to address all clients (skip ROM)
  *
  *  returns:
- *  - 1
- *  - 0
+ *  - 1 on success
+ *  - 0 on any problem (no client)
  */
 
 uint8_t OneWire_AddressClient(uint8_t *ROM_Code)
@@ -491,7 +605,7 @@ uint8_t OneWire_AddressClient(uint8_t *ROM_Code)
     }
     else                     /* NULL pointer */
     {
-      /* assumes a single client on the bus */
+      /* broadcast or single client on the bus */
       OneWire_SendByte(CMD_SKIP_ROM);   /* select all clients */
     }
   }
@@ -499,58 +613,122 @@ uint8_t OneWire_AddressClient(uint8_t *ROM_Code)
   return Flag;
 }
 
-#endif
-
 
 
 /*
- *  calculate CRC-8
- *  - CRC = X^8 + X^5 + X^4 + 1
- *  - start value: 0x00
- *  - uses variable CRC8 to track current CRC
+ *  search ROM: find next client on the bus
+ *  - includes reset of the bus
+ *  - walks the ROM code tree, taking the 0-branch first at each new fork
+ *  - call with *Fork = 0 for the first client and then repeatedly with
+ *    the previous ROM code and fork until *Fork is 0 again
  *
  *  requires:
- *  - Byte: new input byte
+ *  - ROM_Code: pointer to array of 8 bytes with the previous ROM code,
+ *    returns the ROM code found
+ *  - Fork: pointer to position of last fork taken (1-64, 0 for start),
+ *    returns the new position (0 after the last client)
+ *
+ *  returns:
+ *  - 1 on success
+ *  - 0 on any problem (no client or CRC mismatch)
  */
 
-void OneWire_CRC8(uint8_t Byte)
+uint8_t OneWire_SearchROM(uint8_t *ROM_Code, uint8_t *Fork)
 {
-  uint8_t           n = 0;         /* counter */
-  uint8_t           Bit;           /* LSB */ 
+  uint8_t           Flag = 0;      /* return value */
+  uint8_t           n = 1;         /* ROM bit counter (1-64) */
+  uint8_t           NewFork = 0;   /* position of last 0-branch */
+  uint8_t           Bit;           /* ROM bit */
+  uint8_t           Comp;          /* complement of ROM bit */
+  uint8_t           Mask = 0b00000001;  /* bit mask */
+  uint8_t           *Byte;         /* pointer to ROM byte */
 
-  while (n < 8)          /* 8 bits */
-  {
-    /* XOR current LSB of input with CRC8's current X^8 */
-    Bit = CRC8 ^ Byte;        /* XOR */
-    Bit &= 0b00000001;        /* filter LSB */
+  /* reset bus and check for presence pulse */
+  Flag = OneWire_ResetBus();
 
-    /* shift CRC right */
-    CRC8 >>= 1;               /* for next bit */
+  if (Flag)              /* detected client(s) */
+  {
+    OneWire_SendByte(CMD_SEARCH_ROM);   /* start search */
+    Byte = ROM_Code;
 
-    if (Bit)                  /* XORed LSB is 1 */
+    while (Flag && (n <= 64))      /* 64 bits */
     {
-      /*
-       *  XOR CRC's X^5 and X^4 with 1
-       *  - XOR with 0b00011000
-       *  - since CRC is already shifted right: XOR with 0b00001100
-       *  - since we have to feed the XORed LSB back into the CRC
-       *    and the MSB is 0 after shifting: XOR with 0b10001100
-       */
+      /* read ROM bit and its complement from all clients */
+      Bit = OneWire_ReadBit();
+      Comp = OneWire_ReadBit();
 
-      CRC8 ^= 0b10001100;     /* XOR */
+      if (Bit && Comp)             /* 11: no client responded */
+      {
+        Flag = 0;                  /* signal error */
+      }
+      else
+      {
+        if (Bit == Comp)           /* 00: clients differ (fork) */
+        {
+          if (n < *Fork)           /* before last fork */
+          {
+            /* take the same branch as before */
+            Bit = (*Byte & Mask) ? 1 : 0;
+          }
+          else if (n == *Fork)     /* last fork */
+          {
+            Bit = 1;               /* take 1-branch this time */
+          }
+          else                     /* new fork */
+          {
+            Bit = 0;               /* take 0-branch first */
+          }
+
+          /* remember fork with 1-branch still to go */
+          if (Bit == 0) NewFork = n;
+        }
+        /* 01 or 10: all clients have the same ROM bit */
+
+        /* update ROM code */
+        if (Bit) *Byte |= Mask;         /* set bit */
+        else *Byte &= ~Mask;            /* clear bit */
+
+        /* select branch (deselects other clients) */
+        OneWire_SendBit(Bit);
+
+        /* next bit */
+        Mask <<= 1;                     /* shift left */
+        if (Mask == 0)                  /* byte done */
+        {
+          Mask = 0b00000001;            /* LSB of next byte */
+          Byte++;                       /* next byte */
+        }
+        n++;                            /* next bit */
+      }
     }
-    /*  when 0:
-     *  - XOR would keep the original bits
-     *  - MSB will be 0 after a right shift anyway
-     */
+  }
 
-    /* shift input right */
-    Byte >>= 1;               /* for next input bit */
+  if (Flag)              /* got ROM code */
+  {
+    /* check CRC of ROM code */
+    CRC8 = 0x00;              /* reset CRC to start value */
+    n = 0;
+    while (n < 7)             /* 7 data bytes */
+    {
+      OneWire_CRC8(ROM_Code[n]);        /* process byte */
+      n++;                              /* next byte */
+    }
 
-    n++;                      /* next bit */
+    if (ROM_Code[7] == CRC8)            /* CRC matches */
+    {
+      *Fork = NewFork;                  /* save fork for next search */
+    }
+    else                                /* mismatch */
+    {
+      Flag = 0;                         /* signal error */
+    }
   }
+
+  return Flag;
 }
 
+#endif
+
 
 
 /* ************************************************************************
@@ -561,92 +739,143 @@ void OneWire_CRC8(uint8_t Byte)
 #ifdef SW_DS18B20
 
 /*
- *  DS18B20: read temperature
- *  - single client on the bus
+ *  DS18B20: find sensors on the bus
+ *  - search ROM, clients with other family codes are skipped
  *
  *  requires:
- *  - T: for returning temperature in C
- *  - Depth: for returning bit depth (9-12) 
+ *  - ROM_Codes: pointer to array of Max * 8 bytes for ROM codes
+ *  - Max: max. number of sensors
  *
  *  returns:
- *  - 1 on success
- *  - 0 on any problem
+ *  - number of sensors found
  */
 
-uint8_t DS18B20_ReadTemperature(int32_t *Value, int8_t *Scale, uint8_t *Bits)
+uint8_t DS18B20_Search(uint8_t *ROM_Codes, uint8_t Max)
 {
-  uint8_t           Flag = 0;           /* return value */
-  uint8_t           Run = 0;            /* loop control */
+  uint8_t           Count = 0;          /* return value */
+  uint8_t           Run = 1;            /* loop control */
+  uint8_t           Fork = 0;           /* last fork of ROM search */
   uint8_t           n;                  /* counter */
-  uint8_t           ScratchPad[9];      /* scratchpad */
-  uint8_t           Sign;               /* sign flag */
-  int16_t           Temp;               /* temperature */
-
-  /* reset bus and check for presence pulse */
-  Flag = OneWire_ResetBus();
+  uint8_t           ROM_Code[8];        /* ROM code */
 
-  if (Flag)                   /* detected client */
+  while (Run)
   {
-    OneWire_SendByte(CMD_SKIP_ROM);     /* select all clients */
+    if (OneWire_SearchROM(ROM_Code, &Fork))      /* found client */
+    {
+      if (ROM_Code[0] == DS18B20_FAMILY_CODE)    /* DS18B20 */
+      {
+        /* copy ROM code */
+        n = 0;
+        while (n < 8)              /* 8 bytes */
+        {
+          *ROM_Codes = ROM_Code[n];     /* copy byte */
+          ROM_Codes++;                  /* next byte */
+          n++;                          /* next byte */
+        }
+
+        Count++;                   /* got another one */
+        if (Count >= Max) Run = 0; /* no space left */
+      }
+
+      if (Fork == 0) Run = 0;      /* last client */
+    }
+    else                                         /* error */
+    {
+      Run = 0;                     /* end loop */
+    }
+  }
+
+  return Count;
+}
+
 
+
+/*
+ *  DS18B20: start conversion
+ *  - broadcast to all sensors on the bus, so they convert in parallel
+ *
+ *  returns:
+ *  - 1 on success
+ *  - 0 on any problem (no client)
+ */
+
+uint8_t DS18B20_StartConversion(void)
+{
+  uint8_t           Flag;               /* return value */
+
+  /* reset bus and address all clients */
+  Flag = OneWire_AddressClient(NULL);
+
+  if (Flag)                   /* detected client(s) */
+  {
     /* start conversion */
     OneWire_SendByte(CMD_DS18B20_CONVERT_T);
+  }
 
-    /*
-     *  maximum conversion time
-     *  -  9 bits  93.75ms  (t_conv/8)
-     *  - 10 bits  187.5ms  (t_conv/4)
-     *  - 11 bits  375ms    (t_conv/2)
-     *  - 12 bits  750ms    (t_conv)
-     */
+  return Flag;
+}
 
-    #if 0
-    /* fixed delay for conversion (required when parasitic-powered) */
-    MilliSleep(750);          /* 750ms */
-    Run = 3;                  /* three read attempts */
-    #endif
 
-    /*
-     *  check the conversion status to minimize delay
-     *  - requires external power
-     *  - this way we don't need to know the bit depth in advance
-     *    to determine the conversion time
-     */
 
-    Flag = 0;                           /* reset flag */
-    n = 50;                             /* 750ms / 15ms = 50 */
-    while (n > 0)
-    {
-      MilliSleep(15);                   /* wait 15ms */
+/*
+ *  DS18B20: check if conversion is finished
+ *  - single read slot, returns immediately
+ *  - read slot returns 0 as long as any sensor is still converting
+ *  - requires external power (no parasite power)
+ *  - maximum conversion time
+ *    -  9 bits  93.75ms  (t_conv/8)
+ *    - 10 bits  187.5ms  (t_conv/4)
+ *    - 11 bits  375ms    (t_conv/2)
+ *    - 12 bits  750ms    (t_conv)
+ *
+ *  returns:
+ *  - 1 when conversion is finished
+ *  - 0 when conversion is still in progress
+ */
 
-      /* check conversion state */
-      Sign = OneWire_ReadBit();         /* single read slot */
-      if (Sign == FLAG_CONV_DONE)       /* conversion finished */
-      {
-        Flag = 1;                       /* signal "ok" */
-        Run = 3;                        /* three read attempts */
-        n = 1;                          /* end loop */
-      }
+uint8_t DS18B20_CheckConversion(void)
+{
+  uint8_t           Flag = 0;           /* return value */
 
-      n--;                              /* next round */
-    }
+  /* check conversion state */
+  if (OneWire_ReadBit() == FLAG_CONV_DONE)       /* conversion finished */
+  {
+    Flag = 1;                           /* signal "ok" */
   }
 
+  return Flag;
+}
+
 
-  /*
-   *  read scratchpad
-   */
+
+/*
+ *  DS18B20: read scratchpad
+ *  - up to three read attempts
+ *
+ *  requires:
+ *  - ROM_Code: pointer to sensor's ROM code (8 bytes)
+ *    or NULL for a single sensor on the bus
+ *  - ScratchPad: pointer to array of 9 bytes
+ *
+ *  returns:
+ *  - 1 on success
+ *  - 0 on any problem (no client or CRC mismatch)
+ */
+
+uint8_t DS18B20_ReadScratchPad(uint8_t *ROM_Code, uint8_t *ScratchPad)
+{
+  uint8_t           Flag = 0;           /* return value */
+  uint8_t           Run = 3;            /* loop control (three read attempts) */
+  uint8_t           n;                  /* counter */
 
   while (Run)
   {
-    /* reset bus and check for presence pulse */
-    Flag = OneWire_ResetBus();    
+    /* reset bus and address sensor */
+    Flag = OneWire_AddressClient(ROM_Code);
 
     if (Flag)                 /* detected client */
     {
-      OneWire_SendByte(CMD_SKIP_ROM);        /* select all clients */
-
-      /* read scratchpad to get temperature */
+      /* read scratchpad */
       OneWire_SendByte(CMD_DS18B20_READ_SCRATCHPAD);
       n = 0;
       while (n < 9)           /* 9 bytes */
@@ -681,6 +910,87 @@ uint8_t DS18B20_ReadTemperature(int32_t *Value, int8_t *Scale, uint8_t *Bits)
     Run--;                    /* another try */
   }
 
+  return Flag;
+}
+
+
+
+/*
+ *  DS18B20: set resolution
+ *  - changes configuration register in the scratchpad and keeps T_H
+ *    and T_L (not copied to the EEPROM, so it's reset at power-up)
+ *
+ *  requires:
+ *  - ROM_Code: pointer to sensor's ROM code (8 bytes)
+ *    or NULL for a single sensor on the bus
+ *  - Bits: resolution in bits (9-12)
+ *
+ *  returns:
+ *  - 1 on success
+ *  - 0 on any problem
+ */
+
+uint8_t DS18B20_SetResolution(uint8_t *ROM_Code, uint8_t Bits)
+{
+  uint8_t           Flag;               /* return value */
+  uint8_t           ScratchPad[9];      /* scratchpad */
+
+  /* read scratchpad to get T_H and T_L */
+  Flag = DS18B20_ReadScratchPad(ROM_Code, ScratchPad);
+
+  if (Flag)                   /* got scratchpad */
+  {
+    /* reset bus and address sensor */
+    Flag = OneWire_AddressClient(ROM_Code);
+  }
+
+  if (Flag)                   /* detected client */
+  {
+    /* write T_H, T_L and configuration register */
+    OneWire_SendByte(CMD_DS18B20_WRITE_SCRATCHPAD);
+    OneWire_SendByte(ScratchPad[2]);    /* T_H */
+    OneWire_SendByte(ScratchPad[3]);    /* T_L */
+
+    /* configuration register: 0 R1 R0 1 1 1 1 1 (9-12 bits -> 0-3) */
+    Bits -= 9;                          /* 0-3 */
+    Bits <<= 5;                         /* shift to R0/R1 */
+    Bits |= 0b00011111;                 /* reserved bits */
+    OneWire_SendByte(Bits);
+  }
+
+  return Flag;
+}
+
+
+
+/*
+ *  DS18B20: read temperature
+ *  - reads scratchpad after a finished conversion
+ *
+ *  requires:
+ *  - ROM_Code: pointer to sensor's ROM code (8 bytes)
+ *    or NULL for a single sensor on the bus
+ *  - Value: for returning temperature in C
+ *  - Scale: for returning scale of temperature (10^x)
+ *  - Bits: for returning bit depth (9-12) 
+ *
+ *  returns:
+ *  - 1 on success
+ *  - 0 on any problem
+ */
+
+uint8_t DS18B20_ReadTemperature(uint8_t *ROM_Code, int32_t *Value, int8_t *Scale, uint8_t *Bits)
+{
+  uint8_t           Flag;               /* return value */
+  uint8_t           Run;                /* bit depth / binary scale */
+  uint8_t           n;                  /* counter */
+  uint8_t           ScratchPad[9];      /* scratchpad */
+  uint8_t           Sign;               /* sign flag */
+  int16_t           Temp;               /* temperature */
+
+  /* read scratchpad */
+  Flag = DS18B20_ReadScratchPad(ROM_Code, ScratchPad);
+
 
   /*
    *  get temperature from scratchpad (in C)
@@ -767,6 +1077,20 @@ uint8_t DS18B20_ReadTemperature(int32_t *Value, int8_t *Scale, uint8_t *Bits)
 /* source management */
 #undef ONEWIRE_C
 
+/* local constants */
+#undef OW_TOP
+#undef OW_SLOT_RELEASE
+#undef OW_SLOT
+#undef OW_RESET_END
+#undef OW_RESET_SAMPLE
+#undef OW_RESET_LOW
+#undef OW_IDLE
+
+/* DQ line */
+#undef OW_DQ
+#undef OW_DQ_PIN
+#undef OW_DQ_DDR
+
 #endif
 
 /* ************************************************************************
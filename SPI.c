@@ -20,6 +20,8 @@
  *    ATmega 644: SCK PB7 / MOSI PB5 / MISO PB6
  *  - /CS and other control signals have to be managed by the specific
  *    chip driver
+ *  - bit-bang: SPI_Write_Byte(), SPI_Write_Word() and SPI_Repeat_Word()
+ *    are unrolled assembler functions in SPI_bitbang.S
  */
 
 
@@ -126,56 +128,7 @@ void SPI_Write_Bit(uint8_t Bit)
 
 
 
-/*
- *  write a single byte
- *
- *  requires:
- *  - Byte: byte to write
- */
-
-void SPI_Write_Byte(uint8_t Byte)
-{
-  uint8_t           n = 8;         /* counter */
-
-  /* expected state: SCK low / MOSI undefined */
-
-  /*
-   *  bitbang 8 bits:
-   *  - SPI mode 0 (CPOL = 0, CPHA = 0)
-   *    - set MOSI before rising SCK
-   *  - MSB first
-   */
-
-  while (n > 0)               /* for 8 bits */
-  {
-    /* get current MSB and set MOSI */
-    if (Byte & 0b10000000)    /* 1 */
-    {
-      /* set MOSI high */
-      SPI_PORT |= (1 << SPI_MOSI);
-    }
-    else                      /* 0 */
-    {
-      /* set MOSI low */
-      SPI_PORT &= ~(1 << SPI_MOSI);
-    }
-
-    /* end clock cycle (rising edge takes bit) */
-    SPI_PORT |= (1 << SPI_SCK);
-
-    /* start next clock cycle (falling edge) */
-    SPI_PORT &= ~(1 << SPI_SCK);
-
-    Byte <<= 1;               /* shift bits one step left */
-    n--;                      /* next bit */
-  }
-
-  /* current state: SCK low / MOSI undefined */
-}
-
-
-
-#if SPI_RW
+#ifdef SPI_RW
 
 /*
  *  write and read a single byte
@@ -348,7 +301,59 @@ void SPI_Write_Byte(uint8_t Byte)
 
 
 
-#if SPI_RW
+#ifdef SPI_WORD
+
+/*
+ *  write a 16 bit word (MSB first)
+ *
+ *  requires:
+ *  - Word: word to write
+ */
+
+void SPI_Write_Word(uint16_t Word)
+{
+  SPI_Write_Byte((uint8_t)(Word >> 8));      /* write MSB */
+  SPI_Write_Byte((uint8_t)Word);             /* write LSB */
+}
+
+
+
+/*
+ *  write a 16 bit word (MSB first) several times
+ *  - for filling areas with a color
+ *
+ *  requires:
+ *  - Word: word to write
+ *  - Count: number of words
+ */
+
+void SPI_Repeat_Word(uint16_t Word, uint16_t Count)
+{
+  uint8_t           MSB;           /* MSB of word */
+  uint8_t           LSB;           /* LSB of word */
+
+  MSB = (uint8_t)(Word >> 8);
+  LSB = (uint8_t)Word;
+
+  while (Count > 0)
+  {
+    /* writing SPDR after reading SPSR also clears SPIF */
+    SPDR = MSB;                      /* start transmission */
+    while (!(SPSR & (1 << SPIF)));   /* wait for flag */
+    SPDR = LSB;                      /* start transmission */
+    while (!(SPSR & (1 << SPIF)));   /* wait for flag */
+
+    Count--;                         /* next word */
+  }
+
+  LSB = SPDR;                      /* clear flag by reading data */
+}
+
+#endif
+
+
+
+#ifdef SPI_RW
 
 /*
  *  write and read a single byte
@@ -0,0 +1,171 @@
+#!/usr/bin/env python3
+#
+#  bitmap_rle.py
+#
+#  create run-length encoded (RLE) variant of a font or symbol bitmap
+#  - input: horizontally aligned & flipped bitmaps (*_hf.h)
+#  - the pixels of each character/symbol are read row by row (top to
+#    down, left to right) and stored as pairs of runs, one byte per pair:
+#    - bits 7-3: number of background pixels (0-31)
+#    - bits 2-0: number of foreground pixels (0-7)
+#    - longer runs are split and continued by the next pair
+#  - an index table (FontIndex[] or SymbolIndex[]) holds the offset of
+#    each character/symbol in the data table
+#  - all other tables (FontTable[], PinTable[]) are copied unchanged
+#
+#  usage:
+#    bitmap_rle.py <input> <output>
+#    e.g. bitmap_rle.py bitmaps/font_10x16_hf.h bitmaps/font_10x16_hf_rle.h
+#
+#  (c) 2019 by Markus Reschke
+#
+
+import os
+import re
+import sys
+
+
+# maximum runs per pair
+MAX_BG = 31
+MAX_FG = 7
+
+# data byte
+BYTE = re.compile(r'0x[0-9a-fA-F]{2}')
+
+# comment
+COMMENT = re.compile(r'/\*(.*?)\*/')
+
+
+def encode(data, size_x, size_y, bytes_x):
+    """ encode bitmap of a single character/symbol """
+    # get runs, starting with background
+    runs = []
+    color = 0
+    count = 0
+    for y in range(size_y):
+        for x in range(size_x):
+            pixel = (data[y * bytes_x + x // 8] >> (x % 8)) & 1
+            if pixel == color:
+                count += 1
+            else:
+                runs.append(count)
+                color = pixel
+                count = 1
+    runs.append(count)
+    if len(runs) % 2:
+        runs.append(0)                       # no foreground at end
+
+    # create pairs
+    pairs = []
+    for n in range(0, len(runs), 2):
+        bg, fg = runs[n], runs[n + 1]
+        while bg > MAX_BG:                   # long background run
+            pairs.append(MAX_BG << 3)
+            bg -= MAX_BG
+        while fg > MAX_FG:                   # long foreground run
+            pairs.append((bg << 3) | MAX_FG)
+            fg -= MAX_FG
+            bg = 0
+        pairs.append((bg << 3) | fg)
+    return pairs
+
+
+def main(args):
+    if len(args) != 2:
+        sys.exit('usage: bitmap_rle.py <input> <output>')
+    text = open(args[0], encoding='latin-1').read()
+
+    # font or symbols
+    if 'FontData[]' in text:
+        kind, data_name, index_name = 'FONT', 'FontData', 'FontIndex'
+    else:
+        kind, data_name, index_name = 'SYMBOL', 'SymbolData', 'SymbolIndex'
+
+    def define(name):
+        return int(re.search(r'#define ' + kind + '_' + name + r'\s+(\d+)',
+                             text).group(1))
+
+    size_x = define('SIZE_X')
+    size_y = define('SIZE_Y')
+    bytes_n = define('BYTES_N')
+    bytes_x = define('BYTES_X')
+
+    # split bitmap data into characters/symbols
+    # - items: (bytes, comment) or preprocessor line
+    m = re.search(r'const uint8_t ' + data_name +
+                  r'\[\] PROGMEM = \{[^\n]*\n', text)
+    start = m.start()
+    end = text.index('};', m.end()) + 2
+    items = []
+    data = []
+    for line in text[m.end():end - 2].splitlines():
+        if line.strip().startswith('#'):     # conditional bitmaps
+            items.append(line.rstrip())
+            continue
+        c = COMMENT.search(line)
+        data += [int(b, 16) for b in BYTE.findall(COMMENT.sub('', line))]
+        if len(data) >= bytes_n:
+            items.append((data[:bytes_n], c.group(1).strip() if c else ''))
+            data = data[bytes_n:]
+
+    # encode bitmaps
+    data_lines = []
+    index_lines = []
+    offset = 0
+    raw = packed = 0
+    for item in items:
+        if isinstance(item, str):
+            data_lines.append(item)
+            index_lines.append(item)
+            continue
+        pairs = encode(item[0], size_x, size_y, bytes_x)
+        raw += bytes_n
+        packed += len(pairs)
+        for n in range(0, len(pairs), 16):
+            line = '  ' + ''.join('0x%02X,' % b for b in pairs[n:n + 16])
+            if n + 16 >= len(pairs):
+                line = line.ljust(83) + '   /* %s */' % item[1]
+            data_lines.append(line)
+        index_lines.append(('  %d,' % offset).ljust(14) + '/* %s */' % item[1])
+        offset += len(pairs)
+
+    # new bitmap section
+    section = ('const uint8_t %s[] PROGMEM = {\n%s\n};\n\n\n'
+               '/*\n'
+               ' *  offset of each bitmap in %s[]\n'
+               ' */\n\n'
+               'const uint16_t %s[] PROGMEM = {\n%s\n};' %
+               (data_name, '\n'.join(data_lines), data_name,
+                index_name, '\n'.join(index_lines)))
+
+    # description of format
+    head = text[:start]
+    head = re.sub(r'/\*\n \*  (character|symbol) bitmaps\n(.*?)\*/\n',
+                  '/*\n'
+                  ' *  \\1 bitmaps (run-length encoded)\n'
+                  ' *  - format:\n'
+                  ' *    - pixels read row by row (top to down, left to right)\n'
+                  ' *    - one byte per pair of runs:\n'
+                  ' *      bits 7-3: background pixels (0-31)\n'
+                  ' *      bits 2-0: foreground pixels (0-7)\n'
+                  ' *    - longer runs are continued by the next pair\n'
+                  ' */\n', head, count=1, flags=re.S)
+    head = re.sub(r'^/\* todo:.*\n', '', head, flags=re.M)
+
+    # guard and title
+    head = re.sub(r'#ifdef (\w+)', r'#ifdef \1_RLE', head, count=1)
+    head = re.sub(r'(\n \*   [^\n]*\n \*   [^\n]*)',
+                  r'\1\n *   run-length encoded (created by bitmap_rle.py)',
+                  head, count=1)
+
+    out = head + section + text[end:]
+    with open(args[1], 'w', encoding='latin-1') as f:
+        f.write(out)
+
+    count = sum(1 for item in items if not isinstance(item, str))
+    print('%s: %d -> %d bytes' % (os.path.basename(args[1]), raw,
+                                  packed + 2 * count))
+
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
@@ -0,0 +1,610 @@
+/* ************************************************************************
+ *
+ *   fixed 10x16 font based on ISO 8859-1
+ *   horizontally aligned, horizontal bit order flipped
+ *   run-length encoded (created by bitmap_rle.py)
+ *
+ *   (c) 2016-2018 by Markus Reschke
+ *
+ * ************************************************************************ */
+
+
+/* ************************************************************************
+ *   font data
+ * ************************************************************************ */
+
+#ifdef FONT_10X16_HF_RLE
+
+
+/* font size */
+#define FONT_SIZE_X         10     /* width:  10 dots */
+#define FONT_SIZE_Y         16     /* height: 16 dots */
+
+/* font data format */
+#define FONT_BYTES_N        32     /* 32 bytes per character */
+#define FONT_BYTES_X         2     /* 2 bytes in x direction */
+#define FONT_BYTES_Y        16     /* 16 bytes in y direction */
+
+
+/*
+ *  character bitmaps (run-length encoded)
+ *  - format:
+ *    - pixels read row by row (top to down, left to right)
+ *    - one byte per pair of runs:
+ *      bits 7-3: background pixels (0-31)
+ *      bits 2-0: foreground pixels (0-7)
+ *    - longer runs are continued by the next pair
+ */
+
+const uint8_t FontData[] PROGMEM = {
+  0xF8,0xF8,0xF8,0xF8,0xF8,0x28,                                                      /* 0x00 n/a */
+  0xA9,0x29,0x1A,0x21,0x1B,0x19,0x1C,0x11,0x1D,0x09,0x17,0x03,0x0D,0x09,0x1C,0x11,
+  0x1B,0x19,0x1A,0x21,0x19,0x29,0xF8,0x08,                                            /* 0x01 symbol: diode A-C */
+  0xA9,0x29,0x19,0x22,0x19,0x1B,0x19,0x14,0x19,0x0D,0x17,0x03,0x09,0x0D,0x19,0x14,
+  0x19,0x1B,0x19,0x22,0x19,0x29,0xF8,0x08,                                            /* 0x02 symbol: diode C-A */
+  0xAA,0x22,0x12,0x22,0x12,0x22,0x12,0x22,0x12,0x22,0x0B,0x23,0x0A,0x22,0x12,0x22,
+  0x12,0x22,0x12,0x22,0x12,0x22,0xF8,                                                 /* 0x03 symbol: capacitor */
+  0x6C,0x29,0x21,0x19,0x31,0x11,0x31,0x11,0x31,0x11,0x31,0x11,0x31,0x19,0x21,0x29,
+  0x11,0x31,0x11,0x31,0x11,0x22,0x22,0xF8,                                            /* 0x04 omega */
+  0xF8,0xA1,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x1A,0x1A,0x19,
+  0x0B,0x09,0x19,0x49,0x49,0x40,                                                      /* 0x05  (micro) */
+  0xAF,0x02,0x09,0x49,0x49,0x49,0x42,0x49,0x49,0x49,0x49,0x4F,0x02,0xF0,              /* 0x06 symbol: resistor left side */
+  0xA7,0x02,0x49,0x49,0x49,0x49,0x4A,0x41,0x49,0x49,0x49,0x0F,0x02,0xF8,              /* 0x07 symbol: resistor right side */
+  0x11,0x19,0xD9,0x43,0x39,0x09,0x39,0x11,0x29,0x19,0x29,0x21,0x1F,0x19,0x31,0x11,
+  0x31,0x09,0x41,0xF0,                                                                /* 0x08  */
+  0x11,0x19,0xD4,0x29,0x21,0x19,0x31,0x11,0x31,0x11,0x31,0x11,0x31,0x11,0x31,0x11,
+  0x31,0x19,0x21,0x2C,0xF8,0x10,                                                      /* 0x09  */
+  0x11,0x19,0xC1,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,
+  0x19,0x29,0x21,0x19,0x2C,0xF8,0x18,                                                 /* 0x0a  */
+  0x63,0x31,0x19,0x29,0x19,0x29,0x19,0x29,0x11,0x31,0x11,0x31,0x11,0x31,0x19,0x29,
+  0x21,0x21,0x29,0x19,0x29,0x19,0x13,0xF8,0x10,                                       /* 0x0b  */
+  0xB1,0x11,0xD4,0x51,0x49,0x34,0x29,0x19,0x21,0x21,0x21,0x1A,0x2B,0x0A,0xF8,0x08,    /* 0x0c  */
+  0xB1,0x11,0xDB,0x31,0x19,0x21,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x21,0x19,0x33,
+  0xF8,0x18,                                                                          /* 0x0d  */
+  0xB1,0x11,0xC9,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x1A,
+  0x2B,0x09,0xF8,0x10,                                                                /* 0x0e  */
+  0xF8,0xF8,0xF8,0xF8,0xF8,0x28,                                                      /* 0x0f n/a */
+  0xF8,0xF8,0xF8,0xF8,0xF8,0x28,                                                      /* 0x10 space */
+  0x71,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x99,0x49,0xF8,0x20,                   /* 0x11 ! */
+  0x61,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0xF8,0xF8,0xF8,0xA0,                        /* 0x12 " */
+  0x71,0x11,0x31,0x11,0x29,0x11,0x31,0x11,0x27,0x01,0x21,0x11,0x29,0x11,0x27,0x02,
+  0x19,0x11,0x31,0x11,0x29,0x11,0x31,0x11,0xF8,0x20,                                  /* 0x13 # */
+  0x29,0x3D,0x22,0x09,0x31,0x11,0x31,0x11,0x39,0x09,0x42,0x4A,0x43,0x39,0x09,0x39,
+  0x09,0x21,0x11,0x09,0x25,0x41,0xC0,                                                 /* 0x14 $ */
+  0x5B,0x2A,0x19,0x19,0x09,0x19,0x11,0x11,0x19,0x09,0x23,0x11,0x41,0x41,0x41,0x13,
+  0x21,0x09,0x19,0x11,0x11,0x19,0x09,0x19,0x1A,0x2B,0xF8,                             /* 0x15 % */
+  0x6B,0x31,0x19,0x29,0x19,0x29,0x12,0x33,0x32,0x39,0x11,0x22,0x1A,0x1A,0x21,0x11,
+  0x09,0x29,0x09,0x11,0x22,0x27,0xF8,                                                 /* 0x16 & */
+  0x71,0x49,0x49,0x49,0xF8,0xF8,0xF8,0xB0,                                            /* 0x17  */
+  0x8A,0x32,0x3A,0x41,0x41,0x49,0x49,0x49,0x49,0x49,0x51,0x4A,0x4A,0x52,0x58,         /* 0x18 ( */
+  0x5A,0x52,0x4A,0x49,0x51,0x49,0x49,0x49,0x49,0x49,0x41,0x42,0x3A,0x32,0x88,         /* 0x19 ) */
+  0x71,0x49,0x32,0x09,0x0A,0x22,0x0A,0x31,0x09,0x3B,0x39,0x09,0xF8,0xF8,0xB0,         /* 0x1a * */
+  0xF8,0xB9,0x49,0x49,0x49,0x2F,0x02,0x29,0x49,0x49,0xF8,0x20,                        /* 0x1b + */
+  0xF8,0xF8,0xF8,0xA2,0x42,0x49,0x49,0x41,0x30,                                       /* 0x1c , */
+  0xF8,0xF8,0xA6,0xF8,0xF8,0x50,                                                      /* 0x1d - */
+  0xF8,0xF8,0xF8,0xA2,0x42,0xF8,0x20,                                                 /* 0x1e . */
+  0x91,0x41,0x49,0x41,0x49,0x41,0x49,0x41,0x49,0x41,0x49,0x41,0x49,0x41,0x90,         /* 0x1f / */
+  0x6B,0x31,0x19,0x29,0x19,0x21,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,
+  0x29,0x21,0x19,0x29,0x19,0x33,0xF8,0x18,                                            /* 0x20 0 */
+  0x71,0x34,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x37,0xF8,0x08,              /* 0x21 1 */
+  0x5D,0x29,0x21,0x49,0x49,0x49,0x41,0x49,0x41,0x41,0x41,0x41,0x4E,0xF8,0x10,         /* 0x22 2 */
+  0x64,0x51,0x49,0x49,0x49,0x33,0x51,0x49,0x49,0x49,0x49,0x2C,0xF8,0x18,              /* 0x23 3 */
+  0x79,0x42,0x39,0x09,0x39,0x09,0x31,0x11,0x29,0x19,0x29,0x19,0x21,0x21,0x27,0x01,
+  0x39,0x49,0x49,0xF8,0x18,                                                           /* 0x24 4 */
+  0x65,0x29,0x49,0x49,0x4B,0x51,0x51,0x49,0x49,0x49,0x41,0x33,0xF8,0x20,              /* 0x25 5 */
+  0x6C,0x29,0x49,0x41,0x49,0x0B,0x2A,0x19,0x21,0x29,0x19,0x29,0x19,0x29,0x19,0x29,
+  0x21,0x19,0x33,0xF8,0x18,                                                           /* 0x26 6 */
+  0x5F,0x49,0x41,0x41,0x49,0x41,0x49,0x41,0x49,0x49,0x41,0x49,0xF8,0x30,              /* 0x27 7 */
+  0x65,0x21,0x29,0x19,0x29,0x19,0x29,0x21,0x12,0x32,0x39,0x12,0x21,0x21,0x21,0x29,
+  0x19,0x29,0x19,0x21,0x2C,0xF8,0x18,                                                 /* 0x28 8 */
+  0x6B,0x31,0x19,0x21,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x21,0x1A,0x2B,0x09,0x49,
+  0x41,0x49,0x2C,0xF8,0x18,                                                           /* 0x29 9 */
+  0xF8,0xB2,0x42,0xF8,0x8A,0x42,0xF8,0x20,                                            /* 0x2a : */
+  0xF8,0xB2,0x42,0xF8,0x8A,0x42,0x49,0x49,0x41,0x30,                                  /* 0x2b ; */
+  0xF8,0xD9,0x3A,0x32,0x32,0x42,0x52,0x52,0x51,0xF8,                                  /* 0x2c < */
+  0xF8,0xF8,0x4F,0x01,0xB7,0x01,0xF8,0xA0,                                            /* 0x2d = */
+  0xF8,0xA1,0x52,0x52,0x52,0x42,0x32,0x32,0x39,0xF8,0x38,                             /* 0x2e > */
+  0x5E,0x21,0x22,0x19,0x29,0x49,0x41,0x41,0x41,0x41,0x49,0x99,0x49,0xF8,0x28,         /* 0x2f ? */
+  0x6C,0x29,0x21,0x19,0x1B,0x12,0x11,0x11,0x11,0x11,0x19,0x11,0x11,0x19,0x11,0x11,
+  0x12,0x11,0x11,0x12,0x11,0x11,0x0B,0x19,0x12,0x0B,0x0A,0x19,0x2D,0xF8,0x10,         /* 0x30 @ */
+  0xF8,0x19,0x43,0x39,0x09,0x39,0x11,0x29,0x19,0x29,0x21,0x1F,0x19,0x31,0x11,0x31,
+  0x09,0x41,0xF0,                                                                     /* 0x31 A */
+  0xFE,0x21,0x29,0x19,0x29,0x19,0x21,0x25,0x29,0x21,0x21,0x29,0x19,0x29,0x19,0x29,
+  0x1E,0xF8,0x10,                                                                     /* 0x32 B */
+  0xF8,0x15,0x1A,0x21,0x19,0x41,0x49,0x49,0x49,0x51,0x4A,0x55,0xF8,0x08,              /* 0x33 C */
+  0xFD,0x29,0x21,0x21,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,
+  0x21,0x25,0xF8,0x18,                                                                /* 0x34 D */
+  0xFF,0x19,0x49,0x49,0x49,0x4E,0x21,0x49,0x49,0x4F,0xF8,0x08,                        /* 0x35 E */
+  0xFF,0x19,0x49,0x49,0x49,0x4E,0x21,0x49,0x49,0x49,0xF8,0x38,                        /* 0x36 F */
+  0xF8,0x1D,0x1A,0x21,0x19,0x41,0x49,0x49,0x23,0x11,0x31,0x19,0x29,0x1A,0x21,0x2D,
+  0xF8,                                                                               /* 0x37 G */
+  0xF9,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x1F,0x19,0x29,0x19,0x29,0x19,
+  0x29,0x19,0x29,0xF8,0x08,                                                           /* 0x38 H */
+  0xFF,0x31,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x37,0xF8,0x08,                        /* 0x39 I */
+  0xF8,0x14,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x2C,0xF8,0x18,                   /* 0x3a J */
+  0xF9,0x29,0x19,0x21,0x21,0x19,0x29,0x11,0x33,0x39,0x09,0x39,0x11,0x31,0x1A,0x21,
+  0x29,0x19,0x31,0xF8,                                                                /* 0x3b K */
+  0xF9,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x4F,0xF8,0x08,                        /* 0x3c L */
+  0xF2,0x22,0x12,0x22,0x13,0x1A,0x11,0x09,0x11,0x09,0x11,0x09,0x11,0x09,0x11,0x0A,
+  0x09,0x09,0x11,0x12,0x11,0x11,0x12,0x11,0x11,0x31,0x11,0x31,0xF8,0x08,              /* 0x3d M */
+  0xF9,0x29,0x1A,0x21,0x19,0x09,0x19,0x19,0x09,0x19,0x19,0x11,0x11,0x19,0x11,0x11,
+  0x19,0x19,0x09,0x19,0x19,0x09,0x19,0x22,0x19,0x29,0xF8,0x08,                        /* 0x3e N */
+  0xF8,0x14,0x29,0x21,0x19,0x31,0x11,0x31,0x11,0x31,0x11,0x31,0x11,0x31,0x11,0x31,
+  0x19,0x21,0x2C,0xF8,0x10,                                                           /* 0x3f O */
+  0xFE,0x21,0x29,0x19,0x29,0x19,0x29,0x19,0x21,0x25,0x29,0x49,0x49,0x49,0xF8,0x38,    /* 0x40 P */
+  0xF8,0x14,0x29,0x21,0x19,0x31,0x11,0x31,0x11,0x31,0x11,0x31,0x11,0x31,0x11,0x31,
+  0x19,0x21,0x2C,0x49,0x52,0x58,                                                      /* 0x41 Q */
+  0xFD,0x29,0x21,0x21,0x21,0x21,0x21,0x21,0x19,0x2C,0x31,0x11,0x31,0x19,0x29,0x21,
+  0x21,0x29,0xF8,0x08,                                                                /* 0x42 R */
+  0xF8,0x0E,0x19,0x29,0x19,0x4A,0x52,0x52,0x51,0x49,0x19,0x22,0x1D,0xF8,0x18,         /* 0x43 S */
+  0xF7,0x02,0x29,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0xF8,0x20,                   /* 0x44 T */
+  0xF9,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,
+  0x21,0x19,0x2C,0xF8,0x18,                                                           /* 0x45 U */
+  0xF1,0x41,0x09,0x31,0x11,0x31,0x19,0x21,0x21,0x21,0x21,0x19,0x31,0x11,0x31,0x11,
+  0x3A,0x42,0xF8,0x18,                                                                /* 0x46 V */
+  0xF1,0x42,0x41,0x09,0x11,0x19,0x11,0x12,0x11,0x11,0x12,0x11,0x11,0x09,0x09,0x11,
+  0x11,0x09,0x11,0x09,0x1A,0x12,0x22,0x12,0x21,0x21,0xF8,0x08,                        /* 0x47 W */
+  0xF1,0x41,0x09,0x31,0x19,0x21,0x29,0x11,0x3A,0x42,0x39,0x11,0x29,0x21,0x19,0x31,
+  0x09,0x41,0xF0,                                                                     /* 0x48 X */
+  0xF1,0x41,0x09,0x31,0x19,0x21,0x21,0x19,0x31,0x09,0x41,0x49,0x49,0x49,0x49,0xF8,
+  0x20,                                                                               /* 0x49 Y */
+  0xFF,0x01,0x49,0x41,0x41,0x41,0x41,0x41,0x41,0x41,0x4F,0x01,0xF8,                   /* 0x4a Z */
+  0x6D,0x29,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x4D,0x60,         /* 0x4b [ */
+  0x59,0x51,0x49,0x51,0x49,0x51,0x49,0x51,0x49,0x51,0x49,0x51,0x49,0x51,0x58,         /* 0x4c \ */
+  0x5D,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x2D,0x70,         /* 0x4d ] */
+  0x79,0x49,0x42,0x41,0x09,0x32,0x09,0x31,0x11,0x31,0x19,0x21,0x21,0x21,0x21,0x19,
+  0x31,0xF8,0xA0,                                                                     /* 0x4e ^ */
+  0xF8,0xF8,0xF8,0xF8,0x37,0x03,0xA0,                                                 /* 0x4f _ */
+  0x21,0x51,0xF8,0xF8,0xF8,0xF8,0xA0,                                                 /* 0x50 ` */
+  0xF8,0xAC,0x51,0x49,0x34,0x29,0x19,0x21,0x21,0x21,0x1A,0x2B,0x0A,0xF8,0x08,         /* 0x51 a */
+  0x59,0x49,0x49,0x49,0x49,0x0C,0x22,0x19,0x21,0x29,0x19,0x29,0x19,0x29,0x19,0x29,
+  0x1A,0x19,0x21,0x0B,0xF8,0x18,                                                      /* 0x52 b */
+  0xF8,0xB5,0x21,0x41,0x49,0x49,0x49,0x51,0x55,0xF8,0x08,                             /* 0x53 c */
+  0x89,0x49,0x49,0x49,0x2B,0x09,0x21,0x1A,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,
+  0x21,0x1A,0x24,0x09,0xF8,0x08,                                                      /* 0x54 d */
+  0xF8,0xB4,0x29,0x21,0x19,0x29,0x1F,0x19,0x49,0x51,0x55,0xF8,0x08,                   /* 0x55 e */
+  0x7C,0x22,0x41,0x49,0x3F,0x01,0x21,0x49,0x49,0x49,0x49,0x49,0x49,0xF8,0x28,         /* 0x56 f */
+  0xF8,0xB3,0x09,0x21,0x1A,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x21,0x1A,0x24,
+  0x09,0x49,0x41,0x2C,0x20,                                                           /* 0x57 g */
+  0x59,0x49,0x49,0x49,0x49,0x13,0x21,0x09,0x19,0x1A,0x21,0x19,0x29,0x19,0x29,0x19,
+  0x29,0x19,0x29,0x19,0x29,0xF8,0x08,                                                 /* 0x58 h */
+  0x6A,0x42,0xD4,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0xF8,0x20,                        /* 0x59 i */
+  0x72,0x42,0xD4,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x2C,0x28,              /* 0x5a j */
+  0x59,0x49,0x49,0x49,0x49,0x29,0x19,0x1A,0x21,0x11,0x33,0x39,0x09,0x39,0x12,0x29,
+  0x21,0x21,0x29,0xF8,0x08,                                                           /* 0x5b k */
+  0x64,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0xF8,0x18,              /* 0x5c l */
+  0xF8,0x99,0x0A,0x12,0x12,0x12,0x11,0x09,0x19,0x19,0x09,0x19,0x19,0x09,0x19,0x19,
+  0x09,0x19,0x19,0x09,0x19,0x19,0x09,0x19,0x19,0xF8,                                  /* 0x5d m */
+  0xF8,0xA1,0x13,0x23,0x19,0x1A,0x21,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x19,
+  0x29,0xF8,0x08,                                                                     /* 0x5e n */
+  0xF8,0xB3,0x31,0x19,0x21,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x21,0x19,0x33,0xF8,
+  0x18,                                                                               /* 0x5f o */
+  0xF8,0xA1,0x0C,0x22,0x19,0x21,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x1A,0x19,0x21,
+  0x0B,0x29,0x49,0x49,0x40,                                                           /* 0x60 p */
+  0xF8,0xB3,0x09,0x21,0x1A,0x19,0x29,0x19,0x29,0x19,0x29,0x19,0x29,0x21,0x1A,0x24,
+  0x09,0x49,0x49,0x49,0x10,                                                           /* 0x61 q */
+  0xF8,0xA9,0x13,0x21,0x09,0x11,0x22,0x19,0x21,0x49,0x49,0x49,0x49,0xF8,0x30,         /* 0x62 r */
+  0xF8,0xAD,0x21,0x49,0x52,0x52,0x51,0x21,0x21,0x25,0xF8,0x18,                        /* 0x63 s */
+  0xF8,0x11,0x49,0x3F,0x29,0x49,0x49,0x49,0x49,0x49,0x54,0xF8,0x08,                   /* 0x64 t */
+  0xF8,0xA1,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x1A,0x2B,
+  0x09,0xF8,0x10,                                                                     /* 0x65 u */
+  0xF8,0x99,0x39,0x11,0x29,0x19,0x29,0x19,0x21,0x29,0x19,0x29,0x11,0x39,0x09,0x3A,
+  0xF8,0x20,                                                                          /* 0x66 v */
+  0xF8,0x99,0x42,0x19,0x21,0x09,0x12,0x11,0x11,0x12,0x11,0x11,0x09,0x11,0x09,0x11,
+  0x09,0x11,0x09,0x1A,0x12,0x21,0x21,0xF8,0x08,                                       /* 0x67 w */
+  0xF8,0xA1,0x31,0x19,0x21,0x29,0x11,0x3A,0x42,0x39,0x11,0x29,0x21,0x19,0x31,0xF8,    /* 0x68 x */
+  0xF8,0x99,0x41,0x09,0x31,0x11,0x31,0x19,0x21,0x22,0x11,0x31,0x11,0x3A,0x42,0x41,
+  0x41,0x33,0x38,                                                                     /* 0x69 y */
+  0xF8,0xA7,0x01,0x41,0x41,0x41,0x41,0x41,0x41,0x47,0x01,0xF8,                        /* 0x6a z */
+  0x7B,0x31,0x49,0x49,0x49,0x49,0x49,0x3A,0x51,0x49,0x49,0x49,0x49,0x53,0x60,         /* 0x6b { */
+  0x71,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x78,         /* 0x6c | */
+  0x63,0x51,0x49,0x49,0x49,0x49,0x49,0x52,0x39,0x49,0x49,0x49,0x49,0x33,0x78,         /* 0x6d } */
+  0xF8,0xF8,0x4B,0x2A,0x1A,0x1A,0x2B,0xF8,0xF0,                                       /* 0x6e ~ */
+};
+
+
+/*
+ *  offset of each bitmap in FontData[]
+ */
+
+const uint16_t FontIndex[] PROGMEM = {
+  0,          /* 0x00 n/a */
+  6,          /* 0x01 symbol: diode A-C */
+  30,         /* 0x02 symbol: diode C-A */
+  54,         /* 0x03 symbol: capacitor */
+  77,         /* 0x04 omega */
+  101,        /* 0x05  (micro) */
+  123,        /* 0x06 symbol: resistor left side */
+  137,        /* 0x07 symbol: resistor right side */
+  151,        /* 0x08  */
+  171,        /* 0x09  */
+  193,        /* 0x0a  */
+  216,        /* 0x0b  */
+  241,        /* 0x0c  */
+  257,        /* 0x0d  */
+  275,        /* 0x0e  */
+  295,        /* 0x0f n/a */
+  301,        /* 0x10 space */
+  307,        /* 0x11 ! */
+  320,        /* 0x12 " */
+  332,        /* 0x13 # */
+  358,        /* 0x14 $ */
+  381,        /* 0x15 % */
+  408,        /* 0x16 & */
+  431,        /* 0x17  */
+  439,        /* 0x18 ( */
+  454,        /* 0x19 ) */
+  469,        /* 0x1a * */
+  484,        /* 0x1b + */
+  496,        /* 0x1c , */
+  505,        /* 0x1d - */
+  511,        /* 0x1e . */
+  518,        /* 0x1f / */
+  533,        /* 0x20 0 */
+  557,        /* 0x21 1 */
+  571,        /* 0x22 2 */
+  586,        /* 0x23 3 */
+  600,        /* 0x24 4 */
+  621,        /* 0x25 5 */
+  635,        /* 0x26 6 */
+  656,        /* 0x27 7 */
+  670,        /* 0x28 8 */
+  693,        /* 0x29 9 */
+  714,        /* 0x2a : */
+  722,        /* 0x2b ; */
+  732,        /* 0x2c < */
+  742,        /* 0x2d = */
+  750,        /* 0x2e > */
+  761,        /* 0x2f ? */
+  776,        /* 0x30 @ */
+  807,        /* 0x31 A */
+  826,        /* 0x32 B */
+  845,        /* 0x33 C */
+  859,        /* 0x34 D */
+  879,        /* 0x35 E */
+  891,        /* 0x36 F */
+  903,        /* 0x37 G */
+  920,        /* 0x38 H */
+  941,        /* 0x39 I */
+  953,        /* 0x3a J */
+  966,        /* 0x3b K */
+  986,        /* 0x3c L */
+  998,        /* 0x3d M */
+  1028,       /* 0x3e N */
+  1056,       /* 0x3f O */
+  1077,       /* 0x40 P */
+  1093,       /* 0x41 Q */
+  1115,       /* 0x42 R */
+  1135,       /* 0x43 S */
+  1150,       /* 0x44 T */
+  1163,       /* 0x45 U */
+  1184,       /* 0x46 V */
+  1204,       /* 0x47 W */
+  1232,       /* 0x48 X */
+  1251,       /* 0x49 Y */
+  1268,       /* 0x4a Z */
+  1281,       /* 0x4b [ */
+  1296,       /* 0x4c \ */
+  1311,       /* 0x4d ] */
+  1326,       /* 0x4e ^ */
+  1345,       /* 0x4f _ */
+  1352,       /* 0x50 ` */
+  1359,       /* 0x51 a */
+  1374,       /* 0x52 b */
+  1396,       /* 0x53 c */
+  1407,       /* 0x54 d */
+  1429,       /* 0x55 e */
+  1442,       /* 0x56 f */
+  1457,       /* 0x57 g */
+  1478,       /* 0x58 h */
+  1501,       /* 0x59 i */
+  1513,       /* 0x5a j */
+  1527,       /* 0x5b k */
+  1548,       /* 0x5c l */
+  1562,       /* 0x5d m */
+  1588,       /* 0x5e n */
+  1607,       /* 0x5f o */
+  1624,       /* 0x60 p */
+  1645,       /* 0x61 q */
+  1666,       /* 0x62 r */
+  1681,       /* 0x63 s */
+  1693,       /* 0x64 t */
+  1706,       /* 0x65 u */
+  1725,       /* 0x66 v */
+  1743,       /* 0x67 w */
+  1768,       /* 0x68 x */
+  1784,       /* 0x69 y */
+  1803,       /* 0x6a z */
+  1815,       /* 0x6b { */
+  1830,       /* 0x6c | */
+  1845,       /* 0x6d } */
+  1860,       /* 0x6e ~ */
+};
+
+
+/*
+ *  font lookup table for ISO 8859-1
+ *  - 8 bit ISO 8859-1 to custom font
+ *  - ff: no bitmap available
+ */
+
+const uint8_t FontTable[] PROGMEM = {
+  0xff,        /* 0x00 -> n/a */
+  0x01,        /* 0x01 -> symbol: diode A-C */
+  0x02,        /* 0x02 -> symbol: diode C-A */
+  0x03,        /* 0x03 -> symbol: capacitor */
+  0x04,        /* 0x04 -> omega */
+  0x05,        /* 0x05 ->  (micro) */
+  0x06,        /* 0x06 -> symbol: resistor left side */
+  0x07,        /* 0x07 -> symbol: resistor right side */
+  0xff,        /* 0x08 -> n/a */
+  0xff,        /* 0x09 -> n/a */
+  0xff,        /* 0x0a -> n/a */
+  0xff,        /* 0x0b -> n/a */
+  0xff,        /* 0x0c -> n/a */
+  0xff,        /* 0x0d -> n/a */
+  0xff,        /* 0x0e -> n/a */
+  0xff,        /* 0x0f -> n/a */
+
+  0xff,        /* 0x10 -> n/a */
+  0xff,        /* 0x11 -> n/a */
+  0xff,        /* 0x12 -> n/a */
+  0xff,        /* 0x13 -> n/a */
+  0xff,        /* 0x14 -> n/a */
+  0xff,        /* 0x15 -> n/a */
+  0xff,        /* 0x16 -> n/a */
+  0xff,        /* 0x17 -> n/a */
+  0xff,        /* 0x18 -> n/a */
+  0xff,        /* 0x19 -> n/a */
+  0xff,        /* 0x1a -> n/a */
+  0xff,        /* 0x1b -> n/a */
+  0xff,        /* 0x1c -> n/a */
+  0xff,        /* 0x1d -> n/a */
+  0xff,        /* 0x1e -> n/a */
+  0xff,        /* 0x1f -> n/a */
+
+  0x10,        /* 0x20 -> space */
+  0x11,        /* 0x21 -> ! */
+  0x12,        /* 0x22 -> " */
+  0x13,        /* 0x23 -> # */
+  0x14,        /* 0x24 -> $ */
+  0x15,        /* 0x25 -> % */
+  0x16,        /* 0x26 -> & */
+  0x17,        /* 0x27 ->  */
+  0x18,        /* 0x28 -> ( */
+  0x19,        /* 0x29 -> ) */
+  0x1a,        /* 0x2a -> * */
+  0x1b,        /* 0x2b -> + */
+  0x1c,        /* 0x2c -> , */
+  0x1d,        /* 0x2d -> - */
+  0x1e,        /* 0x2e -> . */
+  0x1f,        /* 0x2f -> / */
+
+  0x20,        /* 0x30 -> 0 */
+  0x21,        /* 0x31 -> 1 */
+  0x22,        /* 0x32 -> 2 */
+  0x23,        /* 0x33 -> 3 */
+  0x24,        /* 0x34 -> 4 */
+  0x25,        /* 0x35 -> 5 */
+  0x26,        /* 0x36 -> 6 */
+  0x27,        /* 0x37 -> 7 */
+  0x28,        /* 0x38 -> 8 */
+  0x29,        /* 0x39 -> 9 */
+  0x2a,        /* 0x3a -> : */
+  0x2b,        /* 0x3b -> ; */
+  0x2c,        /* 0x3c -> < */
+  0x2d,        /* 0x3d -> = */
+  0x2e,        /* 0x3e -> > */
+  0x2f,        /* 0x3f -> ? */
+
+  0x30,        /* 0x40 -> @ */
+  0x31,        /* 0x41 -> A */
+  0x32,        /* 0x42 -> B */
+  0x33,        /* 0x43 -> C */
+  0x34,        /* 0x44 -> D */
+  0x35,        /* 0x45 -> E */
+  0x36,        /* 0x46 -> F */
+  0x37,        /* 0x47 -> G */
+  0x38,        /* 0x48 -> H */
+  0x39,        /* 0x49 -> I */
+  0x3a,        /* 0x4a -> J */
+  0x3b,        /* 0x4b -> K */
+  0x3c,        /* 0x4c -> L */
+  0x3d,        /* 0x4d -> M */
+  0x3e,        /* 0x4e -> N */
+  0x3f,        /* 0x4f -> O */
+
+  0x40,        /* 0x50 -> P */
+  0x41,        /* 0x51 -> Q */
+  0x42,        /* 0x52 -> R */
+  0x43,        /* 0x53 -> S */
+  0x44,        /* 0x54 -> T */
+  0x45,        /* 0x55 -> U */
+  0x46,        /* 0x56 -> V */
+  0x47,        /* 0x57 -> W */
+  0x48,        /* 0x58 -> X */
+  0x49,        /* 0x59 -> Y */
+  0x4a,        /* 0x5a -> Z */
+  0x4b,        /* 0x5b -> [ */
+  0x4c,        /* 0x5c -> \ */
+  0x4d,        /* 0x5d -> ] */
+  0x4e,        /* 0x5e -> ^ */
+  0x4f,        /* 0x5f -> _ */
+
+  0x50,        /* 0x60 -> ` */
+  0x51,        /* 0x61 -> a */
+  0x52,        /* 0x62 -> b */
+  0x53,        /* 0x63 -> c */
+  0x54,        /* 0x64 -> d */
+  0x55,        /* 0x65 -> e */
+  0x56,        /* 0x66 -> f */
+  0x57,        /* 0x67 -> g */
+  0x58,        /* 0x68 -> h */
+  0x59,        /* 0x69 -> i */
+  0x5a,        /* 0x6a -> j */
+  0x5b,        /* 0x6b -> k */
+  0x5c,        /* 0x6c -> l */
+  0x5d,        /* 0x6d -> m */
+  0x5e,        /* 0x6e -> n */
+  0x5f,        /* 0x6f -> o */
+
+  0x60,        /* 0x70 -> p */
+  0x61,        /* 0x71 -> q */
+  0x62,        /* 0x72 -> r */
+  0x63,        /* 0x73 -> s */
+  0x64,        /* 0x74 -> t */
+  0x65,        /* 0x75 -> u */
+  0x66,        /* 0x76 -> v */
+  0x67,        /* 0x77 -> w */
+  0x68,        /* 0x78 -> x */
+  0x69,        /* 0x79 -> y */
+  0x6a,        /* 0x7a -> z */
+  0x6b,        /* 0x7b -> { */
+  0x6c,        /* 0x7c -> | */
+  0x6d,        /* 0x7d -> } */
+  0x6e,        /* 0x7e -> ~ */
+  0xff,        /* 0x7f -> n/a */
+
+  0xff,        /* 0x80 -> n/a */
+  0xff,        /* 0x81 -> n/a */
+  0xff,        /* 0x82 -> n/a */
+  0xff,        /* 0x83 -> n/a */
+  0xff,        /* 0x84 -> n/a */
+  0xff,        /* 0x85 -> n/a */
+  0xff,        /* 0x86 -> n/a */
+  0xff,        /* 0x87 -> n/a */
+  0xff,        /* 0x88 -> n/a */
+  0xff,        /* 0x89 -> n/a */
+  0xff,        /* 0x8a -> n/a */
+  0xff,        /* 0x8b -> n/a */
+  0xff,        /* 0x8c -> n/a */
+  0xff,        /* 0x8d -> n/a */
+  0xff,        /* 0x8e -> n/a */
+  0xff,        /* 0x8f -> n/a */
+
+  0xff,        /* 0x90 -> n/a */
+  0xff,        /* 0x91 -> n/a */
+  0xff,        /* 0x92 -> n/a */
+  0xff,        /* 0x93 -> n/a */
+  0xff,        /* 0x94 -> n/a */
+  0xff,        /* 0x95 -> n/a */
+  0xff,        /* 0x96 -> n/a */
+  0xff,        /* 0x97 -> n/a */
+  0xff,        /* 0x98 -> n/a */
+  0xff,        /* 0x99 -> n/a */
+  0xff,        /* 0x9a -> n/a */
+  0xff,        /* 0x9b -> n/a */
+  0xff,        /* 0x9c -> n/a */
+  0xff,        /* 0x9d -> n/a */
+  0xff,        /* 0x9e -> n/a */
+  0xff,        /* 0x9f -> n/a */
+
+  0xff,        /* 0xa0 -> n/a */
+  0xff,        /* 0xa1 -> n/a */
+  0xff,        /* 0xa2 -> n/a */
+  0xff,        /* 0xa3 -> n/a */
+  0xff,        /* 0xa4 -> n/a */
+  0xff,        /* 0xa5 -> n/a */
+  0xff,        /* 0xa6 -> n/a */
+  0xff,        /* 0xa7 -> n/a */
+  0xff,        /* 0xa8 -> n/a */
+  0xff,        /* 0xa9 -> n/a */
+  0xff,        /* 0xaa -> n/a */
+  0xff,        /* 0xab -> n/a */
+  0xff,        /* 0xac -> n/a */
+  0xff,        /* 0xad -> n/a */
+  0xff,        /* 0xae -> n/a */
+  0xff,        /* 0xaf -> n/a */
+
+  0xff,        /* 0xb0 -> n/a */
+  0xff,        /* 0xb1 -> n/a */
+  0xff,        /* 0xb2 -> n/a */
+  0xff,        /* 0xb3 -> n/a */
+  0xff,        /* 0xb4 -> n/a */
+  0x05,        /* 0xb5 ->  (micro) */
+  0xff,        /* 0xb6 -> n/a */
+  0xff,        /* 0xb7 -> n/a */
+  0xff,        /* 0xb8 -> n/a */
+  0xff,        /* 0xb9 -> n/a */
+  0xff,        /* 0xba -> n/a */
+  0xff,        /* 0xbb -> n/a */
+  0xff,        /* 0xbc -> n/a */
+  0xff,        /* 0xbd -> n/a */
+  0xff,        /* 0xbe -> n/a */
+  0xff,        /* 0xbf -> n/a */
+
+  0xff,        /* 0xc0 -> n/a */
+  0xff,        /* 0xc1 -> n/a */
+  0xff,        /* 0xc2 -> n/a */
+  0xff,        /* 0xc3 -> n/a */
+  0x08,        /* 0xc4 ->  */
+  0xff,        /* 0xc5 -> n/a */
+  0xff,        /* 0xc6 -> n/a */
+  0xff,        /* 0xc7 -> n/a */
+  0xff,        /* 0xc8 -> n/a */
+  0xff,        /* 0xc9 -> n/a */
+  0xff,        /* 0xca -> n/a */
+  0xff,        /* 0xcb -> n/a */
+  0xff,        /* 0xcc -> n/a */
+  0xff,        /* 0xcd -> n/a */
+  0xff,        /* 0xce -> n/a */
+  0xff,        /* 0xcf -> n/a */
+
+  0xff,        /* 0xd0 -> n/a */
+  0xff,        /* 0xd1 -> n/a */
+  0xff,        /* 0xd2 -> n/a */
+  0xff,        /* 0xd3 -> n/a */
+  0xff,        /* 0xd4 -> n/a */
+  0xff,        /* 0xd5 -> n/a */
+  0x09,        /* 0xd6 ->  */
+  0xff,        /* 0xd7 -> n/a */
+  0xff,        /* 0xd8 -> n/a */
+  0xff,        /* 0xd9 -> n/a */
+  0xff,        /* 0xda -> n/a */
+  0xff,        /* 0xdb -> n/a */
+  0x0a,        /* 0xdc ->  */
+  0xff,        /* 0xdd -> n/a */
+  0xff,        /* 0xde -> n/a */
+  0x0b,        /* 0xdf ->  */
+
+  0xff,        /* 0xe0 -> n/a */
+  0xff,        /* 0xe1 -> n/a */
+  0xff,        /* 0xe2 -> n/a */
+  0xff,        /* 0xe3 -> n/a */
+  0x0c,        /* 0xe4 ->  */
+  0xff,        /* 0xe5 -> n/a */
+  0xff,        /* 0xe6 -> n/a */
+  0xff,        /* 0xe7 -> n/a */
+  0xff,        /* 0xe8 -> n/a */
+  0xff,        /* 0xe9 -> n/a */
+  0xff,        /* 0xea -> n/a */
+  0xff,        /* 0xeb -> n/a */
+  0xff,        /* 0xec -> n/a */
+  0xff,        /* 0xed -> n/a */
+  0xff,        /* 0xee -> n/a */
+  0xff,        /* 0xef -> n/a */
+
+  0xff,        /* 0xf0 -> n/a */
+  0xff,        /* 0xf1 -> n/a */
+  0xff,        /* 0xf2 -> n/a */
+  0xff,        /* 0xf3 -> n/a */
+  0xff,        /* 0xf4 -> n/a */
+  0xff,        /* 0xf5 -> n/a */
+  0x0d,        /* 0xf6 ->  */
+  0xff,        /* 0xf7 -> n/a */
+  0xff,        /* 0xf8 -> n/a */
+  0xff,        /* 0xf9 -> n/a */
+  0xff,        /* 0xfa -> n/a */
+  0xff,        /* 0xfb -> n/a */
+  0x0e,        /* 0xfc ->  */
+  0xff,        /* 0xfd -> n/a */
+  0xff,        /* 0xfe -> n/a */
+  0xff,        /* 0xff -> n/a */
+};
+
+
+#endif
+
+/* ************************************************************************
+ *   EOF
+ * ************************************************************************ */
@@ -0,0 +1,633 @@
+/* ************************************************************************
+ *
+ *   fixed 12x16 font based on ISO 8859-1
+ *   horizontally aligned, horizontal bit order flipped
+ *   run-length encoded (created by bitmap_rle.py)
+ *
+ *   (c) 2015-2018 by Markus Reschke
+ *
+ * ************************************************************************ */
+
+
+/* ************************************************************************
+ *   font data
+ * ************************************************************************ */
+
+#ifdef FONT_12X16_HF_RLE
+
+
+/* font size */
+#define FONT_SIZE_X         12     /* width:  12 dots */
+#define FONT_SIZE_Y         16     /* height: 16 dots */
+
+/* font data format */
+#define FONT_BYTES_N        32     /* 32 bytes per character */
+#define FONT_BYTES_X         2     /* 2 bytes in x direction */
+#define FONT_BYTES_Y        16     /* 16 bytes in y direction */
+
+
+/*
+ *  character bitmaps (run-length encoded)
+ *  - format:
+ *    - pixels read row by row (top to down, left to right)
+ *    - one byte per pair of runs:
+ *      bits 7-3: background pixels (0-31)
+ *      bits 2-0: foreground pixels (0-7)
+ *    - longer runs are continued by the next pair
+ */
+
+const uint8_t FontData[] PROGMEM = {
+  0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0x30,                                                 /* 0x00 n/a */
+  0x6B,0x31,0x13,0x2A,0x13,0x23,0x13,0x1C,0x13,0x15,0x13,0x0E,0x0F,0x07,0x07,0x03,
+  0x0B,0x0E,0x13,0x15,0x13,0x1C,0x13,0x23,0x13,0x2A,0x13,0x31,0x68,                   /* 0x01 symbol: diode A-C */
+  0x6B,0x31,0x13,0x2A,0x13,0x23,0x13,0x1C,0x13,0x15,0x13,0x0E,0x0F,0x07,0x07,0x03,
+  0x0B,0x0E,0x13,0x15,0x13,0x1C,0x13,0x23,0x13,0x2A,0x13,0x31,0x68,                   /* 0x02 symbol: diode C-A */
+  0x6B,0x23,0x13,0x23,0x13,0x23,0x13,0x23,0x13,0x23,0x13,0x23,0x0C,0x27,0x01,0x24,
+  0x0B,0x23,0x13,0x23,0x13,0x23,0x13,0x23,0x13,0x23,0x13,0x23,0x68,                   /* 0x03 symbol: capacitor */
+  0x25,0x37,0x23,0x1B,0x1A,0x2A,0x12,0x3A,0x0A,0x3A,0x0A,0x3A,0x0A,0x3A,0x0A,0x3A,
+  0x12,0x2A,0x22,0x1A,0x2A,0x1A,0x1C,0x1C,0x0C,0x1C,0xC0,                             /* 0x04 omega */
+  0xF8,0x92,0x2A,0x1A,0x2A,0x1A,0x2A,0x1A,0x2A,0x1A,0x2A,0x1B,0x1B,0x1F,0x02,0x1E,
+  0x0A,0x1A,0x52,0x52,0x52,0x48,                                                      /* 0x05  (micro) */
+  0xCF,0x04,0x0F,0x04,0x0A,0x52,0x52,0x4B,0x4B,0x52,0x52,0x52,0x57,0x04,0x0F,0x04,
+  0xC0,                                                                               /* 0x06 symbol: resistor left side */
+  0xC7,0x04,0x0F,0x04,0x52,0x52,0x52,0x53,0x4B,0x4A,0x52,0x52,0x0F,0x04,0x0F,0x04,
+  0xC8,                                                                               /* 0x07 symbol: resistor right side */
+  0xF8,0x9A,0x22,0x2A,0x12,0x3C,0x4A,0x4C,0x3A,0x12,0x2A,0x22,0xF8,0xF8,              /* 0x08  */
+  0x1A,0x12,0x32,0x12,0x96,0x2F,0x01,0x1B,0x23,0x12,0x32,0x12,0x32,0x12,0x32,0x12,
+  0x32,0x12,0x32,0x13,0x23,0x1F,0x01,0x2E,0xD8,                                       /* 0x09  */
+  0xDA,0x12,0x32,0x12,0x82,0x32,0x12,0x32,0x12,0x32,0x12,0x32,0x12,0x32,0x12,0x32,
+  0x13,0x23,0x1F,0x02,0x25,0x0A,0xC8,                                                 /* 0x0a  (seems to be ) */
+  0xF8,0xAC,0x3A,0x12,0x2A,0x22,0x22,0x22,0x27,0x2A,0x1B,0x22,0x22,0x22,0x22,0x22,
+  0x1B,0x27,0x2A,0x52,0x40,                                                           /* 0x0b  */
+  0xDA,0x12,0x32,0x12,0x97,0x27,0x02,0x52,0x27,0x01,0x1F,0x02,0x12,0x32,0x12,0x32,
+  0x17,0x03,0x1F,0x02,0xC8,                                                           /* 0x0c  */
+  0xDA,0x12,0x32,0x12,0x96,0x2F,0x01,0x1B,0x23,0x12,0x32,0x12,0x32,0x12,0x32,0x13,
+  0x23,0x1F,0x01,0x2E,0xD8,                                                           /* 0x0d  */
+  0xDA,0x12,0x32,0x12,0x82,0x32,0x12,0x32,0x12,0x32,0x12,0x32,0x12,0x32,0x12,0x32,
+  0x13,0x23,0x1F,0x02,0x25,0x0A,0xC8,                                                 /* 0x0e  */
+  0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0x30,                                                 /* 0x0f n/a */
+  0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0x30,                                                 /* 0x10 space */
+  0x2A,0x52,0x4C,0x44,0x44,0x44,0x44,0x4A,0x52,0x52,0xF8,0x1A,0x52,0xE8,              /* 0x11 ! */
+  0xDA,0x12,0x32,0x12,0x32,0x12,0x32,0x12,0xF8,0xF8,0xF8,0xF0,                        /* 0x12 " */
+  0x8A,0x12,0x32,0x12,0x32,0x12,0x1F,0x03,0x22,0x12,0x32,0x12,0x2A,0x12,0x32,0x12,
+  0x27,0x02,0x22,0x12,0x32,0x12,0x32,0x12,0xF8,0x48,                                  /* 0x13 # */
+  0x2A,0x52,0x46,0x2F,0x01,0x22,0x0A,0x3A,0x0A,0x3F,0x37,0x3A,0x0A,0x3A,0x0A,0x27,
+  0x01,0x2E,0x42,0x52,0xE8,                                                           /* 0x14 $ */
+  0xF8,0x21,0x13,0x2A,0x13,0x23,0x13,0x1B,0x43,0x43,0x43,0x43,0x43,0x43,0x1B,0x13,
+  0x23,0x12,0x2B,0xC8,                                                                /* 0x15 % */
+  0x8B,0x42,0x0A,0x32,0x12,0x32,0x12,0x32,0x0A,0x43,0x44,0x3D,0x3A,0x12,0x0A,0x1A,
+  0x14,0x22,0x1A,0x2B,0x0C,0x2C,0x12,0xC8,                                            /* 0x16 & */
+  0x23,0x4B,0x4B,0x52,0x52,0x4A,0xF8,0xF8,0xF8,0xF8,0x10,                             /* 0x17  */
+  0x33,0x42,0x4B,0x4A,0x4B,0x4B,0x4B,0x4B,0x4B,0x4B,0x52,0x53,0x52,0x5B,0xD8,         /* 0x18 ( */
+  0x1B,0x5A,0x53,0x52,0x53,0x4B,0x4B,0x4B,0x4B,0x4B,0x4A,0x4B,0x4A,0x43,0xF0,         /* 0x19 ) */
+  0xF8,0x3A,0x0A,0x0A,0x22,0x0A,0x0A,0x2E,0x3C,0x37,0x01,0x34,0x3E,0x2A,0x0A,0x0A,
+  0x22,0x0A,0x0A,0xF8,0x98,                                                           /* 0x1a * */
+  0xF8,0xB2,0x52,0x52,0x3F,0x01,0x27,0x01,0x3A,0x52,0x52,0xF8,0xB0,                   /* 0x1b + */
+  0xF8,0xF8,0xF8,0xF8,0x63,0x4B,0x4B,0x52,0x4A,0x30,                                  /* 0x1c , */
+  0xF8,0xF8,0xC7,0x01,0x27,0x01,0xF8,0xF8,0xC0,                                       /* 0x1d - */
+  0xF8,0xF8,0xF8,0xF8,0x63,0x4B,0x4B,0xE8,                                            /* 0x1e . */
+  0xB9,0x52,0x4B,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x43,0x4A,0xF8,0x70,              /* 0x1f / */
+  0x25,0x2F,0x02,0x1A,0x2A,0x12,0x33,0x0A,0x2C,0x0A,0x22,0x0A,0x0A,0x1A,0x12,0x0A,
+  0x12,0x1A,0x0A,0x0A,0x22,0x0C,0x2A,0x0B,0x32,0x12,0x2A,0x1F,0x02,0x2D,0xD8,         /* 0x20 0 */
+  0x32,0x4B,0x3D,0x3D,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x3F,0x01,0x27,0x01,
+  0xC8,                                                                               /* 0x21 1 */
+  0x1F,0x27,0x02,0x13,0x2B,0x0A,0x3A,0x0A,0x33,0x43,0x43,0x43,0x43,0x43,0x43,0x43,
+  0x47,0x04,0x0F,0x04,0xC0,                                                           /* 0x22 2 */
+  0x1F,0x27,0x02,0x13,0x2B,0x0A,0x3A,0x52,0x4B,0x27,0x2E,0x5A,0x5A,0x0A,0x3A,0x0B,
+  0x2B,0x17,0x02,0x27,0xD0,                                                           /* 0x23 3 */
+  0x3B,0x44,0x3D,0x33,0x0A,0x2B,0x12,0x23,0x1A,0x1B,0x22,0x1A,0x2A,0x1F,0x04,0x0F,
+  0x04,0x42,0x52,0x52,0x52,0xD0,                                                      /* 0x24 4 */
+  0x0F,0x04,0x0F,0x04,0x0A,0x52,0x52,0x57,0x02,0x27,0x02,0x53,0x52,0x52,0x0A,0x3A,
+  0x0B,0x2B,0x17,0x02,0x27,0xD0,                                                      /* 0x25 5 */
+  0x34,0x3D,0x33,0x43,0x43,0x4A,0x4F,0x02,0x1F,0x03,0x13,0x2B,0x0A,0x3A,0x0A,0x3A,
+  0x0B,0x2B,0x17,0x02,0x27,0xD0,                                                      /* 0x26 6 */
+  0x0F,0x04,0x0F,0x04,0x4A,0x52,0x4A,0x52,0x4A,0x52,0x4A,0x52,0x4A,0x52,0x4A,0x52,
+  0xF0,                                                                               /* 0x27 7 */
+  0x25,0x37,0x23,0x1B,0x1A,0x2A,0x1A,0x2A,0x1B,0x1B,0x27,0x27,0x02,0x13,0x2B,0x0A,
+  0x3A,0x0A,0x3A,0x0B,0x2B,0x17,0x02,0x27,0xD0,                                       /* 0x28 8 */
+  0x1F,0x27,0x02,0x13,0x2B,0x0A,0x3A,0x0A,0x3A,0x0B,0x2B,0x17,0x03,0x1F,0x02,0x4A,
+  0x4B,0x43,0x43,0x35,0x3C,0xE8,                                                      /* 0x29 9 */
+  0xF8,0xAB,0x4B,0x4B,0xF8,0x73,0x4B,0x4B,0xF8,0x50,                                  /* 0x2a : */
+  0xF8,0xAB,0x4B,0x4B,0xF8,0x73,0x4B,0x4B,0x52,0x52,0x4A,0x30,                        /* 0x2b ; */
+  0x42,0x4B,0x43,0x43,0x43,0x43,0x43,0x4B,0x53,0x53,0x53,0x53,0x53,0x52,0xD0,         /* 0x2c < */
+  0xF8,0xFF,0x02,0x1F,0x02,0xDF,0x02,0x1F,0x02,0xF8,0xF0,                             /* 0x2d = */
+  0x12,0x53,0x53,0x53,0x53,0x53,0x53,0x4B,0x43,0x43,0x43,0x43,0x43,0x4A,0xF8,0x08,    /* 0x2e > */
+  0x1E,0x2F,0x01,0x1B,0x23,0x12,0x32,0x12,0x2B,0x43,0x43,0x43,0x4A,0x52,0x52,0xB2,
+  0x52,0xE8,                                                                          /* 0x2f ? */
+  0x1F,0x27,0x02,0x1A,0x2A,0x12,0x14,0x0A,0x0A,0x0D,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,
+  0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0x0A,0x0F,0x12,0x15,0x1B,
+  0x57,0x01,0x36,0xD0,                                                                /* 0x30 @ */
+  0x2A,0x52,0x4C,0x44,0x44,0x3A,0x12,0x32,0x12,0x32,0x12,0x2A,0x22,0x27,0x01,0x27,
+  0x01,0x1A,0x32,0x12,0x32,0x12,0x32,0xC8,                                            /* 0x31 A */
+  0x0F,0x2F,0x01,0x22,0x23,0x1A,0x2A,0x1A,0x2A,0x1A,0x23,0x1F,0x01,0x27,0x02,0x1A,
+  0x2B,0x12,0x32,0x12,0x32,0x12,0x2B,0x17,0x02,0x1F,0x01,0xD8,                        /* 0x32 B */
+  0x25,0x37,0x23,0x1B,0x1A,0x2A,0x12,0x52,0x52,0x52,0x52,0x52,0x5A,0x2A,0x1B,0x1B,
+  0x27,0x35,0xD8,                                                                     /* 0x33 C */
+  0x0F,0x2F,0x01,0x22,0x23,0x1A,0x2A,0x1A,0x32,0x12,0x32,0x12,0x32,0x12,0x32,0x12,
+  0x32,0x12,0x32,0x12,0x2A,0x1A,0x23,0x1F,0x01,0x27,0xE0,                             /* 0x34 D */
+  0x0F,0x03,0x17,0x03,0x12,0x52,0x52,0x52,0x57,0x01,0x27,0x01,0x22,0x52,0x52,0x52,
+  0x57,0x03,0x17,0x03,0xC8,                                                           /* 0x35 E */
+  0x0F,0x03,0x17,0x03,0x12,0x52,0x52,0x52,0x57,0x01,0x27,0x01,0x22,0x52,0x52,0x52,
+  0x52,0x52,0xF8,0x10,                                                                /* 0x36 F */
+  0x26,0x2F,0x01,0x1B,0x22,0x1A,0x4A,0x52,0x52,0x1D,0x12,0x1D,0x12,0x32,0x12,0x32,
+  0x1A,0x2A,0x1B,0x22,0x27,0x01,0x2F,0xC8,                                            /* 0x37 G */
+  0x0A,0x32,0x12,0x32,0x12,0x32,0x12,0x32,0x12,0x32,0x12,0x32,0x17,0x03,0x17,0x03,
+  0x12,0x32,0x12,0x32,0x12,0x32,0x12,0x32,0x12,0x32,0x12,0x32,0xC8,                   /* 0x38 H */
+  0x1E,0x36,0x42,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x46,0x36,0xD8,         /* 0x39 I */
+  0x4A,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x12,0x32,0x12,0x32,0x13,0x22,0x27,
+  0x01,0x2E,0xD8,                                                                     /* 0x3a J */
+  0x0A,0x32,0x12,0x2B,0x12,0x23,0x1A,0x1B,0x22,0x13,0x2A,0x0B,0x35,0x3D,0x3A,0x0B,
+  0x32,0x13,0x2A,0x1B,0x22,0x23,0x1A,0x2B,0x12,0x32,0xC8,                             /* 0x3b K */
+  0x0A,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x57,0x03,0x17,0x03,
+  0xC8,                                                                               /* 0x3c L */
+  0x0A,0x32,0x13,0x23,0x13,0x23,0x14,0x14,0x14,0x14,0x12,0x0C,0x0A,0x12,0x0C,0x0A,
+  0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x32,0x12,0x32,0x12,0x32,0x12,0x32,0x12,0x32,
+  0xC8,                                                                               /* 0x3d M */
+  0x0A,0x32,0x13,0x2A,0x13,0x2A,0x14,0x22,0x12,0x0A,0x1A,0x12,0x0A,0x1A,0x12,0x12,
+  0x12,0x12,0x12,0x12,0x12,0x1A,0x0A,0x12,0x1A,0x0A,0x12,0x24,0x12,0x2B,0x12,0x2B,
+  0x12,0x32,0xC8,                                                                     /* 0x3e N */
+  0x24,0x3E,0x2B,0x13,0x22,0x22,0x1A,0x32,0x12,0x32,0x12,0x32,0x12,0x32,0x12,0x32,
+  0x12,0x32,0x1A,0x22,0x23,0x13,0x2E,0x3C,0xE0,                                       /* 0x3f O */
+  0x0F,0x01,0x27,0x02,0x1A,0x2B,0x12,0x32,0x12,0x32,0x12,0x32,0x12,0x2B,0x17,0x02,
+  0x1F,0x01,0x22,0x52,0x52,0x52,0x52,0xF8,0x10,                                       /* 0x40 P */
+  0x24,0x3E,0x2B,0x13,0x22,0x22,0x1A,0x32,0x12,0x32,0x12,0x32,0x12,0x32,0x12,0x32,
+  0x12,0x1A,0x0A,0x1A,0x14,0x23,0x13,0x2F,0x01,0x2C,0x0A,0xC8,                        /* 0x41 Q */
+  0x0F,0x01,0x27,0x02,0x1A,0x2B,0x12,0x32,0x12,0x32,0x12,0x32,0x12,0x2B,0x17,0x02,
+  0x1F,0x01,0x22,0x13,0x2A,0x1B,0x22,0x23,0x1A,0x2B,0x12,0x32,0xC8,                   /* 0x42 R */
+  0x1E,0x2F,0x01,0x1B,0x23,0x12,0x32,0x12,0x53,0x57,0x37,0x53,0x52,0x12,0x32,0x13,
+  0x23,0x1F,0x01,0x2E,0xD8,                                                           /* 0x43 S */
+  0x17,0x01,0x27,0x01,0x3A,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,
+  0xE8,                                                                               /* 0x44 T */
+  0x0A,0x32,0x12,0x32,0x12,0x32,0x12,0x32,0x12,0x32,0x12,0x32,0x12,0x32,0x12,0x32,
+  0x12,0x32,0x12,0x32,0x12,0x32,0x1A,0x22,0x27,0x01,0x2E,0xD8,                        /* 0x45 U */
+  0x0A,0x32,0x12,0x32,0x12,0x32,0x1A,0x22,0x22,0x22,0x22,0x22,0x2A,0x12,0x32,0x12,
+  0x32,0x12,0x3C,0x44,0x44,0x4A,0x52,0xE8,                                            /* 0x46 V */
+  0x0A,0x32,0x12,0x32,0x12,0x32,0x12,0x32,0x12,0x32,0x12,0x32,0x12,0x32,0x12,0x12,
+  0x12,0x12,0x12,0x12,0x12,0x0C,0x0A,0x14,0x14,0x13,0x23,0x13,0x23,0x12,0x32,0xC8,    /* 0x47 W */
+  0x0A,0x32,0x12,0x32,0x1A,0x22,0x22,0x22,0x2A,0x12,0x3C,0x4A,0x52,0x4C,0x3A,0x12,
+  0x2A,0x22,0x22,0x22,0x1A,0x32,0x12,0x32,0xC8,                                       /* 0x48 X */
+  0x0A,0x32,0x12,0x32,0x1A,0x22,0x22,0x22,0x2A,0x12,0x32,0x12,0x3C,0x44,0x4A,0x52,
+  0x52,0x52,0x52,0x52,0xE8,                                                           /* 0x49 Y */
+  0x0F,0x03,0x17,0x03,0x4A,0x52,0x4A,0x4A,0x4A,0x52,0x4A,0x4A,0x4A,0x52,0x4F,0x03,
+  0x17,0x03,0xC8,                                                                     /* 0x4a Z */
+  0x1E,0x36,0x32,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x56,0x36,0xD8,         /* 0x4b [ */
+  0x69,0x5A,0x53,0x53,0x53,0x53,0x53,0x53,0x53,0x53,0x53,0x52,0xF8,0x28,              /* 0x4c \ */
+  0x1E,0x36,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x36,0x36,0xD8,         /* 0x4d ] */
+  0x31,0x53,0x45,0x33,0x0B,0x23,0x1B,0x13,0x2B,0x0A,0x3A,0xF8,0xF8,0xF8,0x78,         /* 0x4e ^ */
+  0xF8,0xF8,0xF8,0xF8,0xF8,0x77,0x04,0x0F,0x04,                                       /* 0x4f _ */
+  0x8B,0x4B,0x4B,0x4A,0x52,0x5A,0xF8,0xF8,0xF8,0x98,                                  /* 0x50 ` */
+  0xF8,0xF8,0x0F,0x27,0x02,0x52,0x27,0x01,0x1F,0x02,0x12,0x32,0x12,0x32,0x17,0x03,
+  0x1F,0x02,0xC8,                                                                     /* 0x51 a */
+  0x0A,0x52,0x52,0x52,0x52,0x52,0x0D,0x27,0x02,0x1B,0x23,0x12,0x32,0x12,0x32,0x12,
+  0x32,0x12,0x2B,0x17,0x02,0x1F,0x01,0xD8,                                            /* 0x52 b */
+  0xF8,0xF8,0x0E,0x2F,0x01,0x1B,0x2A,0x12,0x52,0x52,0x53,0x2A,0x1F,0x01,0x2E,0xD8,    /* 0x53 c */
+  0x4A,0x52,0x52,0x52,0x52,0x25,0x0A,0x1F,0x02,0x13,0x1C,0x12,0x32,0x12,0x32,0x12,
+  0x32,0x13,0x2A,0x1F,0x02,0x27,0x01,0xC8,                                            /* 0x54 d */
+  0xF8,0xF8,0x0E,0x2F,0x01,0x1B,0x2A,0x17,0x03,0x17,0x02,0x1A,0x53,0x57,0x01,0x2E,
+  0xD8,                                                                               /* 0x55 e */
+  0x2C,0x3D,0x33,0x4A,0x52,0x52,0x47,0x2F,0x3A,0x52,0x52,0x52,0x52,0x52,0xF8,         /* 0x56 f */
+  0xF8,0xF8,0x0F,0x01,0x1F,0x02,0x13,0x2A,0x12,0x32,0x13,0x23,0x1F,0x02,0x25,0x0A,
+  0x52,0x4B,0x1F,0x01,0x27,0x18,                                                      /* 0x57 g */
+  0x0A,0x52,0x52,0x52,0x52,0x52,0x0C,0x2F,0x01,0x23,0x1B,0x1A,0x2A,0x1A,0x2A,0x1A,
+  0x2A,0x1A,0x2A,0x1A,0x2A,0x1A,0x2A,0xD0,                                            /* 0x58 h */
+  0xEA,0x52,0xAB,0x4B,0x52,0x52,0x52,0x52,0x52,0x46,0x36,0xD8,                        /* 0x59 i */
+  0xFA,0x52,0xAB,0x4B,0x52,0x52,0x52,0x52,0x52,0x52,0x32,0x12,0x36,0x3C,0x20,         /* 0x5a j */
+  0x12,0x52,0x52,0x52,0x52,0x52,0x1A,0x2A,0x13,0x2A,0x0B,0x35,0x3D,0x3A,0x0B,0x32,
+  0x13,0x2A,0x1B,0x22,0x22,0xD0,                                                      /* 0x5b k */
+  0x23,0x4B,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x52,0x46,0x36,0xD8,         /* 0x5c l */
+  0xF8,0xF1,0x0A,0x12,0x27,0x02,0x1F,0x03,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+  0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0xC8,                             /* 0x5d m */
+  0xF8,0xFF,0x2F,0x01,0x22,0x23,0x1A,0x2A,0x1A,0x2A,0x1A,0x2A,0x1A,0x2A,0x1A,0x2A,
+  0x1A,0x2A,0xC8,                                                                     /* 0x5e n */
+  0xF8,0xF8,0x0E,0x2F,0x01,0x1B,0x23,0x12,0x32,0x12,0x32,0x12,0x32,0x13,0x23,0x1F,
+  0x01,0x2E,0xD8,                                                                     /* 0x5f o */
+  0xF8,0xF7,0x01,0x27,0x02,0x1A,0x2B,0x12,0x32,0x12,0x32,0x13,0x23,0x17,0x02,0x1A,
+  0x0D,0x22,0x52,0x52,0x48,                                                           /* 0x60 p */
+  0xF8,0xF8,0x0F,0x01,0x1F,0x02,0x13,0x2A,0x12,0x32,0x12,0x32,0x13,0x23,0x1F,0x02,
+  0x25,0x0A,0x52,0x52,0x52,0x08,                                                      /* 0x61 q */
+  0xF8,0xFA,0x0D,0x27,0x02,0x1B,0x22,0x1A,0x52,0x52,0x52,0x52,0x52,0xF8,0x08,         /* 0x62 r */
+  0xF8,0xFE,0x2F,0x01,0x22,0x57,0x37,0x52,0x52,0x27,0x01,0x2E,0xE0,                   /* 0x63 s */
+  0x7A,0x52,0x52,0x52,0x47,0x2F,0x3A,0x52,0x52,0x52,0x52,0x56,0x3D,0xD8,              /* 0x64 t */
+  0xF8,0xF2,0x32,0x12,0x32,0x12,0x32,0x12,0x32,0x12,0x32,0x12,0x32,0x13,0x23,0x1F,
+  0x02,0x25,0x0A,0xC8,                                                                /* 0x65 u */
+  0xF8,0xF2,0x32,0x12,0x32,0x1A,0x22,0x22,0x22,0x2A,0x12,0x32,0x12,0x3C,0x44,0x4A,
+  0xE8,                                                                               /* 0x66 v */
+  0xF8,0xF2,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,0x12,
+  0x12,0x0C,0x0A,0x1F,0x01,0x23,0x13,0x29,0x21,0xD8,                                  /* 0x67 w */
+  0xF8,0xF2,0x2A,0x1B,0x1B,0x23,0x0B,0x35,0x43,0x45,0x33,0x0B,0x23,0x1B,0x1A,0x2A,
+  0xD0,                                                                               /* 0x68 x */
+  0xF8,0xFA,0x22,0x22,0x22,0x2A,0x12,0x32,0x12,0x3C,0x44,0x4A,0x52,0x4A,0x52,0x4A,
+  0x38,                                                                               /* 0x69 y */
+  0xF8,0xF7,0x02,0x1F,0x01,0x4A,0x4A,0x4A,0x4A,0x4A,0x4F,0x02,0x1F,0x02,0xD0,         /* 0x6a z */
+  0x34,0x3D,0x33,0x4A,0x52,0x52,0x4B,0x43,0x53,0x52,0x52,0x52,0x53,0x55,0x44,0x70,    /* 0x6b { */
+  0x2A,0x52,0x52,0x52,0x52,0x52,0xB2,0x52,0x52,0x52,0x52,0x52,0x52,0xE8,              /* 0x6c | */
+  0x14,0x45,0x53,0x52,0x52,0x52,0x53,0x53,0x43,0x4A,0x52,0x52,0x4B,0x35,0x3C,0x90,    /* 0x6d } */
+  0xDB,0x1A,0x1A,0x0A,0x0A,0x1A,0x1B,0xF8,0xF8,0xF8,0xF8,0x58,                        /* 0x6e ~ */
+};
+
+
+/*
+ *  offset of each bitmap in FontData[]
+ */
+
+const uint16_t FontIndex[] PROGMEM = {
+  0,          /* 0x00 n/a */
+  7,          /* 0x01 symbol: diode A-C */
+  36,         /* 0x02 symbol: diode C-A */
+  65,         /* 0x03 symbol: capacitor */
+  94,         /* 0x04 omega */
+  121,        /* 0x05  (micro) */
+  143,        /* 0x06 symbol: resistor left side */
+  160,        /* 0x07 symbol: resistor right side */
+  177,        /* 0x08  */
+  191,        /* 0x09  */
+  216,        /* 0x0a  (seems to be ) */
+  239,        /* 0x0b  */
+  260,        /* 0x0c  */
+  281,        /* 0x0d  */
+  302,        /* 0x0e  */
+  325,        /* 0x0f n/a */
+  332,        /* 0x10 space */
+  339,        /* 0x11 ! */
+  353,        /* 0x12 " */
+  365,        /* 0x13 # */
+  391,        /* 0x14 $ */
+  412,        /* 0x15 % */
+  432,        /* 0x16 & */
+  456,        /* 0x17  */
+  467,        /* 0x18 ( */
+  482,        /* 0x19 ) */
+  497,        /* 0x1a * */
+  518,        /* 0x1b + */
+  531,        /* 0x1c , */
+  541,        /* 0x1d - */
+  550,        /* 0x1e . */
+  558,        /* 0x1f / */
+  572,        /* 0x20 0 */
+  603,        /* 0x21 1 */
+  620,        /* 0x22 2 */
+  641,        /* 0x23 3 */
+  662,        /* 0x24 4 */
+  684,        /* 0x25 5 */
+  706,        /* 0x26 6 */
+  728,        /* 0x27 7 */
+  745,        /* 0x28 8 */
+  770,        /* 0x29 9 */
+  792,        /* 0x2a : */
+  802,        /* 0x2b ; */
+  814,        /* 0x2c < */
+  829,        /* 0x2d = */
+  840,        /* 0x2e > */
+  856,        /* 0x2f ? */
+  874,        /* 0x30 @ */
+  910,        /* 0x31 A */
+  934,        /* 0x32 B */
+  962,        /* 0x33 C */
+  981,        /* 0x34 D */
+  1008,       /* 0x35 E */
+  1029,       /* 0x36 F */
+  1049,       /* 0x37 G */
+  1073,       /* 0x38 H */
+  1102,       /* 0x39 I */
+  1117,       /* 0x3a J */
+  1136,       /* 0x3b K */
+  1163,       /* 0x3c L */
+  1180,       /* 0x3d M */
+  1213,       /* 0x3e N */
+  1248,       /* 0x3f O */
+  1273,       /* 0x40 P */
+  1298,       /* 0x41 Q */
+  1326,       /* 0x42 R */
+  1355,       /* 0x43 S */
+  1376,       /* 0x44 T */
+  1393,       /* 0x45 U */
+  1421,       /* 0x46 V */
+  1445,       /* 0x47 W */
+  1477,       /* 0x48 X */
+  1502,       /* 0x49 Y */
+  1523,       /* 0x4a Z */
+  1542,       /* 0x4b [ */
+  1557,       /* 0x4c \ */
+  1571,       /* 0x4d ] */
+  1586,       /* 0x4e ^ */
+  1601,       /* 0x4f _ */
+  1610,       /* 0x50 ` */
+  1620,       /* 0x51 a */
+  1639,       /* 0x52 b */
+  1663,       /* 0x53 c */
+  1679,       /* 0x54 d */
+  1703,       /* 0x55 e */
+  1720,       /* 0x56 f */
+  1735,       /* 0x57 g */
+  1757,       /* 0x58 h */
+  1781,       /* 0x59 i */
+  1793,       /* 0x5a j */
+  1808,       /* 0x5b k */
+  1830,       /* 0x5c l */
+  1845,       /* 0x5d m */
+  1872,       /* 0x5e n */
+  1891,       /* 0x5f o */
+  1910,       /* 0x60 p */
+  1931,       /* 0x61 q */
+  1953,       /* 0x62 r */
+  1968,       /* 0x63 s */
+  1981,       /* 0x64 t */
+  1995,       /* 0x65 u */
+  2015,       /* 0x66 v */
+  2032,       /* 0x67 w */
+  2058,       /* 0x68 x */
+  2075,       /* 0x69 y */
+  2092,       /* 0x6a z */
+  2107,       /* 0x6b { */
+  2123,       /* 0x6c | */
+  2137,       /* 0x6d } */
+  2153,       /* 0x6e ~ */
+};
+
+
+/*
+ *  font lookup table for ISO 8859-1
+ *  - 8 bit ISO 8859-1 to custom font
+ *  - ff: no bitmap available
+ */
+
+const uint8_t FontTable[] PROGMEM = {
+  0xff,        /* 0x00 -> n/a */
+  0x01,        /* 0x01 -> symbol: diode A-C */
+  0x02,        /* 0x02 -> symbol: diode C-A */
+  0x03,        /* 0x03 -> symbol: capacitor */
+  0x04,        /* 0x04 -> omega */
+  0x05,        /* 0x05 ->  (micro) */
+  0x06,        /* 0x06 -> symbol: resistor left side */
+  0x07,        /* 0x07 -> symbol: resistor right side */
+  0xff,        /* 0x08 -> n/a */
+  0xff,        /* 0x09 -> n/a */
+  0xff,        /* 0x0a -> n/a */
+  0xff,        /* 0x0b -> n/a */
+  0xff,        /* 0x0c -> n/a */
+  0xff,        /* 0x0d -> n/a */
+  0xff,        /* 0x0e -> n/a */
+  0xff,        /* 0x0f -> n/a */
+
+  0xff,        /* 0x10 -> n/a */
+  0xff,        /* 0x11 -> n/a */
+  0xff,        /* 0x12 -> n/a */
+  0xff,        /* 0x13 -> n/a */
+  0xff,        /* 0x14 -> n/a */
+  0xff,        /* 0x15 -> n/a */
+  0xff,        /* 0x16 -> n/a */
+  0xff,        /* 0x17 -> n/a */
+  0xff,        /* 0x18 -> n/a */
+  0xff,        /* 0x19 -> n/a */
+  0xff,        /* 0x1a -> n/a */
+  0xff,        /* 0x1b -> n/a */
+  0xff,        /* 0x1c -> n/a */
+  0xff,        /* 0x1d -> n/a */
+  0xff,        /* 0x1e -> n/a */
+  0xff,        /* 0x1f -> n/a */
+
+  0x10,        /* 0x20 -> space */
+  0x11,        /* 0x21 -> ! */
+  0x12,        /* 0x22 -> " */
+  0x13,        /* 0x23 -> # */
+  0x14,        /* 0x24 -> $ */
+  0x15,        /* 0x25 -> % */
+  0x16,        /* 0x26 -> & */
+  0x17,        /* 0x27 ->  */
+  0x18,        /* 0x28 -> ( */
+  0x19,        /* 0x29 -> ) */
+  0x1a,        /* 0x2a -> * */
+  0x1b,        /* 0x2b -> + */
+  0x1c,        /* 0x2c -> , */
+  0x1d,        /* 0x2d -> - */
+  0x1e,        /* 0x2e -> . */
+  0x1f,        /* 0x2f -> / */
+
+  0x20,        /* 0x30 -> 0 */
+  0x21,        /* 0x31 -> 1 */
+  0x22,        /* 0x32 -> 2 */
+  0x23,        /* 0x33 -> 3 */
+  0x24,        /* 0x34 -> 4 */
+  0x25,        /* 0x35 -> 5 */
+  0x26,        /* 0x36 -> 6 */
+  0x27,        /* 0x37 -> 7 */
+  0x28,        /* 0x38 -> 8 */
+  0x29,        /* 0x39 -> 9 */
+  0x2a,        /* 0x3a -> : */
+  0x2b,        /* 0x3b -> ; */
+  0x2c,        /* 0x3c -> < */
+  0x2d,        /* 0x3d -> = */
+  0x2e,        /* 0x3e -> > */
+  0x2f,        /* 0x3f -> ? */
+
+  0x30,        /* 0x40 -> @ */
+  0x31,        /* 0x41 -> A */
+  0x32,        /* 0x42 -> B */
+  0x33,        /* 0x43 -> C */
+  0x34,        /* 0x44 -> D */
+  0x35,        /* 0x45 -> E */
+  0x36,        /* 0x46 -> F */
+  0x37,        /* 0x47 -> G */
+  0x38,        /* 0x48 -> H */
+  0x39,        /* 0x49 -> I */
+  0x3a,        /* 0x4a -> J */
+  0x3b,        /* 0x4b -> K */
+  0x3c,        /* 0x4c -> L */
+  0x3d,        /* 0x4d -> M */
+  0x3e,        /* 0x4e -> N */
+  0x3f,        /* 0x4f -> O */
+
+  0x40,        /* 0x50 -> P */
+  0x41,        /* 0x51 -> Q */
+  0x42,        /* 0x52 -> R */
+  0x43,        /* 0x53 -> S */
+  0x44,        /* 0x54 -> T */
+  0x45,        /* 0x55 -> U */
+  0x46,        /* 0x56 -> V */
+  0x47,        /* 0x57 -> W */
+  0x48,        /* 0x58 -> X */
+  0x49,        /* 0x59 -> Y */
+  0x4a,        /* 0x5a -> Z */
+  0x4b,        /* 0x5b -> [ */
+  0x4c,        /* 0x5c -> \ */
+  0x4d,        /* 0x5d -> ] */
+  0x4e,        /* 0x5e -> ^ */
+  0x4f,        /* 0x5f -> _ */
+
+  0x50,        /* 0x60 -> ` */
+  0x51,        /* 0x61 -> a */
+  0x52,        /* 0x62 -> b */
+  0x53,        /* 0x63 -> c */
+  0x54,        /* 0x64 -> d */
+  0x55,        /* 0x65 -> e */
+  0x56,        /* 0x66 -> f */
+  0x57,        /* 0x67 -> g */
+  0x58,        /* 0x68 -> h */
+  0x59,        /* 0x69 -> i */
+  0x5a,        /* 0x6a -> j */
+  0x5b,        /* 0x6b -> k */
+  0x5c,        /* 0x6c -> l */
+  0x5d,        /* 0x6d -> m */
+  0x5e,        /* 0x6e -> n */
+  0x5f,        /* 0x6f -> o */
+
+  0x60,        /* 0x70 -> p */
+  0x61,        /* 0x71 -> q */
+  0x62,        /* 0x72 -> r */
+  0x63,        /* 0x73 -> s */
+  0x64,        /* 0x74 -> t */
+  0x65,        /* 0x75 -> u */
+  0x66,        /* 0x76 -> v */
+  0x67,        /* 0x77 -> w */
+  0x68,        /* 0x78 -> x */
+  0x69,        /* 0x79 -> y */
+  0x6a,        /* 0x7a -> z */
+  0x6b,        /* 0x7b -> { */
+  0x6c,        /* 0x7c -> | */
+  0x6d,        /* 0x7d -> } */
+  0x6e,        /* 0x7e -> ~ */
+  0xff,        /* 0x7f -> n/a */
+
+  0xff,        /* 0x80 -> n/a */
+  0xff,        /* 0x81 -> n/a */
+  0xff,        /* 0x82 -> n/a */
+  0xff,        /* 0x83 -> n/a */
+  0xff,        /* 0x84 -> n/a */
+  0xff,        /* 0x85 -> n/a */
+  0xff,        /* 0x86 -> n/a */
+  0xff,        /* 0x87 -> n/a */
+  0xff,        /* 0x88 -> n/a */
+  0xff,        /* 0x89 -> n/a */
+  0xff,        /* 0x8a -> n/a */
+  0xff,        /* 0x8b -> n/a */
+  0xff,        /* 0x8c -> n/a */
+  0xff,        /* 0x8d -> n/a */
+  0xff,        /* 0x8e -> n/a */
+  0xff,        /* 0x8f -> n/a */
+
+  0xff,        /* 0x90 -> n/a */
+  0xff,        /* 0x91 -> n/a */
+  0xff,        /* 0x92 -> n/a */
+  0xff,        /* 0x93 -> n/a */
+  0xff,        /* 0x94 -> n/a */
+  0xff,        /* 0x95 -> n/a */
+  0xff,        /* 0x96 -> n/a */
+  0xff,        /* 0x97 -> n/a */
+  0xff,        /* 0x98 -> n/a */
+  0xff,        /* 0x99 -> n/a */
+  0xff,        /* 0x9a -> n/a */
+  0xff,        /* 0x9b -> n/a */
+  0xff,        /* 0x9c -> n/a */
+  0xff,        /* 0x9d -> n/a */
+  0xff,        /* 0x9e -> n/a */
+  0xff,        /* 0x9f -> n/a */
+
+  0xff,        /* 0xa0 -> n/a */
+  0xff,        /* 0xa1 -> n/a */
+  0xff,        /* 0xa2 -> n/a */
+  0xff,        /* 0xa3 -> n/a */
+  0xff,        /* 0xa4 -> n/a */
+  0xff,        /* 0xa5 -> n/a */
+  0xff,        /* 0xa6 -> n/a */
+  0xff,        /* 0xa7 -> n/a */
+  0xff,        /* 0xa8 -> n/a */
+  0xff,        /* 0xa9 -> n/a */
+  0xff,        /* 0xaa -> n/a */
+  0xff,        /* 0xab -> n/a */
+  0xff,        /* 0xac -> n/a */
+  0xff,        /* 0xad -> n/a */
+  0xff,        /* 0xae -> n/a */
+  0xff,        /* 0xaf -> n/a */
+
+  0xff,        /* 0xb0 -> n/a */
+  0xff,        /* 0xb1 -> n/a */
+  0xff,        /* 0xb2 -> n/a */
+  0xff,        /* 0xb3 -> n/a */
+  0xff,        /* 0xb4 -> n/a */
+  0x05,        /* 0xb5 ->  (micro) */
+  0xff,        /* 0xb6 -> n/a */
+  0xff,        /* 0xb7 -> n/a */
+  0xff,        /* 0xb8 -> n/a */
+  0xff,        /* 0xb9 -> n/a */
+  0xff,        /* 0xba -> n/a */
+  0xff,        /* 0xbb -> n/a */
+  0xff,        /* 0xbc -> n/a */
+  0xff,        /* 0xbd -> n/a */
+  0xff,        /* 0xbe -> n/a */
+  0xff,        /* 0xbf -> n/a */
+
+  0xff,        /* 0xc0 -> n/a */
+  0xff,        /* 0xc1 -> n/a */
+  0xff,        /* 0xc2 -> n/a */
+  0xff,        /* 0xc3 -> n/a */
+  0x08,        /* 0xc4 ->  */
+  0xff,        /* 0xc5 -> n/a */
+  0xff,        /* 0xc6 -> n/a */
+  0xff,        /* 0xc7 -> n/a */
+  0xff,        /* 0xc8 -> n/a */
+  0xff,        /* 0xc9 -> n/a */
+  0xff,        /* 0xca -> n/a */
+  0xff,        /* 0xcb -> n/a */
+  0xff,        /* 0xcc -> n/a */
+  0xff,        /* 0xcd -> n/a */
+  0xff,        /* 0xce -> n/a */
+  0xff,        /* 0xcf -> n/a */
+
+  0xff,        /* 0xd0 -> n/a */
+  0xff,        /* 0xd1 -> n/a */
+  0xff,        /* 0xd2 -> n/a */
+  0xff,        /* 0xd3 -> n/a */
+  0xff,        /* 0xd4 -> n/a */
+  0xff,        /* 0xd5 -> n/a */
+  0x09,        /* 0xd6 ->  */
+  0xff,        /* 0xd7 -> n/a */
+  0xff,        /* 0xd8 -> n/a */
+  0xff,        /* 0xd9 -> n/a */
+  0xff,        /* 0xda -> n/a */
+  0xff,        /* 0xdb -> n/a */
+  0x0a,        /* 0xdc ->  */
+  0xff,        /* 0xdd -> n/a */
+  0xff,        /* 0xde -> n/a */
+  0x0b,        /* 0xdf ->  */
+
+  0xff,        /* 0xe0 -> n/a */
+  0xff,        /* 0xe1 -> n/a */
+  0xff,        /* 0xe2 -> n/a */
+  0xff,        /* 0xe3 -> n/a */
+  0x0c,        /* 0xe4 ->  */
+  0xff,        /* 0xe5 -> n/a */
+  0xff,        /* 0xe6 -> n/a */
+  0xff,        /* 0xe7 -> n/a */
+  0xff,        /* 0xe8 -> n/a */
+  0xff,        /* 0xe9 -> n/a */
+  0xff,        /* 0xea -> n/a */
+  0xff,        /* 0xeb -> n/a */
+  0xff,        /* 0xec -> n/a */
+  0xff,        /* 0xed -> n/a */
+  0xff,        /* 0xee -> n/a */
+  0xff,        /* 0xef -> n/a */
+
+  0xff,        /* 0xf0 -> n/a */
+  0xff,        /* 0xf1 -> n/a */
+  0xff,        /* 0xf2 -> n/a */
+  0xff,        /* 0xf3 -> n/a */
+  0xff,        /* 0xf4 -> n/a */
+  0xff,        /* 0xf5 -> n/a */
+  0x0d,        /* 0xf6 ->  */
+  0xff,        /* 0xf7 -> n/a */
+  0xff,        /* 0xf8 -> n/a */
+  0xff,        /* 0xf9 -> n/a */
+  0xff,        /* 0xfa -> n/a */
+  0xff,        /* 0xfb -> n/a */
+  0x0e,        /* 0xfc ->  */
+  0xff,        /* 0xfd -> n/a */
+  0xff,        /* 0xfe -> n/a */
+  0xff,        /* 0xff -> n/a */
+};
+
+
+#endif
+
+/* ************************************************************************
+ *   EOF
+ * ************************************************************************ */
@@ -0,0 +1,714 @@
+/* ************************************************************************
+ *
+ *   fixed 16x26 font based on ISO 8859-1
+ *   horizontally aligned, horizontal bit order flipped
+ *   run-length encoded (created by bitmap_rle.py)
+ *
+ *   (c) 2015-2018 by Markus Reschke
+ *
+ * ************************************************************************ */
+
+
+/* ************************************************************************
+ *   font data
+ * ************************************************************************ */
+
+#ifdef FONT_16X26_HF_RLE
+
+
+/* font size */
+#define FONT_SIZE_X         16     /* width:  16 dots */
+#define FONT_SIZE_Y         26     /* height: 26 dots */
+
+/* font data format */
+#define FONT_BYTES_N        52     /* 52 bytes per character */
+#define FONT_BYTES_X         2     /* 2 bytes in x direction */
+#define FONT_BYTES_Y        26     /* 26 bytes in y direction */
+
+
+/*
+ *  character bitmaps (run-length encoded)
+ *  - format:
+ *    - pixels read row by row (top to down, left to right)
+ *    - one byte per pair of runs:
+ *      bits 7-3: background pixels (0-31)
+ *      bits 2-0: foreground pixels (0-7)
+ *    - longer runs are continued by the next pair
+ */
+
+const uint8_t FontData[] PROGMEM = {
+  0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0x68,              /* 0x00 n/a */
+  0xF8,0x99,0x4B,0x1A,0x43,0x1B,0x3B,0x1C,0x33,0x1D,0x2B,0x1E,0x23,0x1F,0x1B,0x1F,
+  0x01,0x13,0x1F,0x02,0x0B,0x0F,0x07,0x07,0x07,0x04,0x17,0x02,0x0B,0x1F,0x01,0x13,
+  0x1F,0x1B,0x1E,0x23,0x1D,0x2B,0x1C,0x33,0x1B,0x3B,0x1A,0x43,0x19,0x4B,0xF8,0x90,    /* 0x01 symbol: diode A-C */
+  0xF8,0x93,0x49,0x1B,0x42,0x1B,0x3B,0x1B,0x34,0x1B,0x2D,0x1B,0x26,0x1B,0x1F,0x1B,
+  0x17,0x01,0x1B,0x0F,0x02,0x17,0x07,0x07,0x07,0x04,0x0B,0x0F,0x02,0x1B,0x17,0x01,
+  0x1B,0x1F,0x1B,0x26,0x1B,0x2D,0x1B,0x34,0x1B,0x3B,0x1B,0x42,0x1B,0x49,0xF8,0x98,    /* 0x02 symbol: diode C-A */
+  0xF8,0x9C,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,
+  0x24,0x24,0x24,0x16,0x27,0x05,0x26,0x14,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,
+  0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0xF8,0x98,                             /* 0x03 symbol: capacitor */
+  0xF8,0xBD,0x57,0x42,0x2A,0x32,0x3A,0x22,0x4A,0x1A,0x4A,0x12,0x5A,0x0A,0x5A,0x0A,
+  0x5A,0x0A,0x5A,0x12,0x4A,0x1A,0x4A,0x22,0x3A,0x32,0x2A,0x42,0x1A,0x29,0x1A,0x1A,
+  0x19,0x0E,0x1E,0x0E,0x1E,0xF8,0xF8,0x90,                                            /* 0x04 omega */
+  0xF8,0xF8,0xF8,0xAB,0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x23,
+  0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x24,0x24,0x25,0x15,0x27,0x01,0x0B,0x23,0x0C,
+  0x0C,0x1B,0x6B,0x6B,0x6B,0x6B,0x58,                                                 /* 0x05  (micro) */
+  0xF8,0xF8,0x9F,0x07,0x01,0x0F,0x07,0x01,0x0A,0x72,0x72,0x72,0x72,0x6B,0x6B,0x72,
+  0x72,0x72,0x72,0x72,0x77,0x07,0x01,0x0F,0x07,0x01,0xF8,0xF8,0x90,                   /* 0x06 symbol: resistor left side */
+  0xF8,0xF8,0x97,0x07,0x01,0x0F,0x07,0x01,0x72,0x72,0x72,0x72,0x72,0x73,0x6B,0x6A,
+  0x72,0x72,0x72,0x72,0x0F,0x07,0x01,0x0F,0x07,0x01,0xF8,0xF8,0x98,                   /* 0x07 symbol: resistor right side */
+  0x22,0x22,0x42,0x22,0xF8,0xDB,0x6C,0x5D,0x5A,0x0B,0x52,0x0B,0x4B,0x12,0x4A,0x1B,
+  0x3B,0x1B,0x3B,0x23,0x32,0x2B,0x2F,0x05,0x27,0x05,0x1B,0x3B,0x1B,0x43,0x13,0x43,
+  0x0B,0x53,0xF8,0xF8,0x90,                                                           /* 0x08  */
+  0x22,0x22,0x42,0x22,0xF8,0xD6,0x4F,0x01,0x3B,0x23,0x2B,0x33,0x23,0x33,0x1B,0x43,
+  0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x1B,0x33,0x23,0x33,0x2B,0x23,
+  0x3F,0x01,0x4E,0xF8,0xF8,0xB8,                                                      /* 0x09  */
+  0x2A,0x22,0x42,0x22,0xF8,0xB3,0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,
+  0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x1C,0x2C,0x23,
+  0x2B,0x37,0x02,0x47,0xF8,0xF8,0xB0,                                                 /* 0x0a  */
+  0xA6,0x4F,0x01,0x3C,0x1B,0x33,0x23,0x33,0x23,0x33,0x22,0x3B,0x1B,0x3B,0x13,0x43,
+  0x13,0x43,0x13,0x43,0x14,0x3B,0x1C,0x33,0x24,0x2B,0x2C,0x23,0x34,0x1B,0x3B,0x1B,
+  0x3B,0x1B,0x11,0x23,0x1B,0x17,0x23,0x1D,0xF8,0xF8,0xA8,                             /* 0x0b  */
+  0xF8,0xB2,0x1A,0x4A,0x1A,0xF8,0x56,0x47,0x02,0x3A,0x24,0x6B,0x6B,0x47,0x01,0x3F,
+  0x02,0x33,0x23,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2C,0x1C,0x37,0x0C,0x2C,0x1C,0xF8,
+  0xF8,0x98,                                                                          /* 0x0c  */
+  0xF8,0xAA,0x1A,0x4A,0x1A,0xF8,0x5D,0x4F,0x02,0x34,0x1C,0x2B,0x2B,0x23,0x3B,0x1B,
+  0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x23,0x2B,0x2C,0x1C,0x37,0x02,0x4D,
+  0xF8,0xF8,0xC0,                                                                     /* 0x0d  */
+  0xF8,0xAA,0x1A,0x4A,0x1A,0xF8,0x43,0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x33,
+  0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x2C,0x24,0x1D,0x2F,0x0B,
+  0x34,0x1B,0xF8,0xF8,0xA0,                                                           /* 0x0e  */
+  0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0x68,              /* 0x0f n/a */
+  0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0x68,              /* 0x10 space */
+  0xF8,0x43,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0xF8,
+  0x73,0x6B,0x6B,0xF8,0xF8,0xC0,                                                      /* 0x11 ! */
+  0x9B,0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,0x41,0x29,0x49,0x29,0xF8,0xF8,
+  0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0x70,                                            /* 0x12 " */
+  0xF8,0x42,0x1A,0x4A,0x1A,0x42,0x1A,0x4A,0x1A,0x4A,0x1A,0x4A,0x1A,0x2F,0x06,0x1F,
+  0x06,0x32,0x1A,0x4A,0x12,0x4A,0x1A,0x37,0x06,0x1F,0x06,0x2A,0x1A,0x4A,0x1A,0x4A,
+  0x1A,0x4A,0x1A,0x42,0x1A,0x4A,0x1A,0xF8,0xF8,0xC8,                                  /* 0x13 # */
+  0x42,0x72,0x67,0x3F,0x03,0x33,0x0A,0x19,0x2B,0x12,0x4B,0x12,0x4B,0x12,0x4C,0x0A,
+  0x56,0x5D,0x6C,0x6D,0x5D,0x5A,0x0B,0x52,0x0B,0x52,0x0B,0x52,0x0B,0x2A,0x1A,0x0A,
+  0x37,0x03,0x47,0x62,0x72,0xF8,0xB8,                                                 /* 0x14 $ */
+  0xF8,0x1C,0x42,0x0A,0x12,0x32,0x0A,0x22,0x22,0x12,0x22,0x1A,0x1A,0x22,0x1A,0x1A,
+  0x22,0x12,0x22,0x22,0x0A,0x32,0x12,0x0A,0x44,0x12,0x6A,0x6A,0x14,0x42,0x0A,0x12,
+  0x32,0x0A,0x22,0x22,0x12,0x22,0x1A,0x1A,0x22,0x1A,0x1A,0x22,0x12,0x22,0x22,0x0A,
+  0x32,0x12,0x0A,0x44,0xF8,0xF8,0xA0,                                                 /* 0x15 % */
+  0xF8,0x35,0x57,0x43,0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x1A,0x4B,0x0B,0x4D,0x55,0x56,
+  0x2B,0x0B,0x13,0x26,0x1C,0x1E,0x23,0x1A,0x0B,0x2B,0x12,0x0B,0x36,0x0C,0x2D,0x1C,
+  0x2C,0x27,0x06,0x2E,0x14,0xF8,0xF8,0x90,                                            /* 0x16 & */
+  0xB3,0x6B,0x6B,0x6B,0x6B,0x71,0x79,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,
+  0x88,                                                                               /* 0x17  */
+  0xDA,0x64,0x5C,0x5B,0x63,0x63,0x6B,0x6B,0x63,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,
+  0x73,0x6B,0x6B,0x73,0x73,0x74,0x6C,0x72,0x98,                                       /* 0x18 ( */
+  0x92,0x74,0x6C,0x73,0x73,0x73,0x6B,0x6B,0x73,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,
+  0x63,0x6B,0x6B,0x63,0x63,0x5C,0x5C,0x62,0xE0,                                       /* 0x19 ) */
+  0xF8,0x43,0x6B,0x6B,0x4A,0x13,0x0A,0x2D,0x15,0x32,0x22,0x51,0x11,0x5E,0x4B,0x13,
+  0x3B,0x23,0x41,0x21,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xD8,                             /* 0x1a * */
+  0xF8,0xF8,0xF8,0xD2,0x72,0x72,0x72,0x72,0x72,0x47,0x07,0x17,0x07,0x42,0x72,0x72,
+  0x72,0x72,0x72,0xF8,0xF8,0xC8,                                                      /* 0x1b + */
+  0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF4,0x64,0x64,0x64,0x72,0x6B,0x6A,0x6A,
+  0xC0,                                                                               /* 0x1c , */
+  0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0x4F,0x03,0x37,0x03,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,
+  0x48,                                                                               /* 0x1d - */
+  0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF4,0x64,0x64,0x64,0xF8,0xF8,0xC0,         /* 0x1e . */
+  0xEA,0x6A,0x72,0x6A,0x72,0x6A,0x72,0x6A,0x72,0x6A,0x72,0x6A,0x72,0x6A,0x72,0x6A,
+  0x72,0x6A,0x72,0x6A,0x72,0x6A,0x72,0x6A,0xE8,                                       /* 0x1f / */
+  0xF8,0x35,0x57,0x43,0x1B,0x33,0x2B,0x2B,0x2B,0x23,0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,
+  0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x23,0x2B,0x2B,0x2B,0x33,
+  0x1B,0x47,0x55,0xF8,0xF8,0xC0,                                                      /* 0x20 0 */
+  0xF8,0x4A,0x5D,0x47,0x01,0x42,0x1B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,
+  0x6B,0x6B,0x6B,0x6B,0x47,0x06,0x1F,0x06,0xF8,0xF8,0x98,                             /* 0x21 1 */
+  0xF8,0x2E,0x47,0x02,0x3A,0x2B,0x73,0x6B,0x6B,0x6B,0x63,0x6B,0x63,0x63,0x63,0x63,
+  0x63,0x6A,0x6B,0x63,0x6F,0x04,0x2F,0x04,0xF8,0xF8,0xA8,                             /* 0x22 2 */
+  0xF8,0x2E,0x4F,0x02,0x39,0x2C,0x6B,0x6B,0x6B,0x6A,0x6A,0x55,0x5E,0x6C,0x6C,0x6B,
+  0x6B,0x6B,0x64,0x31,0x24,0x3F,0x01,0x47,0xF8,0xF8,0xC0,                             /* 0x23 3 */
+  0xF8,0x53,0x64,0x5D,0x5D,0x52,0x0B,0x4B,0x0B,0x4A,0x13,0x42,0x1B,0x3A,0x23,0x3A,
+  0x23,0x32,0x2B,0x2A,0x33,0x2F,0x07,0x17,0x07,0x53,0x6B,0x6B,0x6B,0x6B,0xF8,0xF8,
+  0xB0,                                                                               /* 0x24 4 */
+  0xF8,0x2F,0x03,0x37,0x03,0x37,0x03,0x32,0x72,0x72,0x72,0x72,0x76,0x57,0x01,0x6C,
+  0x6C,0x6B,0x6B,0x6B,0x64,0x31,0x24,0x3F,0x01,0x46,0xF8,0xF8,0xC0,                   /* 0x25 5 */
+  0xF8,0x46,0x47,0x02,0x34,0x29,0x33,0x63,0x6B,0x63,0x6B,0x15,0x33,0x0F,0x2D,0x1C,
+  0x24,0x2C,0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x23,0x33,0x23,0x2B,0x33,0x23,0x37,0x02,
+  0x4D,0xF8,0xF8,0xB8,                                                                /* 0x26 6 */
+  0xF8,0x27,0x04,0x2F,0x04,0x2F,0x04,0x6A,0x72,0x6A,0x72,0x6A,0x71,0x72,0x6A,0x72,
+  0x6A,0x72,0x6A,0x72,0x6B,0x6A,0x72,0xF8,0xF8,0xE0,                                  /* 0x27 7 */
+  0xF8,0x3D,0x4F,0x01,0x3C,0x14,0x33,0x23,0x33,0x23,0x33,0x23,0x34,0x1A,0x47,0x01,
+  0x4D,0x57,0x01,0x3B,0x15,0x32,0x24,0x2B,0x2C,0x23,0x33,0x23,0x33,0x23,0x33,0x2B,
+  0x23,0x3F,0x01,0x4E,0xF8,0xF8,0xB8,                                                 /* 0x28 8 */
+  0xF8,0x3D,0x4F,0x02,0x33,0x23,0x33,0x2B,0x23,0x33,0x23,0x3B,0x1B,0x3B,0x1B,0x3B,
+  0x1C,0x2C,0x24,0x1D,0x2F,0x0B,0x35,0x13,0x6B,0x63,0x6B,0x63,0x31,0x2C,0x37,0x02,
+  0x46,0xF8,0xF8,0xC0,                                                                /* 0x29 9 */
+  0xF8,0xF8,0xF8,0xCC,0x64,0x64,0x64,0xF8,0xF8,0xF8,0x7C,0x64,0x64,0x64,0xF8,0xF8,
+  0xC0,                                                                               /* 0x2a : */
+  0xF8,0xF8,0xF8,0xCC,0x64,0x64,0x64,0xF8,0xF8,0xF8,0x7C,0x64,0x64,0x64,0x72,0x6B,
+  0x6A,0x6A,0xC0,                                                                     /* 0x2b ; */
+  0xF8,0xF8,0xF8,0xF8,0x11,0x6B,0x5C,0x54,0x54,0x54,0x54,0x64,0x74,0x74,0x74,0x74,
+  0x73,0x79,0xF8,0xF8,0x98,                                                           /* 0x2c < */
+  0xF8,0xF8,0xF8,0xF8,0xF8,0x37,0x07,0x17,0x07,0xF8,0x9F,0x07,0x17,0x07,0xF8,0xF8,
+  0xF8,0xF8,0xA8,                                                                     /* 0x2d = */
+  0xF8,0xF8,0xF8,0xA1,0x7B,0x74,0x74,0x74,0x74,0x74,0x64,0x54,0x54,0x54,0x54,0x5B,
+  0x69,0xF8,0xF8,0xF8,0x08,                                                           /* 0x2e > */
+  0xF8,0x27,0x01,0x3F,0x04,0x2A,0x34,0x22,0x3B,0x6B,0x6B,0x63,0x64,0x5C,0x5C,0x63,
+  0x63,0x6B,0x6B,0xF8,0x73,0x6B,0x6B,0xF8,0xF8,0xC8,                                  /* 0x2f ? */
+  0xF8,0x3E,0x4F,0x01,0x3B,0x23,0x2A,0x3A,0x23,0x25,0x22,0x21,0x1A,0x1B,0x1A,0x1A,
+  0x1A,0x1A,0x22,0x1A,0x1A,0x22,0x1A,0x1A,0x1B,0x1A,0x1A,0x1B,0x1A,0x1A,0x14,0x1A,
+  0x1A,0x11,0x0A,0x1B,0x1C,0x0C,0x12,0x1B,0x14,0x13,0x73,0x29,0x47,0x01,0x55,0xF8,
+  0xF8,0xB8,                                                                          /* 0x30 @ */
+  0xF8,0xF8,0xC3,0x6C,0x5D,0x5A,0x0B,0x52,0x0B,0x4B,0x12,0x4A,0x1B,0x3B,0x1B,0x3B,
+  0x23,0x32,0x2B,0x2F,0x05,0x27,0x05,0x1B,0x3B,0x1B,0x43,0x13,0x43,0x0B,0x53,0xF8,
+  0xF8,0x90,                                                                          /* 0x31 A */
+  0xF8,0xF8,0xA7,0x02,0x3F,0x03,0x33,0x24,0x2B,0x2B,0x2B,0x2B,0x2B,0x23,0x37,0x02,
+  0x3F,0x02,0x3B,0x24,0x2B,0x2C,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x2C,0x27,0x04,
+  0x2F,0x02,0xF8,0xF8,0xB8,                                                           /* 0x32 B */
+  0xF8,0xF8,0xC7,0x3F,0x03,0x2C,0x2A,0x24,0x63,0x63,0x6B,0x6B,0x6B,0x6B,0x6B,0x73,
+  0x6C,0x6C,0x31,0x37,0x03,0x47,0xF8,0xF8,0xA8,                                       /* 0x33 C */
+  0xF8,0xF8,0xA7,0x02,0x3F,0x03,0x33,0x2C,0x23,0x33,0x23,0x34,0x1B,0x3B,0x1B,0x3B,
+  0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,0x33,0x23,0x33,0x23,0x24,0x2F,0x03,
+  0x37,0x01,0xF8,0xF8,0xC0,                                                           /* 0x34 D */
+  0xF8,0xF8,0xAF,0x04,0x2F,0x04,0x2B,0x6B,0x6B,0x6B,0x6B,0x6F,0x03,0x37,0x03,0x33,
+  0x6B,0x6B,0x6B,0x6B,0x6F,0x05,0x27,0x05,0xF8,0xF8,0x98,                             /* 0x35 E */
+  0xF8,0xF8,0xAF,0x05,0x27,0x05,0x23,0x6B,0x6B,0x6B,0x6B,0x6F,0x04,0x2F,0x04,0x2B,
+  0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0xF8,0xF8,0xE0,                                       /* 0x36 F */
+  0xF8,0xF8,0xC7,0x3F,0x03,0x2C,0x2A,0x24,0x63,0x63,0x6B,0x6B,0x6B,0x26,0x1B,0x26,
+  0x1B,0x3B,0x23,0x33,0x24,0x2B,0x2C,0x23,0x37,0x03,0x47,0xF8,0xF8,0xA8,              /* 0x37 G */
+  0xF8,0xF8,0xA3,0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x33,
+  0x27,0x05,0x27,0x05,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x33,
+  0x23,0x33,0xF8,0xF8,0xA0,                                                           /* 0x38 H */
+  0xF8,0xF8,0xA7,0x04,0x2F,0x04,0x4B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,
+  0x6B,0x6B,0x4F,0x04,0x2F,0x04,0xF8,0xF8,0xA8,                                       /* 0x39 I */
+  0xF8,0xF8,0xAF,0x02,0x3F,0x02,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,
+  0x6B,0x31,0x2B,0x3F,0x01,0x47,0xF8,0xF8,0xC8,                                       /* 0x3a J */
+  0xF8,0xF8,0xA3,0x34,0x1B,0x2C,0x23,0x24,0x2B,0x1C,0x33,0x1B,0x3B,0x13,0x43,0x0B,
+  0x4E,0x53,0x0B,0x4B,0x0C,0x43,0x14,0x3B,0x1C,0x33,0x24,0x2B,0x2C,0x23,0x34,0x1B,
+  0x35,0xF8,0xF8,0x90,                                                                /* 0x3b K */
+  0xF8,0xF8,0xAB,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,
+  0x6F,0x04,0x2F,0x04,0xF8,0xF8,0xA0,                                                 /* 0x3c L */
+  0xF8,0xF8,0x9B,0x3B,0x1C,0x2C,0x1C,0x2C,0x1C,0x2C,0x1A,0x0A,0x1A,0x0A,0x1A,0x0A,
+  0x1A,0x0A,0x1A,0x0A,0x1A,0x0A,0x1A,0x12,0x11,0x12,0x1A,0x12,0x0A,0x12,0x1A,0x12,
+  0x0A,0x12,0x1A,0x1B,0x1A,0x1A,0x1B,0x1A,0x1A,0x1B,0x1A,0x1A,0x4A,0x1A,0x4A,0x1A,
+  0x4A,0xF8,0xF8,0xA0,                                                                /* 0x3d M */
+  0xF8,0xF8,0xA3,0x3A,0x23,0x3A,0x24,0x32,0x25,0x2A,0x25,0x2A,0x26,0x22,0x22,0x0C,
+  0x1A,0x22,0x13,0x1A,0x22,0x14,0x12,0x22,0x1C,0x0A,0x22,0x26,0x22,0x2D,0x22,0x2D,
+  0x22,0x34,0x22,0x3B,0x22,0x3B,0xF8,0xF8,0xA0,                                       /* 0x3e N */
+  0xF8,0xF8,0xBE,0x4F,0x01,0x3B,0x23,0x2B,0x33,0x23,0x33,0x1B,0x43,0x13,0x43,0x13,
+  0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x1B,0x33,0x23,0x33,0x2B,0x23,0x3F,0x01,0x4E,
+  0xF8,0xF8,0xB8,                                                                     /* 0x3f O */
+  0xF8,0xF8,0xAF,0x03,0x37,0x04,0x2B,0x2C,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x2C,
+  0x23,0x24,0x2F,0x03,0x37,0x01,0x43,0x6B,0x6B,0x6B,0x6B,0x6B,0xF8,0xF8,0xE0,         /* 0x40 P */
+  0xF8,0xF8,0xBE,0x4F,0x01,0x3B,0x23,0x2B,0x33,0x23,0x33,0x1B,0x43,0x13,0x43,0x13,
+  0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x1B,0x33,0x23,0x33,0x2B,0x23,0x3F,0x01,0x4E,
+  0x74,0x74,0x6C,0x71,0x88,                                                           /* 0x41 Q */
+  0xF8,0xF8,0xA7,0x02,0x3F,0x03,0x33,0x24,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x23,
+  0x37,0x02,0x3F,0x01,0x43,0x14,0x3B,0x1B,0x3B,0x1C,0x33,0x24,0x2B,0x2C,0x23,0x33,
+  0x23,0x34,0xF8,0xF8,0x98,                                                           /* 0x42 R */
+  0xF8,0xF8,0xBF,0x3F,0x03,0x2C,0x2A,0x2B,0x6B,0x6C,0x6D,0x67,0x5F,0x65,0x6B,0x6B,
+  0x6B,0x22,0x33,0x2F,0x04,0x3F,0xF8,0xF8,0xB8,                                       /* 0x43 S */
+  0xF8,0xF8,0x97,0x07,0x01,0x0F,0x07,0x01,0x3B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,
+  0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0xF8,0xF8,0xC8,                                       /* 0x44 T */
+  0xF8,0xF8,0xA3,0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,
+  0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x1C,0x2C,0x23,0x2B,0x37,0x02,
+  0x47,0xF8,0xF8,0xB0,                                                                /* 0x45 U */
+  0xF8,0xF8,0x93,0x53,0x0B,0x43,0x13,0x43,0x1B,0x3B,0x1B,0x33,0x24,0x2B,0x2B,0x2B,
+  0x2B,0x23,0x3B,0x1B,0x3B,0x1A,0x4B,0x0B,0x4B,0x0B,0x4E,0x5D,0x5D,0x63,0xF8,0xF8,
+  0xC0,                                                                               /* 0x46 V */
+  0xF8,0xF8,0x92,0x64,0x65,0x5A,0x0A,0x22,0x22,0x12,0x1C,0x1A,0x12,0x1C,0x1A,0x12,
+  0x1C,0x1A,0x12,0x1C,0x1A,0x13,0x11,0x12,0x0B,0x1A,0x0A,0x12,0x0A,0x22,0x0A,0x12,
+  0x0A,0x22,0x0A,0x12,0x0A,0x22,0x09,0x1D,0x24,0x24,0x24,0x23,0x2C,0x23,0xF8,0xF8,
+  0xA8,                                                                               /* 0x47 W */
+  0xF8,0xF8,0x9C,0x43,0x14,0x33,0x24,0x23,0x2C,0x1B,0x3C,0x0B,0x4E,0x5C,0x64,0x65,
+  0x56,0x52,0x0C,0x42,0x1C,0x32,0x2C,0x23,0x33,0x1B,0x3C,0x0B,0x4C,0xF8,0xF8,0x90,    /* 0x48 X */
+  0xF8,0xF8,0x93,0x53,0x0B,0x43,0x1B,0x3A,0x23,0x32,0x33,0x23,0x34,0x13,0x43,0x0B,
+  0x55,0x5D,0x63,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0xF8,0xF8,0xC8,                        /* 0x49 Y */
+  0xF8,0xF8,0xA7,0x05,0x27,0x05,0x6B,0x63,0x63,0x63,0x63,0x6A,0x6A,0x6B,0x63,0x63,
+  0x63,0x63,0x6F,0x06,0x1F,0x06,0xF8,0xF8,0xA0,                                       /* 0x4a Z */
+  0xB7,0x01,0x47,0x01,0x43,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,
+  0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6F,0x01,0x47,0x01,0x90,                   /* 0x4b [ */
+  0x8A,0x7A,0x72,0x7A,0x72,0x7A,0x72,0x7A,0x72,0x7A,0x72,0x7A,0x72,0x7A,0x72,0x7A,
+  0x72,0x7A,0x72,0x7A,0x72,0x7A,0x72,0x7A,0x88,                                       /* 0x4c \ */
+  0x97,0x01,0x47,0x01,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,
+  0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x47,0x01,0x47,0x01,0xB0,                   /* 0x4d ] */
+  0xF8,0x49,0x79,0x73,0x6B,0x64,0x62,0x0A,0x53,0x0A,0x52,0x1A,0x42,0x22,0x42,0x2A,
+  0x32,0x32,0x32,0x32,0x2A,0x42,0x22,0x42,0x1A,0x52,0xF8,0xF8,0xF8,0xF8,0xA8,         /* 0x4e ^ */
+  0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xD7,0x07,0x07,0x07,0x04,0xF8,
+  0x88,                                                                               /* 0x4f _ */
+  0x33,0x73,0x73,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0x08,    /* 0x50 ` */
+  0xF8,0xF8,0xF8,0xC6,0x47,0x02,0x3A,0x24,0x6B,0x6B,0x47,0x01,0x3F,0x02,0x33,0x23,
+  0x2B,0x2B,0x2B,0x2B,0x2B,0x2B,0x2C,0x1C,0x37,0x0C,0x2C,0x1C,0xF8,0xF8,0x98,         /* 0x51 a */
+  0x93,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x14,0x3B,0x0F,0x2D,0x1B,0x2C,0x2B,0x23,0x33,
+  0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x2B,0x2C,0x1C,0x2F,0x03,
+  0x32,0x15,0xF8,0xF8,0xB8,                                                           /* 0x52 b */
+  0xF8,0xF8,0xF8,0xCF,0x3F,0x03,0x2C,0x31,0x2B,0x63,0x6B,0x6B,0x6B,0x6B,0x6C,0x6B,
+  0x6D,0x29,0x37,0x03,0x47,0xF8,0xF8,0xA8,                                            /* 0x53 c */
+  0xE3,0x6B,0x6B,0x6B,0x6B,0x6B,0x3C,0x13,0x2F,0x04,0x24,0x1D,0x23,0x33,0x1B,0x3B,
+  0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x1C,0x2C,0x23,0x25,0x2F,0x0B,
+  0x35,0x13,0xF8,0xF8,0x98,                                                           /* 0x54 d */
+  0xF8,0xF8,0xF8,0xCD,0x4F,0x01,0x3C,0x1B,0x33,0x2B,0x23,0x33,0x23,0x33,0x27,0x05,
+  0x27,0x05,0x23,0x6B,0x73,0x6C,0x31,0x37,0x03,0x47,0xF8,0xF8,0xA8,                   /* 0x55 e */
+  0xC7,0x01,0x3F,0x02,0x34,0x63,0x6B,0x6B,0x4F,0x06,0x1F,0x06,0x3B,0x6B,0x6B,0x6B,
+  0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0xF8,0xF8,0xC8,                             /* 0x56 f */
+  0xF8,0xF8,0xF8,0xCC,0x13,0x2F,0x04,0x24,0x1D,0x23,0x33,0x1B,0x3B,0x1B,0x3B,0x1B,
+  0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x1C,0x2C,0x23,0x25,0x2F,0x0B,0x35,0x13,0x6B,
+  0x63,0x2A,0x2C,0x2F,0x03,0x5B,0x28,                                                 /* 0x57 g */
+  0x93,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x1C,0x33,0x0F,0x2D,0x1C,0x24,0x2B,0x23,0x33,
+  0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x33,
+  0x23,0x33,0xF8,0xF8,0xA0,                                                           /* 0x58 h */
+  0xBB,0x6B,0x6B,0xF8,0xCF,0x01,0x47,0x01,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,
+  0x6B,0x6B,0x6B,0x6B,0xF8,0xF8,0xC0,                                                 /* 0x59 i */
+  0xCB,0x6B,0x6B,0xF8,0xC7,0x02,0x3F,0x02,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,
+  0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x31,0x2B,0x3F,0x02,0x46,0x38,                        /* 0x5a j */
+  0x9B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x24,0x2B,0x1C,0x33,0x1B,0x3B,0x14,0x3B,0x0C,
+  0x43,0x0B,0x4F,0x4B,0x0B,0x4B,0x0C,0x43,0x14,0x3B,0x1B,0x3B,0x1C,0x33,0x24,0x2B,
+  0x2C,0xF8,0xF8,0x98,                                                                /* 0x5b k */
+  0x9F,0x01,0x47,0x01,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,
+  0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0xF8,0xF8,0xB8,                                       /* 0x5c l */
+  0xF8,0xF8,0xF8,0xA3,0x13,0x1A,0x1B,0x0C,0x14,0x17,0x07,0x14,0x14,0x0B,0x14,0x13,
+  0x13,0x13,0x1B,0x13,0x13,0x1B,0x13,0x13,0x1B,0x13,0x13,0x1B,0x13,0x13,0x1B,0x13,
+  0x13,0x1B,0x13,0x13,0x1B,0x13,0x13,0x1B,0x13,0x13,0x1B,0x13,0xF8,0xF8,0x98,         /* 0x5d m */
+  0xF8,0xF8,0xF8,0xAB,0x1C,0x33,0x0F,0x2D,0x1C,0x24,0x2B,0x23,0x33,0x23,0x33,0x23,
+  0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x33,0xF8,
+  0xF8,0xA0,                                                                          /* 0x5e n */
+  0xF8,0xF8,0xF8,0xC5,0x4F,0x02,0x34,0x1C,0x2B,0x2B,0x23,0x3B,0x1B,0x3B,0x1B,0x3B,
+  0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x23,0x2B,0x2C,0x1C,0x37,0x02,0x4D,0xF8,0xF8,0xC0,    /* 0x5f o */
+  0xF8,0xF8,0xF8,0xAB,0x14,0x3B,0x0F,0x2D,0x1B,0x2C,0x2B,0x23,0x33,0x23,0x33,0x23,
+  0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x2B,0x2C,0x1C,0x2F,0x03,0x33,0x14,0x3B,
+  0x6B,0x6B,0x6B,0x6B,0x58,                                                           /* 0x60 p */
+  0xF8,0xF8,0xF8,0xC4,0x13,0x2F,0x04,0x24,0x1D,0x23,0x33,0x1B,0x3B,0x1B,0x3B,0x1B,
+  0x3B,0x1B,0x3B,0x1B,0x3B,0x1B,0x3B,0x1C,0x2C,0x23,0x25,0x2F,0x0B,0x34,0x1B,0x6B,
+  0x6B,0x6B,0x6B,0x6B,0x10,                                                           /* 0x61 q */
+  0xF8,0xF8,0xF8,0xBB,0x15,0x33,0x0E,0x35,0x1A,0x34,0x22,0x33,0x6B,0x6B,0x6B,0x6B,
+  0x6B,0x6B,0x6B,0x6B,0x6B,0xF8,0xF8,0xD8,                                            /* 0x62 r */
+  0xF8,0xF8,0xF8,0xC7,0x47,0x02,0x34,0x29,0x33,0x6B,0x6E,0x5F,0x66,0x6C,0x6B,0x6B,
+  0x2A,0x2C,0x2F,0x03,0x3F,0xF8,0xF8,0xB8,                                            /* 0x63 s */
+  0xF8,0xF8,0xBB,0x6B,0x57,0x05,0x27,0x05,0x3B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,0x6B,
+  0x6B,0x6C,0x6F,0x01,0x4F,0xF8,0xF8,0xA0,                                            /* 0x64 t */
+  0xF8,0xF8,0xF8,0xAB,0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x23,
+  0x33,0x23,0x33,0x23,0x33,0x23,0x33,0x23,0x2C,0x24,0x1D,0x2F,0x0B,0x34,0x1B,0xF8,
+  0xF8,0xA0,                                                                          /* 0x65 u */
+  0xF8,0xF8,0xF8,0xA4,0x3B,0x1B,0x33,0x23,0x33,0x24,0x2B,0x2B,0x2A,0x33,0x23,0x3B,
+  0x1B,0x3B,0x1A,0x4B,0x0B,0x4B,0x0B,0x4B,0x0A,0x5D,0x5D,0x63,0xF8,0xF8,0xC0,         /* 0x66 v */
+  0xF8,0xF8,0xF8,0x9A,0x65,0x23,0x25,0x23,0x21,0x12,0x1C,0x1A,0x12,0x1C,0x1A,0x12,
+  0x19,0x11,0x1A,0x13,0x0A,0x12,0x12,0x13,0x0A,0x12,0x11,0x22,0x0A,0x12,0x0A,0x22,
+  0x09,0x1A,0x0A,0x24,0x24,0x24,0x24,0x24,0x23,0x32,0x2B,0xF8,0xF8,0xA8,              /* 0x67 w */
+  0xF8,0xF8,0xF8,0xA4,0x3A,0x24,0x2A,0x34,0x1A,0x43,0x13,0x44,0x0A,0x55,0x64,0x64,
+  0x5E,0x4B,0x0C,0x42,0x1B,0x3B,0x1C,0x2B,0x2C,0x1B,0x3C,0xF8,0xF8,0x98,              /* 0x68 x */
+  0xF8,0xF8,0xF8,0xA4,0x3B,0x1B,0x3A,0x23,0x33,0x2B,0x2A,0x33,0x23,0x34,0x1B,0x3B,
+  0x13,0x44,0x0B,0x4E,0x56,0x5C,0x64,0x63,0x72,0x6B,0x6A,0x6B,0x55,0x5C,0x50,         /* 0x69 y */
+  0xF8,0xF8,0xF8,0xAF,0x05,0x27,0x05,0x6B,0x63,0x63,0x63,0x63,0x63,0x63,0x63,0x63,
+  0x63,0x6F,0x05,0x27,0x05,0xF8,0xF8,0xA0,                                            /* 0x6a z */
+  0xC5,0x56,0x4C,0x63,0x6B,0x6B,0x73,0x6B,0x6B,0x6B,0x63,0x55,0x5D,0x73,0x73,0x6B,
+  0x6B,0x6B,0x63,0x6B,0x6B,0x6C,0x6E,0x5D,0x98,                                       /* 0x6b { */
+  0xBA,0x72,0x72,0x72,0x72,0x72,0x72,0x72,0x72,0x72,0x72,0x72,0x72,0x72,0x72,0x72,
+  0x72,0x72,0x72,0x72,0x72,0x72,0x72,0x72,0xB8,                                       /* 0x6c | */
+  0x95,0x5E,0x6C,0x6B,0x6B,0x6B,0x63,0x6B,0x6B,0x6B,0x73,0x75,0x5D,0x53,0x63,0x6B,
+  0x6B,0x6B,0x73,0x6B,0x6B,0x64,0x4E,0x55,0xC8,                                       /* 0x6d } */
+  0xF8,0xF8,0xF8,0xF8,0xF8,0xF8,0x4C,0x32,0x1F,0x01,0x1A,0x12,0x1F,0x01,0x1A,0x34,
+  0xF8,0xF8,0xF8,0xF8,0xF8,0x40,                                                      /* 0x6e ~ */
+};
+
+
+/*
+ *  offset of each bitmap in FontData[]
+ */
+
+const uint16_t FontIndex[] PROGMEM = {
+  0,          /* 0x00 n/a */
+  14,         /* 0x01 symbol: diode A-C */
+  62,         /* 0x02 symbol: diode C-A */
+  110,        /* 0x03 symbol: capacitor */
+  153,        /* 0x04 omega */
+  193,        /* 0x05  (micro) */
+  232,        /* 0x06 symbol: resistor left side */
+  261,        /* 0x07 symbol: resistor right side */
+  290,        /* 0x08  */
+  327,        /* 0x09  */
+  365,        /* 0x0a  */
+  404,        /* 0x0b  */
+  447,        /* 0x0c  */
+  481,        /* 0x0d  */
+  516,        /* 0x0e  */
+  553,        /* 0x0f n/a */
+  567,        /* 0x10 space */
+  581,        /* 0x11 ! */
+  603,        /* 0x12 " */
+  627,        /* 0x13 # */
+  669,        /* 0x14 $ */
+  708,        /* 0x15 % */
+  763,        /* 0x16 & */
+  803,        /* 0x17  */
+  820,        /* 0x18 ( */
+  845,        /* 0x19 ) */
+  870,        /* 0x1a * */
+  897,        /* 0x1b + */
+  919,        /* 0x1c , */
+  936,        /* 0x1d - */
+  953,        /* 0x1e . */
+  968,        /* 0x1f / */
+  993,        /* 0x20 0 */
+  1031,       /* 0x21 1 */
+  1058,       /* 0x22 2 */
+  1085,       /* 0x23 3 */
+  1112,       /* 0x24 4 */
+  1145,       /* 0x25 5 */
+  1174,       /* 0x26 6 */
+  1210,       /* 0x27 7 */
+  1236,       /* 0x28 8 */
+  1275,       /* 0x29 9 */
+  1311,       /* 0x2a : */
+  1328,       /* 0x2b ; */
+  1347,       /* 0x2c < */
+  1368,       /* 0x2d = */
+  1387,       /* 0x2e > */
+  1408,       /* 0x2f ? */
+  1434,       /* 0x30 @ */
+  1484,       /* 0x31 A */
+  1518,       /* 0x32 B */
+  1555,       /* 0x33 C */
+  1580,       /* 0x34 D */
+  1617,       /* 0x35 E */
+  1644,       /* 0x36 F */
+  1669,       /* 0x37 G */
+  1699,       /* 0x38 H */
+  1736,       /* 0x39 I */
+  1761,       /* 0x3a J */
+  1786,       /* 0x3b K */
+  1822,       /* 0x3c L */
+  1845,       /* 0x3d M */
+  1897,       /* 0x3e N */
+  1938,       /* 0x3f O */
+  1973,       /* 0x40 P */
+  2004,       /* 0x41 Q */
+  2041,       /* 0x42 R */
+  2078,       /* 0x43 S */
+  2103,       /* 0x44 T */
+  2128,       /* 0x45 U */
+  2164,       /* 0x46 V */
+  2197,       /* 0x47 W */
+  2246,       /* 0x48 X */
+  2278,       /* 0x49 Y */
+  2306,       /* 0x4a Z */
+  2331,       /* 0x4b [ */
+  2360,       /* 0x4c \ */
+  2385,       /* 0x4d ] */
+  2414,       /* 0x4e ^ */
+  2445,       /* 0x4f _ */
+  2462,       /* 0x50 ` */
+  2478,       /* 0x51 a */
+  2509,       /* 0x52 b */
+  2546,       /* 0x53 c */
+  2570,       /* 0x54 d */
+  2607,       /* 0x55 e */
+  2636,       /* 0x56 f */
+  2663,       /* 0x57 g */
+  2702,       /* 0x58 h */
+  2739,       /* 0x59 i */
+  2762,       /* 0x5a j */
+  2790,       /* 0x5b k */
+  2826,       /* 0x5c l */
+  2851,       /* 0x5d m */
+  2898,       /* 0x5e n */
+  2932,       /* 0x5f o */
+  2964,       /* 0x60 p */
+  3001,       /* 0x61 q */
+  3038,       /* 0x62 r */
+  3062,       /* 0x63 s */
+  3086,       /* 0x64 t */
+  3110,       /* 0x65 u */
+  3144,       /* 0x66 v */
+  3175,       /* 0x67 w */
+  3221,       /* 0x68 x */
+  3251,       /* 0x69 y */
+  3282,       /* 0x6a z */
+  3306,       /* 0x6b { */
+  3331,       /* 0x6c | */
+  3356,       /* 0x6d } */
+  3381,       /* 0x6e ~ */
+};
+
+
+/*
+ *  font lookup table for ISO 8859-1
+ *  - 8 bit ISO 8859-1 to custom font
+ *  - ff: no bitmap available
+ */
+
+const uint8_t FontTable[] PROGMEM = {
+  0xff,        /* 0x00 -> n/a */
+  0x01,        /* 0x01 -> symbol: diode A-C */
+  0x02,        /* 0x02 -> symbol: diode C-A */
+  0x03,        /* 0x03 -> symbol: capacitor */
+  0x04,        /* 0x04 -> omega */
+  0x05,        /* 0x05 ->  (micro) */
+  0x06,        /* 0x06 -> symbol: resistor left side */
+  0x07,        /* 0x07 -> symbol: resistor right side */
+  0xff,        /* 0x08 -> n/a */
+  0xff,        /* 0x09 -> n/a */
+  0xff,        /* 0x0a -> n/a */
+  0xff,        /* 0x0b -> n/a */
+  0xff,        /* 0x0c -> n/a */
+  0xff,        /* 0x0d -> n/a */
+  0xff,        /* 0x0e -> n/a */
+  0xff,        /* 0x0f -> n/a */
+
+  0xff,        /* 0x10 -> n/a */
+  0xff,        /* 0x11 -> n/a */
+  0xff,        /* 0x12 -> n/a */
+  0xff,        /* 0x13 -> n/a */
+  0xff,        /* 0x14 -> n/a */
+  0xff,        /* 0x15 -> n/a */
+  0xff,        /* 0x16 -> n/a */
+  0xff,        /* 0x17 -> n/a */
+  0xff,        /* 0x18 -> n/a */
+  0xff,        /* 0x19 -> n/a */
+  0xff,        /* 0x1a -> n/a */
+  0xff,        /* 0x1b -> n/a */
+  0xff,        /* 0x1c -> n/a */
+  0xff,        /* 0x1d -> n/a */
+  0xff,        /* 0x1e -> n/a */
+  0xff,        /* 0x1f -> n/a */
+
+  0x10,        /* 0x20 -> space */
+  0x11,        /* 0x21 -> ! */
+  0x12,        /* 0x22 -> " */
+  0x13,        /* 0x23 -> # */
+  0x14,        /* 0x24 -> $ */
+  0x15,        /* 0x25 -> % */
+  0x16,        /* 0x26 -> & */
+  0x17,        /* 0x27 ->  */
+  0x18,        /* 0x28 -> ( */
+  0x19,        /* 0x29 -> ) */
+  0x1a,        /* 0x2a -> * */
+  0x1b,        /* 0x2b -> + */
+  0x1c,        /* 0x2c -> , */
+  0x1d,        /* 0x2d -> - */
+  0x1e,        /* 0x2e -> . */
+  0x1f,        /* 0x2f -> / */
+
+  0x20,        /* 0x30 -> 0 */
+  0x21,        /* 0x31 -> 1 */
+  0x22,        /* 0x32 -> 2 */
+  0x23,        /* 0x33 -> 3 */
+  0x24,        /* 0x34 -> 4 */
+  0x25,        /* 0x35 -> 5 */
+  0x26,        /* 0x36 -> 6 */
+  0x27,        /* 0x37 -> 7 */
+  0x28,        /* 0x38 -> 8 */
+  0x29,        /* 0x39 -> 9 */
+  0x2a,        /* 0x3a -> : */
+  0x2b,        /* 0x3b -> ; */
+  0x2c,        /* 0x3c -> < */
+  0x2d,        /* 0x3d -> = */
+  0x2e,        /* 0x3e -> > */
+  0x2f,        /* 0x3f -> ? */
+
+  0x30,        /* 0x40 -> @ */
+  0x31,        /* 0x41 -> A */
+  0x32,        /* 0x42 -> B */
+  0x33,        /* 0x43 -> C */
+  0x34,        /* 0x44 -> D */
+  0x35,        /* 0x45 -> E */
+  0x36,        /* 0x46 -> F */
+  0x37,        /* 0x47 -> G */
+  0x38,        /* 0x48 -> H */
+  0x39,        /* 0x49 -> I */
+  0x3a,        /* 0x4a -> J */
+  0x3b,        /* 0x4b -> K */
+  0x3c,        /* 0x4c -> L */
+  0x3d,        /* 0x4d -> M */
+  0x3e,        /* 0x4e -> N */
+  0x3f,        /* 0x4f -> O */
+
+  0x40,        /* 0x50 -> P */
+  0x41,        /* 0x51 -> Q */
+  0x42,        /* 0x52 -> R */
+  0x43,        /* 0x53 -> S */
+  0x44,        /* 0x54 -> T */
+  0x45,        /* 0x55 -> U */
+  0x46,        /* 0x56 -> V */
+  0x47,        /* 0x57 -> W */
+  0x48,        /* 0x58 -> X */
+  0x49,        /* 0x59 -> Y */
+  0x4a,        /* 0x5a -> Z */
+  0x4b,        /* 0x5b -> [ */
+  0x4c,        /* 0x5c -> \ */
+  0x4d,        /* 0x5d -> ] */
+  0x4e,        /* 0x5e -> ^ */
+  0x4f,        /* 0x5f -> _ */
+
+  0x50,        /* 0x60 -> ` */
+  0x51,        /* 0x61 -> a */
+  0x52,        /* 0x62 -> b */
+  0x53,        /* 0x63 -> c */
+  0x54,        /* 0x64 -> d */
+  0x55,        /* 0x65 -> e */
+  0x56,        /* 0x66 -> f */
+  0x57,        /* 0x67 -> g */
+  0x58,        /* 0x68 -> h */
+  0x59,        /* 0x69 -> i */
+  0x5a,        /* 0x6a -> j */
+  0x5b,        /* 0x6b -> k */
+  0x5c,        /* 0x6c -> l */
+  0x5d,        /* 0x6d -> m */
+  0x5e,        /* 0x6e -> n */
+  0x5f,        /* 0x6f -> o */
+
+  0x60,        /* 0x70 -> p */
+  0x61,        /* 0x71 -> q */
+  0x62,        /* 0x72 -> r */
+  0x63,        /* 0x73 -> s */
+  0x64,        /* 0x74 -> t */
+  0x65,        /* 0x75 -> u */
+  0x66,        /* 0x76 -> v */
+  0x67,        /* 0x77 -> w */
+  0x68,        /* 0x78 -> x */
+  0x69,        /* 0x79 -> y */
+  0x6a,        /* 0x7a -> z */
+  0x6b,        /* 0x7b -> { */
+  0x6c,        /* 0x7c -> | */
+  0x6d,        /* 0x7d -> } */
+  0x6e,        /* 0x7e -> ~ */
+  0xff,        /* 0x7f -> n/a */
+
+  0xff,        /* 0x80 -> n/a */
+  0xff,        /* 0x81 -> n/a */
+  0xff,        /* 0x82 -> n/a */
+  0xff,        /* 0x83 -> n/a */
+  0xff,        /* 0x84 -> n/a */
+  0xff,        /* 0x85 -> n/a */
+  0xff,        /* 0x86 -> n/a */
+  0xff,        /* 0x87 -> n/a */
+  0xff,        /* 0x88 -> n/a */
+  0xff,        /* 0x89 -> n/a */
+  0xff,        /* 0x8a -> n/a */
+  0xff,        /* 0x8b -> n/a */
+  0xff,        /* 0x8c -> n/a */
+  0xff,        /* 0x8d -> n/a */
+  0xff,        /* 0x8e -> n/a */
+  0xff,        /* 0x8f -> n/a */
+
+  0xff,        /* 0x90 -> n/a */
+  0xff,        /* 0x91 -> n/a */
+  0xff,        /* 0x92 -> n/a */
+  0xff,        /* 0x93 -> n/a */
+  0xff,        /* 0x94 -> n/a */
+  0xff,        /* 0x95 -> n/a */
+  0xff,        /* 0x96 -> n/a */
+  0xff,        /* 0x97 -> n/a */
+  0xff,        /* 0x98 -> n/a */
+  0xff,        /* 0x99 -> n/a */
+  0xff,        /* 0x9a -> n/a */
+  0xff,        /* 0x9b -> n/a */
+  0xff,        /* 0x9c -> n/a */
+  0xff,        /* 0x9d -> n/a */
+  0xff,        /* 0x9e -> n/a */
+  0xff,        /* 0x9f -> n/a */
+
+  0xff,        /* 0xa0 -> n/a */
+  0xff,        /* 0xa1 -> n/a */
+  0xff,        /* 0xa2 -> n/a */
+  0xff,        /* 0xa3 -> n/a */
+  0xff,        /* 0xa4 -> n/a */
+  0xff,        /* 0xa5 -> n/a */
+  0xff,        /* 0xa6 -> n/a */
+  0xff,        /* 0xa7 -> n/a */
+  0xff,        /* 0xa8 -> n/a */
+  0xff,        /* 0xa9 -> n/a */
+  0xff,        /* 0xaa -> n/a */
+  0xff,        /* 0xab -> n/a */
+  0xff,        /* 0xac -> n/a */
+  0xff,        /* 0xad -> n/a */
+  0xff,        /* 0xae -> n/a */
+  0xff,        /* 0xaf -> n/a */
+
+  0xff,        /* 0xb0 -> n/a */
+  0xff,        /* 0xb1 -> n/a */
+  0xff,        /* 0xb2 -> n/a */
+  0xff,        /* 0xb3 -> n/a */
+  0xff,        /* 0xb4 -> n/a */
+  0x05,        /* 0xb5 ->  (micro) */
+  0xff,        /* 0xb6 -> n/a */
+  0xff,        /* 0xb7 -> n/a */
+  0xff,        /* 0xb8 -> n/a */
+  0xff,        /* 0xb9 -> n/a */
+  0xff,        /* 0xba -> n/a */
+  0xff,        /* 0xbb -> n/a */
+  0xff,        /* 0xbc -> n/a */
+  0xff,        /* 0xbd -> n/a */
+  0xff,        /* 0xbe -> n/a */
+  0xff,        /* 0xbf -> n/a */
+
+  0xff,        /* 0xc0 -> n/a */
+  0xff,        /* 0xc1 -> n/a */
+  0xff,        /* 0xc2 -> n/a */
+  0xff,        /* 0xc3 -> n/a */
+  0x08,        /* 0xc4 ->  */
+  0xff,        /* 0xc5 -> n/a */
+  0xff,        /* 0xc6 -> n/a */
+  0xff,        /* 0xc7 -> n/a */
+  0xff,        /* 0xc8 -> n/a */
+  0xff,        /* 0xc9 -> n/a */
+  0xff,        /* 0xca -> n/a */
+  0xff,        /* 0xcb -> n/a */
+  0xff,        /* 0xcc -> n/a */
+  0xff,        /* 0xcd -> n/a */
+  0xff,        /* 0xce -> n/a */
+  0xff,        /* 0xcf -> n/a */
+
+  0xff,        /* 0xd0 -> n/a */
+  0xff,        /* 0xd1 -> n/a */
+  0xff,        /* 0xd2 -> n/a */
+  0xff,        /* 0xd3 -> n/a */
+  0xff,        /* 0xd4 -> n/a */
+  0xff,        /* 0xd5 -> n/a */
+  0x09,        /* 0xd6 ->  */
+  0xff,        /* 0xd7 -> n/a */
+  0xff,        /* 0xd8 -> n/a */
+  0xff,        /* 0xd9 -> n/a */
+  0xff,        /* 0xda -> n/a */
+  0xff,        /* 0xdb -> n/a */
+  0x0a,        /* 0xdc ->  */
+  0xff,        /* 0xdd -> n/a */
+  0xff,        /* 0xde -> n/a */
+  0x0b,        /* 0xdf ->  */
+
+  0xff,        /* 0xe0 -> n/a */
+  0xff,        /* 0xe1 -> n/a */
+  0xff,        /* 0xe2 -> n/a */
+  0xff,        /* 0xe3 -> n/a */
+  0x0c,        /* 0xe4 ->  */
+  0xff,        /* 0xe5 -> n/a */
+  0xff,        /* 0xe6 -> n/a */
+  0xff,        /* 0xe7 -> n/a */
+  0xff,        /* 0xe8 -> n/a */
+  0xff,        /* 0xe9 -> n/a */
+  0xff,        /* 0xea -> n/a */
+  0xff,        /* 0xeb -> n/a */
+  0xff,        /* 0xec -> n/a */
+  0xff,        /* 0xed -> n/a */
+  0xff,        /* 0xee -> n/a */
+  0xff,        /* 0xef -> n/a */
+
+  0xff,        /* 0xf0 -> n/a */
+  0xff,        /* 0xf1 -> n/a */
+  0xff,        /* 0xf2 -> n/a */
+  0xff,        /* 0xf3 -> n/a */
+  0xff,        /* 0xf4 -> n/a */
+  0xff,        /* 0xf5 -> n/a */
+  0x0d,        /* 0xf6 ->  */
+  0xff,        /* 0xf7 -> n/a */
+  0xff,        /* 0xf8 -> n/a */
+  0xff,        /* 0xf9 -> n/a */
+  0xff,        /* 0xfa -> n/a */
+  0xff,        /* 0xfb -> n/a */
+  0x0e,        /* 0xfc ->  */
+  0xff,        /* 0xfd -> n/a */
+  0xff,        /* 0xfe -> n/a */
+  0xff,        /* 0xff -> n/a */
+};
+
+
+#endif
+
+/* ************************************************************************
+ *   EOF
+ * ************************************************************************ */
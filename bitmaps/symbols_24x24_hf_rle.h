@@ -0,0 +1,177 @@
+/* ************************************************************************
+ *
+ *   24x24 component symbols 
+ *   horizontally aligned, horizontal bit order flipped
+ *   run-length encoded (created by bitmap_rle.py)
+ *
+ *   (c) 2015-2017 by Markus Reschke
+ *
+ * ************************************************************************ */
+
+
+/* ************************************************************************
+ *   symbol data
+ * ************************************************************************ */
+
+#ifdef SYMBOLS_24X24_HF_RLE
+
+
+/* symbol size */
+#define SYMBOL_SIZE_X       24     /* width:  24 dots */
+#define SYMBOL_SIZE_Y       24     /* height: 24 dots */
+
+/* symbol data format */
+#define SYMBOL_BYTES_N      72     /* 72 bytes per symbol */
+#define SYMBOL_BYTES_X       3     /* 3 bytes in x direction */
+#define SYMBOL_BYTES_Y      24     /* 24 bytes in y direction */
+
+
+/*
+ *  symbol bitmaps (run-length encoded)
+ *  - format:
+ *    - pixels read row by row (top to down, left to right)
+ *    - one byte per pair of runs:
+ *      bits 7-3: background pixels (0-31)
+ *      bits 2-0: foreground pixels (0-7)
+ *    - longer runs are continued by the next pair
+ */
+const uint8_t SymbolData[] PROGMEM = {
+  0x89,0xB9,0x85,0x11,0x72,0x2B,0x62,0x4A,0x51,0x51,0x11,0x49,0x1A,0x21,0x19,0x41,
+  0x22,0x19,0x29,0x39,0x22,0x11,0x31,0x31,0x2A,0x09,0x41,0x29,0x2B,0x49,0x17,0x04,
+  0x51,0x29,0x2B,0x49,0x29,0x2A,0x09,0x41,0x31,0x22,0x11,0x09,0x21,0x39,0x22,0x1A,
+  0x21,0x41,0x1A,0x13,0x19,0x49,0x51,0x11,0x52,0x4A,0x6A,0x2B,0x85,0x11,0xB9,0xB9,
+  0xF0,                                                                               /* BJT npn */
+  0x89,0xB9,0x85,0x11,0x72,0x2B,0x62,0x4A,0x51,0x51,0x11,0x49,0x1A,0x11,0x09,0x19,
+  0x41,0x22,0x12,0x29,0x39,0x22,0x13,0x21,0x31,0x2A,0x09,0x41,0x29,0x2B,0x49,0x17,
+  0x04,0x51,0x29,0x2B,0x49,0x29,0x2A,0x09,0x41,0x31,0x22,0x11,0x31,0x39,0x22,0x19,
+  0x29,0x41,0x1A,0x21,0x19,0x49,0x51,0x11,0x52,0x4A,0x6A,0x2B,0x85,0x11,0xB9,0xB9,
+  0xF0,                                                                               /* BJT pnp */
+  0x89,0xB9,0x85,0x11,0x72,0x2B,0x62,0x4A,0x51,0x21,0x31,0x09,0x49,0x11,0x0F,0x01,
+  0x09,0x41,0x19,0x09,0x49,0x39,0x19,0x59,0x31,0x21,0x29,0x31,0x29,0x21,0x09,0x12,
+  0x31,0x29,0x21,0x0F,0x01,0x19,0x29,0x21,0x09,0x12,0x11,0x19,0x29,0x21,0x29,0x11,
+  0x19,0x31,0x19,0x41,0x11,0x39,0x19,0x09,0x31,0x11,0x1F,0x02,0x0F,0x01,0x09,0x49,
+  0x21,0x31,0x09,0x52,0x4A,0x6A,0x2C,0x7D,0x11,0xB9,0xB9,0xF0,                        /* MOSFET enh n-ch */
+  0x89,0xB9,0x85,0x11,0x72,0x2B,0x62,0x4A,0x51,0x21,0x31,0x09,0x27,0x02,0x0F,0x01,
+  0x09,0x41,0x19,0x09,0x49,0x39,0x19,0x59,0x31,0x21,0x21,0x39,0x29,0x21,0x09,0x12,
+  0x31,0x29,0x21,0x0F,0x01,0x19,0x29,0x21,0x09,0x12,0x11,0x19,0x29,0x21,0x21,0x19,
+  0x19,0x31,0x19,0x41,0x11,0x39,0x19,0x09,0x31,0x11,0x41,0x11,0x0F,0x01,0x09,0x49,
+  0x21,0x31,0x09,0x52,0x4A,0x6A,0x2B,0x85,0x11,0xB9,0xB9,0xF0,                        /* MOSFET enh p-ch */
+  0x89,0xB9,0x85,0x11,0x72,0x2B,0x62,0x4A,0x51,0x21,0x31,0x09,0x49,0x11,0x0F,0x01,
+  0x09,0x41,0x19,0x09,0x49,0x39,0x19,0x09,0x49,0x31,0x21,0x09,0x19,0x31,0x29,0x21,
+  0x09,0x12,0x31,0x29,0x21,0x0F,0x01,0x19,0x29,0x21,0x09,0x12,0x11,0x19,0x29,0x21,
+  0x09,0x19,0x11,0x19,0x31,0x19,0x09,0x31,0x11,0x39,0x19,0x09,0x31,0x11,0x1F,0x02,
+  0x0F,0x01,0x09,0x49,0x21,0x31,0x09,0x52,0x4A,0x6A,0x2C,0x7D,0x11,0xB9,0xB9,0xF0,    /* MOSFET dep n-ch */
+  0x89,0xB9,0x85,0x11,0x72,0x2B,0x62,0x4A,0x51,0x21,0x31,0x09,0x27,0x02,0x0F,0x01,
+  0x09,0x41,0x19,0x09,0x49,0x39,0x19,0x09,0x49,0x31,0x21,0x09,0x11,0x39,0x29,0x21,
+  0x09,0x12,0x31,0x29,0x21,0x0F,0x01,0x19,0x29,0x21,0x09,0x12,0x11,0x19,0x29,0x21,
+  0x09,0x11,0x19,0x19,0x31,0x19,0x09,0x31,0x11,0x39,0x19,0x09,0x31,0x11,0x41,0x11,
+  0x0F,0x01,0x09,0x49,0x21,0x31,0x09,0x52,0x4A,0x6A,0x2B,0x85,0x11,0xB9,0xB9,0xF0,    /* MOSFET dep p-ch */
+  0x89,0xB9,0x85,0x11,0x72,0x2B,0x62,0x4A,0x51,0x29,0x29,0x09,0x49,0x29,0x29,0x09,
+  0x41,0x37,0x11,0x39,0x31,0x41,0x31,0x39,0x49,0x29,0x39,0x49,0x29,0x39,0x49,0x29,
+  0x39,0x49,0x29,0x21,0x11,0x49,0x31,0x1A,0x09,0x41,0x1F,0x07,0x04,0x11,0x41,0x12,
+  0x09,0x29,0x09,0x49,0x11,0x11,0x29,0x09,0x52,0x4A,0x6A,0x2B,0x85,0x11,0xB9,0xB9,
+  0xF0,                                                                               /* JFET n-ch */
+  0x89,0xB9,0x85,0x11,0x72,0x2B,0x62,0x4A,0x51,0x19,0x09,0x29,0x09,0x49,0x12,0x09,
+  0x29,0x09,0x27,0x07,0x04,0x11,0x39,0x1A,0x09,0x41,0x31,0x29,0x09,0x49,0x29,0x39,
+  0x49,0x29,0x39,0x49,0x29,0x39,0x49,0x29,0x39,0x49,0x31,0x31,0x41,0x39,0x37,0x11,
+  0x41,0x29,0x29,0x09,0x49,0x29,0x29,0x09,0x52,0x4A,0x6A,0x2B,0x85,0x11,0xB9,0xB9,
+  0xF0,                                                                               /* JFET p-ch */
+  0x89,0xB9,0x85,0x11,0x72,0x2B,0x62,0x4A,0x51,0x51,0x11,0x49,0x21,0x21,0x19,0x41,
+  0x19,0x09,0x19,0x29,0x39,0x19,0x09,0x11,0x31,0x31,0x21,0x09,0x09,0x41,0x29,0x21,
+  0x0A,0x49,0x17,0x02,0x09,0x51,0x29,0x21,0x0A,0x49,0x29,0x21,0x09,0x09,0x41,0x31,
+  0x19,0x09,0x11,0x09,0x21,0x39,0x19,0x09,0x1A,0x21,0x41,0x21,0x13,0x19,0x49,0x51,
+  0x11,0x52,0x4A,0x6A,0x2B,0x85,0x11,0xB9,0xB9,0xF0,                                  /* IGBT enh n-ch */
+  0x89,0xB9,0x85,0x11,0x72,0x2B,0x62,0x4A,0x51,0x51,0x11,0x49,0x21,0x11,0x09,0x19,
+  0x41,0x19,0x09,0x12,0x29,0x39,0x19,0x09,0x13,0x21,0x31,0x21,0x09,0x09,0x41,0x29,
+  0x21,0x0A,0x49,0x17,0x02,0x09,0x51,0x29,0x21,0x0A,0x49,0x29,0x21,0x09,0x09,0x41,
+  0x31,0x19,0x09,0x11,0x31,0x39,0x19,0x09,0x19,0x29,0x41,0x21,0x21,0x19,0x49,0x51,
+  0x11,0x52,0x4A,0x6A,0x2B,0x85,0x11,0xB9,0xB9,0xF0,                                  /* IGBT enh p-ch */
+  0xF8,0x29,0xB9,0xB9,0xB9,0x97,0x04,0x77,0x02,0x7F,0x02,0x87,0x8F,0x95,0x9D,0xA3,
+  0xAB,0xB1,0x97,0x04,0x8A,0xA9,0x09,0xA1,0x11,0x67,0x01,0x19,0xB9,0xB9,0xB9,0xF8,
+  0x20,                                                                               /* SCR */
+  0xF8,0x29,0xB9,0xB9,0xB9,0xB9,0xB9,0x77,0x07,0x05,0x49,0x2F,0x02,0x43,0x2F,0x4B,
+  0x2F,0x45,0x2D,0x4D,0x2D,0x47,0x2B,0x4F,0x2B,0x47,0x02,0x29,0x4F,0x07,0x05,0x49,
+  0x21,0x89,0x29,0x81,0x31,0x5D,0x39,0xB9,0xB9,0xB9,0x58,                             /* Triac */
+  0xF8,0x29,0xB9,0xB9,0x67,0x01,0x19,0xA1,0x11,0xA9,0x09,0xB2,0x97,0x04,0x77,0x02,
+  0x7F,0x02,0x87,0x8F,0x95,0x9D,0xA3,0xAB,0xB1,0x97,0x04,0x91,0xB9,0xB9,0xB9,0xF8,
+  0x20,                                                                               /* PUT */
+  #ifdef SW_UJT
+  0x89,0xB9,0x85,0x11,0x72,0x2B,0x62,0x4A,0x51,0x29,0x29,0x09,0x26,0x29,0x29,0x09,
+  0x41,0x09,0x27,0x11,0x39,0x11,0x09,0x09,0x41,0x31,0x22,0x09,0x49,0x29,0x1B,0x09,
+  0x49,0x29,0x32,0x49,0x29,0x39,0x49,0x29,0x39,0x49,0x31,0x31,0x41,0x39,0x37,0x11,
+  0x41,0x29,0x29,0x09,0x49,0x29,0x29,0x09,0x52,0x4A,0x6A,0x2B,0x85,0x11,0xB9,0xB9,
+  0xF0,                                                                               /* UJT */
+  #endif
+};
+
+
+/*
+ *  offset of each bitmap in SymbolData[]
+ */
+
+const uint16_t SymbolIndex[] PROGMEM = {
+  0,          /* BJT npn */
+  65,         /* BJT pnp */
+  130,        /* MOSFET enh n-ch */
+  206,        /* MOSFET enh p-ch */
+  282,        /* MOSFET dep n-ch */
+  362,        /* MOSFET dep p-ch */
+  442,        /* JFET n-ch */
+  507,        /* JFET p-ch */
+  572,        /* IGBT enh n-ch */
+  646,        /* IGBT enh p-ch */
+  720,        /* SCR */
+  753,        /* Triac */
+  796,        /* PUT */
+  #ifdef SW_UJT
+  829,        /* UJT */
+  #endif
+};
+
+
+
+/*
+ *  pin position lookup table
+ *  - one byte per pin and 3 bytes (pins) for each symbol
+ *  - cross reference for the Semi structure's pins:
+ *
+ *      BJT         FET         SCR         Triac       IGBT
+ *  ------------------------------------------------------------------
+ *  A   Base        Gate        Gate        Gate        Gate
+ *  B   Collector   Drain       Anode       MT2         Collector
+ *  C   Emitter     Source      Cathode     MT1         Emitter
+ *
+ *      PUT         UJT
+ *  ------------------------------------------------------------------
+ *  A   Gate        Emitter
+ *  B   Anode       B2
+ *  C   Cathode     B1
+ */
+
+const uint8_t PinTable[] PROGMEM = {
+  PIN_LEFT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM,   /* BJT npn */
+  PIN_LEFT | PIN_BOTTOM, PIN_RIGHT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP,   /* BJT pnp */
+  PIN_LEFT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM,   /* MOSFET enh n-ch */
+  PIN_LEFT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP,      /* MOSFET enh p-ch */
+  PIN_LEFT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM,   /* MOSFET dep n-ch */
+  PIN_LEFT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP,      /* MOSFET dep p-ch */
+  PIN_LEFT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM,   /* JFET n-ch */
+  PIN_LEFT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP,      /* JFET p-ch */
+  PIN_LEFT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM,   /* IGBT enh n-ch */
+  PIN_LEFT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP,      /* IGBT enh p-ch */
+  PIN_LEFT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM,   /* SCR */
+  PIN_LEFT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM,   /* Triac */
+  PIN_LEFT | PIN_TOP, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM       /* PUT */
+  #ifdef SW_UJT
+  ,
+  PIN_LEFT | PIN_TOP, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM       /* UJT */
+  #endif
+};
+
+
+
+#endif
+
+/* ************************************************************************
+ *   EOF
+ * ************************************************************************ */
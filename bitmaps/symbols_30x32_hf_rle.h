@@ -0,0 +1,200 @@
+/* ************************************************************************
+ *
+ *   30x32 component symbols 
+ *   horizontally aligned, horizontal bit order flipped
+ *   run-length encoded (created by bitmap_rle.py)
+ *
+ *   (c) 2015-2017 by Markus Reschke
+ *
+ * ************************************************************************ */
+
+
+/* ************************************************************************
+ *   symbol data
+ * ************************************************************************ */
+
+#ifdef SYMBOLS_30X32_HF_RLE
+
+
+/* symbol size */
+#define SYMBOL_SIZE_X       30     /* width:  30 dots */
+#define SYMBOL_SIZE_Y       32     /* height: 32 dots */
+
+/* symbol data format */
+#define SYMBOL_BYTES_N     128     /* 128 bytes per symbol */
+#define SYMBOL_BYTES_X       4     /* 4 bytes in x direction */
+#define SYMBOL_BYTES_Y      32     /* 32 bytes in y direction */
+
+
+/*
+ *  symbol bitmaps (run-length encoded)
+ *  - format:
+ *    - pixels read row by row (top to down, left to right)
+ *    - one byte per pair of runs:
+ *      bits 7-3: background pixels (0-31)
+ *      bits 2-0: foreground pixels (0-7)
+ *    - longer runs are continued by the next pair
+ */
+
+const uint8_t SymbolData[] PROGMEM = {
+  0xA1,0xE9,0xB5,0x11,0x9B,0x2B,0x8A,0x53,0x71,0x61,0x11,0x61,0x69,0x19,0x51,0x22,
+  0x39,0x29,0x41,0x2A,0x31,0x39,0x39,0x2A,0x29,0x41,0x31,0x32,0x21,0x51,0x29,0x32,
+  0x19,0x59,0x29,0x32,0x11,0x61,0x21,0x3A,0x09,0x71,0x19,0x3B,0x79,0x0F,0x05,0x81,
+  0x19,0x3B,0x79,0x19,0x3A,0x09,0x71,0x21,0x32,0x11,0x61,0x29,0x32,0x19,0x11,0x41,
+  0x29,0x32,0x23,0x41,0x31,0x2A,0x23,0x39,0x39,0x2A,0x1C,0x39,0x41,0x22,0x39,0x29,
+  0x51,0x69,0x19,0x61,0x61,0x11,0x72,0x53,0x8B,0x2B,0xB5,0x11,0xE9,0xE9,0xF8,0x40,    /* BJT npn */
+  0xA1,0xE9,0xB5,0x11,0x9B,0x2B,0x8A,0x53,0x71,0x61,0x11,0x61,0x69,0x19,0x51,0x69,
+  0x29,0x41,0x2A,0x19,0x11,0x39,0x39,0x2A,0x1B,0x41,0x31,0x32,0x1B,0x49,0x29,0x32,
+  0x1C,0x41,0x29,0x32,0x11,0x61,0x21,0x3A,0x09,0x71,0x19,0x3B,0x79,0x0F,0x05,0x81,
+  0x19,0x3B,0x79,0x19,0x3A,0x09,0x71,0x21,0x32,0x11,0x61,0x29,0x32,0x19,0x59,0x29,
+  0x32,0x21,0x51,0x31,0x2A,0x29,0x41,0x39,0x2A,0x31,0x39,0x41,0x69,0x29,0x51,0x69,
+  0x19,0x61,0x61,0x11,0x72,0x53,0x8B,0x2B,0xB5,0x11,0xE9,0xE9,0xF8,0x40,              /* BJT pnp */
+  0xA1,0xE9,0xB5,0x11,0x9B,0x2B,0x8A,0x53,0x71,0x61,0x11,0x61,0x29,0x39,0x19,0x51,
+  0x31,0x39,0x21,0x41,0x29,0x0F,0x02,0x29,0x39,0x29,0x09,0x69,0x31,0x31,0x09,0x71,
+  0x29,0x31,0x81,0x29,0x31,0x81,0x21,0x39,0x09,0x21,0x51,0x19,0x39,0x09,0x1A,0x51,
+  0x19,0x39,0x0F,0x02,0x39,0x19,0x39,0x09,0x1A,0x11,0x39,0x19,0x39,0x09,0x21,0x11,
+  0x39,0x21,0x31,0x49,0x31,0x29,0x31,0x49,0x31,0x29,0x31,0x09,0x39,0x31,0x31,0x29,
+  0x09,0x39,0x29,0x1F,0x04,0x0F,0x02,0x29,0x41,0x31,0x39,0x21,0x51,0x29,0x39,0x19,
+  0x61,0x61,0x11,0x72,0x53,0x8B,0x2B,0xB5,0x11,0xE9,0xE9,0xF8,0x40,                   /* MOSFET enh n-ch */
+  0xA1,0xE9,0xB5,0x11,0x9B,0x2B,0x8A,0x53,0x71,0x61,0x11,0x61,0x29,0x39,0x19,0x51,
+  0x31,0x39,0x21,0x27,0x04,0x0F,0x02,0x29,0x39,0x29,0x09,0x39,0x29,0x31,0x31,0x09,
+  0x39,0x31,0x29,0x31,0x49,0x31,0x29,0x31,0x49,0x31,0x21,0x39,0x09,0x19,0x19,0x39,
+  0x19,0x39,0x09,0x1A,0x11,0x39,0x19,0x39,0x0F,0x02,0x39,0x19,0x39,0x09,0x1A,0x51,
+  0x19,0x39,0x09,0x19,0x59,0x21,0x31,0x81,0x29,0x31,0x81,0x29,0x31,0x09,0x71,0x31,
+  0x29,0x09,0x69,0x39,0x29,0x0F,0x02,0x29,0x41,0x31,0x39,0x21,0x51,0x29,0x39,0x19,
+  0x61,0x61,0x11,0x72,0x53,0x8B,0x2B,0xB5,0x11,0xE9,0xE9,0xF8,0x40,                   /* MOSFET enh p-ch */
+  0xA1,0xE9,0xB5,0x11,0x9B,0x2B,0x8A,0x53,0x71,0x61,0x11,0x61,0x29,0x39,0x19,0x51,
+  0x31,0x39,0x21,0x41,0x29,0x0F,0x02,0x29,0x39,0x29,0x09,0x69,0x31,0x31,0x09,0x71,
+  0x29,0x31,0x09,0x71,0x29,0x31,0x09,0x71,0x21,0x39,0x09,0x21,0x51,0x19,0x39,0x09,
+  0x1A,0x51,0x19,0x39,0x0F,0x02,0x39,0x19,0x39,0x09,0x1A,0x11,0x39,0x19,0x39,0x09,
+  0x21,0x11,0x39,0x21,0x31,0x09,0x39,0x31,0x29,0x31,0x09,0x39,0x31,0x29,0x31,0x09,
+  0x39,0x31,0x31,0x29,0x09,0x39,0x29,0x1F,0x04,0x0F,0x02,0x29,0x41,0x31,0x39,0x21,
+  0x51,0x29,0x39,0x19,0x61,0x61,0x11,0x72,0x53,0x8B,0x2B,0xB5,0x11,0xE9,0xE9,0xF8,
+  0x40,                                                                               /* MOSFET dep n-ch */
+  0xA1,0xE9,0xB5,0x11,0x9B,0x2B,0x8A,0x53,0x71,0x61,0x11,0x61,0x29,0x39,0x19,0x51,
+  0x31,0x39,0x21,0x27,0x04,0x0F,0x02,0x29,0x39,0x29,0x09,0x39,0x29,0x31,0x31,0x09,
+  0x39,0x31,0x29,0x31,0x09,0x39,0x31,0x29,0x31,0x09,0x39,0x31,0x21,0x39,0x09,0x19,
+  0x19,0x39,0x19,0x39,0x09,0x1A,0x11,0x39,0x19,0x39,0x0F,0x02,0x39,0x19,0x39,0x09,
+  0x1A,0x51,0x19,0x39,0x09,0x19,0x59,0x21,0x31,0x09,0x71,0x29,0x31,0x09,0x71,0x29,
+  0x31,0x09,0x71,0x31,0x29,0x09,0x69,0x39,0x29,0x0F,0x02,0x29,0x41,0x31,0x39,0x21,
+  0x51,0x29,0x39,0x19,0x61,0x61,0x11,0x72,0x53,0x8B,0x2B,0xB5,0x11,0xE9,0xE9,0xF8,
+  0x40,                                                                               /* MOSFET dep p-ch */
+  0xA1,0xE9,0xB5,0x11,0x9B,0x2B,0x8A,0x53,0x71,0x61,0x11,0x61,0x69,0x19,0x51,0x31,
+  0x39,0x21,0x41,0x39,0x39,0x29,0x39,0x3F,0x02,0x29,0x31,0x41,0x71,0x29,0x41,0x71,
+  0x29,0x41,0x71,0x21,0x49,0x79,0x19,0x49,0x79,0x19,0x49,0x79,0x19,0x49,0x79,0x19,
+  0x49,0x79,0x21,0x41,0x71,0x29,0x29,0x11,0x71,0x29,0x2A,0x09,0x71,0x17,0x07,0x07,
+  0x29,0x39,0x22,0x09,0x39,0x29,0x41,0x19,0x11,0x39,0x21,0x51,0x69,0x19,0x61,0x61,
+  0x11,0x72,0x53,0x8B,0x2B,0xB5,0x11,0xE9,0xE9,0xF8,0x40,                             /* JFET n-ch */
+  0xA1,0xE9,0xB5,0x11,0x9B,0x2B,0x8A,0x53,0x71,0x61,0x11,0x61,0x69,0x19,0x51,0x19,
+  0x11,0x39,0x21,0x41,0x1A,0x11,0x39,0x29,0x1F,0x07,0x07,0x29,0x31,0x22,0x11,0x71,
+  0x29,0x29,0x11,0x71,0x29,0x41,0x71,0x21,0x49,0x79,0x19,0x49,0x79,0x19,0x49,0x79,
+  0x19,0x49,0x79,0x19,0x49,0x79,0x21,0x41,0x71,0x29,0x41,0x71,0x29,0x41,0x71,0x31,
+  0x3F,0x02,0x29,0x39,0x39,0x39,0x29,0x41,0x31,0x39,0x21,0x51,0x69,0x19,0x61,0x61,
+  0x11,0x72,0x53,0x8B,0x2B,0xB5,0x11,0xE9,0xE9,0xF8,0x40,                             /* JFET p-ch */
+  0xA1,0xE9,0xB5,0x11,0x9B,0x2B,0x8A,0x53,0x71,0x61,0x11,0x61,0x69,0x19,0x51,0x29,
+  0x39,0x29,0x41,0x21,0x09,0x31,0x39,0x39,0x21,0x09,0x29,0x41,0x31,0x29,0x09,0x21,
+  0x51,0x29,0x29,0x09,0x19,0x59,0x29,0x29,0x09,0x11,0x61,0x21,0x31,0x09,0x09,0x71,
+  0x19,0x31,0x0A,0x79,0x0F,0x03,0x09,0x81,0x19,0x31,0x0A,0x79,0x19,0x31,0x09,0x09,
+  0x71,0x21,0x29,0x09,0x11,0x61,0x29,0x29,0x09,0x19,0x11,0x41,0x29,0x29,0x09,0x23,
+  0x41,0x31,0x21,0x09,0x23,0x39,0x39,0x21,0x09,0x1C,0x39,0x41,0x29,0x39,0x29,0x51,
+  0x69,0x19,0x61,0x61,0x11,0x72,0x53,0x8B,0x2B,0xB5,0x11,0xE9,0xE9,0xF8,0x40,         /* IGBT enh n-ch */
+  0xA1,0xE9,0xB5,0x11,0x9B,0x2B,0x8A,0x53,0x71,0x61,0x11,0x61,0x69,0x19,0x51,0x69,
+  0x29,0x41,0x31,0x19,0x11,0x39,0x39,0x21,0x09,0x1B,0x41,0x31,0x29,0x09,0x1B,0x49,
+  0x29,0x29,0x09,0x1C,0x41,0x29,0x29,0x09,0x11,0x61,0x21,0x31,0x09,0x09,0x71,0x19,
+  0x31,0x0A,0x79,0x0F,0x03,0x09,0x81,0x19,0x31,0x0A,0x79,0x19,0x31,0x09,0x09,0x71,
+  0x21,0x29,0x09,0x11,0x61,0x29,0x29,0x09,0x19,0x59,0x29,0x29,0x09,0x21,0x51,0x31,
+  0x21,0x09,0x29,0x41,0x39,0x31,0x31,0x39,0x41,0x69,0x29,0x51,0x69,0x19,0x61,0x61,
+  0x11,0x72,0x53,0x8B,0x2B,0xB5,0x11,0xE9,0xE9,0xF8,0x40,                             /* IGBT enh p-ch */
+  0xF8,0x71,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xA7,0x07,0x05,0x67,0x07,0x03,0x77,
+  0x07,0x01,0x87,0x06,0x97,0x04,0xA7,0x02,0xB7,0xC5,0xD3,0xE1,0xA7,0x07,0x05,0x9A,
+  0xD9,0x09,0xD1,0x11,0xC9,0x19,0xC1,0x21,0xB9,0x29,0x77,0x02,0x31,0xE9,0xE9,0xE9,
+  0xE9,0xF8,0x68,                                                                     /* SCR */
+  0xF8,0x71,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,0x9F,0x07,0x07,0x71,0x2F,0x02,
+  0x73,0x27,0x02,0x73,0x2F,0x75,0x27,0x75,0x2D,0x77,0x25,0x77,0x2B,0x77,0x02,0x23,
+  0x77,0x02,0x29,0x77,0x07,0x07,0x71,0x21,0xB9,0x29,0xB1,0x31,0xA9,0x39,0x77,0x41,
+  0xE9,0xE9,0xE9,0xE9,0xE9,0xF8,0x68,                                                 /* Triac */
+  0xF8,0x71,0xE9,0xE9,0xE9,0x77,0x02,0x31,0xB9,0x29,0xC1,0x21,0xC9,0x19,0xD1,0x11,
+  0xD9,0x09,0xE2,0xA7,0x07,0x05,0x67,0x07,0x03,0x77,0x07,0x01,0x87,0x06,0x97,0x04,
+  0xA7,0x02,0xB7,0xC5,0xD3,0xE1,0xA7,0x07,0x05,0xA1,0xE9,0xE9,0xE9,0xE9,0xE9,0xE9,
+  0xE9,0xF8,0x68,                                                                     /* PUT */
+  #ifdef SW_UJT
+  0xA1,0xE9,0xB5,0x11,0x9B,0x2B,0x8A,0x53,0x71,0x61,0x11,0x61,0x69,0x19,0x51,0x31,
+  0x39,0x21,0x26,0x31,0x39,0x29,0x39,0x09,0x2F,0x02,0x29,0x31,0x19,0x09,0x11,0x71,
+  0x29,0x22,0x11,0x71,0x29,0x1B,0x11,0x71,0x21,0x39,0x09,0x79,0x19,0x42,0x79,0x19,
+  0x49,0x79,0x19,0x49,0x79,0x19,0x49,0x79,0x21,0x41,0x71,0x29,0x41,0x71,0x29,0x41,
+  0x71,0x31,0x3F,0x02,0x29,0x39,0x39,0x39,0x29,0x41,0x31,0x39,0x21,0x51,0x69,0x19,
+  0x61,0x61,0x11,0x72,0x53,0x8B,0x2B,0xB5,0x11,0xE9,0xE9,0xF8,0x40,                   /* UJT */
+  #endif
+};
+
+
+/*
+ *  offset of each bitmap in SymbolData[]
+ */
+
+const uint16_t SymbolIndex[] PROGMEM = {
+  0,          /* BJT npn */
+  96,         /* BJT pnp */
+  190,        /* MOSFET enh n-ch */
+  299,        /* MOSFET enh p-ch */
+  408,        /* MOSFET dep n-ch */
+  521,        /* MOSFET dep p-ch */
+  634,        /* JFET n-ch */
+  725,        /* JFET p-ch */
+  816,        /* IGBT enh n-ch */
+  927,        /* IGBT enh p-ch */
+  1034,       /* SCR */
+  1085,       /* Triac */
+  1140,       /* PUT */
+  #ifdef SW_UJT
+  1191,       /* UJT */
+  #endif
+};
+
+
+
+/*
+ *  pin position lookup table
+ *  - one byte per pin and 3 bytes (pins) for each symbol
+ *  - cross reference for the Semi structure's pins:
+ *
+ *      BJT         FET         SCR         Triac       IGBT
+ *  ------------------------------------------------------------------
+ *  A   Base        Gate        Gate        Gate        Gate
+ *  B   Collector   Drain       Anode       MT2         Collector
+ *  C   Emitter     Source      Cathode     MT1         Emitter
+ *
+ *      PUT         UJT
+ *  ------------------------------------------------------------------
+ *  A   Gate        Emitter
+ *  B   Anode       B2
+ *  C   Cathode     B1
+ */
+
+const uint8_t PinTable[] PROGMEM = {
+  PIN_LEFT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM,   /* BJT npn */
+  PIN_LEFT | PIN_BOTTOM, PIN_RIGHT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP,   /* BJT pnp */
+  PIN_LEFT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM,   /* MOSFET enh n-ch */
+  PIN_LEFT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP,      /* MOSFET enh p-ch */
+  PIN_LEFT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM,   /* MOSFET dep n-ch */
+  PIN_LEFT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP,      /* MOSFET dep p-ch */
+  PIN_LEFT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM,   /* JFET n-ch */
+  PIN_LEFT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP,      /* JFET p-ch */
+  PIN_LEFT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM,   /* IGBT enh n-ch */
+  PIN_LEFT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP,      /* IGBT enh p-ch */
+  PIN_LEFT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM,   /* SCR */
+  PIN_LEFT | PIN_BOTTOM, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM,   /* Triac */
+  PIN_LEFT | PIN_TOP, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM       /* PUT */
+  #ifdef SW_UJT
+  ,
+  PIN_LEFT | PIN_TOP, PIN_RIGHT | PIN_TOP, PIN_RIGHT | PIN_BOTTOM       /* UJT */
+  #endif
+};
+
+
+
+#endif
+
+/* ************************************************************************
+ *   EOF
+ * ************************************************************************ */
@@ -0,0 +1,57 @@
+/* ************************************************************************
+ *
+ *   perfect hash for remote commands
+ *   - created by cmd_hash.py from variables.h, don't edit
+ *   - run "make cmdhash" after changing the command names
+ *
+ * ************************************************************************ */
+
+
+/* source management */
+#define CMD_HASH_H
+
+
+/* hash parameters */
+#define CMD_HASH_MUL          47    /* multiplier */
+#define CMD_HASH_SEED         2     /* start value */
+
+/* command ID for each slot */
+#define CMD_SLOT_TABLE \
+  0, 0, CMD_STREAM, 0, \
+  0, 0, 0, 0, \
+  0, 0, CMD_C_GS, 0, \
+  0, 0, CMD_PROBE, CMD_MSG, \
+  0, CMD_COMP, CMD_ESR, 0, \
+  0, CMD_I_CEO, 0, 0, \
+  0, 0, 0, 0, \
+  0, 0, 0, 0, \
+  0, CMD_C, 0, CMD_PIN, \
+  0, 0, 0, 0, \
+  CMD_V_GT, 0, CMD_L, 0, \
+  0, 0, CMD_V_BE, 0, \
+  CMD_R, CMD_VER, 0, 0, \
+  0, 0, 0, 0, \
+  0, 0, 0, 0, \
+  0, 0, 0, 0, \
+  0, 0, 0, 0, \
+  0, 0, 0, 0, \
+  0, CMD_HINT, CMD_I_R, 0, \
+  CMD_I_DSS, 0, 0, 0, \
+  0, 0, 0, 0, \
+  CMD_QTY, CMD_BIN, 0, CMD_V_F2, \
+  0, 0, 0, CMD_H_FE_R, \
+  CMD_TYPE, 0, CMD_R_DS, 0, \
+  0, 0, 0, 0, \
+  CMD_I_L, 0, CMD_DUMP, 0, \
+  0, 0, CMD_SWEEP, CMD_V_F, \
+  0, CMD_OFF, 0, CMD_R_BB, \
+  0, 0, CMD_R_BE, 0, \
+  0, CMD_NEXT, CMD_C_D, 0, \
+  CMD_H_FE, CMD_V_T, 0, 0, \
+  CMD_C_GE, 0, 0, CMD_V_TH
+
+
+
+/* ************************************************************************
+ *   EOF
+ * ************************************************************************ */
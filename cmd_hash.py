@@ -0,0 +1,125 @@
+#!/usr/bin/env python3
+#
+#  cmd_hash.py
+#
+#  create perfect hash for the remote commands
+#  - input: command names in variables.h (CMD_ENTRY(<ID>, "<name>"))
+#  - hash: h = h * CMD_HASH_MUL + char, starting with CMD_HASH_SEED
+#    (8 bit), slot = h % CMD_SLOTS
+#  - searches multiplier and seed which map all commands, including the
+#    optional ones, to different slots (keeps the current values when
+#    they still do)
+#  - writes cmd_hash.h with the hash parameters and the slot table
+#    (command ID for each slot, 0 for an empty slot)
+#
+#  usage:
+#    cmd_hash.py [<variables.h> [<cmd_hash.h>]]
+#
+#  (c) 2019 by Markus Reschke
+#
+
+import re
+import sys
+
+
+# number of slots (2^n, see common.h)
+SLOTS = 128
+
+# command entry
+ENTRY = re.compile(r'CMD_ENTRY\((CMD_\w+),\s*"([^"]*)"\)')
+
+# current hash parameters
+PARAM = re.compile(r'#define\s+CMD_HASH_(MUL|SEED)\s+(\d+)')
+
+
+def slot(name, mul, seed):
+    """ hash command name and return slot """
+    h = seed
+    for c in name.encode('latin-1'):
+        h = (h * mul + c) & 0xff
+    return h % SLOTS
+
+
+def slots(commands, mul, seed):
+    """ map commands to slots, None on collision """
+    table = [None] * SLOTS
+    for cmd_id, name in commands:
+        n = slot(name, mul, seed)
+        if table[n] is not None:
+            return None
+        table[n] = cmd_id
+    return table
+
+
+def current(path):
+    """ get hash parameters of existing output file """
+    param = {}
+    try:
+        with open(path, encoding='latin-1') as f:
+            for key, value in PARAM.findall(f.read()):
+                param[key] = int(value)
+    except OSError:
+        pass
+    if 'MUL' in param and 'SEED' in param:
+        return [(param['MUL'], param['SEED'])]
+    return []
+
+
+def main(args):
+    source = args[0] if len(args) > 0 else 'variables.h'
+    output = args[1] if len(args) > 1 else 'cmd_hash.h'
+
+    with open(source, encoding='latin-1') as f:
+        commands = ENTRY.findall(f.read())
+    if not commands:
+        sys.exit('%s: no command entries' % source)
+
+    # try current parameters first, then odd multipliers and all seeds
+    candidates = current(output)
+    candidates += [(m, s) for m in range(3, 256, 2) for s in range(256)]
+
+    for mul, seed in candidates:
+        table = slots(commands, mul, seed)
+        if table:
+            break
+    else:
+        sys.exit('no perfect hash for %d commands in %d slots'
+                 % (len(commands), SLOTS))
+
+    lines = []
+    lines.append('/* ************************************************************************')
+    lines.append(' *')
+    lines.append(' *   perfect hash for remote commands')
+    lines.append(' *   - created by cmd_hash.py from variables.h, don\'t edit')
+    lines.append(' *   - run "make cmdhash" after changing the command names')
+    lines.append(' *')
+    lines.append(' * ************************************************************************ */')
+    lines.append('')
+    lines.append('')
+    lines.append('/* source management */')
+    lines.append('#define CMD_HASH_H')
+    lines.append('')
+    lines.append('')
+    lines.append('/* hash parameters */')
+    lines.append('#define CMD_HASH_MUL          %-5d /* multiplier */' % mul)
+    lines.append('#define CMD_HASH_SEED         %-5d /* start value */' % seed)
+    lines.append('')
+    lines.append('/* command ID for each slot */')
+    lines.append('#define CMD_SLOT_TABLE \\')
+    for n in range(0, SLOTS, 4):
+        row = [table[i] or '0' for i in range(n, n + 4)]
+        end = ' \\' if n + 4 < SLOTS else ''
+        lines.append('  ' + ', '.join(row) + (',' if end else '') + end)
+    lines.append('')
+    lines.append('')
+    lines.append('')
+    lines.append('/* ************************************************************************')
+    lines.append(' *   EOF')
+    lines.append(' * ************************************************************************ */')
+
+    with open(output, 'w', encoding='latin-1') as f:
+        f.write('\n'.join(lines) + '\n')
+
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
@@ -52,6 +52,18 @@
 /* control logic */
 uint8_t             FirstFlag;     /* multiple strings in a line */
 
+#ifdef UI_SERIAL_BINARY
+/* binary frames */
+uint8_t             FrameMode;     /* 0: count size / 1: send */
+uint8_t             FrameSize;     /* frame size (command & payload) */
+uint8_t             FrameCRC;      /* CRC-8 */
+#endif
+
+#ifdef UI_SERIAL_STREAM
+/* command arguments */
+uint8_t             ArgPos;        /* position of argument in RX buffer */
+#endif
+
 
 
 /* ************************************************************************
@@ -794,7 +806,7 @@ uint8_t Cmd_V_F(void)
 
     case COMP_PUT:            /* PUT */
       Display_Value(AltSemi.U_1, -3, 'V');   /* send Vf */
-      break;
+      return Flag;
 
     default:                  /* unsupported */
       Flag = SIGNAL_ERR;      /* signal error */
@@ -806,6 +818,10 @@ uint8_t Cmd_V_F(void)
     /* send Vf */
     Display_Value(D->V_f, -3, 'V');     /* in mV */
   }
+  else if (Flag == SIGNAL_OK)           /* no diode */
+  {
+    Flag = SIGNAL_NA;                   /* signal n/a */
+  }
 
   return Flag;
 }
@@ -1357,6 +1373,315 @@ uint8_t Cmd_V_T(void)
 
 
 
+#ifdef UI_SERIAL_BINARY
+
+/* ************************************************************************
+ *   binary frames
+ * ************************************************************************ */
+
+
+/*
+ *  hints:
+ *  - frame: <sync> <length> <command> <payload> <CRC-8>
+ *    sync     FRAME_SYNC
+ *    length   number of bytes for command and payload
+ *    command  command ID
+ *    CRC-8    X^8 + X^5 + X^4 + 1 (like OneWire) for length, command
+ *             and payload, start value 0x00
+ *  - multi-byte values are sent LSB first
+ *  - a frame is built twice, first for counting its size and then
+ *    for sending it
+ */
+
+
+/*
+ *  add byte to frame
+ *  - counts size or sends byte and updates CRC
+ *
+ *  requires:
+ *  - Byte: data byte
+ */
+
+void Frame_Byte(uint8_t Byte)
+{
+  uint8_t           n = 8;         /* bit counter */
+
+  if (FrameMode == 0)         /* count mode */
+  {
+    FrameSize++;              /* one more byte */
+    return;
+  }
+
+  Serial_WriteByte(Byte);     /* send byte */
+
+  /* update CRC-8 */
+  while (n > 0)
+  {
+    if ((FrameCRC ^ Byte) & 0b00000001)   /* XORed LSB is 1 */
+    {
+      FrameCRC >>= 1;                     /* shift right */
+      FrameCRC ^= 0b10001100;             /* XOR X^5, X^4 and feedback */
+    }
+    else                                  /* XORed LSB is 0 */
+    {
+      FrameCRC >>= 1;                     /* shift right */
+    }
+
+    Byte >>= 1;               /* next bit */
+    n--;
+  }
+}
+
+
+
+/*
+ *  add 16 bit value to frame (LSB first)
+ *
+ *  requires:
+ *  - Word: data value
+ */
+
+void Frame_Word(uint16_t Word)
+{
+  Frame_Byte((uint8_t)Word);            /* LSB */
+  Frame_Byte((uint8_t)(Word >> 8));     /* MSB */
+}
+
+
+
+/*
+ *  add 32 bit value to frame (LSB first)
+ *
+ *  requires:
+ *  - Long: data value
+ */
+
+void Frame_Long(uint32_t Long)
+{
+  Frame_Word((uint16_t)Long);           /* lower word */
+  Frame_Word((uint16_t)(Long >> 16));   /* upper word */
+}
+
+
+
+/*
+ *  add resistor record to frame
+ *  - A, B, Scale, Value
+ *
+ *  requires:
+ *  - R: pointer to resistor
+ */
+
+void Frame_Resistor(Resistor_Type *R)
+{
+  Frame_Byte(REC_RESISTOR);
+  Frame_Byte(R->A);
+  Frame_Byte(R->B);
+  Frame_Byte(R->Scale);
+  Frame_Long(R->Value);
+}
+
+
+
+/*
+ *  add diode record to frame
+ *  - A, C, V_f, V_f2
+ *
+ *  requires:
+ *  - D: pointer to diode
+ */
+
+void Frame_Diode(Diode_Type *D)
+{
+  Frame_Byte(REC_DIODE);
+  Frame_Byte(D->A);
+  Frame_Byte(D->C);
+  Frame_Word(D->V_f);
+  Frame_Word(D->V_f2);
+}
+
+
+
+/*
+ *  add value record to frame
+ *  - Scale, Value
+ *
+ *  requires:
+ *  - ID: record ID
+ *  - Value: value
+ *  - Scale: exponent of factor (value * 10^x)
+ */
+
+void Frame_Value(uint8_t ID, uint32_t Value, int8_t Scale)
+{
+  Frame_Byte(ID);
+  Frame_Byte(Scale);
+  Frame_Long(Value);
+}
+
+
+
+/*
+ *  add probing results to frame
+ *  - header: component type, subtype, quantity, info flags, info value
+ *  - followed by records based on component type
+ */
+
+void Frame_Results(void)
+{
+  uint8_t           n;             /* counter */
+  Diode_Type        *D;            /* pointer to diode */
+  Capacitor_Type    *C;            /* pointer to capacitor */
+
+  /* header */
+  Frame_Byte(Check.Found);
+  Frame_Byte(Check.Type);
+  Frame_Byte(Info.Quantity);
+  Frame_Byte(Info.Flags);
+  Frame_Word(Info.Val1);           /* ESR or V_BE */
+
+  switch (Check.Found)        /* based on component */
+  {
+    case COMP_ERROR:          /* error */
+      Frame_Byte(REC_ERROR);
+      Frame_Byte(Check.Probe);
+      Frame_Word(Check.U);
+      break;
+
+    case COMP_RESISTOR:       /* resistor(s) */
+      Frame_Resistor((Resistor_Type *)Info.Comp1);
+      if (Info.Quantity == 2)
+      {
+        Frame_Resistor((Resistor_Type *)Info.Comp2);
+      }
+      #ifdef SW_INDUCTOR
+      if (Info.Flags & INFO_R_L)        /* inductance measured */
+      {
+        Frame_Value(REC_INDUCTOR, Inductor.Value, Inductor.Scale);
+      }
+      #endif
+      break;
+
+    case COMP_CAPACITOR:      /* capacitor */
+      C = (Capacitor_Type *)Info.Comp1;
+      if (C == NULL) break;             /* no cap */
+      Frame_Byte(REC_CAPACITOR);
+      Frame_Byte(C->A);
+      Frame_Byte(C->B);
+      Frame_Byte(C->Scale);
+      Frame_Long(C->Value);
+      Frame_Long(C->I_leak);            /* in 10nA */
+      break;
+
+    case COMP_DIODE:          /* diode(s) */
+      n = 0;
+      while (n < Info.Quantity)         /* loop through diodes */
+      {
+        D = (Diode_Type *)Info.Comp1;   /* first diode */
+        if (n > 0) D = (Diode_Type *)Info.Comp2;    /* second diode */
+        if (D == NULL) break;           /* too many diodes */
+        Frame_Diode(D);
+
+        /* capacitance is stored in Caps[0] and Caps[1] */
+        if (Info.Flags & (INFO_D_CAP1 << n))
+        {
+          Frame_Value(REC_DIODE_CAP, Caps[n].Value, Caps[n].Scale);
+        }
+
+        n++;                            /* next diode */
+      }
+      if (Info.Flags & INFO_D_I_R)      /* I_R measured */
+      {
+        Frame_Value(REC_CURRENT, Semi.I_value, Semi.I_scale);
+      }
+      if (Info.Flags & INFO_D_R_BE)     /* R_BE */
+      {
+        Frame_Resistor(&Resistors[0]);
+      }
+      break;
+
+    case COMP_BJT:            /* BJT */
+    case COMP_FET:            /* FET (JFET/MOSFET) */
+    case COMP_IGBT:           /* IGBT */
+    case COMP_THYRISTOR:      /* SCR */
+    case COMP_TRIAC:          /* TRIAC */
+      Frame_Byte(REC_SEMI);
+      Frame_Byte(Semi.A);
+      Frame_Byte(Semi.B);
+      Frame_Byte(Semi.C);
+      Frame_Word(Semi.U_1);
+      Frame_Word(Semi.U_2);
+      Frame_Long(Semi.F_1);
+      #ifdef SW_REVERSE_HFE
+      Frame_Long(Semi.F_2);
+      #else
+      Frame_Long(0);
+      #endif
+      Frame_Byte(Semi.I_scale);
+      Frame_Long(Semi.I_value);
+      Frame_Byte(Semi.C_scale);
+      Frame_Long(Semi.C_value);
+
+      /* flyback diode (same flag for BJT and FET/IGBT) */
+      if ((Check.Found <= COMP_IGBT) && (Info.Flags & INFO_BJT_D_FB))
+      {
+        Frame_Diode((Diode_Type *)Info.Comp1);
+      }
+      if ((Check.Found == COMP_BJT) && (Info.Flags & INFO_BJT_R_BE))
+      {
+        Frame_Resistor(&Resistors[0]);
+      }
+      break;
+
+    case COMP_PUT:            /* PUT */
+    #ifdef SW_UJT
+    case COMP_UJT:            /* UJT */
+    #endif
+      Frame_Byte(REC_ALTSEMI);
+      Frame_Byte(AltSemi.A);
+      Frame_Byte(AltSemi.B);
+      Frame_Byte(AltSemi.C);
+      Frame_Word(AltSemi.U_1);
+      Frame_Word(AltSemi.U_2);
+      #ifdef SW_UJT
+      if (Check.Found == COMP_UJT)      /* R_BB */
+      {
+        Frame_Resistor(&Resistors[0]);
+      }
+      #endif
+      break;
+  }
+}
+
+
+
+/*
+ *  command: BIN
+ *  - return probing results as binary frame
+ *  - no newline
+ */
+
+void Cmd_BIN(void)
+{
+  /* first run: get size */
+  FrameMode = 0;                   /* count mode */
+  FrameSize = 1;                   /* command byte */
+  Frame_Results();
+
+  /* second run: send frame */
+  Serial_WriteByte(FRAME_SYNC);    /* start of frame */
+  FrameMode = 1;                   /* send mode */
+  FrameCRC = 0;                    /* reset CRC */
+  Frame_Byte(FrameSize);           /* length */
+  Frame_Byte(CMD_BIN);             /* command */
+  Frame_Results();                 /* payload */
+  Serial_WriteByte(FrameCRC);      /* CRC */
+}
+
+#endif
+
+
+
 /* ************************************************************************
  *   command parsing and processing
  * ************************************************************************ */
@@ -1364,71 +1689,88 @@ uint8_t Cmd_V_T(void)
 
 /*
  *  check RX buffer for known command
+ *  - the hash of the received command selects a slot of the perfect hash
+ *    table (flash), just the command of that slot is compared
+ *  - O(command length), independent of the number of commands
+ *  - with UI_SERIAL_STREAM a command may be followed by a space and
+ *    an argument, ArgPos is set to the argument's position then
+ *
+ *  requires:
+ *  - Pos: start position in RX buffer
  *
  *  returns:
  *  - command ID
  */
 
-uint8_t FindCommand(void)
+uint8_t FindCommand(uint8_t Pos)
 {
   uint8_t           ID = CMD_NONE;      /* command ID */
-  uint8_t           Flag = 1;           /* loop control flag */
+  uint8_t           Hash = CMD_HASH_SEED;    /* hash of command */
+  uint8_t           Length;             /* length of command */
   uint8_t           n;                  /* counter */
   uint8_t           CmdID;              /* command ID */
-  char              CmdChar;            /* single character */
-  unsigned char     *CmdAddr;           /* address of command string */
-  Cmd_Type          *Data;              /* address of table entry */
-  uint8_t           *Addr;              /* address pointer */
+  char              RX_Char;            /* single character in RX buffer */
+  const char        *Name;              /* address of command string */
+
+  #ifdef UI_SERIAL_STREAM
+  ArgPos = 0;                      /* no argument */
+  #endif
+
+
+  /*
+   *  get hash and length of received command
+   */
+
+  n = Pos;
+  while (n < RX_BUFFER_SIZE)       /* loop through RX buffer */
+  {
+    RX_Char = RX_Buffer[n];        /* get char */
+
+    if (RX_Char == 0) break;       /* end of string */
+    #ifdef UI_SERIAL_STREAM
+    if (RX_Char == ' ') break;     /* command followed by argument */
+    #endif
+
+    Hash = Hash * CMD_HASH_MUL + RX_Char;    /* update hash */
+    n++;                           /* next char */
+  }
+
+  Length = n - Pos;
+  if ((Length == 0) || (Length > CMD_LENGTH)) return ID;  /* no command */
+
 
   /*
-   *  Compare command in RX buffer with command strings referenced by
-   *  a stored table.
+   *  get command of hash slot and compare strings
    */
 
-  Data = (Cmd_Type *)&Cmd_Table;   /* start address of table */
+  CmdID = pgm_read_byte(&Cmd_Slot[Hash % CMD_SLOTS]);
 
-  while (Flag)                /* loop through table entries */
+  if (CmdID != CMD_NONE)           /* slot used */
   {
-    /* read entry from reference table */
-    Addr = (uint8_t *)Data;             /* start of current entry */
-    CmdID = eeprom_read_byte(Addr);     /* read command ID */
-    Addr++;                             /* for next data field */
-    /* read string address */
-    CmdAddr = (unsigned char *)eeprom_read_word((uint16_t *)Addr);
+    Name = Cmd_Name[CmdID];        /* address of string */
 
-    if (CmdID)                /* valid command ID */
+    /* compare characterwise (including terminating 0) */
+    /* a disabled command has an empty string */
+    n = 0;
+    while (n < Length)
     {
-      /* read and compare characterwise */
-      n = 0;
-      while (n < RX_BUFFER_SIZE)        /* loop through string */
-      {
-        CmdChar = eeprom_read_byte(CmdAddr);      /* read char */
-
-        if (CmdChar == RX_Buffer[n])    /* match */
-        {
-          if (CmdChar == 0)             /* end of string */
-          {
-            n = RX_BUFFER_SIZE;         /* end string loop */
-            Flag = 0;                   /* end table loop */
-            ID = CmdID;                 /* found command */
-          }
-
-          n++;                          /* next char */
-          CmdAddr++;                    /* next char */
-        }
-        else                            /* mismatch */
-        {
-          n = RX_BUFFER_SIZE;           /* end string loop */
-        }
-      }
+      if (pgm_read_byte(&Name[n]) != RX_Buffer[Pos + n]) break;
+      n++;
     }
-    else                      /* reached end of table */
+
+    if ((n == Length) && (pgm_read_byte(&Name[n]) == 0))
     {
-      Flag = 0;                         /* end table loop */
+      ID = CmdID;                  /* found command */
     }
+  }
 
-    Data++;                             /* next entry */
+  #ifdef UI_SERIAL_STREAM
+  /* argument follows space */
+  if ((ID != CMD_NONE) && (RX_Buffer[Pos + Length] == ' '))
+  {
+    ArgPos = Pos + Length + 1;
   }
+  #endif
 
   return ID;
 }
@@ -1445,15 +1787,27 @@ uint8_t FindCommand(void)
 uint8_t GetCommand(void)
 {
   uint8_t           ID = CMD_NONE;      /* command ID */
+  uint8_t           State;              /* RX state */
+
+  #ifdef SERIAL_RX_QUEUE
+  State = Serial_GetLine();             /* get next line from queue */
+  #else
+  State = Cfg.OP_Control;               /* RX buffer */
+  #endif
 
   /* check for locked RX buffer */
-  if (Cfg.OP_Control & OP_RX_LOCKED)    /* buffer locked */
+  if (State & OP_RX_LOCKED)             /* buffer locked */
   {
     /* check if we don't have a overflow */
-    if (! (Cfg.OP_Control & OP_RX_OVERFLOW))   /* no buffer overflow */
+    if (! (State & OP_RX_OVERFLOW))     /* no buffer overflow */
     {
       /* check for command */
-      ID = FindCommand();               /* get command */
+      ID = FindCommand(0);              /* get command */
+
+      #ifdef UI_SERIAL_STREAM
+      /* just STREAM and SWEEP take arguments */
+      if (ArgPos && (ID != CMD_STREAM) && (ID != CMD_SWEEP)) ID = CMD_NONE;
+      #endif
     }
     /* else: overflow triggers output of error */
 
@@ -1462,9 +1816,16 @@ uint8_t GetCommand(void)
       Display_EEString_NL(Cmd_ERR_str);      /* send: ERR & newline */
     }
 
+    #ifndef SERIAL_RX_QUEUE
+    #ifdef UI_SERIAL_STREAM
+    /* STREAM and SWEEP unlock the buffer after parsing the arguments */
+    if ((ID == CMD_STREAM) || (ID == CMD_SWEEP)) return ID;
+    #endif
+
     /* unlock buffer and clear overflow flag */
     RX_Pos = 0;                         /* reset position */
     Cfg.OP_Control &= (~OP_RX_LOCKED & ~OP_RX_OVERFLOW);
+    #endif
   }
 
   return ID;
@@ -1473,41 +1834,24 @@ uint8_t GetCommand(void)
 
 
 /*
- *  run command received via serial interface
+ *  run command returning a probing result
+ *  - used by RunCommand() and Cmd_DUMP()
  *
  *  requires:
  *  - ID: command ID
  *
  *  returns:
- *  - virtual key
+ *  - SIGNAL_ERR on error
+ *  - SIGNAL_NA on n/a
+ *  - SIGNAL_OK on success
  */
 
-uint8_t RunCommand(uint8_t ID)
+uint8_t ValueCommand(uint8_t ID)
 {
-  uint8_t           Key = KEY_NONE;     /* virtual key */
   uint8_t           Flag = SIGNAL_OK;   /* result of command function */
 
-  /*
-   *  run command
-   */
-
   switch (ID)
   {
-    case CMD_VER:             /* return firmware version */
-      Display_EEString(Version_str);         /* send firmware version */
-      break;
-
-    case CMD_PROBE:           /* probe component */
-      Key = KEY_PROBE;                       /* set virtual key */
-      /* OK is returned after probing by main() */
-      Flag = SIGNAL_NONE;                    /* no newline */ 
-      break;
-
-    case CMD_OFF:             /* power off */
-      Key = KEY_POWER_OFF;                   /* set virtual key */
-      Display_EEString(Cmd_OK_str);          /* send: OK */
-      break;
-
     case CMD_COMP:            /* return component type ID */
       Display_Value(Check.Found, 0, 0);      /* send component type ID */
       break;
@@ -1520,19 +1864,6 @@ uint8_t RunCommand(uint8_t ID)
       Display_Value(Info.Quantity, 0, 0);    /* send quantity */
       break;
 
-    case CMD_NEXT:            /* select next component */
-      /* allow only 2nd component */
-      if ((Info.Selected == 1) && (Info.Quantity == 2))
-      {
-        Info.Selected = 2;                   /* 2nd one */
-        Display_EEString(Cmd_OK_str);        /* send: OK */
-      }
-      else
-      {
-        Flag = SIGNAL_NA;                    /* signal n/a */
-      }
-      break;
-
     case CMD_TYPE:            /* return more specific type */
       Flag = Cmd_TYPE();                     /* run command */
       break;
@@ -1634,6 +1965,664 @@ uint8_t RunCommand(uint8_t ID)
       break;
   }
 
+  return Flag;
+}
+
+
+
+/*
+ *  command: DUMP
+ *  - return all values available for the component(s) found
+ *  - runs the probing result commands in the order of Cmd_Dump[] and
+ *    sends a "<command>=<value>" pair for each command with a valid value
+ *  - pairs are separated by ';'
+ *  - for a second component the command is suffixed by "#2"
+ *  - just the first two components, like NEXT
+ *
+ *  returns:
+ *  - SIGNAL_ERR on error
+ *  - SIGNAL_NA on n/a
+ *  - SIGNAL_OK on success
+ */
+
+uint8_t Cmd_DUMP(void)
+{
+  uint8_t           Flag = SIGNAL_NA;   /* return value */
+  uint8_t           Test;               /* result of command */
+  uint8_t           Selected;           /* selected component */
+  uint8_t           n;                  /* component counter */
+  uint8_t           i;                  /* counter */
+  uint8_t           CmdID;              /* command ID */
+  char              Char;               /* single character */
+  const char        *Name;              /* address of command string */
+  const uint8_t     *Data;              /* address of list entry */
+
+  Selected = Info.Selected;        /* save selection */
+  n = 1;                           /* first component */
+
+  /* loop through components (at least one for errors) */
+  do
+  {
+    Info.Selected = n;             /* select component */
+    Data = &Cmd_Dump[0];           /* first entry */
+
+    while (1)                 /* loop through list entries */
+    {
+      /* read entry from DUMP list */
+      CmdID = pgm_read_byte(Data);        /* read command ID */
+      if (CmdID == CMD_NONE) break;       /* end of list */
+      Name = Cmd_Name[CmdID];             /* address of string */
+      Data++;                             /* next entry */
+
+      /* for 2nd component just values depending on the selection */
+      if ((n > 1) && (CmdID != CMD_PIN) && (CmdID != CMD_R) &&
+          (CmdID != CMD_V_F) && (CmdID != CMD_V_F2) && (CmdID != CMD_C_D))
+      {
+        continue;
+      }
+
+      /* check command quietly */
+      Cfg.OP_Control &= ~OP_OUT_SER;      /* disable serial output */
+      Test = ValueCommand(CmdID);         /* run command */
+      Cfg.OP_Control |= OP_OUT_SER;       /* enable serial output */
+
+      if (Test == SIGNAL_OK)              /* got a value */
+      {
+        if (Flag == SIGNAL_OK)            /* not first pair */
+        {
+          Display_Char(';');              /* send: ; */
+        }
+
+        /* send command */
+        i = 0;
+        while (i < CMD_LENGTH)
+        {
+          Char = pgm_read_byte(&Name[i]); /* read char */
+          if (Char == 0) break;           /* end of string */
+          Display_Char(Char);             /* send char */
+          i++;
+        }
+        if (n > 1)                        /* 2nd component */
+        {
+          Display_Char('#');              /* send: # */
+          Display_Char('0' + n);          /* send: number */
+        }
+        Display_Char('=');                /* send: = */
+        ValueCommand(CmdID);              /* send value */
+
+        Flag = SIGNAL_OK;                 /* signal success */
+      }
+    }
+
+    n++;                           /* next component */
+  } while ((n <= Info.Quantity) && (n <= 2));   /* max. 2 components */
+
+  Info.Selected = Selected;        /* restore selection */
+
+  return Flag;
+}
+
+
+
+#ifdef UI_SERIAL_STREAM
+
+/*
+ *  measure V_f of selected diode
+ *  - uses Rl as pull-up like CheckDiode()
+ *
+ *  requires:
+ *  - D: pointer to diode
+ */
+
+void Stream_V_F(Diode_Type *D)
+{
+  uint16_t          U_Rl;          /* V_f */
+
+  UpdateProbes(D->A, D->C, 0);     /* probe-1 = A / probe-2 = C */
+
+  /* set probes: Gnd -- probe-2 / probe-1 -- Rl -- Vcc */
+  ADC_PORT = 0;
+  ADC_DDR = Probes.Pin_2;          /* pull down cathode directly */
+  R_PORT = Probes.Rl_1;            /* pull up anode via Rl */
+  R_DDR = Probes.Rl_1;             /* enable Rl for probe-1 */
+  U_Rl = ReadU_5ms(Probes.ADC_1);  /* get voltage at anode */
+  U_Rl -= ReadU(Probes.ADC_2);     /* substract voltage at cathode */
+
+  /* reset probes */
+  ADC_DDR = 0;
+  R_DDR = 0;
+  R_PORT = 0;
+
+  D->V_f = U_Rl;                   /* save V_f */
+}
+
+
+
+/*
+ *  measure single value of component found
+ *  - updates the component's data, so that the value command can
+ *    return the new value
+ *  - skips component identification
+ *
+ *  requires:
+ *  - ID: command ID of value (CMD_R, CMD_C, CMD_ESR, CMD_V_F or CMD_I_L)
+ *
+ *  returns:
+ *  - 1 on success
+ *  - 0 on any problem
+ */
+
+uint8_t Stream_Measure(uint8_t ID)
+{
+  uint8_t           Flag = 1;           /* return value */
+  uint8_t           Found;              /* component type */
+  uint8_t           Counter;            /* number of resistors */
+  Resistor_Type     *R;                 /* pointer to resistor */
+  Resistor_Type     Backup;             /* copy of first resistor */
+  Capacitor_Type    *C;                 /* pointer to cap */
+
+  Found = Check.Found;             /* save component type */
+
+  /* same conditions as for probing */
+  #ifdef SERIAL_BITBANG
+  Serial_Ctrl(SER_TIMER_LOCK);     /* free Timer0 for measurement */
+  #endif
+
+  DischargeProbes();               /* try to discharge probes */
+
+  if (Check.Found == COMP_ERROR)   /* discharge failed */
+  {
+    Flag = 0;                      /* signal problem */
+  }
+  else if (ID == CMD_R)            /* resistance */
+  {
+    R = (Resistor_Type *)SelectedComp();
+    Backup = Resistors[0];              /* save first resistor */
+    Counter = Check.Resistors;          /* save number of resistors */
+
+    /* measure into first resistor */
+    if (CheckSingleResistor(R->A, R->B, 0))
+    {
+      if (R != &Resistors[0])           /* 2nd resistor */
+      {
+        *R = Resistors[0];              /* copy new value */
+      }
+    }
+    else                                /* no resistor anymore */
+    {
+      Flag = 0;                         /* signal problem */
+    }
+
+    if (R != &Resistors[0])             /* 2nd resistor */
+    {
+      Resistors[0] = Backup;            /* restore first resistor */
+    }
+    Check.Resistors = Counter;          /* restore number of resistors */
+  }
+  else if (ID == CMD_V_F)          /* forward voltage */
+  {
+    Stream_V_F((Diode_Type *)SelectedComp());
+  }
+  else                             /* capacitor */
+  {
+    C = (Capacitor_Type *)Info.Comp1;
+
+    if ((ID == CMD_C) || (ID == CMD_I_L))
+    {
+      /* MeasureCap() resets the cap data and swaps the probes */
+      MeasureCap(C->B, C->A, (uint8_t)(C - &Caps[0]));
+      if (C->Value == 0) Flag = 0;      /* no cap anymore */
+    }
+    #if defined (SW_ESR) || defined (SW_OLD_ESR)
+    else                           /* ESR */
+    {
+      Clock_Hold();                     /* keep clock's ISR out of ESR */
+      Info.Val1 = MeasureESR(C);        /* measure ESR */
+      Clock_Release();                  /* catch up clock */
+    }
+    #endif
+  }
+
+  #ifdef SERIAL_BITBANG
+  Serial_Ctrl(SER_TIMER_UNLOCK);   /* use Timer0 for TTL serial */
+  #endif
+
+  Check.Found = Found;             /* restore component type */
+
+  return Flag;
+}
+
+
+
+/*
+ *  command: STREAM <value> [<interval>]
+ *  - re-measures a value of the component found and sends a sample
+ *    line "<time>;<value>" at a fixed rate
+ *  - value: R, C, ESR, V_F or I_l (applies to the selected component)
+ *  - interval: time between samples in ms (default: STREAM_INTERVAL)
+ *  - time: ms since start of streaming, based on Timer2
+ *  - any new line or a key press stops streaming
+ *  - sleeps between samples (TestKey() with timeout)
+ *  - missed sample slots (measurement took longer than interval) are
+ *    skipped to keep the rate
+ *  - output is sent via the TX buffer: with hardware serial also while
+ *    measuring the next sample, with bit-bang serial only until then
+ *    (locking Timer0 for the measurement flushes the rest by busy
+ *    waiting, so a long line delays the next sample)
+ *  - without SERIAL_RX_QUEUE the RX buffer is still locked and gets
+ *    unlocked after parsing the arguments
+ *
+ *  returns:
+ *  - SIGNAL_ERR on error
+ *  - SIGNAL_OK on success
+ */
+
+uint8_t Cmd_STREAM(uint8_t Pos)
+{
+  uint8_t           ID = CMD_NONE;      /* command ID of value */
+  uint8_t           Flag = SIGNAL_OK;   /* control flag */
+  uint8_t           n;                  /* counter */
+  uint8_t           Digit;              /* digit of interval */
+  uint32_t          Interval = STREAM_INTERVAL;   /* sample interval */
+  uint32_t          StartTime;          /* start time */
+  uint32_t          Time;               /* current time */
+  uint32_t          Next = 0;           /* time of next sample */
+  uint16_t          Wait;               /* time to next sample */
+
+
+  /*
+   *  get arguments
+   */
+
+  if (Pos == 0) Flag = SIGNAL_ERR;      /* no argument */
+  else ID = FindCommand(Pos);           /* get value */
+
+  if ((Flag == SIGNAL_OK) && ArgPos)    /* got interval */
+  {
+    n = ArgPos;
+    Interval = 0;
+
+    while (RX_Buffer[n] != 0)           /* loop through digits */
+    {
+      Digit = RX_Buffer[n] - '0';
+      Interval *= 10;
+      Interval += Digit;
+      /* no digit or too large */
+      if ((Digit > 9) || (Interval > UINT16_MAX))
+      {
+        Flag = SIGNAL_ERR;
+        break;
+      }
+      n++;
+    }
+
+    if (Interval < 10) Flag = SIGNAL_ERR;    /* too small */
+  }
+
+  #ifndef SERIAL_RX_QUEUE
+  /* arguments are parsed: unlock buffer and clear overflow flag */
+  RX_Pos = 0;                           /* reset position */
+  Cfg.OP_Control &= (~OP_RX_LOCKED & ~OP_RX_OVERFLOW);
+  #endif
+
+  if (Flag == SIGNAL_ERR) return SIGNAL_ERR;
+
+  /* just R, C, ESR, V_F and I_l */
+  if ((ID != CMD_R) && (ID != CMD_C) && (ID != CMD_ESR) &&
+      (ID != CMD_V_F) && (ID != CMD_I_L))
+  {
+    return SIGNAL_ERR;
+  }
+
+  /* check if value applies to component found (quietly) */
+  Cfg.OP_Control &= ~OP_OUT_SER;        /* disable serial output */
+  Flag = ValueCommand(ID);              /* run command */
+  Cfg.OP_Control |= OP_OUT_SER;         /* enable serial output */
+  if (Flag == SIGNAL_ERR) return SIGNAL_ERR;
+
+  /* V_F just for diodes (not for flyback diodes) */
+  if ((ID == CMD_V_F) && (Check.Found != COMP_DIODE)) return SIGNAL_ERR;
+
+  /* with NEXT a 2nd diode or resistor might be selected */
+  if (SelectedComp() == NULL) return SIGNAL_ERR;
+
+
+  /*
+   *  processing loop
+   */
+
+  StartTime = Clock_Get();         /* get start time */
+  Flag = 1;
+
+  while (Flag)
+  {
+    Time = Clock_Get() - StartTime;    /* get current time */
+
+    if (Time >= Next)              /* time for next sample */
+    {
+      n = Stream_Measure(ID);      /* measure value */
+
+      /* send: <time>;<value> */
+      Display_FullValue(Time, 0, 0);
+      Display_Char(';');
+      if ((n == 0) || (ValueCommand(ID) != SIGNAL_OK))
+      {
+        Display_EEString(Cmd_NA_str);        /* send: N/A */
+      }
+      Serial_NewLine();
+
+      /* schedule next sample, skip missed slots */
+      Time = Clock_Get() - StartTime;
+      while (Next <= Time) Next += Interval;
+    }
+
+    /* sleep until next sample, any new line or key press stops streaming */
+    Time = Clock_Get() - StartTime;
+    Wait = 1;                      /* check for keys at least */
+    if (Next > Time) Wait = Next - Time;
+    if (TestKey(Wait, 0) != KEY_TIMEOUT) Flag = 0;
+  }
+
+  /* discard received line */
+  if (Cfg.OP_Control & OP_RX_LOCKED)
+  {
+    #ifdef SERIAL_RX_QUEUE
+    Serial_GetLine();              /* remove line from queue */
+    #else
+    RX_Pos = 0;                    /* reset position */
+    Cfg.OP_Control &= (~OP_RX_LOCKED & ~OP_RX_OVERFLOW);
+    #endif
+  }
+
+  Display_EEString(Cmd_OK_str);    /* send: OK */
+
+  return SIGNAL_OK;
+}
+
+
+
+#ifdef SW_DDS
+
+/*
+ *  get numeric argument
+ *  - decimal number with optional fractional part (dot)
+ *  - arguments are separated by a space
+ *
+ *  requires:
+ *  - Pos: pointer to position of argument in RX buffer
+ *         (updated to position of next argument)
+ *  - DecPlaces: decimal places of value (scales value by 10^DecPlaces)
+ *
+ *  returns:
+ *  - value
+ *  - UINT32_MAX on any problem
+ */
+
+uint32_t GetArgument(uint8_t *Pos, uint8_t DecPlaces)
+{
+  uint32_t          Value = 0;          /* return value */
+  uint8_t           n;                  /* position */
+  uint8_t           Digits = 0;         /* number of digits */
+  uint8_t           Dot = 0;            /* got dot */
+  uint8_t           Digit;              /* single digit */
+  char              RX_Char;            /* single character in RX buffer */
+
+  n = *Pos;
+  while (n < RX_BUFFER_SIZE)       /* loop through RX buffer */
+  {
+    RX_Char = RX_Buffer[n];        /* get char */
+    if ((RX_Char == 0) || (RX_Char == ' ')) break;     /* end of argument */
+
+    if ((RX_Char == '.') && (Dot == 0))      /* dot */
+    {
+      Dot = 1;
+    }
+    else                                     /* digit */
+    {
+      Digit = RX_Char - '0';
+      if (Digit > 9) return UINT32_MAX;      /* no digit */
+      if (Dot)                               /* fractional part */
+      {
+        if (DecPlaces == 0) return UINT32_MAX;    /* too many places */
+        DecPlaces--;
+      }
+      if (Value > (UINT32_MAX / 10 - 1)) return UINT32_MAX;   /* too large */
+      Value *= 10;
+      Value += Digit;
+      Digits++;
+    }
+
+    n++;                           /* next char */
+  }
+
+  if (Digits == 0) return UINT32_MAX;   /* no number */
+
+  /* scale value */
+  while (DecPlaces > 0)
+  {
+    if (Value > (UINT32_MAX / 10 - 1)) return UINT32_MAX;     /* too large */
+    Value *= 10;
+    DecPlaces--;
+  }
+
+  if (RX_Buffer[n] == ' ') n++;    /* skip separator */
+  *Pos = n;                        /* next argument */
+
+  return Value;
+}
+
+
+
+/*
+ *  command: SWEEP <start> <stop> <step> <dwell>
+ *  - runs a linear frequency sweep with the DDS signal generator
+ *    and sends a line "<time>;<frequency>" for each step
+ *  - start, stop, step: frequency in Hz, up to 3 decimal places
+ *  - dwell: time per step in ms (10-60000)
+ *  - time: ms since start of sweep, based on Timer2
+ *  - any new line or a key press stops the sweep
+ *  - sleeps between steps (TestKey() with timeout)
+ *  - output: see DDS_Start()
+ *  - without SERIAL_RX_QUEUE the RX buffer is still locked and gets
+ *    unlocked after parsing the arguments
+ *
+ *  returns:
+ *  - SIGNAL_ERR on error
+ *  - SIGNAL_OK on success
+ */
+
+uint8_t Cmd_SWEEP(uint8_t Pos)
+{
+  uint8_t           Flag;               /* control flag */
+  uint32_t          Start;              /* start frequency (mHz) */
+  uint32_t          Stop;               /* stop frequency (mHz) */
+  uint32_t          Step;               /* step size (mHz) */
+  uint32_t          Dwell;              /* time per step (ms) */
+  uint32_t          Freq;               /* current frequency (mHz) */
+  uint32_t          StartTime;          /* start time */
+  uint32_t          Time;               /* current time */
+  uint32_t          Next = 0;           /* time of next step */
+  uint16_t          Wait;               /* time to next step */
+
+
+  /*
+   *  get arguments
+   */
+
+  Start = UINT32_MAX;                   /* preset error */
+
+  if (Pos)                              /* got arguments */
+  {
+    Start = GetArgument(&Pos, 3);
+    Stop = GetArgument(&Pos, 3);
+    Step = GetArgument(&Pos, 3);
+    Dwell = GetArgument(&Pos, 0);
+    if (RX_Buffer[Pos] != 0) Start = UINT32_MAX;   /* too many arguments */
+  }
+
+  #ifndef SERIAL_RX_QUEUE
+  /* arguments are parsed: unlock buffer and clear overflow flag */
+  RX_Pos = 0;                           /* reset position */
+  Cfg.OP_Control &= (~OP_RX_LOCKED & ~OP_RX_OVERFLOW);
+  #endif
+
+  /* check limits (UINT32_MAX for bad arguments is caught too) */
+  if ((Start < DDS_MIN_FREQ) || (Start > DDS_MAX_FREQ)) return SIGNAL_ERR;
+  if ((Stop < DDS_MIN_FREQ) || (Stop > DDS_MAX_FREQ)) return SIGNAL_ERR;
+  if ((Step == 0) || (Step > DDS_MAX_FREQ)) return SIGNAL_ERR;
+  if ((Dwell < 10) || (Dwell > 60000)) return SIGNAL_ERR;
+
+
+  /*
+   *  processing loop
+   */
+
+  DDS_Start();                     /* set up generator */
+  StartTime = Clock_Get();         /* get start time */
+  Freq = Start;
+  Flag = 1;
+
+  while (Flag)
+  {
+    Time = Clock_Get() - StartTime;    /* get current time */
+
+    if (Time >= Next)              /* time for next step */
+    {
+      /* passed stop frequency */
+      if (Freq == 0) break;        /* end loop */
+
+      DDS_Set(Freq);               /* set frequency */
+
+      /* send: <time>;<frequency> */
+      Display_FullValue(Time, 0, 0);
+      Display_Char(';');
+      Display_FullValue(Freq, 3, 0);
+      Serial_NewLine();
+
+      /* schedule next step */
+      Next += Dwell;
+
+      /* next frequency (0 when passing stop frequency) */
+      if (Stop >= Start)           /* upwards */
+      {
+        Freq += Step;
+        if (Freq > Stop) Freq = 0;
+      }
+      else                         /* downwards */
+      {
+        if (Freq < (Stop + Step)) Freq = 0;
+        else Freq -= Step;
+      }
+    }
+
+    /* sleep until next step, any new line or key press stops sweep */
+    Time = Clock_Get() - StartTime;
+    Wait = 1;                      /* check for keys at least */
+    if (Next > Time) Wait = Next - Time;
+    if (TestKey(Wait, 0) != KEY_TIMEOUT) Flag = 0;
+  }
+
+  DDS_Stop();                      /* stop generator */
+
+  /* discard received line */
+  if (Cfg.OP_Control & OP_RX_LOCKED)
+  {
+    #ifdef SERIAL_RX_QUEUE
+    Serial_GetLine();              /* remove line from queue */
+    #else
+    RX_Pos = 0;                    /* reset position */
+    Cfg.OP_Control &= (~OP_RX_LOCKED & ~OP_RX_OVERFLOW);
+    #endif
+  }
+
+  Display_EEString(Cmd_OK_str);    /* send: OK */
+
+  return SIGNAL_OK;
+}
+
+#endif
+
+#endif
+
+
+
+/*
+ *  run command received via serial interface
+ *
+ *  requires:
+ *  - ID: command ID
+ *
+ *  returns:
+ *  - virtual key
+ */
+
+uint8_t RunCommand(uint8_t ID)
+{
+  uint8_t           Key = KEY_NONE;     /* virtual key */
+  uint8_t           Flag = SIGNAL_OK;   /* result of command function */
+
+  /*
+   *  run command
+   */
+
+  switch (ID)
+  {
+    case CMD_VER:             /* return firmware version */
+      Display_EEString(Version_str);         /* send firmware version */
+      break;
+
+    case CMD_PROBE:           /* probe component */
+      Key = KEY_PROBE;                       /* set virtual key */
+      /* OK is returned after probing by main() */
+      Flag = SIGNAL_NONE;                    /* no newline */ 
+      break;
+
+    case CMD_OFF:             /* power off */
+      Key = KEY_POWER_OFF;                   /* set virtual key */
+      Display_EEString(Cmd_OK_str);          /* send: OK */
+      break;
+
+    case CMD_NEXT:            /* select next component */
+      /* allow only 2nd component */
+      if ((Info.Selected == 1) && (Info.Quantity == 2))
+      {
+        Info.Selected = 2;                   /* 2nd one */
+        Display_EEString(Cmd_OK_str);        /* send: OK */
+      }
+      else
+      {
+        Flag = SIGNAL_NA;                    /* signal n/a */
+      }
+      break;
+
+    case CMD_DUMP:            /* return all values */
+      Flag = Cmd_DUMP();                     /* run command */
+      break;
+
+    #ifdef UI_SERIAL_BINARY
+    case CMD_BIN:             /* return all values as binary frame */
+      Cmd_BIN();                             /* run command */
+      Flag = SIGNAL_NONE;                    /* no newline */
+      break;
+    #endif
+
+    #ifdef UI_SERIAL_STREAM
+    case CMD_STREAM:          /* stream value */
+      Flag = Cmd_STREAM(ArgPos);             /* run command */
+      break;
+    #endif
+
+    #if defined (UI_SERIAL_STREAM) && defined (SW_DDS)
+    case CMD_SWEEP:           /* frequency sweep */
+      Flag = Cmd_SWEEP(ArgPos);              /* run command */
+      break;
+    #endif
+
+    default:                  /* probing results */
+      Flag = ValueCommand(ID);               /* run command */
+      break;
+  }
+
 
   /*
    *  error handling
@@ -70,6 +70,22 @@
 #define KEY_PROBE             104  /* probe component */
 
 
+/* soft timers (IDs) */
+#define TIMER_KEY_POLL        0    /* TestKey(): polling delay */
+#define TIMER_KEY_TIMEOUT     1    /* TestKey(): timeout */
+#define TIMER_KEY_100MS       2    /* TestKey(): 100ms tick */
+#define TIMER_KEY_500MS       3    /* TestKey(): 500ms tick */
+#define TIMERS                4    /* number of soft timers (max. 8) */
+
+/* soft timer modes */
+#define TIMER_ONESHOT         0    /* expire once */
+#define TIMER_PERIODIC        1    /* expire periodically */
+
+/* wake-up of soft timer sleep */
+#define WAKE_DEADLINE         0    /* deadline only */
+#define WAKE_EVENT            1    /* deadline or pending UI event */
+
+
 /* operation mode/state flags (bitmask) */
 #define OP_NONE               0b00000000     /* no flags */
 #define OP_AUTOHOLD           0b00000001     /* auto-hold mode (instead of continuous) */
@@ -120,10 +136,28 @@
 /* control */
 #define SER_RX_PAUSE          1              /* pause RX */
 #define SER_RX_RESUME         2              /* resume RX */
+#define SER_TIMER_LOCK        3              /* free timer for other use */
+#define SER_TIMER_UNLOCK      4              /* use timer for serial again */
+
+/* state of bit-bang serial */
+#define SER_TX_BUSY           0b00000001     /* sending char */
+#define SER_RX_BUSY           0b00000010     /* receiving char */
+#define SER_LOCKED            0b00000100     /* timer locked for other use */
+#define SER_RX_PAUSED         0b00001000     /* RX paused on purpose */
+
+/* state of RX queue */
+#define RXQ_DISCARD           0b00000001     /* discard line (overflow) */
+#define RXQ_XOFF              0b00000010     /* host stopped by XOFF */
+#define RXQ_FLOW              0b00000100     /* XON/XOFF pending */
 
 /* special characters */
 #define CHAR_XON              17             /* software flow control: XON */
 #define CHAR_XOFF             19             /* software flow control: XOFF */
+#define CHAR_CAN              24             /* cancel (RX queue: overflow) */
+
+/* DDS signal generator: frequency range (in mHz) */
+#define DDS_MIN_FREQ          1000UL                        /* 1Hz */
+#define DDS_MAX_FREQ          (CPU_FREQ / 256 * 1000UL)     /* f_MCU/256 */
 
 
 
@@ -134,7 +168,13 @@
 
 /* buffer sizes */
 #define OUT_BUFFER_SIZE      12    /* 11 chars + terminating 0 */
-#define RX_BUFFER_SIZE       11    /* 10 chars + terminating 0 */
+#if defined (UI_SERIAL_STREAM) && defined (SW_DDS)
+  #define RX_BUFFER_SIZE     48    /* 47 chars + terminating 0 */
+#elif defined (UI_SERIAL_STREAM)
+  #define RX_BUFFER_SIZE     20    /* 19 chars + terminating 0 */
+#else
+  #define RX_BUFFER_SIZE     11    /* 10 chars + terminating 0 */
+#endif
 
 /* number of entries in data tables */
 #define NUM_PREFIXES          7    /* unit prefixes */
@@ -191,6 +231,46 @@
 #define CMD_V_GT              37    /* return V_GT */
 #define CMD_V_T               38    /* return V_T */
 #define CMD_R_BB              39    /* return R_BB */
+#define CMD_DUMP              40    /* return all values */
+#define CMD_BIN               41    /* return all values as binary frame */
+#define CMD_STREAM            42    /* stream value */
+#define CMD_SWEEP             43    /* frequency sweep */
+#define CMD_IDS               44    /* number of IDs (last ID + 1) */
+
+
+/*
+ *  command tables (flash)
+ *  - Cmd_Name[]: command string for each ID (hand-edited, empty for
+ *    disabled commands)
+ *  - Cmd_Slot[]: command ID for each hash slot (perfect hash)
+ *  - Cmd_Dump[]: IDs of probing commands in the order of DUMP's response
+ *  - hash: h = h * CMD_HASH_MUL + char, starting with CMD_HASH_SEED
+ *    (8 bit), slot = h % CMD_SLOTS
+ *  - cmd_hash.py chooses the hash parameters to map all commands to
+ *    different slots and creates the slot table in cmd_hash.h
+ *    (run "make cmdhash" after changing the command names)
+ */
+
+#define CMD_LENGTH            6     /* max. length of command string */
+#define CMD_SLOTS             128   /* number of hash slots (2^n) */
+
+/* name table entry: ID and string */
+#define CMD_ENTRY(ID, s)      [ID] = s
+
+
+/* binary frames for remote commands */
+#define FRAME_SYNC            0xA5  /* start of frame */
+
+/* record IDs */
+#define REC_RESISTOR          1     /* resistor */
+#define REC_CAPACITOR         2     /* capacitor */
+#define REC_INDUCTOR          3     /* inductor */
+#define REC_DIODE             4     /* diode */
+#define REC_SEMI              5     /* common semiconductor */
+#define REC_ALTSEMI           6     /* special semiconductor */
+#define REC_ERROR             7     /* error */
+#define REC_DIODE_CAP         8     /* capacitance of preceding diode */
+#define REC_CURRENT           9     /* current (I_R of diode) */
 
 
 
@@ -224,6 +304,66 @@
 
 
 
+/* ************************************************************************
+ *   constants for IR remote control
+ * ************************************************************************ */
+
+
+/* code bit mode */
+#define IR_LSB                1     /* LSB */
+#define IR_MSB                2     /* MSB */
+
+/* bi-phase modes (bitmask) */
+#define IR_IEEE               0b00000001     /* IEEE bit encoding */
+#define IR_THOMAS             0b00000010     /* Thomas bit encoding */
+#define IR_PRE_PAUSE          0b00000100     /* heading pause */
+
+/* timing control flags (bitmask) */
+#define IR_STD_TOLER          0b00000000     /* use default tolerance */
+#define IR_RELAX_SHORT        0b00000001     /* relax short pulses */
+#define IR_RELAX_LONG         0b00000010     /* relax long pulses */
+
+/* timing control for start: pulse and pause */
+#define IR_START(p, s)        ((p) | ((s) << 2))
+#define IR_START_PULSE        0b00000011     /* mask for pulse */
+
+
+/*
+ *  protocol table (receiver)
+ *  - checked in order, first pulse-pause pair and number of
+ *    pulses/pauses prune the candidates before demodulating
+ *  - rows with the same demodulation settings share the result
+ *  - table ends with a row having a start pulse of 0
+ */
+
+/* modulation (bitmask, lower nibble holds bi-phase mode) */
+#define IR_MOD_NONE           0b00000000     /* no data, just stop pulse */
+#define IR_MOD_PXM            0b00010000     /* PDM/PWM: tS, t0, t1 */
+#define IR_MOD_BIPHASE        0b00100000     /* Bi-Phase: tS = half cycle */
+#define IR_MOD_PPM            0b00110000     /* PPM: tS = slot, t0 = slots */
+#define IR_MOD_MASK           0b11110000     /* mask for modulation */
+
+/* flags (bitmask, lower bits hold code bit mode) */
+#define IR_BIT_MODE           0b00000011     /* mask for code bit mode */
+#define IR_LOCK               0b00000100     /* start pair is unique, report bad packet */
+#define IR_TAG_BITS           0b00001000     /* display number of bits as tag */
+
+/* special processing (1-3 modify pulse data before demodulation) */
+#define IR_SPEC_NONE          0     /* none */
+#define IR_SPEC_SYNC          1     /* sync pause at item Param becomes "0" */
+#define IR_SPEC_TRUNC         2     /* cut off repeat packet at item Param */
+#define IR_SPEC_TOGGLE        3     /* RC-6 toggle bit at half cycle Param */
+#define IR_SPEC_INV           4     /* hide inverted high byte of field #1 */
+#define IR_SPEC_NIBBLE        5     /* show nibble at bit Param before field #2 */
+#define IR_SPEC_FRAME         6     /* start/command/end packets, Param = start/end */
+#define IR_SPEC_PAIR          7     /* two packets, first one is displayed */
+
+/* data fields: start bit and number of bits (up to 16) */
+#define IR_FIELDS             3     /* number of fields */
+#define IR_NO_FIELD           0, 0  /* unused field */
+
+
+
 /* ************************************************************************
  *   constants for probing
  * ************************************************************************ */
@@ -658,12 +798,35 @@ typedef struct
 } I2C_Type;
 
 
-/* remote command */
+/* IR demodulation settings */
+typedef struct
+{
+  uint8_t                Skip;     /* pulses/pauses to skip (start) */
+  uint8_t                Mode;     /* modulation and bi-phase mode */
+  uint8_t                tS;       /* time units of spacer/half cycle/slot */
+  uint8_t                t0;       /* time units of 0 (PPM: slots) */
+  uint8_t                t1;       /* time units of 1 */
+  uint8_t                Timing;   /* timing control */
+} IR_Demod_Type;
+
+
+/* IR protocol (receiver) */
 typedef struct
 {
-  uint8_t                ID;       /* command ID */
-  const unsigned char    *Cmd;     /* storage address of command string */
-} Cmd_Type;
+  const unsigned char    *Name;    /* protocol name (EEPROM) */
+  uint8_t                Pulse;    /* start: time units of pulse */
+  uint8_t                Pause;    /* start: time units of pause */
+  uint8_t                Pause2;   /* start: alternative pause (0 = none) */
+  uint8_t                Start;    /* start: timing control */
+  uint8_t                Items;    /* number of pulses/pauses (0 = any) */
+  IR_Demod_Type          Demod;    /* demodulation */
+  uint8_t                Bits;     /* number of bits */
+  uint8_t                Flags;    /* code bit mode and flags */
+  uint8_t                Special;  /* special processing */
+  uint16_t               Param;    /* parameter for special processing */
+  uint8_t                Tag;      /* char displayed after name (0 = none) */
+  uint8_t                Field[IR_FIELDS * 2];  /* start bit & bits */
+} IR_Proto_Type;
 
 
 
@@ -146,11 +146,14 @@
  *  - requires a display with more than 2 text lines
  *  - uncomment to enable
  *  - select the circuit's prescaler setting: either 16:1 or 32:1 
+ *  - counts continuously in 100ms ticks, FREQ_COUNTER_DEPTH sets the
+ *    number of ticks of the moving window (1-10, 10 for 1s)
  */
 
 //#define HW_FREQ_COUNTER_EXT
 #define FREQ_COUNTER_PRESCALER     16   /* 16:1 */
 //#define FREQ_COUNTER_PRESCALER     32   /* 32:1 */
+#define FREQ_COUNTER_DEPTH         10   /* 1s */
 
 
 /*
@@ -162,9 +165,18 @@
  *    more than 5 lines
  *  - only for MCU clock of 8, 16 or 20MHz
  *  - uncomment to enable
+ *  - EVENT_COUNTER_EXT: extended mode
+ *    64 bit event counter without any time limit, event rate based on
+ *    timestamps of first and last event, streaming of results via
+ *    serial each second (requires UI_SERIAL_COMMANDS)
+ *  - EVENT_COUNTER_PRESCALER: use prescaler of extended frequency counter
+ *    (FREQ_COUNTER_PRESCALER) for higher event rates, counts in steps of
+ *    the prescaler (requires EVENT_COUNTER_EXT and HW_FREQ_COUNTER_EXT)
  */
 
 //#define HW_EVENT_COUNTER
+//#define EVENT_COUNTER_EXT
+//#define EVENT_COUNTER_PRESCALER
 
 
 /*
@@ -255,6 +267,22 @@
 #define SW_SQUAREWAVE
 
 
+/*
+ *  DDS signal generator
+ *  - squarewave with arbitrary frequency: a phase accumulator dithers
+ *    the period of Timer1 for an average resolution of 0.001Hz
+ *  - fixed frequency or linear sweep (start, stop, step, dwell time)
+ *  - 1Hz up to f_MCU/256
+ *  - same output as squarewave signal generator
+ *  - remote command SWEEP with UI_SERIAL_STREAM
+ *  - the generator tool requires additional keys and a display with
+ *    more than 5 lines (SWEEP works without)
+ *  - uncomment to enable
+ */
+
+//#define SW_DDS
+
+
 /*
  *  IR remote control detection/decoder (via probes)
  *  - requires IR receiver module, e.g. TSOP series
@@ -294,16 +322,6 @@
 //#define SW_IR_TRANSMITTER
 
 
-/*
- *  Alternative delay loop for IR remote control sender
- *  - in case the the C compiler screws up the default delay loop
- *    and causes incorrect pulse/pause timings
- *  - uncomment to enable
- */
-
-//#define SW_IR_TX_ALTDELAY
-
-
 /*
  *  additional protocols for IR remote control sender
  *  - uncommon protocols which will increase flash memory usage ;)
@@ -343,9 +361,17 @@
  *  DS18B20
  *  - uncomment to enable
  *  - also enable ONEWIRE_PROBES or ONEWIRE_IO_PIN (see section 'Busses')
+ *  - multiple sensors on the bus are found via ROM search and converted
+ *    in parallel, DS18B20_SENSORS is the max. number of sensors
+ *    (also limited by the number of display lines)
+ *  - DS18B20_RESOLUTION is the resolution at start (9-12 bits), a higher
+ *    resolution increases the conversion time (9 bits: 94ms, 10 bits:
+ *    188ms, 11 bits: 375ms, 12 bits: 750ms)
  */
 
 //#define SW_DS18B20
+#define DS18B20_SENSORS       4         /* up to 4 sensors */
+#define DS18B20_RESOLUTION    12        /* 9-12 bits */
 
 
 /*
@@ -458,6 +484,22 @@
 //#define UI_KEY_HINTS
 
 
+/*
+ *  Event-driven user input.
+ *  - test key and rotary encoder are read by a pin change interrupt
+ *    which queues key presses and encoder steps
+ *  - encoder steps aren't lost anymore when turning fast, and TestKey()
+ *    doesn't need to sample the encoder
+ *  - requires dedicated IO pins for the test key and the rotary encoder
+ *    (not in parallel with display signals) within the same PCINT group
+ *  - see BUTTON_PCINT, ENCODER_PCINT_A and ENCODER_PCINT_B
+ *    (config-<MCU>.h)
+ *  - uncomment to enable
+ */
+
+//#define UI_KEY_EVENTS
+
+
 /*
  *  Output components found also via TTL serial interface.
  *  - uncomment to enable
@@ -477,6 +519,37 @@
 //#define UI_SERIAL_COMMANDS
 
 
+/*
+ *  Binary response for remote commands: "BIN" command
+ *  - returns all values of the component(s) found as a binary frame
+ *    with CRC-8 (see README for the frame format)
+ *  - host side decoder: host/tester_frame.c
+ *  - requires UI_SERIAL_COMMANDS
+ *  - can't be combined with SERIAL_RX_QUEUE (XON/XOFF would corrupt
+ *    frames, and frame bytes 0x11/0x13 would be taken as flow control)
+ *  - uncomment to enable
+ */
+
+//#define UI_SERIAL_BINARY
+
+
+/*
+ *  Streaming measurements for remote commands: "STREAM" command
+ *  - re-measures a single value (R, C, ESR, V_F or I_l) of the component
+ *    found and sends a timestamped sample at a fixed rate until any new
+ *    line is received or the test button is pressed
+ *  - timestamps are based on the millisecond clock (Timer2)
+ *  - STREAM_INTERVAL: default sample interval in ms (10-65535)
+ *  - enables TX buffer (default: 16 bytes)
+ *  - requires UI_SERIAL_COMMANDS
+ *  - uncomment to enable
+ */
+
+//#define UI_SERIAL_STREAM
+#define STREAM_INTERVAL       1000
+
+
+
 /*
  *  Maximum time to wait after probing (in ms).
  *  - applies to continuous mode only
@@ -514,6 +587,18 @@
 #define SW_PROBE_COLORS
 
 
+/*
+ *  run-length encoded fonts and component symbols
+ *  - saves flash memory, large fonts and symbols are also displayed faster
+ *  - supported by ILI9163, ILI9341 and ST7735
+ *  - applies to fonts and symbols with a RLE variant (bitmaps/<name>_rle.h)
+ *  - RLE fonts can't be reduced by FONT_SUBSET (Makefile)
+ *  - uncomment to enable
+ */
+
+//#define SW_BITMAP_RLE
+
+
 /*
  *  main menu: power off tester
  *  - uncomment to enable
@@ -595,6 +680,8 @@
 
 /*
  *  Enter sleep mode when idle to save power.
+ *  - MCU sleeps in power save mode until the next deadline of the
+ *    clock (Timer2 keeps running)
  *  - uncomment to enable
  */
 
@@ -801,6 +888,47 @@
 //#define SERIAL_RW                  /* enable serial read support */
 
 
+/*
+ *  TTL serial interface: baud rate
+ *  - hardware serial supports also higher rates, e.g. 38400 or 115200,
+ *    if the MCU clock allows a baud rate error of 2% max.
+ *  - bit-bang serial supports up to MCU clock / 400, e.g. 19200 at 8MHz
+ *    or 38400 at 16MHz, and down to MCU clock / 32768
+ */
+
+#define SERIAL_BAUD        9600      /* 9600 bps */
+
+
+/*
+ *  TTL serial interface: TX buffer
+ *  - data is sent in the background (interrupt driven) 
+ *  - size in bytes, has to be a power of 2 (max. 128)
+ *  - optional for hardware serial
+ *  - bit-bang serial uses always a TX buffer (default: 16 bytes)
+ *  - uncomment to enable and adjust size
+ */
+
+//#define SERIAL_TX_BUFFER   32        /* 32 bytes */
+
+
+/*
+ *  TTL serial interface: RX queue
+ *  - queues several received command lines, so a host can send the
+ *    next commands without waiting for the response (pipelining)
+ *  - software flow control: XOFF is sent when the queue is getting full
+ *    or while probing, XON when there's enough space again
+ *  - chars sent by the host after XOFF are kept just by the hardware
+ *    USART (up to 2), the bit-bang UART loses them
+ *  - size in bytes, has to be a power of 2 (min. 32, max. 128)
+ *  - enables TX buffer (default: 16 bytes)
+ *  - requires SERIAL_RW
+ *  - can't be combined with UI_SERIAL_BINARY
+ *  - uncomment to enable and adjust size
+ */
+
+//#define SERIAL_RX_QUEUE    64        /* 64 bytes */
+
+
 /*
  *  OneWire bus
  *  - for dedicated I/O pin please see ONEWIRE_PORT (config_<MCU>.h)
@@ -972,6 +1100,11 @@
   #define HW_SPI
 #endif
 
+/* 16 bit words and color fills for color displays */
+#if defined (HW_SPI) && defined (LCD_COLOR) && defined (LCD_SPI)
+  #define SPI_WORD
+#endif
+
 /* 9-Bit SPI requires bit-bang mode */
 #ifdef SPI_9
   #ifndef SPI_BITBANG
@@ -991,6 +1124,48 @@
   #define HW_SERIAL
 #endif
 
+/* bit-bang serial: check baud rate (max. 128 ticks per bit with Timer0's
+   prescaler 256) and use TX buffer */
+#ifdef SERIAL_BITBANG
+  #if (SERIAL_BAUD > CPU_FREQ / 400) || (SERIAL_BAUD < CPU_FREQ / 32768)
+    #error <<< Bit-bang serial: baud rate out of range! >>>
+  #endif
+  #ifndef SERIAL_TX_BUFFER
+    #define SERIAL_TX_BUFFER   16
+  #endif
+#endif
+
+/* RX queue requires read support */
+#ifdef SERIAL_RX_QUEUE
+  #ifndef SERIAL_RW
+    #undef SERIAL_RX_QUEUE
+  #endif
+#endif
+
+/* RX queue: check size and use TX buffer (for XON/XOFF) */
+#ifdef SERIAL_RX_QUEUE
+  #if (SERIAL_RX_QUEUE < 32) || (SERIAL_RX_QUEUE > 128) || (SERIAL_RX_QUEUE & (SERIAL_RX_QUEUE - 1))
+    #error <<< SERIAL_RX_QUEUE: size has to be a power of 2 (32-128)! >>>
+  #endif
+  #ifndef SERIAL_TX_BUFFER
+    #define SERIAL_TX_BUFFER   16
+  #endif
+#endif
+
+/* TX buffer requires TTL serial */
+#ifdef SERIAL_TX_BUFFER
+  #ifndef HW_SERIAL
+    #undef SERIAL_TX_BUFFER
+  #endif
+#endif
+
+/* check size of TX buffer */
+#ifdef SERIAL_TX_BUFFER
+  #if (SERIAL_TX_BUFFER > 128) || (SERIAL_TX_BUFFER & (SERIAL_TX_BUFFER - 1))
+    #error <<< SERIAL_TX_BUFFER: size has to be a power of 2 (max. 128)! >>>
+  #endif
+#endif
+
 /* VT100 display driver disables other options for serial interface */
 #ifdef LCD_VT100
   #ifdef UI_SERIAL_COPY
@@ -1021,6 +1196,46 @@
   #endif
 #endif
 
+/* binary response requires remote commands */
+#ifndef UI_SERIAL_COMMANDS
+  #ifdef UI_SERIAL_BINARY
+    #undef UI_SERIAL_BINARY
+  #endif
+#endif
+
+/* binary frames and software flow control exclude each other */
+#if defined (UI_SERIAL_BINARY) && defined (SERIAL_RX_QUEUE)
+  #error <<< UI_SERIAL_BINARY and SERIAL_RX_QUEUE can't be combined! >>>
+#endif
+
+/* streaming requires remote commands */
+#ifndef UI_SERIAL_COMMANDS
+  #ifdef UI_SERIAL_STREAM
+    #undef UI_SERIAL_STREAM
+  #endif
+#endif
+
+/* streaming: use TX buffer (send samples without blocking) */
+#ifdef UI_SERIAL_STREAM
+  #ifndef SERIAL_TX_BUFFER
+    #define SERIAL_TX_BUFFER   16
+  #endif
+#endif
+
+/* DDS signal generator: without additional keys just SWEEP command */
+#if defined (SW_DDS) && ! defined (HW_KEYS)
+  #ifndef UI_SERIAL_STREAM
+    #undef SW_DDS
+  #endif
+#endif
+
+/* SWEEP command: RX queue has to hold a complete command line */
+#if defined (SW_DDS) && defined (UI_SERIAL_STREAM) && defined (SERIAL_RX_QUEUE)
+  #if SERIAL_RX_QUEUE < 64
+    #error <<< SERIAL_RX_QUEUE: SWEEP command requires 64 bytes! >>>
+  #endif
+#endif
+
 
 /* OneWire: probe leads prevail */
 #ifdef ONEWIRE_PROBES
@@ -1037,6 +1252,13 @@
   #endif
 #endif
 
+/* DS18B20: resolution */
+#ifdef SW_DS18B20
+  #if (DS18B20_RESOLUTION < 9) || (DS18B20_RESOLUTION > 12)
+    #error <<< DS18B20_RESOLUTION must be 9-12 bits! >>>
+  #endif
+#endif
+
 
 /* touchscreen */
 #ifdef TOUCH_PORT
@@ -1082,11 +1304,80 @@
 #endif
 
 
+/* run-length encoded fonts and symbols require a supported display */
+#ifdef SW_BITMAP_RLE
+  #if ! defined (LCD_ILI9163) && ! defined (LCD_ILI9341) && ! defined (LCD_ST7735)
+    #undef SW_BITMAP_RLE
+  #endif
+#endif
+
+/* select run-length encoded variants of fonts and symbols */
+#ifdef SW_BITMAP_RLE
+  #ifdef FONT_10X16_HF
+    #undef FONT_10X16_HF
+    #define FONT_10X16_HF_RLE
+    #define FONT_RLE
+  #endif
+  #ifdef FONT_12X16_HF
+    #undef FONT_12X16_HF
+    #define FONT_12X16_HF_RLE
+    #define FONT_RLE
+  #endif
+  #ifdef FONT_16X26_HF
+    #undef FONT_16X26_HF
+    #define FONT_16X26_HF_RLE
+    #define FONT_RLE
+  #endif
+  #ifdef SYMBOLS_24X24_HF
+    #undef SYMBOLS_24X24_HF
+    #define SYMBOLS_24X24_HF_RLE
+    #define SYMBOLS_RLE
+  #endif
+  #ifdef SYMBOLS_30X32_HF
+    #undef SYMBOLS_30X32_HF
+    #define SYMBOLS_30X32_HF_RLE
+    #define SYMBOLS_RLE
+  #endif
+  #ifdef SYMBOLS_32X32_HF
+    #undef SYMBOLS_32X32_HF
+    #define SYMBOLS_32X32_HF_RLE
+    #define SYMBOLS_RLE
+  #endif
+#endif
+
+/* font subsets (Makefile) don't support run-length encoded fonts */
+#if defined (FONT_SUBSET) && defined (FONT_RLE)
+  #error <<< FONT_SUBSET: run-length encoded fonts are not supported! >>>
+#endif
+
+
 /* frequency counter */
 #if defined (HW_FREQ_COUNTER_BASIC) || defined (HW_FREQ_COUNTER_EXT)
   #define HW_FREQ_COUNTER
 #endif
 
+/* extended frequency counter: moving window */
+#ifdef HW_FREQ_COUNTER_EXT
+  #if (FREQ_COUNTER_DEPTH < 1) || (FREQ_COUNTER_DEPTH > 10)
+    #error <<< FREQ_COUNTER_DEPTH must be 1-10! >>>
+  #endif
+#endif
+
+
+/* extended event counter requires event counter */
+#ifndef HW_EVENT_COUNTER
+  #ifdef EVENT_COUNTER_EXT
+    #undef EVENT_COUNTER_EXT
+  #endif
+#endif
+
+/* event counter prescaler requires extended modes */
+#if ! defined (EVENT_COUNTER_EXT) || ! defined (HW_FREQ_COUNTER_EXT)
+  #ifdef EVENT_COUNTER_PRESCALER
+    #undef EVENT_COUNTER_PRESCALER
+  #endif
+#endif
+
 
 /* IR detector/decoder: probe lead based decoder prevails */
 #ifdef SW_IR_RECEIVER
@@ -1096,6 +1387,67 @@
   #undef SW_IR_RECEIVER
 #endif
 
+/* IR detector/decoder: PCINT# of data signal */
+#ifdef SW_IR_RECEIVER
+  #define IR_RX_PCINT     IR_TP3_PCINT
+#endif
+#ifdef HW_IR_RECEIVER
+  #define IR_RX_PCINT     IR_PCINT
+#endif
+
+/* IR detector/decoder: pin change interrupt shared with bit-bang serial */
+#if defined (IR_RX_PCINT) && defined (SERIAL_BITBANG) && defined (SERIAL_RW)
+  #if (IR_RX_PCINT / 8) == (SERIAL_PCINT / 8)
+    #error <<< IR detector: PCINT group used by bit-bang serial! >>>
+  #endif
+#endif
+
+/* touch screen: pin change interrupt for /PENIRQ */
+#ifdef HW_TOUCH
+  #ifndef TOUCH_PCINT
+    #error <<< Touch screen: please set TOUCH_PCINT! >>>
+  #endif
+
+  #if defined (SERIAL_BITBANG) && defined (SERIAL_RW)
+    #if (TOUCH_PCINT / 8) == (SERIAL_PCINT / 8)
+      #error <<< Touch screen: PCINT group used by bit-bang serial! >>>
+    #endif
+  #endif
+
+  #ifdef IR_RX_PCINT
+    #if (TOUCH_PCINT / 8) == (IR_RX_PCINT / 8)
+      #error <<< Touch screen: PCINT group used by IR detector! >>>
+    #endif
+  #endif
+#endif
+
+/* key events: pin change interrupt for test key and rotary encoder */
+#ifdef UI_KEY_EVENTS
+  #ifdef HW_ENCODER
+    #if ((ENCODER_PCINT_A / 8) != (BUTTON_PCINT / 8)) || ((ENCODER_PCINT_B / 8) != (BUTTON_PCINT / 8))
+      #error <<< Key events: test key and encoder require same PCINT group! >>>
+    #endif
+  #endif
+
+  #if defined (SERIAL_BITBANG) && defined (SERIAL_RW)
+    #if (BUTTON_PCINT / 8) == (SERIAL_PCINT / 8)
+      #error <<< Key events: PCINT group used by bit-bang serial! >>>
+    #endif
+  #endif
+
+  #ifdef IR_RX_PCINT
+    #if (BUTTON_PCINT / 8) == (IR_RX_PCINT / 8)
+      #error <<< Key events: PCINT group used by IR detector! >>>
+    #endif
+  #endif
+
+  #ifdef HW_TOUCH
+    #if (BUTTON_PCINT / 8) == (TOUCH_PCINT / 8)
+      #error <<< Key events: PCINT group used by touch screen! >>>
+    #endif
+  #endif
+#endif
+
 
 
 /* ************************************************************************
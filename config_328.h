@@ -641,6 +641,7 @@
 #define BUTTON_DDR       DDRD      /* port data direction register */
 #define BUTTON_PIN       PIND      /* port input pins register */
 #define TEST_BUTTON      PD7       /* test/start push button (low active) */
+#define BUTTON_PCINT     23        /* PCINT# for test button */
 
 
 /*
@@ -652,6 +653,8 @@
 #define ENCODER_PIN      PIND      /* port input pins register */
 #define ENCODER_A        PD2       /* rotary encoder A signal */
 #define ENCODER_B        PD3       /* rotary encoder B signal */
+#define ENCODER_PCINT_A  18        /* PCINT# for A signal */
+#define ENCODER_PCINT_B  19        /* PCINT# for B signal */
 
 
 /*
@@ -678,12 +681,16 @@
 /*
  *  IR detector/decoder
  *  - fixed module connected to dedicated I/O pin
+ *  - pin change interrupt of data pin, or of probe #3 when the module is
+ *    connected to the probes
  */
 
 #define IR_PORT          PORTC     /* port data register */
 #define IR_DDR           DDRC      /* port data direction register */
 #define IR_PIN           PINC      /* port input pins register */
 #define IR_DATA          PC6       /* data signal */
+#define IR_PCINT         14        /* PCINT# for data pin */
+#define IR_TP3_PCINT     10        /* PCINT# for probe #3 */
 
 
 /*
@@ -565,6 +565,7 @@
 #define TOUCH_PIN        PINB      /* port input pins register */
 #define TOUCH_CS         PB0       /* port pin used for /CS */
 #define TOUCH_PEN        PB1       /* port pin used for /PENIRQ */
+#define TOUCH_PCINT      9         /* PCINT# for /PENIRQ */
 //#define TOUCH_FLIP_X               /* enable horizontal flip */
 //#define TOUCH_FLIP_Y               /* enable vertical flip */
 //#define TOUCH_ROTATE               /* switch X and Y (rotate by 90) */
@@ -642,6 +643,7 @@
 #define BUTTON_DDR       DDRC      /* port data direction register */
 #define BUTTON_PIN       PINC      /* port input pins register */
 #define TEST_BUTTON      PC7       /* test/start push button (low active) */
+#define BUTTON_PCINT     23        /* PCINT# for test button */
 
 
 /*
@@ -653,6 +655,8 @@
 #define ENCODER_PIN      PINC      /* port input pins register */
 #define ENCODER_A        PC4       /* rotary encoder A signal */
 #define ENCODER_B        PC3       /* rotary encoder B signal */
+#define ENCODER_PCINT_A  20        /* PCINT# for A signal */
+#define ENCODER_PCINT_B  19        /* PCINT# for B signal */
 
 
 /*
@@ -687,12 +691,16 @@
 /*
  *  IR detector/decoder
  *  - fixed module connected to dedicated I/O pin
+ *  - pin change interrupt of data pin, or of probe #3 when the module is
+ *    connected to the probes
  */
 
 #define IR_PORT          PORTC     /* port data register */
 #define IR_DDR           DDRC      /* port data direction register */
 #define IR_PIN           PINC      /* port input pins register */
 #define IR_DATA          PC2       /* data signal */
+#define IR_PCINT         18        /* PCINT# for data pin */
+#define IR_TP3_PCINT     2         /* PCINT# for probe #3 */
 
 
 /*
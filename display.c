@@ -452,7 +452,7 @@ void Display_HexValue(uint16_t Value, uint8_t Bits)
 
 
 
-#if defined (SW_SQUAREWAVE) || defined (SW_PWM_PLUS) || defined (HW_FREQ_COUNTER_EXT) || defined (SW_SERVO) || defined (SW_DS18B20) || defined (HW_EVENT_COUNTER)
+#if defined (SW_SQUAREWAVE) || defined (SW_PWM_PLUS) || defined (HW_FREQ_COUNTER) || defined (SW_SERVO) || defined (SW_DS18B20) || defined (HW_EVENT_COUNTER) || defined (UI_SERIAL_STREAM) || defined (SW_DDS)
 
 /*
  *  display unsigned value plus unit
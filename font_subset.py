@@ -0,0 +1,237 @@
+#!/usr/bin/env python3
+#
+#  font_subset.py
+#
+#  create font subsets with just the characters used by the firmware
+#  - preprocesses all C sources with the active settings (language,
+#    options, display) and collects the characters of all string and
+#    character literals (UI texts and the output alphabet of the
+#    formatting functions)
+#  - writes a copy of each graphic font with a reduced FontData[] and
+#    a remapped FontTable[] to the output directory, which is searched
+#    before bitmaps/ when enabled in the Makefile (FONT_SUBSET)
+#
+#  usage:
+#    font_subset.py [-o <dir>] [-f <dir>] <sources> -- <cc> <flags>
+#    -o: output directory (default: subset)
+#    -f: font directory (default: bitmaps)
+#
+#  (c) 2019 by Markus Reschke
+#
+
+import os
+import re
+import subprocess
+import sys
+
+
+#
+#  settings
+#
+
+# characters always kept
+# - 0x01-0x1f: symbols and special characters (LCD_CHAR_*)
+# - 0-9, A-F, a-f: digits calculated at run time (values, hex output)
+# - space
+ALWAYS = set(range(0x01, 0x20))
+ALWAYS |= set(b'0123456789ABCDEFabcdef ')
+
+# fonts for character displays (custom characters, no subset possible)
+SKIP = ('font_HD44780_', 'font_ST7036')
+
+# run-length encoded fonts (variable size per character, not supported)
+SKIP_RLE = '_rle.h'
+
+
+#
+#  collect characters used
+#
+
+# string or character literal
+LITERAL = re.compile(r'"((?:[^"\\\n]|\\.)*)"|\'((?:[^\'\\\n]|\\.)*)\'')
+
+# line marker of preprocessor: # <line> "<file>" <flags>
+MARKER = re.compile(r'^#\s*(?:line\s+)?\d+\s+"([^"]*)"')
+
+
+def unescape(text):
+    """ convert C escape sequences to byte values """
+    out = []
+    i = 0
+    while i < len(text):
+        c = text[i]
+        i += 1
+        if c != '\\':
+            out.append(ord(c) & 0xff)
+            continue
+        c = text[i]
+        i += 1
+        if c == 'x':                         # hex: \xhh
+            m = re.match(r'[0-9a-fA-F]+', text[i:])
+            out.append(int(m.group(0), 16) & 0xff)
+            i += len(m.group(0))
+        elif c in '01234567':                # octal: \ooo
+            m = re.match(r'[0-7]{1,3}', text[i - 1:])
+            out.append(int(m.group(0), 8) & 0xff)
+            i += len(m.group(0)) - 1
+        else:
+            out.append({'n': 10, 'r': 13, 't': 9, 'a': 7, 'b': 8,
+                        'f': 12, 'v': 11}.get(c, ord(c) & 0xff))
+    return out
+
+
+def used_chars(sources, cc):
+    """ preprocess sources and return set of characters used """
+    chars = set(ALWAYS)
+    base = os.getcwd()
+
+    for source in sources:
+        proc = subprocess.run(cc + ['-E', source], stdout=subprocess.PIPE,
+                              check=True)
+        text = proc.stdout.decode('latin-1')   # sources are ISO 8859-1
+
+        # only literals from the project's files, not from system headers
+        local = True
+        for line in text.splitlines():
+            m = MARKER.match(line)
+            if m:
+                path = os.path.abspath(m.group(1))
+                local = path.startswith(base + os.sep)
+                continue
+            if not local:
+                continue
+            for m in LITERAL.finditer(line):
+                literal = m.group(1) if m.group(1) is not None else m.group(2)
+                chars.update(unescape(literal))
+
+    chars.discard(0)
+    return chars
+
+
+#
+#  font processing
+#
+
+# data byte
+BYTE = re.compile(r'0x[0-9a-fA-F]{2}')
+
+# comment
+COMMENT = re.compile(r'/\*(.*?)\*/')
+
+
+def find_block(text, name):
+    """ return start and end of initializer of array <name> """
+    m = re.search(r'const uint8_t ' + name + r'\[\] PROGMEM = \{\s*\n', text)
+    start = m.end()
+    end = text.index('};', start)
+    return start, end
+
+
+def subset_font(path, chars, outdir):
+    """ write subset of font <path> to <outdir> """
+    text = open(path, encoding='latin-1').read()
+    size = int(re.search(r'#define FONT_BYTES_N\s+(\d+)', text).group(1))
+
+    # split font data into characters (list of source lines)
+    start, end = find_block(text, 'FontData')
+    glyphs = []
+    lines = []
+    count = 0
+    for line in text[start:end].splitlines():
+        n = len(BYTE.findall(COMMENT.sub('', line)))
+        if n == 0:                           # empty line or comment
+            continue
+        lines.append(line.rstrip())
+        count += n
+        if count >= size:
+            glyphs.append(lines)
+            lines = []
+            count = 0
+
+    # font table: 256 entries with comments
+    t_start, t_end = find_block(text, 'FontTable')
+    table = []
+    for line in text[t_start:t_end].splitlines():
+        m = BYTE.search(line)
+        if m:
+            c = COMMENT.search(line)
+            table.append((int(m.group(0), 16), c.group(1) if c else ''))
+    if len(table) != 256:
+        sys.exit('%s: bad font table' % path)
+
+    # characters to keep and their new positions
+    keep = sorted({table[c][0] for c in chars if table[c][0] != 0xff})
+    remap = {old: new for new, old in enumerate(keep)}
+
+    # new font data
+    data = []
+    for new, old in enumerate(keep):
+        for n, line in enumerate(glyphs[old]):
+            m = COMMENT.search(line)
+            pos = m.start() if m else len(line)
+            code = line[:pos].rstrip().rstrip(',')
+            if new < len(keep) - 1 or n < len(glyphs[old]) - 1:
+                code += ','                  # not the last line
+            data.append(code.ljust(pos) + line[pos:])
+
+    # new font table
+    entries = []
+    for c, (old, comment) in enumerate(table):
+        new = remap[old] if (c in chars and old != 0xff) else 0xff
+        if new == 0xff and old != 0xff:
+            comment = comment.split('->')[0] + '-> n/a (not used) '
+        entries.append('  0x%02x,        /*%s*/' % (new, comment))
+
+    text = (text[:start] + '\n'.join(data) + '\n' + text[end:t_start] +
+            '\n'.join(entries) + '\n' + text[t_end:])
+
+    # note about origin
+    name = os.path.basename(path)
+    note = ('/* ************************************************************************\n'
+            ' *\n'
+            ' *   subset of %s (%d of %d characters)\n'
+            ' *   - created by font_subset.py, don\'t edit!\n'
+            ' *\n'
+            ' * ************************************************************************ */\n'
+            '\n\n' % (path, len(keep), len(glyphs)))
+
+    with open(os.path.join(outdir, name), 'w', encoding='latin-1') as f:
+        f.write(note + text)
+
+
+#
+#  main
+#
+
+def main(args):
+    outdir = 'subset'
+    fontdir = 'bitmaps'
+
+    if '--' not in args:
+        sys.exit('usage: font_subset.py [-o <dir>] [-f <dir>] <sources> -- <cc> <flags>')
+    cc = args[args.index('--') + 1:]
+    args = args[:args.index('--')]
+
+    sources = []
+    while args:
+        arg = args.pop(0)
+        if arg == '-o':
+            outdir = args.pop(0)
+        elif arg == '-f':
+            fontdir = args.pop(0)
+        else:
+            sources.append(arg)
+
+    chars = used_chars(sources, cc)
+    os.makedirs(outdir, exist_ok=True)
+
+    for name in sorted(os.listdir(fontdir)):
+        if not name.startswith('font_') or name.startswith(SKIP):
+            continue
+        if name.endswith(SKIP_RLE):
+            continue
+        subset_font(os.path.join(fontdir, name), chars, outdir)
+
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
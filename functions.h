@@ -63,7 +63,7 @@
 
 
 /* ************************************************************************
- *   functions from SPI.c
+ *   functions from SPI.c (and SPI_bitbang.S)
  * ************************************************************************ */
 
 #ifndef SPI_C
@@ -77,6 +77,10 @@
     extern void SPI_Write_Bit(uint8_t Bit);
     #endif
   extern void SPI_Write_Byte(uint8_t Byte);
+    #ifdef SPI_WORD
+    extern void SPI_Write_Word(uint16_t Word);
+    extern void SPI_Repeat_Word(uint16_t Word, uint16_t Count);
+    #endif
     #ifdef SPI_RW
     extern uint8_t SPI_WriteRead_Byte(uint8_t Byte);
     #endif
@@ -113,12 +117,22 @@
   #ifdef HW_SERIAL
   extern void Serial_Setup(void);
   extern void Serial_WriteByte(uint8_t Byte);
-    #ifdef SERIAL_RW
+    #ifdef SERIAL_TX_BUFFER
+    extern void Serial_Flush(void);
+    #endif
+    #if defined (SERIAL_RW) || defined (SERIAL_BITBANG)
     void Serial_Ctrl(uint8_t Control);
     #endif
+    #ifdef SERIAL_BITBANG
+    extern void Serial_SetBaud(uint16_t Baud);
+    #endif
 
     extern void Serial_Char(unsigned char Char);
 
+    #ifdef SERIAL_RX_QUEUE
+    extern uint8_t Serial_GetLine(void);
+    #endif
+
     #if defined (UI_SERIAL_COPY) || defined (UI_SERIAL_COMMANDS)
     extern void Serial_NewLine(void);
     #endif
@@ -143,11 +157,19 @@
   #endif
 
   #if defined (ONEWIRE_IO_PIN) || defined (ONEWIRE_PROBES)
+  extern void OneWire_StartReset(void);
+  extern void OneWire_StartBits(uint8_t Data, uint8_t Count);
+  extern uint8_t OneWire_Ready(void);
+  extern uint8_t OneWire_Result(void);
   extern uint8_t OneWire_ResetBus(void);
   #endif
 
   #ifdef SW_DS18B20
-  extern uint8_t DS18B20_ReadTemperature(int32_t *Value, int8_t *Scale, uint8_t *Bits);
+  extern uint8_t DS18B20_Search(uint8_t *ROM_Codes, uint8_t Max);
+  extern uint8_t DS18B20_StartConversion(void);
+  extern uint8_t DS18B20_CheckConversion(void);
+  extern uint8_t DS18B20_SetResolution(uint8_t *ROM_Code, uint8_t Bits);
+  extern uint8_t DS18B20_ReadTemperature(uint8_t *ROM_Code, int32_t *Value, int8_t *Scale, uint8_t *Bits);
   #endif
 
 #endif
@@ -212,7 +234,7 @@
   extern void Display_HexValue(uint16_t Value, uint8_t Bits);
   #endif
 
-  #if defined (SW_SQUAREWAVE) || defined (SW_PWM_PLUS) || defined (HW_FREQ_COUNTER_EXT) || defined (SW_SERVO) || defined (SW_DS18B20) || defined (HW_EVENT_COUNTER)
+  #if defined (SW_SQUAREWAVE) || defined (SW_PWM_PLUS) || defined (HW_FREQ_COUNTER) || defined (SW_SERVO) || defined (SW_DS18B20) || defined (HW_EVENT_COUNTER) || defined (UI_SERIAL_STREAM) || defined (SW_DDS)
   extern void Display_FullValue(uint32_t Value, uint8_t DecPlaces, unsigned char Unit);
   #endif
 
@@ -236,8 +258,18 @@
 
 #ifndef PAUSE_C
 
+  extern void Clock_Init(void);
+  extern void Clock_Hold(void);
+  extern void Clock_Release(void);
+  extern uint32_t Clock_Get(void);
+
   extern void MilliSleep(uint16_t Time);
 
+  extern void Timer_Start(uint8_t ID, uint16_t Time, uint8_t Mode);
+  extern void Timer_Stop(uint8_t ID);
+  extern uint8_t Timer_Expired(uint8_t ID);
+  extern void Timer_Sleep(uint8_t Wake);
+
 #endif
 
 
@@ -286,6 +318,10 @@
     uint32_t Value2, int8_t Scale2);
   extern uint32_t RescaleValue(uint32_t Value, int8_t Scale, int8_t NewScale);
 
+  #ifdef UI_KEY_EVENTS
+  extern void Key_Init(void);
+  extern uint8_t Key_Pending(void);
+  #endif
   extern uint8_t TestKey(uint16_t Timeout, uint8_t Mode);
   extern void WaitKey(void);
   #if defined (SW_PWM_PLUS) || defined (SW_SERVO) || defined (HW_EVENT_COUNTER)
@@ -339,6 +375,16 @@
   extern void SquareWave_SignalGenerator(void);
   #endif
 
+  #ifdef SW_DDS
+  extern void DDS_Start(void);
+  extern void DDS_Set(uint32_t Freq);
+  extern void DDS_Stop(void);
+  #endif
+
+  #if defined (SW_DDS) && defined (HW_KEYS)
+  extern void DDS_SignalGenerator(void);
+  #endif
+
   #if defined (SW_ESR) || defined (SW_OLD_ESR)
   extern void ESR_Tool(void);
   #endif
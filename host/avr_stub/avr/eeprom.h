@@ -0,0 +1,14 @@
+/* host stub of <avr/eeprom.h>: EEPROM is plain memory */
+
+#ifndef STUB_AVR_EEPROM_H
+#define STUB_AVR_EEPROM_H
+
+#include <stdint.h>
+
+#define EEMEM
+#define eeprom_read_byte(p)    (*(const uint8_t *)(p))
+#define eeprom_read_word(p)    (*(const uint16_t *)(p))
+#define eeprom_write_byte(p, v)   (*(uint8_t *)(p) = (v))
+#define eeprom_write_word(p, v)   (*(uint16_t *)(p) = (v))
+
+#endif
@@ -0,0 +1,11 @@
+/* host stub of <avr/interrupt.h>: ISRs become plain functions */
+
+#ifndef STUB_AVR_INTERRUPT_H
+#define STUB_AVR_INTERRUPT_H
+
+#define ISR(vector, ...)       void vector(void)
+#define ISR_BLOCK
+#define cli()
+#define sei()
+
+#endif
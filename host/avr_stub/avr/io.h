@@ -0,0 +1,64 @@
+/* ************************************************************************
+ *
+ *   host stub of <avr/io.h>
+ *   - I/O registers become plain variables (see ir_test.c)
+ *   - just the registers and bits used by the tested sources
+ *
+ * ************************************************************************ */
+
+#ifndef STUB_AVR_IO_H
+#define STUB_AVR_IO_H
+
+#include <stdint.h>
+
+/* registers */
+extern volatile uint8_t   SREG;
+extern volatile uint8_t   PORTB, DDRB, PINB;
+extern volatile uint8_t   PORTC, DDRC, PINC;
+extern volatile uint8_t   PORTD, DDRD, PIND;
+extern volatile uint8_t   PCICR, PCIFR, PCMSK0, PCMSK1, PCMSK2;
+extern volatile uint8_t   TCCR1A, TCCR1B, TIMSK1, TIFR1;
+extern volatile uint16_t  TCNT1, OCR1A, OCR1B, ICR1;
+
+/* bits */
+#define SREG_I    7
+#define PB0       0
+#define PB1       1
+#define PB2       2
+#define PB3       3
+#define PB4       4
+#define PB5       5
+#define PB6       6
+#define PB7       7
+#define PC0       0
+#define PC1       1
+#define PC2       2
+#define PC3       3
+#define PC4       4
+#define PC5       5
+#define PC6       6
+#define PD0       0
+#define PD1       1
+#define PD2       2
+#define PD3       3
+#define PD4       4
+#define PD5       5
+#define PD6       6
+#define PD7       7
+#define PCIE0     0
+#define PCIE1     1
+#define PCIE2     2
+#define PCIF0     0
+#define PCIF1     1
+#define PCIF2     2
+#define CS10      0
+#define CS11      1
+#define CS12      2
+#define TOIE1     0
+#define OCIE1A    1
+#define OCIE1B    2
+#define TOV1      0
+#define OCF1A     1
+#define OCF1B     2
+
+#endif
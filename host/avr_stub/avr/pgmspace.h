@@ -0,0 +1,14 @@
+/* host stub of <avr/pgmspace.h>: flash is plain memory */
+
+#ifndef STUB_AVR_PGMSPACE_H
+#define STUB_AVR_PGMSPACE_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+#define memcpy_P(d, s, n)      memcpy((d), (s), (n))
+#define pgm_read_byte(p)       (*(const uint8_t *)(p))
+#define pgm_read_word(p)       (*(const uint16_t *)(p))
+
+#endif
@@ -0,0 +1,13 @@
+/* host stub of <avr/sleep.h> */
+
+#ifndef STUB_AVR_SLEEP_H
+#define STUB_AVR_SLEEP_H
+
+#define SLEEP_MODE_IDLE        0
+#define SLEEP_MODE_PWR_SAVE    3
+#define set_sleep_mode(m)
+#define sleep_enable()
+#define sleep_disable()
+#define sleep_cpu()
+
+#endif
@@ -0,0 +1,8 @@
+/* host stub of <avr/wdt.h> */
+
+#ifndef STUB_AVR_WDT_H
+#define STUB_AVR_WDT_H
+
+#define wdt_reset()
+
+#endif
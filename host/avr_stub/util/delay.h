@@ -0,0 +1,9 @@
+/* host stub of <util/delay.h> */
+
+#ifndef STUB_UTIL_DELAY_H
+#define STUB_UTIL_DELAY_H
+
+#define _delay_us(t)
+#define _delay_ms(t)
+
+#endif
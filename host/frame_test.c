@@ -0,0 +1,438 @@
+/* ************************************************************************
+ *
+ *   host test for the frame decoder (tester_frame.c)
+ *   - round trip of frames built like the firmware does
+ *   - bad CRC, resync after a false sync and truncated input
+ *   - payload parser with valid and truncated records
+ *
+ *   (c) 2019 by Markus Reschke
+ *
+ * ************************************************************************ */
+
+
+/*
+ *  include header files
+ */
+
+/* basic includes */
+#include <stdio.h>
+#include <string.h>
+
+/* local includes */
+#include "tester_frame.h"
+
+
+/*
+ *  local constants
+ */
+
+#define MAX_FRAMES       8         /* frames collected per stream */
+
+
+/*
+ *  local variables
+ */
+
+static TF_Decoder   Dec;                     /* decoder */
+static uint8_t      Stream[1024];            /* input stream */
+static size_t       StreamSize;              /* bytes in stream */
+
+static uint8_t      Frames[MAX_FRAMES][TF_MAX_DATA];  /* decoded frames */
+static uint8_t      FrameLength[MAX_FRAMES]; /* length of decoded frames */
+static unsigned     FrameCount;              /* number of decoded frames */
+static unsigned     CRC_Errors;              /* number of CRC errors */
+
+static unsigned     Tests;                   /* number of checks */
+static unsigned     Failed;                  /* number of failed checks */
+
+
+
+/* ************************************************************************
+ *   helpers
+ * ************************************************************************ */
+
+
+/*
+ *  check a condition
+ */
+
+static void Check(const char *Name, int Condition)
+{
+  Tests++;
+  if (! Condition)
+  {
+    Failed++;
+    printf("FAIL %s\n", Name);
+  }
+}
+
+
+/*
+ *  add bytes to input stream
+ */
+
+static void Put(const void *Data, size_t Size)
+{
+  memcpy(&Stream[StreamSize], Data, Size);
+  StreamSize += Size;
+}
+
+static void PutByte(uint8_t Byte)
+{
+  Put(&Byte, 1);
+}
+
+
+/*
+ *  add frame to input stream
+ *  - <sync> <length> <command> <payload> <CRC-8>
+ *
+ *  returns:
+ *  - position of frame in stream
+ */
+
+static size_t PutFrame(uint8_t Command, const uint8_t *Payload, uint8_t Size)
+{
+  size_t            Pos = StreamSize;   /* return value */
+  uint8_t           CRC = 0;            /* CRC-8 */
+  uint8_t           n;                  /* counter */
+
+  PutByte(TF_SYNC);
+  PutByte(Size + 1);
+  CRC = tf_crc8(CRC, Size + 1);
+  PutByte(Command);
+  CRC = tf_crc8(CRC, Command);
+
+  for (n = 0; n < Size; n++)
+  {
+    PutByte(Payload[n]);
+    CRC = tf_crc8(CRC, Payload[n]);
+  }
+
+  PutByte(CRC);
+
+  return Pos;
+}
+
+
+/*
+ *  feed stream to a new decoder and collect results
+ */
+
+static void Decode(void)
+{
+  size_t            n;             /* counter */
+  int               Flag;          /* decoder result */
+
+  tf_init(&Dec);
+  FrameCount = 0;
+  CRC_Errors = 0;
+
+  for (n = 0; n < StreamSize; n++)
+  {
+    Flag = tf_feed(&Dec, Stream[n]);
+
+    if (Flag == TF_FRAME)
+    {
+      if (FrameCount < MAX_FRAMES)
+      {
+        memcpy(Frames[FrameCount], Dec.Data, Dec.Length);
+        FrameLength[FrameCount] = Dec.Length;
+      }
+      FrameCount++;
+    }
+    else if (Flag == TF_ERR_CRC)
+    {
+      CRC_Errors++;
+    }
+  }
+}
+
+
+/*
+ *  start new stream
+ */
+
+static void Reset(void)
+{
+  StreamSize = 0;
+}
+
+
+
+/* ************************************************************************
+ *   tests
+ * ************************************************************************ */
+
+
+/* payload of "BIN": BJT with a resistor, a diode and a semi record */
+static const uint8_t Payload[] = {
+  TF_COMP_BJT, 1, 1, 0x02, 0x9A, 0x02,     /* header, V_BE 666 */
+  TF_REC_RESISTOR, 0, 2,                   /* resistor, probes 1-3 */
+    0xFD, 0x40, 0xE2, 0x01, 0x00,          /* 123456 * 10^-3 */
+  TF_REC_DIODE, 1, 0, 0xBC, 0x02, 0xFF, 0xFF,   /* V_f 700, V_f2 -1 */
+  TF_REC_SEMI, 0, 1, 2,                    /* B, C, E */
+    0x9A, 0x02, 0x00, 0x00,                /* U_1 666, U_2 0 */
+    0x2C, 0x01, 0x00, 0x00,                /* hFE 300 */
+    0x00, 0x00, 0x00, 0x00,                /* reverse hFE 0 */
+    0xF7, 0x05, 0x00, 0x00, 0x00,          /* I_CEO 5 * 10^-9 */
+    0xF4, 0x0A, 0x00, 0x00, 0x00           /* C_BE 10 * 10^-12 */
+};
+
+
+/*
+ *  CRC-8 (OneWire) check value
+ */
+
+static void Test_CRC(void)
+{
+  const char        *Text = "123456789";
+  uint8_t           CRC = 0;
+
+  while (*Text)
+  {
+    CRC = tf_crc8(CRC, (uint8_t)*Text);
+    Text++;
+  }
+
+  Check("CRC-8 check value", CRC == 0xA1);
+}
+
+
+/*
+ *  round trip: frame between text responses, parse payload
+ */
+
+static void Test_RoundTrip(void)
+{
+  TF_Results        Res;           /* probing results */
+  TF_Record         Rec;           /* record */
+  size_t            n;             /* counter */
+  int               Flag = TF_NONE;     /* decoder result */
+
+  Reset();
+  Put("OK\n", 3);
+  PutFrame(TF_CMD_BIN, Payload, sizeof(Payload));
+  Put("OK\n", 3);
+  Decode();
+
+  Check("round trip: one frame", (FrameCount == 1) && (CRC_Errors == 0));
+  Check("round trip: length", FrameLength[0] == sizeof(Payload) + 1);
+  Check("round trip: data", memcmp(&Frames[0][1], Payload, sizeof(Payload)) == 0);
+
+  /* CRC byte completes frame, frame stays in decoder */
+  Reset();
+  PutFrame(TF_CMD_BIN, Payload, sizeof(Payload));
+  tf_init(&Dec);
+  for (n = 0; n < StreamSize; n++) Flag = tf_feed(&Dec, Stream[n]);
+  Check("round trip: CRC completes frame", Flag == TF_FRAME);
+
+  Check("command", tf_command(&Dec) == TF_CMD_BIN);
+  Check("results header", tf_results(&Dec, &Res) == TF_OK);
+  Check("results fields", (Res.Found == TF_COMP_BJT) && (Res.Type == 1) &&
+        (Res.Quantity == 1) && (Res.Flags == 0x02) && (Res.Val1 == 666));
+
+  Check("resistor record", tf_next_record(&Res, &Rec) == 1);
+  Check("resistor fields", (Rec.ID == TF_REC_RESISTOR) && (Rec.A == 0) &&
+        (Rec.B == 2) && (Rec.Val.Value == 123456) && (Rec.Val.Scale == -3));
+  Check("resistor value", (tf_value(&Rec.Val) > 123.455) &&
+        (tf_value(&Rec.Val) < 123.457));
+
+  Check("diode record", tf_next_record(&Res, &Rec) == 1);
+  Check("diode fields", (Rec.ID == TF_REC_DIODE) && (Rec.A == 1) &&
+        (Rec.B == 0) && (Rec.U_1 == 700) && (Rec.U_2 == -1));
+
+  Check("semi record", tf_next_record(&Res, &Rec) == 1);
+  Check("semi fields", (Rec.ID == TF_REC_SEMI) && (Rec.A == 0) &&
+        (Rec.B == 1) && (Rec.C == 2) && (Rec.U_1 == 666) && (Rec.U_2 == 0) &&
+        (Rec.F_1 == 300) && (Rec.F_2 == 0) &&
+        (Rec.I.Value == 5) && (Rec.I.Scale == -9) &&
+        (Rec.Cap.Value == 10) && (Rec.Cap.Scale == -12));
+
+  Check("end of records", tf_next_record(&Res, &Rec) == 0);
+}
+
+
+/*
+ *  bad CRC: frame is dropped, following frame is decoded
+ */
+
+static void Test_BadCRC(void)
+{
+  uint8_t           Data[] = {1, 2, 3};
+
+  Reset();
+  PutFrame(TF_CMD_BIN, Data, sizeof(Data));
+  Stream[StreamSize - 1] ^= 0x01;       /* corrupt CRC */
+  PutFrame(TF_CMD_BIN, Payload, sizeof(Payload));
+  Put("\n", 1);
+  Decode();
+
+  Check("bad CRC: reported", CRC_Errors >= 1);
+  Check("bad CRC: next frame", (FrameCount == 1) &&
+        (FrameLength[0] == sizeof(Payload) + 1));
+
+  /* corrupted payload */
+  Reset();
+  PutFrame(TF_CMD_BIN, Data, sizeof(Data));
+  Stream[4] ^= 0x80;                    /* corrupt payload byte */
+  Put("\n", 1);
+  Decode();
+
+  Check("bad payload: dropped", (FrameCount == 0) && (CRC_Errors == 1));
+}
+
+
+/*
+ *  resync: a sync byte in a text response starts a false frame, the
+ *  rescan after its CRC error finds the real frames inside
+ */
+
+static void Test_Resync(void)
+{
+  uint8_t           Data1[] = {0x11, 0x22};
+  uint8_t           Data2[] = {0x33, 0x44, 0x55};
+
+  /* false sync with a length covering both real frames */
+  Reset();
+  Put("V=", 2);
+  PutByte(TF_SYNC);                     /* false sync */
+  PutByte(12);                          /* false length */
+  Put("\n", 1);
+  PutFrame(5, Data1, sizeof(Data1));
+  PutFrame(6, Data2, sizeof(Data2));
+  Put("\r\n", 2);
+  Decode();
+
+  Check("resync: both frames", FrameCount == 2);
+  Check("resync: first frame", (FrameLength[0] == 3) &&
+        (Frames[0][0] == 5) && (Frames[0][1] == 0x11));
+  Check("resync: second frame", (FrameLength[1] == 4) &&
+        (Frames[1][0] == 6) && (Frames[1][3] == 0x55));
+
+  /* false sync with max. length ahead of several frames */
+  Reset();
+  PutByte(TF_SYNC);                     /* false sync */
+  PutByte(255);                         /* false length */
+  PutFrame(TF_CMD_BIN, Payload, sizeof(Payload));
+  PutFrame(5, Data1, sizeof(Data1));
+  PutFrame(6, Data2, sizeof(Data2));
+  while (StreamSize < 300) PutByte('\n');   /* idle bytes */
+  Decode();
+
+  Check("resync max. length: all frames", FrameCount == 3);
+  Check("resync max. length: order", (Frames[0][0] == TF_CMD_BIN) &&
+        (Frames[1][0] == 5) && (Frames[2][0] == 6));
+
+  /* zero length is no frame */
+  Reset();
+  PutByte(TF_SYNC);
+  PutByte(0);
+  PutFrame(5, Data1, sizeof(Data1));
+  Put("\n", 1);
+  Decode();
+
+  Check("zero length: skipped", (FrameCount == 1) && (Frames[0][0] == 5));
+}
+
+
+/*
+ *  truncated input
+ */
+
+static void Test_Truncated(void)
+{
+  uint8_t           Data[] = {0x11, 0x22};
+  uint8_t           Short[] = {TF_COMP_RESISTOR, 0, 1};
+  uint8_t           Record[sizeof(Payload)];
+  TF_Results        Res;           /* probing results */
+  TF_Record         Rec;           /* record */
+  size_t            Pos;           /* position of frame */
+
+  /* stream ends inside a frame */
+  Reset();
+  PutFrame(TF_CMD_BIN, Payload, sizeof(Payload));
+  StreamSize -= 10;
+  Decode();
+
+  Check("truncated stream: no frame", (FrameCount == 0) && (CRC_Errors == 0));
+
+  /* truncated frame followed by a complete one */
+  Reset();
+  Pos = PutFrame(TF_CMD_BIN, Payload, sizeof(Payload));
+  StreamSize = Pos + 20;                /* cut off */
+  PutFrame(5, Data, sizeof(Data));
+  while (StreamSize < Pos + sizeof(Payload) + 20) PutByte('\n');
+  Decode();
+
+  /* CRC error isn't reported when the rescan finds a frame */
+  Check("truncated frame: next frame", (FrameCount == 1) &&
+        (Frames[0][0] == 5));
+
+  /* truncated header */
+  Reset();
+  PutFrame(TF_CMD_BIN, Short, sizeof(Short));
+  Put("\n", 1);
+  Decode();
+  memcpy(Dec.Data, Frames[0], FrameLength[0]);
+  Dec.Length = FrameLength[0];
+
+  Check("truncated header: frame", FrameCount == 1);
+  Check("truncated header: rejected", tf_results(&Dec, &Res) == TF_ERR_FORMAT);
+
+  /* wrong command */
+  Dec.Data[0] = 5;
+  Check("wrong command: rejected", tf_results(&Dec, &Res) == TF_ERR_FORMAT);
+
+  /* truncated record (cut off semi record) */
+  memcpy(Record, Payload, sizeof(Payload));
+  Reset();
+  PutFrame(TF_CMD_BIN, Record, sizeof(Payload) - 4);
+  Put("\n", 1);
+  Decode();
+  memcpy(Dec.Data, Frames[0], FrameLength[0]);
+  Dec.Length = FrameLength[0];
+
+  Check("truncated record: header", tf_results(&Dec, &Res) == TF_OK);
+  Check("truncated record: resistor", tf_next_record(&Res, &Rec) == 1);
+  Check("truncated record: diode", tf_next_record(&Res, &Rec) == 1);
+  Check("truncated record: rejected", tf_next_record(&Res, &Rec) == TF_ERR_FORMAT);
+
+  /* unknown record */
+  Record[6] = 99;                       /* ID of first record */
+  Reset();
+  PutFrame(TF_CMD_BIN, Record, sizeof(Payload));
+  Put("\n", 1);
+  Decode();
+  memcpy(Dec.Data, Frames[0], FrameLength[0]);
+  Dec.Length = FrameLength[0];
+
+  Check("unknown record: header", tf_results(&Dec, &Res) == TF_OK);
+  Check("unknown record: rejected", tf_next_record(&Res, &Rec) == TF_ERR_FORMAT);
+}
+
+
+
+/* ************************************************************************
+ *   main
+ * ************************************************************************ */
+
+
+int main(void)
+{
+  Test_CRC();
+  Test_RoundTrip();
+  Test_BadCRC();
+  Test_Resync();
+  Test_Truncated();
+
+  printf("frame_test: %u checks, %u failed\n", Tests, Failed);
+
+  return (Failed > 0);
+}
+
+
+
+/* ************************************************************************
+ *   EOF
+ * ************************************************************************ */
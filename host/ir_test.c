@@ -0,0 +1,807 @@
+/* ************************************************************************
+ *
+ *   host test for the IR decoder
+ *   - runs the firmware's IR_Decode() with IR_Proto_Table on pulse trains
+ *     in 50us units, one vector per table row
+ *   - checks the line displayed for each packet
+ *   - build: make ir_test (uses the stub AVR headers in avr_stub/)
+ *
+ *   (c) 2019 by Markus Reschke
+ *
+ * ************************************************************************ */
+
+
+/* source management: define the firmware's global variables here */
+#define MAIN_C
+
+
+/*
+ *  include header files
+ */
+
+/* basic includes */
+#include <stdio.h>
+#include <string.h>
+
+/* local includes */
+#include "config.h"           /* global configuration */
+#include "common.h"           /* common header file */
+#include "variables.h"        /* global variables */
+#include "functions.h"        /* external functions */
+
+
+/*
+ *  local constants
+ */
+
+#define MAX_ITEMS        255       /* pulses/pauses per packet */
+#define MAX_BITS          64       /* bits per packet */
+#define LINE_SIZE         64       /* display line */
+
+
+/*
+ *  external variables and functions (IR.c)
+ */
+
+extern uint8_t      IR_State;
+extern void IR_Decode(uint8_t *PulseData, uint8_t Pulses);
+
+
+/*
+ *  stubs for the I/O registers
+ */
+
+volatile uint8_t    SREG;
+volatile uint8_t    PORTB, DDRB, PINB;
+volatile uint8_t    PORTC, DDRC, PINC;
+volatile uint8_t    PORTD, DDRD, PIND;
+volatile uint8_t    PCICR, PCIFR, PCMSK0, PCMSK1, PCMSK2;
+volatile uint8_t    TCCR1A, TCCR1B, TIMSK1, TIFR1;
+volatile uint16_t   TCNT1, OCR1A, OCR1B, ICR1;
+
+
+/*
+ *  local variables
+ */
+
+static char         Line[LINE_SIZE];    /* displayed line */
+static uint8_t      LinePos;            /* position in line */
+
+static uint8_t      Data[MAX_ITEMS];    /* pulse train */
+static uint8_t      Items;              /* number of pulses/pauses */
+static uint8_t      Level;              /* level of last item (1 = pulse) */
+
+static uint8_t      Bits[MAX_BITS];     /* code bits in sending order */
+static uint8_t      BitCount;           /* number of code bits */
+static uint8_t      Sent;               /* code bits already encoded */
+
+static unsigned     Tests;              /* number of checks */
+static unsigned     Failed;             /* number of failed checks */
+
+
+
+/* ************************************************************************
+ *   display stubs (capture current line)
+ * ************************************************************************ */
+
+
+void LCD_Char(unsigned char Char)
+{
+  if (LinePos < LINE_SIZE - 1)
+  {
+    Line[LinePos] = Char;
+    LinePos++;
+    Line[LinePos] = 0;
+  }
+}
+
+#ifndef Display_Char
+void Display_Char(unsigned char Char)
+{
+  LCD_Char(Char);
+}
+#endif
+
+void Display_NextLine(void)
+{
+  LinePos = 0;                     /* new line replaces old one */
+  Line[0] = 0;
+}
+
+void Display_Space(void)
+{
+  Display_Char(' ');
+}
+
+void Display_EEString(const unsigned char *String)
+{
+  while (*String)
+  {
+    Display_Char(*String);
+    String++;
+  }
+}
+
+void Display_NL_EEString_Space(const unsigned char *String)
+{
+  Display_NextLine();
+  Display_EEString(String);
+  Display_Space();
+}
+
+void Display_HexDigit(uint8_t Digit)
+{
+  if (Digit < 10) Digit += '0';    /* 0-9 */
+  else Digit += 'A' - 10;          /* A-F */
+  Display_Char(Digit);
+}
+
+void Display_HexByte(uint8_t Value)
+{
+  Display_HexDigit(Value >> 4);
+  Display_HexDigit(Value & 0x0F);
+}
+
+void Display_Value(uint32_t Value, int8_t Exponent, unsigned char Unit)
+{
+  char              Buffer[12];    /* decimal number */
+
+  (void)Exponent;                  /* decoder displays plain numbers */
+  (void)Unit;
+
+  snprintf(Buffer, sizeof(Buffer), "%lu", (unsigned long)Value);
+  Display_EEString((const unsigned char *)Buffer);
+}
+
+
+/*
+ *  not used by IR_Decode(), but by IR_Detector()
+ */
+
+void LCD_CharPos(uint8_t x, uint8_t y) { (void)x; (void)y; }
+void LCD_Clear(void) {}
+void LCD_ClearLine2(void) {}
+void MilliSleep(uint16_t Time) { (void)Time; }
+int8_t ShortCircuit(uint8_t Mode) { (void)Mode; return 1; }
+void Show_SimplePinout(uint8_t ID_1, uint8_t ID_2, uint8_t ID_3)
+  { (void)ID_1; (void)ID_2; (void)ID_3; }
+uint8_t TestKey(uint16_t Timeout, uint8_t Mode)
+  { (void)Timeout; (void)Mode; return 0; }
+
+
+
+/* ************************************************************************
+ *   pulse train
+ * ************************************************************************ */
+
+
+/*
+ *  start new packet
+ */
+
+static void Reset(void)
+{
+  Items = 0;
+  Level = 0;
+  BitCount = 0;
+  Sent = 0;
+}
+
+
+/*
+ *  add pulse or pause
+ *  - merges with last item of same level
+ *  - a heading pause isn't logged by the receiver
+ *
+ *  requires:
+ *  - 1 for pulse, 0 for pause
+ *  - time units
+ */
+
+static void Add(uint8_t Pulse, uint8_t Time)
+{
+  if (Items == 0)                  /* first item */
+  {
+    if (! Pulse) return;           /* skip heading pause */
+  }
+  else if (Pulse == Level)         /* same level */
+  {
+    Data[Items - 1] += Time;       /* extend last item */
+    return;
+  }
+
+  Level = Pulse;
+  Data[Items] = Time;
+  Items++;
+}
+
+
+/*
+ *  end packet
+ *  - a trailing pause isn't logged by the receiver
+ */
+
+static void End(void)
+{
+  if ((Items > 0) && (Level == 0)) Items--;
+}
+
+
+/*
+ *  add code bits
+ *
+ *  requires:
+ *  - value
+ *  - number of bits
+ *  - bit mode (IR_LSB or IR_MSB)
+ */
+
+static void AddBits(uint16_t Value, uint8_t Number, uint8_t Mode)
+{
+  uint8_t           n;             /* counter */
+
+  for (n = 0; n < Number; n++)
+  {
+    if (Mode == IR_LSB)
+      Bits[BitCount] = (Value >> n) & 1;
+    else
+      Bits[BitCount] = (Value >> (Number - 1 - n)) & 1;
+
+    BitCount++;
+  }
+}
+
+
+/*
+ *  encode pending bits with PDM: pulse tS, pause t0/t1
+ *  - adds stop pulse
+ */
+
+static void PDM(uint8_t tS, uint8_t t0, uint8_t t1)
+{
+  while (Sent < BitCount)
+  {
+    Add(1, tS);
+    Add(0, Bits[Sent] ? t1 : t0);
+    Sent++;
+  }
+
+  Add(1, tS);                      /* stop */
+}
+
+
+/*
+ *  encode pending bits with PWM: pause tS, pulse t0/t1
+ */
+
+static void PWM(uint8_t tS, uint8_t t0, uint8_t t1)
+{
+  while (Sent < BitCount)
+  {
+    Add(0, tS);
+    Add(1, Bits[Sent] ? t1 : t0);
+    Sent++;
+  }
+}
+
+
+/*
+ *  encode pending bits with Bi-Phase
+ *
+ *  requires:
+ *  - time units of half cycle
+ *  - IR_THOMAS (1: pulse pause) or IR_IEEE (1: pause pulse)
+ */
+
+static void BiPhase(uint8_t tH, uint8_t Mode)
+{
+  uint8_t           First;         /* level of first half */
+
+  while (Sent < BitCount)
+  {
+    First = Bits[Sent];
+    if (Mode == IR_IEEE) First = ! First;
+
+    Add(First, tH);
+    Add(! First, tH);
+    Sent++;
+  }
+}
+
+
+/*
+ *  encode pending bits with PPM: one slot per bit, 1 is pulse
+ */
+
+static void PPM(uint8_t tP)
+{
+  while (Sent < BitCount)
+  {
+    Add(Bits[Sent], tP);
+    Sent++;
+  }
+}
+
+
+
+/* ************************************************************************
+ *   checks
+ * ************************************************************************ */
+
+
+/*
+ *  decode packet and compare displayed line
+ *
+ *  requires:
+ *  - name of vector
+ *  - expected line ("" for packets not displayed)
+ */
+
+static void Expect(const char *Name, const char *Line_Ok)
+{
+  End();                           /* close packet */
+  Display_NextLine();              /* clear line */
+  IR_Decode(Data, Items);
+
+  Tests++;
+  if (strcmp(Line, Line_Ok) != 0)
+  {
+    Failed++;
+    printf("FAIL %s: got \"%s\", expected \"%s\"\n", Name, Line, Line_Ok);
+  }
+}
+
+
+/*
+ *  check a condition
+ */
+
+static void Assert(const char *Name, int Condition)
+{
+  Tests++;
+  if (! Condition)
+  {
+    Failed++;
+    printf("FAIL %s\n", Name);
+  }
+}
+
+
+
+/* ************************************************************************
+ *   test vectors (one per protocol table row)
+ * ************************************************************************ */
+
+
+/*
+ *  NEC, Sanyo and NEC repeat
+ *  - Sanyo shares start and demodulation with NEC
+ */
+
+static void Test_NEC(void)
+{
+  /* NEC standard: 8 bit address */
+  Reset();
+  Add(1, 179); Add(0, 89);
+  AddBits(0x04, 8, IR_LSB); AddBits(0xFB, 8, IR_LSB);
+  AddBits(0x08, 8, IR_LSB); AddBits(0xF7, 8, IR_LSB);
+  PDM(11, 11, 33);
+  Expect("NEC std", "NEC 04:08");
+
+  /* NEC extended: 16 bit address */
+  Reset();
+  Add(1, 179); Add(0, 89);
+  AddBits(0x1234, 16, IR_LSB);
+  AddBits(0x56, 8, IR_LSB); AddBits(0xA9, 8, IR_LSB);
+  PDM(11, 11, 33);
+  Expect("NEC ext", "NEC 1234:56");
+
+  #ifdef SW_IR_RX_EXTRA
+  /* Sanyo: 42 bits */
+  Reset();
+  Add(1, 179); Add(0, 89);
+  AddBits(0x0ABC, 13, IR_LSB); AddBits(~0x0ABC, 13, IR_LSB);
+  AddBits(0x5A, 8, IR_LSB); AddBits(0xA5, 8, IR_LSB);
+  PDM(11, 11, 33);
+  Expect("Sanyo", "Sanyo 0ABC:5A");
+  #endif
+
+  /* NEC repeat sequence */
+  Reset();
+  Add(1, 179); Add(0, 45); Add(1, 11);
+  Expect("NEC repeat", "NEC-R ");
+}
+
+
+/*
+ *  Proton
+ *  - sync pause becomes "0"
+ */
+
+static void Test_Proton(void)
+{
+  uint8_t           n;             /* counter */
+
+  /* valid packet */
+  Reset();
+  Add(1, 162); Add(0, 80);
+  AddBits(0x12, 8, IR_LSB);
+  PDM(11, 11, 30);
+  Add(0, 80);                      /* sync */
+  AddBits(0x34, 8, IR_LSB);
+  PDM(11, 11, 30);
+  Expect("Proton", "Prot 12:34");
+
+  /* broken command bit: sync pause has to be restored */
+  Reset();
+  Add(1, 162); Add(0, 80);
+  AddBits(0x12, 8, IR_LSB);
+  PDM(11, 11, 30);
+  Add(0, 80);                      /* sync */
+  n = Items - 1;                   /* position of sync pause */
+  AddBits(0x34, 8, IR_LSB);
+  PDM(11, 11, 30);
+  Data[n + 4] = 20;                /* invalid pause */
+  Expect("Proton broken", "Prot ?");
+  Assert("Proton sync restored", Data[n] == 80);
+}
+
+
+/*
+ *  JVC: standard and alternative start
+ *  - alternative start also matches NEC's start
+ */
+
+static void Test_JVC(void)
+{
+  Reset();
+  Add(1, 168); Add(0, 84);
+  AddBits(0x21, 8, IR_LSB); AddBits(0x43, 8, IR_LSB);
+  PDM(11, 11, 32);
+  Expect("JVC", "JVC 21:43");
+
+  Reset();
+  Add(1, 184); Add(0, 84);
+  AddBits(0x21, 8, IR_LSB); AddBits(0x43, 8, IR_LSB);
+  PDM(11, 11, 32);
+  Expect("JVC alt", "JVC 21:43");
+}
+
+
+/*
+ *  Matsushita: C6D6 and C5D6 (shared demodulation)
+ */
+
+static void Test_Matsushita(void)
+{
+  Reset();
+  Add(1, 70); Add(0, 70);
+  AddBits(0x15, 6, IR_LSB); AddBits(0x2A, 6, IR_LSB);
+  AddBits(~0x15, 6, IR_LSB); AddBits(~0x2A, 6, IR_LSB);
+  PDM(17, 17, 52);
+  Expect("Matsushita C6D6", "Mat-6 15:2A");
+
+  #ifdef SW_IR_RX_EXTRA
+  Reset();
+  Add(1, 70); Add(0, 70);
+  AddBits(0x0B, 5, IR_LSB); AddBits(0x33, 6, IR_LSB);
+  AddBits(~0x0B, 5, IR_LSB); AddBits(~0x33, 6, IR_LSB);
+  PDM(17, 17, 52);
+  Expect("Matsushita C5D6", "Mat-5 0B:33");
+  #endif
+}
+
+
+/*
+ *  Kaseikyo: manufacturer:system-product:function
+ */
+
+static void Test_Kaseikyo(void)
+{
+  Reset();
+  Add(1, 70); Add(0, 34);
+  AddBits(0x2002, 16, IR_LSB);     /* manufacturer */
+  AddBits(0x0, 4, IR_LSB);         /* parity */
+  AddBits(0x8, 4, IR_LSB);         /* system */
+  AddBits(0x30, 8, IR_LSB);        /* product */
+  AddBits(0x3D, 8, IR_LSB);        /* function */
+  AddBits(0x05, 8, IR_LSB);        /* check */
+  PDM(8, 8, 26);
+  Expect("Kaseikyo", "Kas 2002:8-30:3D");
+}
+
+
+#ifdef SW_IR_RX_EXTRA
+
+/*
+ *  RCA: with partial repeat packet after short delay
+ */
+
+static void Test_RCA(void)
+{
+  Reset();
+  Add(1, 79); Add(0, 79);
+  AddBits(0xA, 4, IR_MSB); AddBits(0x5C, 8, IR_MSB);
+  AddBits(0x5, 4, IR_MSB); AddBits(0xA3, 8, IR_MSB);
+  PDM(10, 20, 40);
+  Add(0, 160);                     /* repeat delay */
+  Add(1, 79); Add(0, 79);
+  AddBits(0xA, 4, IR_MSB);
+  PDM(10, 20, 40);
+  Expect("RCA", "RCA 0A:5C");
+}
+
+#endif
+
+
+/*
+ *  Motorola and IR60 (shared start and demodulation)
+ *  - start packet, command packet, end packet
+ */
+
+static void Test_Motorola(void)
+{
+  IR_State = 0;
+
+  /* Motorola */
+  Reset();
+  Add(1, 11); Add(0, 52);
+  AddBits(1, 1, IR_LSB); AddBits(0x1FF, 9, IR_LSB);
+  BiPhase(11, IR_THOMAS);
+  Expect("Motorola start", "");
+
+  Reset();
+  Add(1, 11); Add(0, 52);
+  AddBits(1, 1, IR_LSB); AddBits(0x0A5, 9, IR_LSB);
+  BiPhase(11, IR_THOMAS);
+  Expect("Motorola command", "Mot 0A5");
+
+  Reset();
+  Add(1, 11); Add(0, 52);
+  AddBits(1, 1, IR_LSB); AddBits(0x1FF, 9, IR_LSB);
+  BiPhase(11, IR_THOMAS);
+  Expect("Motorola end", "");
+  Assert("Motorola done", IR_State == 0);
+
+  #ifdef SW_IR_RX_EXTRA
+  /* IR60 */
+  Reset();
+  Add(1, 11); Add(0, 52);
+  AddBits(1, 1, IR_LSB); AddBits(62, 6, IR_LSB);
+  BiPhase(11, IR_THOMAS);
+  Expect("IR60 start", "");
+
+  Reset();
+  Add(1, 11); Add(0, 52);
+  AddBits(1, 1, IR_LSB); AddBits(0x15, 6, IR_LSB);
+  BiPhase(11, IR_THOMAS);
+  Expect("IR60 command", "IR60 15");
+
+  Reset();
+  Add(1, 11); Add(0, 52);
+  AddBits(1, 1, IR_LSB); AddBits(62, 6, IR_LSB);
+  BiPhase(11, IR_THOMAS);
+  Expect("IR60 end", "");
+  Assert("IR60 done", IR_State == 0);
+  #endif
+}
+
+
+#ifdef SW_IR_RX_EXTRA
+
+/*
+ *  Thomson: no start
+ */
+
+static void Test_Thomson(void)
+{
+  Reset();
+  AddBits(0x5, 4, IR_LSB);         /* device */
+  AddBits(1, 1, IR_LSB);           /* toggle */
+  AddBits(0x2B, 7, IR_LSB);        /* function */
+  PDM(10, 40, 90);
+  Expect("Thomson", "Thom 05:2B");
+}
+
+#endif
+
+
+/*
+ *  Samsung
+ */
+
+static void Test_Samsung(void)
+{
+  Reset();
+  Add(1, 89); Add(0, 89);
+  AddBits(0x07, 8, IR_LSB); AddBits(0x07, 8, IR_LSB);
+  AddBits(0x02, 8, IR_LSB); AddBits(0xFD, 8, IR_LSB);
+  PDM(11, 11, 34);
+  Expect("Samsung", "Sams 07:02");
+}
+
+
+/*
+ *  SIRC-12, SIRC-15 and SIRC-20 (shared demodulation)
+ */
+
+static void Test_SIRC(void)
+{
+  Reset();
+  Add(1, 48);
+  AddBits(0x15, 7, IR_LSB); AddBits(0x01, 5, IR_LSB);
+  PWM(12, 12, 24);
+  Expect("SIRC-12", "SIRC12 15:01");
+
+  Reset();
+  Add(1, 48);
+  AddBits(0x2A, 7, IR_LSB); AddBits(0x9C, 8, IR_LSB);
+  PWM(12, 12, 24);
+  Expect("SIRC-15", "SIRC15 2A:9C");
+
+  Reset();
+  Add(1, 48);
+  AddBits(0x12, 7, IR_LSB); AddBits(0x1A, 5, IR_LSB);
+  AddBits(0xE5, 8, IR_LSB);
+  PWM(12, 12, 24);
+  Expect("SIRC-20", "SIRC20 12:1A:E5");
+}
+
+
+#ifdef SW_IR_RX_EXTRA
+
+/*
+ *  RECS80 standard and extended
+ */
+
+static void Test_RECS80(void)
+{
+  Reset();
+  AddBits(1, 1, IR_MSB);           /* reference */
+  AddBits(0, 1, IR_MSB);           /* toggle */
+  AddBits(0x5, 3, IR_MSB);         /* address */
+  AddBits(0x2D, 6, IR_MSB);        /* command */
+  PDM(4, 98, 149);
+  Expect("RECS80", "RECS80 05:2D");
+
+  Reset();
+  Add(1, 4); Add(0, 173); Add(1, 4); Add(0, 73);
+  AddBits(0, 1, IR_MSB);           /* toggle */
+  AddBits(0x9, 4, IR_MSB);         /* address */
+  AddBits(0x21, 6, IR_MSB);        /* command */
+  PDM(4, 98, 149);
+  Expect("RECS80 ext", "RECS80-x 09:21");
+}
+
+#endif
+
+
+/*
+ *  Sharp: packet pair, second one is inverted
+ */
+
+static void Test_Sharp(void)
+{
+  IR_State = 0;
+
+  Reset();
+  AddBits(0x11, 5, IR_LSB); AddBits(0x4E, 8, IR_LSB);
+  AddBits(0, 1, IR_LSB); AddBits(0, 1, IR_LSB);
+  PDM(6, 14, 35);
+  Expect("Sharp #1", "Sharp 11:4E");
+
+  Reset();
+  AddBits(0x11, 5, IR_LSB); AddBits(0xB1, 8, IR_LSB);
+  AddBits(1, 1, IR_LSB); AddBits(1, 1, IR_LSB);
+  PDM(6, 14, 35);
+  Expect("Sharp #2", "");
+  Assert("Sharp done", IR_State == 0);
+}
+
+
+/*
+ *  RC-5: start bits are part of data
+ */
+
+static void Test_RC5(void)
+{
+  Reset();
+  AddBits(1, 1, IR_MSB); AddBits(1, 1, IR_MSB);    /* start bits */
+  AddBits(0, 1, IR_MSB);                           /* toggle */
+  AddBits(0x14, 5, IR_MSB); AddBits(0x35, 6, IR_MSB);
+  BiPhase(17, IR_IEEE);
+  Expect("RC-5", "RC-5 14:35");
+}
+
+
+#ifdef SW_IR_RX_EXTRA
+
+/*
+ *  uPD1986C: no start, 8 time slots
+ */
+
+static void Test_uPD1986C(void)
+{
+  Reset();
+  AddBits(1, 1, IR_LSB); AddBits(0, 1, IR_LSB); AddBits(1, 1, IR_LSB);
+  AddBits(0x0D, 5, IR_LSB);
+  PPM(22);
+  Expect("uPD1986C", "\xB5PD1986C 0D");
+}
+
+#endif
+
+
+/*
+ *  RC-6: toggle bit with double timing
+ */
+
+static void Test_RC6(void)
+{
+  Reset();
+  Add(1, 53); Add(0, 17);
+  AddBits(1, 1, IR_MSB); AddBits(0, 3, IR_MSB);    /* start bit, mode */
+  BiPhase(8, IR_THOMAS);
+  AddBits(1, 1, IR_MSB);                           /* toggle */
+  BiPhase(17, IR_THOMAS);
+  AddBits(0x0C, 8, IR_MSB); AddBits(0x3A, 8, IR_MSB);
+  BiPhase(8, IR_THOMAS);
+  Expect("RC-6", "RC-6 0C:3A");
+}
+
+
+/*
+ *  unknown protocol
+ */
+
+static void Test_Unknown(void)
+{
+  Reset();
+  Add(1, 5); Add(0, 100); Add(1, 5);
+  Expect("unknown", "3:5-100");
+}
+
+
+
+/* ************************************************************************
+ *   main
+ * ************************************************************************ */
+
+
+int main(void)
+{
+  Test_NEC();
+  Test_Proton();
+  Test_JVC();
+  Test_Matsushita();
+  Test_Kaseikyo();
+  #ifdef SW_IR_RX_EXTRA
+  Test_RCA();
+  #endif
+  Test_Motorola();
+  #ifdef SW_IR_RX_EXTRA
+  Test_Thomson();
+  #endif
+  Test_Samsung();
+  Test_SIRC();
+  #ifdef SW_IR_RX_EXTRA
+  Test_RECS80();
+  #endif
+  Test_Sharp();
+  Test_RC5();
+  #ifdef SW_IR_RX_EXTRA
+  Test_uPD1986C();
+  #endif
+  Test_RC6();
+  Test_Unknown();
+
+  printf("ir_test: %u checks, %u failed\n", Tests, Failed);
+
+  return (Failed > 0);
+}
+
+
+
+/* ************************************************************************
+ *   EOF
+ * ************************************************************************ */
@@ -0,0 +1,453 @@
+/* ************************************************************************
+ *
+ *   host side decoder for binary frames of remote commands
+ *
+ *   (c) 2019 by Markus Reschke
+ *
+ * ************************************************************************ */
+
+
+/* local includes */
+#include "tester_frame.h"
+
+
+/*
+ *  local constants
+ */
+
+/* decoder states */
+#define STATE_SYNC       0         /* wait for sync */
+#define STATE_LENGTH     1         /* wait for length */
+#define STATE_DATA       2         /* collect command & payload */
+#define STATE_CRC        3         /* wait for CRC */
+
+/* size of header of "BIN" payload (excl. command) */
+#define RESULTS_HEADER   6
+
+
+
+/* ************************************************************************
+ *   frame decoder
+ * ************************************************************************ */
+
+
+/*
+ *  update CRC-8
+ *  - CRC = X^8 + X^5 + X^4 + 1 (like OneWire)
+ *
+ *  requires:
+ *  - CRC: current CRC
+ *  - Byte: new input byte
+ *
+ *  returns:
+ *  - new CRC
+ */
+
+uint8_t tf_crc8(uint8_t CRC, uint8_t Byte)
+{
+  uint8_t           n;             /* bit counter */
+
+  for (n = 0; n < 8; n++)
+  {
+    if ((CRC ^ Byte) & 0x01)       /* XORed LSB is 1 */
+    {
+      CRC = (CRC >> 1) ^ 0x8C;
+    }
+    else                           /* XORed LSB is 0 */
+    {
+      CRC >>= 1;
+    }
+
+    Byte >>= 1;                    /* next bit */
+  }
+
+  return CRC;
+}
+
+
+
+/*
+ *  reset decoder
+ *
+ *  requires:
+ *  - Dec: pointer to decoder
+ */
+
+void tf_init(TF_Decoder *Dec)
+{
+  Dec->State = STATE_SYNC;
+  Dec->Length = 0;
+  Dec->Pos = 0;
+  Dec->CRC = 0;
+  Dec->Count = 0;
+  Dec->Next = 0;
+}
+
+
+
+/*
+ *  process single byte
+ *
+ *  requires:
+ *  - Dec: pointer to decoder
+ *  - Byte: byte
+ *
+ *  returns:
+ *  - TF_NONE when more data is needed
+ *  - TF_FRAME when a valid frame is complete
+ *  - TF_ERR_CRC on CRC error
+ */
+
+static int tf_byte(TF_Decoder *Dec, uint8_t Byte)
+{
+  int               Flag = TF_NONE;     /* return value */
+
+  switch (Dec->State)
+  {
+    case STATE_SYNC:          /* wait for sync */
+      if (Byte == TF_SYNC)
+      {
+        Dec->State = STATE_LENGTH;
+        Dec->CRC = 0;
+      }
+      break;
+
+    case STATE_LENGTH:        /* length */
+      if (Byte == 0)          /* invalid, command byte is missing */
+      {
+        Dec->State = STATE_SYNC;
+      }
+      else
+      {
+        Dec->Length = Byte;
+        Dec->Pos = 0;
+        Dec->CRC = tf_crc8(Dec->CRC, Byte);
+        Dec->State = STATE_DATA;
+      }
+      break;
+
+    case STATE_DATA:          /* command & payload */
+      Dec->Data[Dec->Pos] = Byte;
+      Dec->Pos++;
+      Dec->CRC = tf_crc8(Dec->CRC, Byte);
+      if (Dec->Pos == Dec->Length) Dec->State = STATE_CRC;
+      break;
+
+    case STATE_CRC:           /* CRC */
+      Dec->State = STATE_SYNC;
+      if (Byte == Dec->CRC) Flag = TF_FRAME;
+      else Flag = TF_ERR_CRC;
+      break;
+  }
+
+  return Flag;
+}
+
+
+
+/*
+ *  remove processed bytes from buffer
+ *
+ *  requires:
+ *  - Dec: pointer to decoder
+ */
+
+static void tf_shift(TF_Decoder *Dec)
+{
+  uint16_t          n = 0;              /* counter */
+
+  while (Dec->Next < Dec->Count)        /* move unprocessed bytes */
+  {
+    Dec->Buffer[n] = Dec->Buffer[Dec->Next];
+    Dec->Next++;
+    n++;
+  }
+
+  Dec->Count = n;
+  Dec->Next = 0;
+}
+
+
+
+/*
+ *  feed received byte to decoder
+ *  - bytes outside of frames (e.g. text responses) are skipped
+ *  - the bytes of the current frame are buffered, on a CRC error the
+ *    bytes following the sync byte are rescanned for the next sync byte
+ *    (the sync byte might have been part of a text response)
+ *  - after TF_FRAME the frame stays in the decoder until the next byte
+ *    is fed, remaining bytes of a rescan are processed then
+ *
+ *  requires:
+ *  - Dec: pointer to decoder
+ *  - Byte: received byte
+ *
+ *  returns:
+ *  - TF_NONE when more data is needed
+ *  - TF_FRAME when a valid frame is complete
+ *  - TF_ERR_CRC on CRC error and no valid frame found by rescanning
+ */
+
+int tf_feed(TF_Decoder *Dec, uint8_t Byte)
+{
+  int               Flag;               /* result of single byte */
+  int               Result = TF_NONE;   /* return value */
+
+  /* buffer can't overflow, just for safety */
+  if (Dec->Count >= TF_MAX_FRAME) tf_init(Dec);
+
+  Dec->Buffer[Dec->Count] = Byte;       /* add byte */
+  Dec->Count++;
+
+  while (Dec->Next < Dec->Count)        /* process buffered bytes */
+  {
+    /* no frame yet: frame starts at the byte to process */
+    if (Dec->State == STATE_SYNC) tf_shift(Dec);
+
+    Flag = tf_byte(Dec, Dec->Buffer[Dec->Next]);
+    Dec->Next++;
+
+    if (Flag == TF_FRAME)               /* got frame */
+    {
+      tf_shift(Dec);                    /* remove frame from buffer */
+      Result = TF_FRAME;
+      break;
+    }
+    else if (Flag == TF_ERR_CRC)        /* CRC error */
+    {
+      /* rescan bytes following the sync byte */
+      Dec->Next = 1;
+      Result = TF_ERR_CRC;
+    }
+  }
+
+  return Result;
+}
+
+
+
+/*
+ *  get command ID of decoded frame
+ *
+ *  requires:
+ *  - Dec: pointer to decoder (after TF_FRAME)
+ *
+ *  returns:
+ *  - command ID
+ */
+
+uint8_t tf_command(const TF_Decoder *Dec)
+{
+  return Dec->Data[0];
+}
+
+
+
+/* ************************************************************************
+ *   payload parser
+ * ************************************************************************ */
+
+
+/*
+ *  read 16 bit value (LSB first)
+ */
+
+static uint16_t get16(const uint8_t *Data)
+{
+  return (uint16_t)(Data[0] | (Data[1] << 8));
+}
+
+
+
+/*
+ *  read 32 bit value (LSB first)
+ */
+
+static uint32_t get32(const uint8_t *Data)
+{
+  return (uint32_t)get16(Data) | ((uint32_t)get16(Data + 2) << 16);
+}
+
+
+
+/*
+ *  read value with scale (scale first)
+ */
+
+static void getvalue(const uint8_t *Data, TF_Value *Val)
+{
+  Val->Scale = (int8_t)Data[0];
+  Val->Value = get32(Data + 1);
+}
+
+
+
+/*
+ *  parse header of probing results
+ *
+ *  requires:
+ *  - Dec: pointer to decoder (after TF_FRAME)
+ *  - Res: pointer to results
+ *
+ *  returns:
+ *  - TF_OK on success
+ *  - TF_ERR_FORMAT on wrong command or truncated header
+ */
+
+int tf_results(const TF_Decoder *Dec, TF_Results *Res)
+{
+  const uint8_t     *Data = &Dec->Data[1];   /* payload */
+
+  if ((Dec->Data[0] != TF_CMD_BIN) || (Dec->Length < 1 + RESULTS_HEADER))
+  {
+    return TF_ERR_FORMAT;
+  }
+
+  Res->Found = Data[0];
+  Res->Type = Data[1];
+  Res->Quantity = Data[2];
+  Res->Flags = Data[3];
+  Res->Val1 = get16(&Data[4]);
+  Res->Next = Data + RESULTS_HEADER;
+  Res->End = &Dec->Data[Dec->Length];
+
+  return TF_OK;
+}
+
+
+
+/*
+ *  get next record of probing results
+ *
+ *  requires:
+ *  - Res: pointer to results (set up by tf_results())
+ *  - Rec: pointer to record
+ *
+ *  returns:
+ *  - 1 when got a record
+ *  - 0 at end of payload
+ *  - TF_ERR_FORMAT on unknown or truncated record
+ */
+
+int tf_next_record(TF_Results *Res, TF_Record *Rec)
+{
+  const uint8_t     *Data = Res->Next;
+  size_t            Left;          /* bytes left */
+  size_t            Size;          /* size of record */
+
+  if (Data >= Res->End) return 0;  /* end of payload */
+  Left = (size_t)(Res->End - Data);
+
+  /* size of record incl. ID */
+  switch (Data[0])
+  {
+    case TF_REC_RESISTOR:     Size = 8; break;
+    case TF_REC_CAPACITOR:    Size = 12; break;
+    case TF_REC_INDUCTOR:     Size = 6; break;
+    case TF_REC_DIODE:        Size = 7; break;
+    case TF_REC_SEMI:         Size = 26; break;
+    case TF_REC_ALTSEMI:      Size = 8; break;
+    case TF_REC_ERROR:        Size = 4; break;
+    case TF_REC_DIODE_CAP:    Size = 6; break;
+    case TF_REC_CURRENT:      Size = 6; break;
+    default:                  return TF_ERR_FORMAT;
+  }
+
+  if (Left < Size) return TF_ERR_FORMAT;
+
+  /* reset record */
+  *Rec = (TF_Record){0};
+  Rec->ID = Data[0];
+  Data++;
+
+  switch (Rec->ID)
+  {
+    case TF_REC_RESISTOR:
+      Rec->A = Data[0];
+      Rec->B = Data[1];
+      getvalue(&Data[2], &Rec->Val);
+      break;
+
+    case TF_REC_CAPACITOR:
+      Rec->A = Data[0];
+      Rec->B = Data[1];
+      getvalue(&Data[2], &Rec->Val);
+      Rec->I.Value = get32(&Data[7]);
+      Rec->I.Scale = -8;                /* in 10nA */
+      break;
+
+    case TF_REC_INDUCTOR:
+    case TF_REC_DIODE_CAP:
+      getvalue(Data, &Rec->Val);
+      break;
+
+    case TF_REC_CURRENT:
+      getvalue(Data, &Rec->I);
+      break;
+
+    case TF_REC_DIODE:
+      Rec->A = Data[0];
+      Rec->B = Data[1];                 /* cathode */
+      Rec->U_1 = get16(&Data[2]);       /* V_f in mV */
+      Rec->U_2 = (int16_t)get16(&Data[4]);   /* V_f2 in mV */
+      break;
+
+    case TF_REC_SEMI:
+      Rec->A = Data[0];
+      Rec->B = Data[1];
+      Rec->C = Data[2];
+      Rec->U_1 = get16(&Data[3]);
+      Rec->U_2 = (int16_t)get16(&Data[5]);
+      Rec->F_1 = get32(&Data[7]);
+      Rec->F_2 = get32(&Data[11]);
+      getvalue(&Data[15], &Rec->I);
+      getvalue(&Data[20], &Rec->Cap);
+      break;
+
+    case TF_REC_ALTSEMI:
+      Rec->A = Data[0];
+      Rec->B = Data[1];
+      Rec->C = Data[2];
+      Rec->U_1 = get16(&Data[3]);
+      Rec->U_2 = (int16_t)get16(&Data[5]);
+      break;
+
+    case TF_REC_ERROR:
+      Rec->A = Data[0];                 /* probe */
+      Rec->U_1 = get16(&Data[1]);       /* voltage in mV */
+      break;
+  }
+
+  Res->Next += Size;               /* next record */
+
+  return 1;
+}
+
+
+
+/*
+ *  convert value with scale to floating point
+ *
+ *  requires:
+ *  - Val: pointer to value
+ *
+ *  returns:
+ *  - value in base unit
+ */
+
+double tf_value(const TF_Value *Val)
+{
+  double            Value = Val->Value;
+  int8_t            Scale = Val->Scale;
+
+  while (Scale > 0) { Value *= 10; Scale--; }
+  while (Scale < 0) { Value /= 10; Scale++; }
+
+  return Value;
+}
+
+
+
+/* ************************************************************************
+ *   EOF
+ * ************************************************************************ */
@@ -0,0 +1,170 @@
+/* ************************************************************************
+ *
+ *   host side decoder for binary frames of remote commands
+ *
+ *   (c) 2019 by Markus Reschke
+ *
+ * ************************************************************************ */
+
+/*
+ *  hints:
+ *  - frame: <sync> <length> <command> <payload> <CRC-8>
+ *    sync     0xA5
+ *    length   number of bytes for command and payload
+ *    command  command ID
+ *    CRC-8    X^8 + X^5 + X^4 + 1 for length, command and payload,
+ *             start value 0x00
+ *  - multi-byte values are LSB first
+ *  - payload of "BIN" command:
+ *    header   component type (COMP_*), subtype (TYPE_*), quantity,
+ *             info flags (INFO_*), info value (16 bit: ESR or V_BE)
+ *    records  <record ID> <fields>, see TF_REC_*
+ *  - a value is value * 10^scale in the base unit
+ *  - plain C, can be used from C++ also
+ */
+
+
+#ifndef TESTER_FRAME_H
+#define TESTER_FRAME_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/* ************************************************************************
+ *   constants
+ * ************************************************************************ */
+
+
+/* frame */
+#define TF_SYNC               0xA5      /* start of frame */
+#define TF_MAX_DATA           255       /* max. size of command & payload */
+#define TF_MAX_FRAME          (TF_MAX_DATA + 3)   /* max. size of frame */
+
+/* commands */
+#define TF_CMD_BIN            41        /* probing results */
+
+/* component types (COMP_* in common.h) */
+#define TF_COMP_NONE          0
+#define TF_COMP_ERROR         1
+#define TF_COMP_RESISTOR      10
+#define TF_COMP_CAPACITOR     11
+#define TF_COMP_DIODE         20
+#define TF_COMP_BJT           30
+#define TF_COMP_FET           31
+#define TF_COMP_IGBT          32
+#define TF_COMP_TRIAC         33
+#define TF_COMP_THYRISTOR     34
+#define TF_COMP_PUT           35
+#define TF_COMP_UJT           36
+
+/* record IDs (REC_* in common.h) */
+#define TF_REC_RESISTOR       1         /* A, B, scale, value */
+#define TF_REC_CAPACITOR      2         /* A, B, scale, value, I_leak */
+#define TF_REC_INDUCTOR       3         /* scale, value */
+#define TF_REC_DIODE          4         /* A, C, V_f, V_f2 */
+#define TF_REC_SEMI           5         /* common semiconductor */
+#define TF_REC_ALTSEMI        6         /* special semiconductor */
+#define TF_REC_ERROR          7         /* probe, U */
+#define TF_REC_DIODE_CAP      8         /* scale, value */
+#define TF_REC_CURRENT        9         /* scale, value */
+
+/* decoder results */
+#define TF_NONE               0         /* need more data */
+#define TF_FRAME              1         /* got valid frame */
+#define TF_ERR_CRC            -1        /* CRC error, no frame found by rescan */
+
+/* parser results */
+#define TF_OK                 0         /* ok */
+#define TF_ERR_FORMAT         -2        /* invalid or truncated data */
+
+
+
+/* ************************************************************************
+ *   data types
+ * ************************************************************************ */
+
+
+/* frame decoder */
+typedef struct
+{
+  uint8_t           State;         /* decoder state */
+  uint8_t           Length;        /* length of command & payload */
+  uint8_t           Pos;           /* position in data buffer */
+  uint8_t           CRC;           /* current CRC-8 */
+  uint8_t           Data[TF_MAX_DATA];  /* command & payload */
+  uint16_t          Count;         /* number of bytes in buffer */
+  uint16_t          Next;          /* position of next byte to process */
+  uint8_t           Buffer[TF_MAX_FRAME];    /* current frame & bytes to rescan */
+} TF_Decoder;
+
+
+/* value with scale */
+typedef struct
+{
+  uint32_t          Value;         /* value */
+  int8_t            Scale;         /* exponent of factor (value * 10^x) */
+} TF_Value;
+
+
+/* single record */
+typedef struct
+{
+  uint8_t           ID;            /* record ID */
+  uint8_t           A;             /* pin A (probe number 0-2) */
+  uint8_t           B;             /* pin B (C for diode) */
+  uint8_t           C;             /* pin C */
+  uint16_t          U_1;           /* voltage #1 / V_f / U of error */
+  int16_t           U_2;           /* voltage #2 / V_f2 */
+  uint32_t          F_1;           /* factor #1 (hFE) */
+  uint32_t          F_2;           /* factor #2 (reverse hFE) */
+  TF_Value          Val;           /* main value (R, C, L, ...) */
+  TF_Value          I;             /* current (I_leak in 10nA, I_CEO, ...) */
+  TF_Value          Cap;           /* capacitance (C_GS / C_BE) */
+} TF_Record;
+
+
+/* probing results */
+typedef struct
+{
+  uint8_t           Found;         /* component type */
+  uint8_t           Type;          /* component subtype */
+  uint8_t           Quantity;      /* component quantity */
+  uint8_t           Flags;         /* info flags */
+  uint16_t          Val1;          /* info value (ESR or V_BE) */
+  const uint8_t     *Next;         /* next record */
+  const uint8_t     *End;          /* end of payload */
+} TF_Results;
+
+
+
+/* ************************************************************************
+ *   functions
+ * ************************************************************************ */
+
+
+extern uint8_t tf_crc8(uint8_t CRC, uint8_t Byte);
+
+extern void tf_init(TF_Decoder *Dec);
+extern int tf_feed(TF_Decoder *Dec, uint8_t Byte);
+extern uint8_t tf_command(const TF_Decoder *Dec);
+
+extern int tf_results(const TF_Decoder *Dec, TF_Results *Res);
+extern int tf_next_record(TF_Results *Res, TF_Record *Rec);
+
+extern double tf_value(const TF_Value *Val);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+
+/* ************************************************************************
+ *   EOF
+ * ************************************************************************ */
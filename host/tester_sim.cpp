@@ -0,0 +1,746 @@
+/* ************************************************************************
+ *
+ *   host side tester simulator on pseudo terminals
+ *
+ *   (c) 2019 by Markus Reschke
+ *
+ * ************************************************************************ */
+
+/*
+ *  hints:
+ *  - usage: tester_sim [options]
+ *  - creates one pseudo terminal per simulated tester and prints the
+ *    device names of the slave sides (one per line), the host software
+ *    (e.g. teststation) opens them like a serial port
+ *  - speaks the text based remote commands of the firmware, each PROBE
+ *    picks a random component: none, resistor, capacitor, diode or BJT
+ *  - simulates the firmware's RX handling:
+ *    - RX queue with XON/XOFF like SERIAL_RX_QUEUE (default: 64 bytes)
+ *    - or a single line buffer dropping chars while busy (-q 0)
+ *    - max. line length like RX_BUFFER_SIZE - 1 in common.h (-m):
+ *      10 chars, 19 with UI_SERIAL_STREAM, 47 with SW_DDS too
+ *  - probing takes some time and pauses RX like the firmware
+ *  - a pty has no line speed and the host's data would arrive at once,
+ *    so while XOFF is active the pty isn't read (data stays on the
+ *    "line") like with a host obeying XOFF immediately
+ */
+
+
+/* system includes */
+#include <cerrno>
+#include <cmath>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <chrono>
+#include <deque>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <termios.h>
+#include <unistd.h>
+
+
+/*
+ *  local constants
+ */
+
+#define DEFAULT_TESTERS  1              /* number of testers */
+#define DEFAULT_PROBE    500            /* probing time (ms) */
+#define DEFAULT_QUEUE    64             /* RX queue size (bytes) */
+#define DEFAULT_LINE     10             /* max. line length (chars) */
+#define MAX_EVENTS       16             /* epoll events per call */
+#define VERSION          "1.37m"        /* firmware version */
+
+/* special chars (see common.h) */
+#define CHAR_XON         17
+#define CHAR_XOFF        19
+#define CHAR_CAN         24
+
+/* component types (COMP_* in common.h) */
+#define COMP_NONE        0
+#define COMP_RESISTOR    10
+#define COMP_CAPACITOR   11
+#define COMP_DIODE       20
+#define COMP_BJT         30
+
+
+/*
+ *  local types
+ */
+
+typedef std::chrono::steady_clock Clock;
+
+
+/* simulated tester */
+struct SimTester
+{
+  int               Master = -1;        /* pty master */
+  int               Slave = -1;         /* pty slave (kept open) */
+  std::string       Name;               /* slave device name */
+  std::string       Link;               /* symlink to slave */
+
+  /* RX */
+  std::string       Wire;               /* data read but not received yet */
+  std::string       RX_Line;            /* partial line */
+  std::deque<std::string>  Lines;       /* complete lines */
+  unsigned          Queued = 0;         /* bytes in queue */
+  bool              Discard = false;    /* line overflow */
+  bool              XOFF = false;       /* host stopped */
+
+  /* TX */
+  std::string       TX_Data;            /* data not sent yet */
+  uint32_t          Events = EPOLLIN;   /* epoll events */
+
+  /* probing */
+  bool              Busy = false;       /* probing */
+  Clock::time_point BusyUntil;          /* end of probing */
+  int               Comp = COMP_NONE;   /* component type */
+  double            Value = 0;          /* main value */
+  double            Value2 = 0;         /* second value */
+};
+
+
+/* settings */
+struct Settings
+{
+  unsigned          Testers = DEFAULT_TESTERS;    /* number of testers */
+  unsigned          ProbeTime = DEFAULT_PROBE;    /* ms */
+  unsigned          Queue = DEFAULT_QUEUE;        /* RX queue size */
+  unsigned          LineMax = DEFAULT_LINE;       /* max. line length */
+  const char        *LinkPrefix = NULL;           /* symlink prefix */
+};
+
+
+/*
+ *  local variables
+ */
+
+static volatile sig_atomic_t  Stop = 0;      /* stop request */
+static Settings     Cfg;                     /* settings */
+static int          EpollFd = -1;            /* epoll instance */
+static std::mt19937 Random;                  /* random numbers */
+
+
+
+/* ************************************************************************
+ *   pseudo terminal
+ * ************************************************************************ */
+
+
+/*
+ *  create pseudo terminal for simulated tester
+ *  - raw mode for the slave side, so nothing is echoed before the
+ *    host software opens it
+ *
+ *  requires:
+ *  - Sim: simulated tester
+ *
+ *  returns:
+ *  - true on success
+ */
+
+static bool OpenPTY(SimTester &Sim)
+{
+  struct termios    Term;          /* port settings */
+  const char        *Name;         /* slave name */
+
+  Sim.Master = posix_openpt(O_RDWR | O_NOCTTY | O_NONBLOCK);
+  if (Sim.Master < 0) return false;
+  if ((grantpt(Sim.Master) < 0) || (unlockpt(Sim.Master) < 0)) return false;
+
+  Name = ptsname(Sim.Master);
+  if (Name == NULL) return false;
+  Sim.Name = Name;
+
+  /* keep slave open to avoid hangups when host closes it */
+  Sim.Slave = open(Name, O_RDWR | O_NOCTTY);
+  if (Sim.Slave < 0) return false;
+
+  if (tcgetattr(Sim.Slave, &Term) < 0) return false;
+  cfmakeraw(&Term);
+  if (tcsetattr(Sim.Slave, TCSANOW, &Term) < 0) return false;
+
+  return true;
+}
+
+
+
+/*
+ *  update epoll events of simulated tester
+ *  - EPOLLIN unless host is stopped by XOFF
+ *  - EPOLLOUT while TX data is pending
+ *
+ *  requires:
+ *  - Sim: simulated tester
+ */
+
+static void SetEvents(SimTester &Sim)
+{
+  struct epoll_event  Event;       /* event settings */
+  uint32_t          Events = 0;    /* new events */
+
+  if (! Sim.XOFF) Events |= EPOLLIN;
+  if (! Sim.TX_Data.empty()) Events |= EPOLLOUT;
+  if (Events == Sim.Events) return;     /* no change */
+
+  memset(&Event, 0, sizeof(Event));
+  Event.events = Events;
+  Event.data.ptr = &Sim;
+  epoll_ctl(EpollFd, EPOLL_CTL_MOD, Sim.Master, &Event);
+  Sim.Events = Events;
+}
+
+
+
+/*
+ *  send pending TX data
+ *
+ *  requires:
+ *  - Sim: simulated tester
+ */
+
+static void FlushTX(SimTester &Sim)
+{
+  ssize_t           n;             /* bytes written */
+
+  while (! Sim.TX_Data.empty())
+  {
+    n = write(Sim.Master, Sim.TX_Data.data(), Sim.TX_Data.size());
+    if (n < 0)
+    {
+      if (errno == EINTR) continue;
+      break;                            /* EAGAIN: pty buffer full */
+    }
+    Sim.TX_Data.erase(0, (size_t)n);
+  }
+
+  SetEvents(Sim);
+}
+
+
+
+/*
+ *  send response line
+ *
+ *  requires:
+ *  - Sim: simulated tester
+ *  - Text: response
+ */
+
+static void SendLine(SimTester &Sim, const std::string &Text)
+{
+  Sim.TX_Data += Text;
+  Sim.TX_Data += "\r\n";
+  FlushTX(Sim);
+}
+
+
+
+/*
+ *  send flow control char
+ *  - ahead of other data like the firmware does
+ *
+ *  requires:
+ *  - Sim: simulated tester
+ *  - XOFF: true to stop host, false to resume host
+ */
+
+static void SendFlow(SimTester &Sim, bool XOFF)
+{
+  if (Cfg.Queue == 0) return;           /* no flow control */
+  if (Sim.XOFF == XOFF) return;         /* no change */
+
+  Sim.XOFF = XOFF;
+  Sim.TX_Data.insert(Sim.TX_Data.begin(), XOFF ? CHAR_XOFF : CHAR_XON);
+  FlushTX(Sim);
+}
+
+
+
+/* ************************************************************************
+ *   component simulation
+ * ************************************************************************ */
+
+
+/*
+ *  format value with SI prefix
+ *  - 3 significant digits
+ *
+ *  requires:
+ *  - Value: value in base unit
+ *  - Unit: unit string
+ *
+ *  returns:
+ *  - formatted value, e.g. "4.7kR"
+ */
+
+static std::string FormatValue(double Value, const char *Unit)
+{
+  static const char Prefix[] = "pnum kM";  /* 10^-12 to 10^6 */
+  char              Buffer[32];    /* output */
+  int               n = 4;         /* index of no prefix */
+
+  while ((Value >= 1000) && (n < 6)) { Value /= 1000; n++; }
+  while ((Value < 1) && (Value > 0) && (n > 0)) { Value *= 1000; n--; }
+
+  if (Prefix[n] == ' ')
+    snprintf(Buffer, sizeof(Buffer), "%.3g%s", Value, Unit);
+  else
+    snprintf(Buffer, sizeof(Buffer), "%.3g%c%s", Value, Prefix[n], Unit);
+
+  return Buffer;
+}
+
+
+
+/*
+ *  simulate probing: pick random component
+ *
+ *  requires:
+ *  - Sim: simulated tester
+ */
+
+static void PickComponent(SimTester &Sim)
+{
+  static const double E12[] = {1.0, 1.2, 1.5, 1.8, 2.2, 2.7, 3.3, 3.9, 4.7, 5.6, 6.8, 8.2};
+  std::uniform_int_distribution<int>  Type(0, 19);
+  std::uniform_int_distribution<int>  Series(0, 11);
+  std::uniform_int_distribution<int>  Decade(0, 5);
+  std::uniform_real_distribution<double>  Tol(0.97, 1.03);
+  int               n;             /* random type */
+
+  n = Type(Random);
+  if (n == 0)                           /* nothing found (5%) */
+  {
+    Sim.Comp = COMP_NONE;
+  }
+  else if (n < 8)                       /* resistor: 10R - 8.2M */
+  {
+    Sim.Comp = COMP_RESISTOR;
+    Sim.Value = E12[Series(Random)] * 10 * std::pow(10.0, Decade(Random)) * Tol(Random);
+  }
+  else if (n < 14)                      /* capacitor: 10nF - 820uF */
+  {
+    Sim.Comp = COMP_CAPACITOR;
+    Sim.Value = E12[Series(Random)] * 10e-9 * std::pow(10.0, Decade(Random)) * Tol(Random);
+    Sim.Value2 = 0.05 + 0.5 * (Tol(Random) - 0.97) / 0.06;   /* ESR */
+  }
+  else if (n < 17)                      /* diode: V_F 550-750mV */
+  {
+    Sim.Comp = COMP_DIODE;
+    Sim.Value = 0.550 + 0.2 * (Tol(Random) - 0.97) / 0.06;
+  }
+  else                                  /* BJT: hFE 100-400, V_BE ~650mV */
+  {
+    Sim.Comp = COMP_BJT;
+    Sim.Value = 100 + 300 * (Tol(Random) - 0.97) / 0.06;
+    Sim.Value2 = 0.650 * Tol(Random);
+  }
+}
+
+
+
+/*
+ *  run command
+ *
+ *  requires:
+ *  - Sim: simulated tester
+ *  - Cmd: command line
+ */
+
+static void RunCommand(SimTester &Sim, const std::string &Cmd)
+{
+  std::uniform_real_distribution<double>  Jitter(0.8, 1.2);
+  std::string       Out = "ERR";   /* response */
+  int               Comp = Sim.Comp;
+
+  if (Cmd == "VER") Out = VERSION;
+  else if (Cmd == "OFF") Out = "OK";
+  else if (Cmd == "PROBE")              /* takes some time */
+  {
+    SendFlow(Sim, true);                /* RX paused while probing */
+    Sim.Busy = true;
+    Sim.BusyUntil = Clock::now() + std::chrono::milliseconds(
+      (long)(Cfg.ProbeTime * Jitter(Random)));
+    return;
+  }
+  else if (Cmd == "COMP") Out = std::to_string(Comp);
+  else if (Cmd == "QTY") Out = (Comp == COMP_NONE) ? "0" : "1";
+  else if (Comp == COMP_RESISTOR)
+  {
+    if (Cmd == "PIN") Out = "xx-";
+    else if (Cmd == "R") Out = FormatValue(Sim.Value, "R");
+    else if (Cmd == "L") Out = "N/A";
+  }
+  else if (Comp == COMP_CAPACITOR)
+  {
+    if (Cmd == "PIN") Out = "xx-";
+    else if (Cmd == "C") Out = FormatValue(Sim.Value, "F");
+    else if (Cmd == "ESR") Out = FormatValue(Sim.Value2, "R");
+    else if (Cmd == "I_l") Out = "N/A";
+  }
+  else if (Comp == COMP_DIODE)
+  {
+    if (Cmd == "PIN") Out = "A-C";
+    else if (Cmd == "V_F") Out = FormatValue(Sim.Value, "V");
+  }
+  else if (Comp == COMP_BJT)
+  {
+    if (Cmd == "PIN") Out = "EBC";
+    else if (Cmd == "TYPE") Out = "NPN";
+    else if (Cmd == "h_FE") Out = std::to_string((int)Sim.Value);
+    else if (Cmd == "V_BE") Out = FormatValue(Sim.Value2, "V");
+  }
+
+  SendLine(Sim, Out);
+}
+
+
+
+/*
+ *  process queued lines
+ *  - one after the other until probing starts
+ *
+ *  requires:
+ *  - Sim: simulated tester
+ */
+
+static void ProcessLines(SimTester &Sim)
+{
+  std::string       Line;          /* command line */
+
+  while ((! Sim.Busy) && (! Sim.Lines.empty()))
+  {
+    Line = Sim.Lines.front();
+    Sim.Lines.pop_front();
+    Sim.Queued -= (unsigned)Line.size() + 1;
+
+    if (Line[0] == CHAR_CAN) SendLine(Sim, "ERR");    /* overflow */
+    else RunCommand(Sim, Line);
+
+    /* resume host when there's enough space again */
+    if ((! Sim.Busy) && (Cfg.Queue - 1 - Sim.Queued >= Cfg.Queue / 2))
+    {
+      SendFlow(Sim, false);
+    }
+  }
+}
+
+
+
+/*
+ *  check for end of probing
+ *
+ *  requires:
+ *  - Sim: simulated tester
+ *  - Now: current time
+ */
+
+static void CheckProbe(SimTester &Sim, Clock::time_point Now)
+{
+  if ((! Sim.Busy) || (Now < Sim.BusyUntil)) return;
+
+  Sim.Busy = false;
+  PickComponent(Sim);
+  SendLine(Sim, "OK");
+
+  if (Cfg.Queue - 1 - Sim.Queued >= Cfg.Queue / 2)
+  {
+    SendFlow(Sim, false);               /* RX resumed */
+  }
+
+  ProcessLines(Sim);
+}
+
+
+
+/* ************************************************************************
+ *   RX
+ * ************************************************************************ */
+
+
+/*
+ *  put received char into queue
+ *  - like Serial_StoreChar() of the firmware
+ *
+ *  requires:
+ *  - Sim: simulated tester
+ *  - Char: received char
+ */
+
+static void StoreChar(SimTester &Sim, char Char)
+{
+  unsigned          Free;          /* free space */
+
+  if (Char == '\r') return;             /* ignore CR */
+
+  if (Cfg.Queue == 0)                   /* single line buffer */
+  {
+    /* buffer locked or RX paused: drop char */
+    if (Sim.Busy || ! Sim.Lines.empty()) return;
+    Free = Cfg.LineMax + 1;
+  }
+  else                                  /* RX queue */
+  {
+    Free = Cfg.Queue - 1 - Sim.Queued;
+  }
+
+  if (Char == '\n')                     /* end of line */
+  {
+    if (Sim.Discard)                    /* line dropped */
+    {
+      Sim.Discard = false;
+      if (Free < 2) return;             /* no space for marker */
+      Sim.RX_Line = (char)CHAR_CAN;
+      Sim.Queued++;
+    }
+    else if (Sim.RX_Line.empty())       /* empty line */
+    {
+      return;
+    }
+
+    Sim.Lines.push_back(Sim.RX_Line);
+    Sim.Queued++;                       /* terminating 0 */
+    Sim.RX_Line.clear();
+  }
+  else if (! Sim.Discard)
+  {
+    if ((Free < 2) || (Sim.RX_Line.size() >= Cfg.LineMax))   /* overflow */
+    {
+      Sim.Queued -= (unsigned)Sim.RX_Line.size();
+      Sim.RX_Line.clear();
+      Sim.Discard = true;
+      return;
+    }
+
+    Sim.RX_Line += Char;
+    Sim.Queued++;
+  }
+
+  /* stop host when queue is getting full */
+  if ((Cfg.Queue > 0) && (Free <= Cfg.Queue / 4)) SendFlow(Sim, true);
+}
+
+
+
+/*
+ *  receive data on the "line"
+ *  - stops when XOFF is sent
+ *
+ *  requires:
+ *  - Sim: simulated tester
+ */
+
+static void Receive(SimTester &Sim)
+{
+  size_t            n = 0;         /* counter */
+
+  while ((n < Sim.Wire.size()) && (! Sim.XOFF))
+  {
+    StoreChar(Sim, Sim.Wire[n]);
+    n++;
+  }
+  Sim.Wire.erase(0, n);
+
+  ProcessLines(Sim);
+}
+
+
+
+/*
+ *  read from pty
+ *
+ *  requires:
+ *  - Sim: simulated tester
+ */
+
+static void ReadPTY(SimTester &Sim)
+{
+  char              Buffer[256];   /* RX buffer */
+  ssize_t           n;             /* bytes read */
+
+  n = read(Sim.Master, Buffer, sizeof(Buffer));
+  if (n > 0) Sim.Wire.append(Buffer, (size_t)n);
+
+  Receive(Sim);
+}
+
+
+
+/* ************************************************************************
+ *   main
+ * ************************************************************************ */
+
+
+/*
+ *  signal handler
+ */
+
+static void HandleSignal(int Signal)
+{
+  (void)Signal;
+  Stop = 1;
+}
+
+
+
+/*
+ *  show usage
+ */
+
+static void Usage(const char *Name)
+{
+  fprintf(stderr,
+    "usage: %s [options]\n"
+    "  -n <n>        number of simulated testers (default: %u)\n"
+    "  -d <ms>       probing time (default: %u)\n"
+    "  -q <bytes>    RX queue size, 0 for single line buffer (default: %u)\n"
+    "  -m <chars>    max. line length (default: %u)\n"
+    "  -l <prefix>   create symlinks <prefix>0, <prefix>1, ...\n"
+    "  -s <seed>     seed for random components\n",
+    Name, DEFAULT_TESTERS, DEFAULT_PROBE, DEFAULT_QUEUE, DEFAULT_LINE);
+}
+
+
+
+int main(int argc, char **argv)
+{
+  std::vector<SimTester>    Sims;      /* all testers */
+  struct epoll_event        Events[MAX_EVENTS];
+  struct epoll_event        Event;     /* event settings */
+  struct sigaction          Action;    /* signal settings */
+  int               Opt;               /* option */
+  int               n;                 /* counter */
+  int               Timeout;           /* epoll timeout (ms) */
+  Clock::time_point Now;               /* current time */
+
+  Random.seed((unsigned)time(NULL));
+
+  /* process options */
+  while ((Opt = getopt(argc, argv, "n:d:q:m:l:s:h")) != -1)
+  {
+    switch (Opt)
+    {
+      case 'n': Cfg.Testers = (unsigned)atoi(optarg); break;
+      case 'd': Cfg.ProbeTime = (unsigned)atoi(optarg); break;
+      case 'q': Cfg.Queue = (unsigned)atoi(optarg); break;
+      case 'm': Cfg.LineMax = (unsigned)atoi(optarg); break;
+      case 'l': Cfg.LinkPrefix = optarg; break;
+      case 's': Random.seed((unsigned)atoi(optarg)); break;
+      default: Usage(argv[0]); return 1;
+    }
+  }
+
+  if ((Cfg.Testers == 0) || (Cfg.LineMax < 5) ||
+      ((Cfg.Queue > 0) && (Cfg.Queue < 32)))
+  {
+    Usage(argv[0]);
+    return 1;
+  }
+
+  /* stop gracefully */
+  memset(&Action, 0, sizeof(Action));
+  Action.sa_handler = HandleSignal;
+  sigaction(SIGINT, &Action, NULL);
+  sigaction(SIGTERM, &Action, NULL);
+
+  /* create ptys (vector must not grow later, epoll stores pointers) */
+  EpollFd = epoll_create1(0);
+  Sims.resize(Cfg.Testers);
+  for (n = 0; n < (int)Cfg.Testers; n++)
+  {
+    SimTester &Sim = Sims[(size_t)n];
+
+    if (! OpenPTY(Sim))
+    {
+      perror("pty");
+      return 1;
+    }
+
+    if (Cfg.LinkPrefix)
+    {
+      Sim.Link = Cfg.LinkPrefix + std::to_string(n);
+      unlink(Sim.Link.c_str());
+      if (symlink(Sim.Name.c_str(), Sim.Link.c_str()) < 0)
+      {
+        perror(Sim.Link.c_str());
+        Sim.Link.clear();
+      }
+    }
+
+    memset(&Event, 0, sizeof(Event));
+    Event.events = EPOLLIN;
+    Event.data.ptr = &Sim;
+    epoll_ctl(EpollFd, EPOLL_CTL_ADD, Sim.Master, &Event);
+
+    printf("%s\n", Sim.Link.empty() ? Sim.Name.c_str() : Sim.Link.c_str());
+  }
+  fflush(stdout);
+
+
+  /*
+   *  event loop
+   */
+
+  while (! Stop)
+  {
+    /* wait until next end of probing */
+    Now = Clock::now();
+    Timeout = -1;
+    for (SimTester &Sim : Sims)
+    {
+      if (! Sim.Busy) continue;
+
+      n = (int)std::chrono::duration_cast<std::chrono::milliseconds>(Sim.BusyUntil - Now).count() + 1;
+      if (n < 0) n = 0;
+      if ((Timeout < 0) || (n < Timeout)) Timeout = n;
+    }
+
+    n = epoll_wait(EpollFd, Events, MAX_EVENTS, Timeout);
+    if (n < 0)
+    {
+      if (errno == EINTR) continue;
+      perror("epoll_wait");
+      break;
+    }
+
+    while (n > 0)
+    {
+      n--;
+      SimTester &Sim = *(SimTester *)Events[n].data.ptr;
+
+      if (Events[n].events & EPOLLOUT) FlushTX(Sim);
+      if (Events[n].events & EPOLLIN) ReadPTY(Sim);
+    }
+
+    Now = Clock::now();
+    for (SimTester &Sim : Sims)
+    {
+      CheckProbe(Sim, Now);
+      Receive(Sim);                     /* data left after XON */
+    }
+  }
+
+
+  /* clean up */
+  for (SimTester &Sim : Sims)
+  {
+    if (! Sim.Link.empty()) unlink(Sim.Link.c_str());
+    close(Sim.Slave);
+    close(Sim.Master);
+  }
+  close(EpollFd);
+
+  return 0;
+}
+
+
+/* ************************************************************************
+ *   EOF
+ * ************************************************************************ */
@@ -0,0 +1,892 @@
+/* ************************************************************************
+ *
+ *   host side test station: drives several testers in parallel
+ *
+ *   (c) 2019 by Markus Reschke
+ *
+ * ************************************************************************ */
+
+/*
+ *  hints:
+ *  - usage: teststation [options] <device> [<device> ...]
+ *  - a single epoll loop serves all testers (no threads)
+ *  - each test cycle sends the command list to the tester, the responses
+ *    are matched to the commands in order
+ *  - up to <window> commands are in flight per tester (pipelining)
+ *    a window > 1 requires the RX queue of the firmware (SERIAL_RX_QUEUE)
+ *    and enables XON/XOFF for the serial port
+ *  - results are written as CSV or JSON lines, one line per test cycle
+ *  - at start and after a timeout the station syncs to the tester by
+ *    sending VER and dropping all responses until the version is received
+ *  - for testing without hardware see tester_sim
+ */
+
+
+/* system includes */
+#include <cctype>
+#include <cerrno>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <chrono>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/epoll.h>
+#include <termios.h>
+#include <unistd.h>
+
+
+/*
+ *  local constants
+ */
+
+#define DEFAULT_BAUD     9600           /* baud rate */
+#define DEFAULT_CMDS     "PROBE,COMP,QTY,PIN,R,C"
+#define DEFAULT_TIMEOUT  10000          /* timeout per command (ms) */
+#define MAX_EVENTS       16             /* epoll events per call */
+#define MAX_LINE         256            /* max. length of response line */
+
+/* flow control chars (see CHAR_XON/CHAR_XOFF in common.h) */
+#define CHAR_XON         17
+#define CHAR_XOFF        19
+
+/* output formats */
+#define FORMAT_CSV       0
+#define FORMAT_JSON      1
+
+
+/*
+ *  local types
+ */
+
+typedef std::chrono::steady_clock Clock;
+
+
+/* tester */
+struct Tester
+{
+  std::string       Path;               /* device path */
+  int               Fd = -1;            /* file descriptor */
+  unsigned          Cycle = 0;          /* number of current cycle */
+  size_t            NextCmd = 0;        /* next command to send */
+  std::deque<size_t>  InFlight;         /* commands sent */
+  std::vector<std::string>  Values;     /* responses of current cycle */
+  std::string       RX_Line;            /* received partial line */
+  std::string       TX_Data;            /* data not sent yet */
+  bool              TX_Wait = false;    /* waiting for EPOLLOUT */
+  bool              Sync = false;       /* waiting for version */
+  bool              Done = false;       /* all cycles done */
+  Clock::time_point Start;              /* start of current cycle */
+  Clock::time_point Deadline;           /* timeout for oldest command */
+  unsigned          Timeouts = 0;       /* number of timeouts */
+  double            TotalTime = 0;      /* sum of cycle times (ms) */
+};
+
+
+/* settings */
+struct Settings
+{
+  unsigned          Baud = DEFAULT_BAUD;     /* baud rate */
+  unsigned          Window = 1;              /* commands in flight */
+  unsigned          Cycles = 1;              /* cycles per tester */
+  unsigned          Timeout = DEFAULT_TIMEOUT;   /* ms */
+  int               Format = FORMAT_CSV;     /* output format */
+  std::vector<std::string>  Cmds;            /* command list */
+};
+
+
+/*
+ *  local variables
+ */
+
+static volatile sig_atomic_t  Stop = 0;      /* stop request */
+static Settings     Cfg;                     /* settings */
+static FILE         *Out = stdout;           /* results sink */
+static int          EpollFd = -1;            /* epoll instance */
+
+
+
+/* ************************************************************************
+ *   serial port
+ * ************************************************************************ */
+
+
+/*
+ *  get termios speed for baud rate
+ *
+ *  requires:
+ *  - Baud: baud rate in bps
+ *
+ *  returns:
+ *  - speed or B0 for unsupported baud rate
+ */
+
+static speed_t GetSpeed(unsigned Baud)
+{
+  switch (Baud)
+  {
+    case 2400:   return B2400;
+    case 4800:   return B4800;
+    case 9600:   return B9600;
+    case 19200:  return B19200;
+    case 38400:  return B38400;
+    case 57600:  return B57600;
+    case 115200: return B115200;
+  }
+
+  return B0;
+}
+
+
+
+/*
+ *  open and set up serial port
+ *  - raw mode, 8N1, non-blocking
+ *  - XON/XOFF for TX when pipelining
+ *
+ *  requires:
+ *  - Path: device path
+ *
+ *  returns:
+ *  - file descriptor or -1 on error
+ */
+
+static int OpenPort(const std::string &Path)
+{
+  int               Fd;            /* file descriptor */
+  struct termios    Term;          /* port settings */
+
+  Fd = open(Path.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK);
+  if (Fd < 0)
+  {
+    fprintf(stderr, "%s: %s\n", Path.c_str(), strerror(errno));
+    return -1;
+  }
+
+  if (tcgetattr(Fd, &Term) < 0)
+  {
+    fprintf(stderr, "%s: %s\n", Path.c_str(), strerror(errno));
+    close(Fd);
+    return -1;
+  }
+
+  cfmakeraw(&Term);                     /* no line processing */
+  Term.c_cflag |= CLOCAL | CREAD;       /* no modem control */
+  Term.c_cflag &= ~(CSTOPB | PARENB);   /* 8N1 */
+  cfsetspeed(&Term, GetSpeed(Cfg.Baud));
+
+  /* the tester's RX queue stops us by XOFF
+     (RX queue excludes binary frames, so no frame byte is taken as XOFF) */
+  if (Cfg.Window > 1) Term.c_iflag |= IXON;
+
+  if (tcsetattr(Fd, TCSANOW, &Term) < 0)
+  {
+    fprintf(stderr, "%s: %s\n", Path.c_str(), strerror(errno));
+    close(Fd);
+    return -1;
+  }
+
+  tcflush(Fd, TCIOFLUSH);               /* drop stale data */
+
+  return Fd;
+}
+
+
+
+/*
+ *  update epoll events of tester
+ *
+ *  requires:
+ *  - Dev: tester
+ *  - Write: wait for EPOLLOUT also
+ */
+
+static void SetEvents(Tester &Dev, bool Write)
+{
+  struct epoll_event  Event;       /* event settings */
+
+  if (Dev.TX_Wait == Write) return;     /* no change */
+
+  memset(&Event, 0, sizeof(Event));
+  Event.events = EPOLLIN | (Write ? (uint32_t)EPOLLOUT : 0);
+  Event.data.ptr = &Dev;
+  epoll_ctl(EpollFd, EPOLL_CTL_MOD, Dev.Fd, &Event);
+  Dev.TX_Wait = Write;
+}
+
+
+
+/*
+ *  drop tester after I/O error or hangup
+ *
+ *  requires:
+ *  - Dev: tester
+ */
+
+static void DropTester(Tester &Dev)
+{
+  fprintf(stderr, "%s: lost connection in cycle %u\n", Dev.Path.c_str(), Dev.Cycle);
+  epoll_ctl(EpollFd, EPOLL_CTL_DEL, Dev.Fd, NULL);
+  Dev.InFlight.clear();
+  Dev.Done = true;
+}
+
+
+
+/*
+ *  send pending TX data
+ *  - writes as much as possible and waits for EPOLLOUT for the rest
+ *
+ *  requires:
+ *  - Dev: tester
+ */
+
+static void FlushTX(Tester &Dev)
+{
+  ssize_t           n;             /* bytes written */
+
+  while (! Dev.TX_Data.empty())
+  {
+    n = write(Dev.Fd, Dev.TX_Data.data(), Dev.TX_Data.size());
+    if (n < 0)
+    {
+      if (errno == EINTR) continue;
+      if (errno != EAGAIN) fprintf(stderr, "%s: %s\n", Dev.Path.c_str(), strerror(errno));
+      break;
+    }
+    Dev.TX_Data.erase(0, (size_t)n);
+  }
+
+  SetEvents(Dev, ! Dev.TX_Data.empty());
+}
+
+
+
+/* ************************************************************************
+ *   results sink
+ * ************************************************************************ */
+
+
+/*
+ *  quote string for CSV
+ *  - quotes only when required
+ *
+ *  requires:
+ *  - Text: string
+ *
+ *  returns:
+ *  - CSV field
+ */
+
+static std::string QuoteCSV(const std::string &Text)
+{
+  std::string       Field;         /* output */
+
+  if (Text.find_first_of(",\" ") == std::string::npos) return Text;
+
+  Field = "\"";
+  for (char Char : Text)
+  {
+    if (Char == '"') Field += '"';      /* double quote */
+    Field += Char;
+  }
+  Field += '"';
+
+  return Field;
+}
+
+
+
+/*
+ *  quote string for JSON
+ *
+ *  requires:
+ *  - Text: string
+ *
+ *  returns:
+ *  - JSON string
+ */
+
+static std::string QuoteJSON(const std::string &Text)
+{
+  std::string       Field = "\"";  /* output */
+  char              Buffer[8];     /* for escape sequence */
+
+  for (unsigned char Char : Text)
+  {
+    if ((Char == '"') || (Char == '\\'))
+    {
+      Field += '\\';
+      Field += (char)Char;
+    }
+    else if (Char < 0x20)               /* control char */
+    {
+      snprintf(Buffer, sizeof(Buffer), "\\u%04x", Char);
+      Field += Buffer;
+    }
+    else
+    {
+      Field += (char)Char;
+    }
+  }
+  Field += '"';
+
+  return Field;
+}
+
+
+
+/*
+ *  write header for CSV
+ */
+
+static void WriteHeader(void)
+{
+  if (Cfg.Format != FORMAT_CSV) return;
+
+  fprintf(Out, "device,cycle,start_ms,duration_ms");
+  for (const std::string &Cmd : Cfg.Cmds)
+  {
+    fprintf(Out, ",%s", QuoteCSV(Cmd).c_str());
+  }
+  fprintf(Out, "\n");
+  fflush(Out);
+}
+
+
+
+/*
+ *  write results of a test cycle
+ *
+ *  requires:
+ *  - Dev: tester
+ *  - Duration: cycle time in ms
+ */
+
+static void WriteResults(const Tester &Dev, double Duration)
+{
+  long long         StartTime;     /* wall clock of cycle start (ms) */
+  size_t            n;             /* counter */
+
+  /* wall clock time of cycle start */
+  StartTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+    std::chrono::system_clock::now().time_since_epoch()).count();
+  StartTime -= (long long)Duration;
+
+  if (Cfg.Format == FORMAT_CSV)         /* CSV */
+  {
+    fprintf(Out, "%s,%u,%lld,%.1f", QuoteCSV(Dev.Path).c_str(), Dev.Cycle,
+      StartTime, Duration);
+    for (n = 0; n < Cfg.Cmds.size(); n++)
+    {
+      fprintf(Out, ",%s", QuoteCSV(Dev.Values[n]).c_str());
+    }
+  }
+  else                                  /* JSON lines */
+  {
+    fprintf(Out, "{\"device\":%s,\"cycle\":%u,\"start_ms\":%lld,\"duration_ms\":%.1f,\"results\":{",
+      QuoteJSON(Dev.Path).c_str(), Dev.Cycle, StartTime, Duration);
+    for (n = 0; n < Cfg.Cmds.size(); n++)
+    {
+      fprintf(Out, "%s%s:%s", n ? "," : "", QuoteJSON(Cfg.Cmds[n]).c_str(),
+        QuoteJSON(Dev.Values[n]).c_str());
+    }
+    fprintf(Out, "}}");
+  }
+
+  fprintf(Out, "\n");
+  fflush(Out);
+}
+
+
+
+/* ************************************************************************
+ *   command processing
+ * ************************************************************************ */
+
+
+/*
+ *  send commands until window is full
+ *
+ *  requires:
+ *  - Dev: tester
+ */
+
+static void FillWindow(Tester &Dev)
+{
+  bool              Sent = false;  /* flag */
+
+  while ((Dev.InFlight.size() < Cfg.Window) && (Dev.NextCmd < Cfg.Cmds.size()))
+  {
+    if (Dev.InFlight.empty())           /* start timeout for first command */
+    {
+      Dev.Deadline = Clock::now() + std::chrono::milliseconds(Cfg.Timeout);
+    }
+
+    Dev.TX_Data += Cfg.Cmds[Dev.NextCmd];
+    Dev.TX_Data += '\n';
+    Dev.InFlight.push_back(Dev.NextCmd);
+    Dev.NextCmd++;
+    Sent = true;
+  }
+
+  if (Sent) FlushTX(Dev);
+}
+
+
+
+/*
+ *  check for version string (response to VER)
+ *  - e.g. "1.37m", not to be confused with values which have a unit
+ *
+ *  requires:
+ *  - Line: response
+ *
+ *  returns:
+ *  - true for a version string
+ */
+
+static bool IsVersion(const std::string &Line)
+{
+  size_t            n = 0;         /* position */
+
+  while ((n < Line.size()) && isdigit((unsigned char)Line[n])) n++;
+  if ((n == 0) || (n >= Line.size()) || (Line[n] != '.')) return false;
+  n++;
+  if ((n >= Line.size()) || ! isdigit((unsigned char)Line[n])) return false;
+  while ((n < Line.size()) && isdigit((unsigned char)Line[n])) n++;
+
+  return (Line.substr(n) == "m");
+}
+
+
+
+/*
+ *  sync to tester
+ *  - sends VER, ProcessLine() drops any stale responses until the
+ *    version is received and starts the next cycle then
+ *
+ *  requires:
+ *  - Dev: tester
+ */
+
+static void StartSync(Tester &Dev)
+{
+  Dev.Sync = true;
+  Dev.InFlight.clear();
+  Dev.Deadline = Clock::now() + std::chrono::milliseconds(Cfg.Timeout);
+  Dev.TX_Data += "VER\n";
+  FlushTX(Dev);
+}
+
+
+
+/*
+ *  start next test cycle
+ *
+ *  requires:
+ *  - Dev: tester
+ */
+
+static void StartCycle(Tester &Dev)
+{
+  if ((Cfg.Cycles > 0) && (Dev.Cycle >= Cfg.Cycles))   /* all done */
+  {
+    Dev.Done = true;
+    return;
+  }
+
+  Dev.Cycle++;
+  Dev.NextCmd = 0;
+  Dev.InFlight.clear();
+  Dev.Values.assign(Cfg.Cmds.size(), "");
+  Dev.Start = Clock::now();
+
+  FillWindow(Dev);
+}
+
+
+
+/*
+ *  finish test cycle
+ *
+ *  requires:
+ *  - Dev: tester
+ */
+
+static void EndCycle(Tester &Dev)
+{
+  double            Duration;      /* cycle time in ms */
+
+  Duration = std::chrono::duration<double, std::milli>(Clock::now() - Dev.Start).count();
+  Dev.TotalTime += Duration;
+  WriteResults(Dev, Duration);
+}
+
+
+
+/*
+ *  process response line
+ *
+ *  requires:
+ *  - Dev: tester
+ *  - Line: response
+ */
+
+static void ProcessLine(Tester &Dev, const std::string &Line)
+{
+  if (Dev.Sync)                         /* syncing */
+  {
+    if (IsVersion(Line))                /* got response to VER */
+    {
+      Dev.Sync = false;
+      StartCycle(Dev);
+    }
+    /* else: drop stale response */
+    return;
+  }
+
+  if (Dev.InFlight.empty())             /* unexpected */
+  {
+    fprintf(stderr, "%s: unexpected response: %s\n", Dev.Path.c_str(), Line.c_str());
+    return;
+  }
+
+  Dev.Values[Dev.InFlight.front()] = Line;
+  Dev.InFlight.pop_front();
+  Dev.Deadline = Clock::now() + std::chrono::milliseconds(Cfg.Timeout);
+
+  FillWindow(Dev);
+
+  if (Dev.InFlight.empty() && (Dev.NextCmd >= Cfg.Cmds.size()))
+  {
+    EndCycle(Dev);                      /* got all responses */
+    StartCycle(Dev);
+  }
+}
+
+
+
+/*
+ *  read and split responses
+ *
+ *  requires:
+ *  - Dev: tester
+ */
+
+static void ReadPort(Tester &Dev)
+{
+  char              Buffer[256];   /* RX buffer */
+  ssize_t           n;             /* bytes read */
+  ssize_t           i;             /* counter */
+  char              Char;          /* character */
+
+  while (1)
+  {
+    n = read(Dev.Fd, Buffer, sizeof(Buffer));
+    if (n < 0)
+    {
+      if (errno == EINTR) continue;
+      if (errno != EAGAIN) DropTester(Dev);  /* e.g. EIO */
+      break;
+    }
+    if (n == 0)                         /* hangup */
+    {
+      DropTester(Dev);
+      break;
+    }
+
+    for (i = 0; i < n; i++)
+    {
+      Char = Buffer[i];
+
+      if (Char == '\n')                 /* end of line */
+      {
+        if (! Dev.RX_Line.empty())      /* skip empty lines */
+        {
+          ProcessLine(Dev, Dev.RX_Line);
+          Dev.RX_Line.clear();
+        }
+      }
+      else if ((Char == '\r') || (Char == CHAR_XON) || (Char == CHAR_XOFF))
+      {
+        /* ignore CR and flow control */
+      }
+      else if (Dev.RX_Line.size() < MAX_LINE)
+      {
+        Dev.RX_Line += Char;
+      }
+    }
+  }
+}
+
+
+
+/*
+ *  check for timeout
+ *  - marks missing responses and syncs to the tester again
+ *
+ *  requires:
+ *  - Dev: tester
+ *  - Now: current time
+ */
+
+static void CheckTimeout(Tester &Dev, Clock::time_point Now)
+{
+  size_t            n;             /* counter */
+
+  if (Dev.Done || (Now < Dev.Deadline)) return;
+  if ((! Dev.Sync) && Dev.InFlight.empty()) return;
+
+  Dev.Timeouts++;
+
+  if (Dev.Sync)                         /* no response to VER */
+  {
+    fprintf(stderr, "%s: no response\n", Dev.Path.c_str());
+    StartSync(Dev);                     /* try again */
+    return;
+  }
+
+  fprintf(stderr, "%s: timeout in cycle %u\n", Dev.Path.c_str(), Dev.Cycle);
+
+  for (n = 0; n < Cfg.Cmds.size(); n++)
+  {
+    if (Dev.Values[n].empty()) Dev.Values[n] = "TIMEOUT";
+  }
+
+  EndCycle(Dev);
+
+  /* late responses would be assigned to wrong commands */
+  tcflush(Dev.Fd, TCIOFLUSH);
+  Dev.TX_Data.clear();
+  Dev.RX_Line.clear();
+  SetEvents(Dev, false);
+
+  if ((Cfg.Cycles > 0) && (Dev.Cycle >= Cfg.Cycles)) Dev.Done = true;
+  else StartSync(Dev);
+}
+
+
+
+/* ************************************************************************
+ *   main
+ * ************************************************************************ */
+
+
+/*
+ *  signal handler
+ */
+
+static void HandleSignal(int Signal)
+{
+  (void)Signal;
+  Stop = 1;
+}
+
+
+
+/*
+ *  show usage
+ */
+
+static void Usage(const char *Name)
+{
+  fprintf(stderr,
+    "usage: %s [options] <device> [<device> ...]\n"
+    "  -b <baud>     baud rate (default: %u)\n"
+    "  -c <cmds>     comma separated command list (default: %s)\n"
+    "  -w <n>        commands in flight per tester (default: 1)\n"
+    "                n > 1 requires SERIAL_RX_QUEUE, enables XON/XOFF\n"
+    "  -n <n>        test cycles per tester, 0 for endless (default: 1)\n"
+    "  -t <ms>       timeout per command (default: %u)\n"
+    "  -f csv|json   output format (default: csv)\n"
+    "  -o <file>     output file (default: stdout)\n",
+    Name, DEFAULT_BAUD, DEFAULT_CMDS, DEFAULT_TIMEOUT);
+}
+
+
+
+/*
+ *  split comma separated list
+ *
+ *  requires:
+ *  - List: string
+ *
+ *  returns:
+ *  - non-empty items
+ */
+
+static std::vector<std::string> SplitList(const std::string &List)
+{
+  std::vector<std::string>  Items;     /* output */
+  size_t            Pos = 0;           /* start of item */
+  size_t            End;               /* end of item */
+
+  while (Pos <= List.size())
+  {
+    End = List.find(',', Pos);
+    if (End == std::string::npos) End = List.size();
+    if (End > Pos) Items.push_back(List.substr(Pos, End - Pos));
+    Pos = End + 1;
+  }
+
+  return Items;
+}
+
+
+
+int main(int argc, char **argv)
+{
+  std::vector<Tester>       Testers;   /* all testers */
+  struct epoll_event        Events[MAX_EVENTS];
+  struct epoll_event        Event;     /* event settings */
+  struct sigaction          Action;    /* signal settings */
+  const char        *OutFile = NULL;   /* output file */
+  std::string       CmdList = DEFAULT_CMDS;
+  int               Opt;               /* option */
+  int               n;                 /* counter */
+  int               Timeout;           /* epoll timeout (ms) */
+  bool              Running;           /* flag */
+  Clock::time_point Now;               /* current time */
+
+  /* process options */
+  while ((Opt = getopt(argc, argv, "b:c:w:n:t:f:o:h")) != -1)
+  {
+    switch (Opt)
+    {
+      case 'b': Cfg.Baud = (unsigned)atoi(optarg); break;
+      case 'c': CmdList = optarg; break;
+      case 'w': Cfg.Window = (unsigned)atoi(optarg); break;
+      case 'n': Cfg.Cycles = (unsigned)atoi(optarg); break;
+      case 't': Cfg.Timeout = (unsigned)atoi(optarg); break;
+      case 'o': OutFile = optarg; break;
+      case 'f':
+        if (strcmp(optarg, "csv") == 0) Cfg.Format = FORMAT_CSV;
+        else if (strcmp(optarg, "json") == 0) Cfg.Format = FORMAT_JSON;
+        else { Usage(argv[0]); return 1; }
+        break;
+      default: Usage(argv[0]); return 1;
+    }
+  }
+
+  Cfg.Cmds = SplitList(CmdList);
+  if ((optind >= argc) || Cfg.Cmds.empty() || (Cfg.Window == 0) ||
+      (GetSpeed(Cfg.Baud) == B0))
+  {
+    Usage(argv[0]);
+    return 1;
+  }
+
+  if (OutFile)
+  {
+    Out = fopen(OutFile, "w");
+    if (Out == NULL)
+    {
+      fprintf(stderr, "%s: %s\n", OutFile, strerror(errno));
+      return 1;
+    }
+  }
+
+  /* stop gracefully */
+  memset(&Action, 0, sizeof(Action));
+  Action.sa_handler = HandleSignal;
+  sigaction(SIGINT, &Action, NULL);
+  sigaction(SIGTERM, &Action, NULL);
+
+  /* open ports (vector must not grow later, epoll stores pointers) */
+  EpollFd = epoll_create1(0);
+  Testers.resize((size_t)(argc - optind));
+  for (n = 0; n < argc - optind; n++)
+  {
+    Tester &Dev = Testers[(size_t)n];
+
+    Dev.Path = argv[optind + n];
+    Dev.Fd = OpenPort(Dev.Path);
+    if (Dev.Fd < 0) return 1;
+
+    memset(&Event, 0, sizeof(Event));
+    Event.events = EPOLLIN;
+    Event.data.ptr = &Dev;
+    epoll_ctl(EpollFd, EPOLL_CTL_ADD, Dev.Fd, &Event);
+  }
+
+  WriteHeader();
+  for (Tester &Dev : Testers) StartSync(Dev);
+
+
+  /*
+   *  event loop
+   */
+
+  while (! Stop)
+  {
+    /* wait until next deadline */
+    Now = Clock::now();
+    Timeout = -1;
+    Running = false;
+    for (Tester &Dev : Testers)
+    {
+      if (Dev.Done) continue;
+      Running = true;
+      if ((! Dev.Sync) && Dev.InFlight.empty()) continue;
+
+      n = (int)std::chrono::duration_cast<std::chrono::milliseconds>(Dev.Deadline - Now).count() + 1;
+      if (n < 0) n = 0;
+      if ((Timeout < 0) || (n < Timeout)) Timeout = n;
+    }
+    if (! Running) break;               /* all testers done */
+
+    n = epoll_wait(EpollFd, Events, MAX_EVENTS, Timeout);
+    if (n < 0)
+    {
+      if (errno == EINTR) continue;
+      perror("epoll_wait");
+      break;
+    }
+
+    while (n > 0)
+    {
+      n--;
+      Tester &Dev = *(Tester *)Events[n].data.ptr;
+
+      if (Dev.Done) continue;           /* dropped meanwhile */
+      if (Events[n].events & EPOLLOUT) FlushTX(Dev);
+      if (Events[n].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) ReadPort(Dev);
+    }
+
+    Now = Clock::now();
+    for (Tester &Dev : Testers) CheckTimeout(Dev, Now);
+  }
+
+
+  /*
+   *  summary
+   */
+
+  for (Tester &Dev : Testers)
+  {
+    unsigned        Cycles;        /* finished cycles */
+
+    Cycles = Dev.Cycle;
+    if (! Dev.Done && Cycles > 0) Cycles--;  /* current cycle unfinished */
+
+    fprintf(stderr, "%s: %u cycles, %u timeouts, %.1f ms per cycle\n",
+      Dev.Path.c_str(), Cycles, Dev.Timeouts,
+      Cycles ? Dev.TotalTime / Cycles : 0.0);
+    close(Dev.Fd);
+  }
+
+  close(EpollFd);
+  if (Out != stdout) fclose(Out);
+
+  return 0;
+}
+
+
+/* ************************************************************************
+ *   EOF
+ * ************************************************************************ */
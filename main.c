@@ -384,7 +384,18 @@ void Show_Capacitor(void)
 
   #if defined (SW_ESR) || defined (SW_OLD_ESR)
   /* show ESR */
+    #ifdef SERIAL_BITBANG
+    Serial_Ctrl(SER_TIMER_LOCK);   /* free Timer0 for ESR */
+    #endif
+
+  Clock_Hold();                    /* keep clock's ISR out of ESR */
   ESR = MeasureESR(MaxCap);        /* measure ESR */
+  Clock_Release();                 /* catch up clock */
+
+    #ifdef SERIAL_BITBANG
+    Serial_Ctrl(SER_TIMER_UNLOCK); /* use Timer0 for TTL serial */
+    #endif
+
   if (ESR < UINT16_MAX)            /* if successfull */
   {
     Display_Space();
@@ -1306,6 +1317,10 @@ void PowerOff(void)
   #endif
   Display_EEString(Bye_str);            /* display: Bye! */
 
+  #ifdef SERIAL_TX_BUFFER
+  Serial_Flush();                       /* send remaining data */
+  #endif
+
   cli();                                /* disable interrupts */
   wdt_disable();                        /* disable watchdog */
   POWER_PORT &= ~(1 << POWER_CTRL);     /* power off myself */
@@ -1487,6 +1502,8 @@ int main(void)
   Cfg.SleepMode = SLEEP_MODE_PWR_SAVE;  /* sleep mode: power save */
   #endif                                /* we have to keep Timer2 running */
 
+  Clock_Init();                         /* start clock (Timer2) */
+
 
   /*
    *  set up busses and interfaces
@@ -1604,6 +1621,9 @@ int main(void)
   #ifdef HW_TOUCH
   Touch_Init();                         /* init touch screen */
   #endif
+  #ifdef UI_KEY_EVENTS
+  Key_Init();                           /* init key events */
+  #endif
 
 
   /*
@@ -1684,6 +1704,10 @@ int main(void)
 
 cycle_start:
 
+  #ifdef SERIAL_BITBANG
+  Serial_Ctrl(SER_TIMER_LOCK);     /* free Timer0 for probing */
+  #endif
+
   /* reset variables */
   Check.Found = COMP_NONE;         /* no component */
   Check.Type = 0;                  /* reset type flags */
@@ -1820,6 +1844,10 @@ cycle_start:
 
 show_component:
 
+  #ifdef SERIAL_BITBANG
+  Serial_Ctrl(SER_TIMER_UNLOCK);   /* use Timer0 for TTL serial */
+  #endif
+
   LCD_Clear();                     /* clear LCD */
 
   /* next-line mode */
@@ -1941,6 +1969,10 @@ cycle_control:
   ADC_DDR = (1 << TP_REF);         /* short circuit probes */
   #endif
 
+  #ifdef SERIAL_BITBANG
+  Serial_Ctrl(SER_TIMER_UNLOCK);   /* use Timer0 for TTL serial */
+  #endif
+
   #ifdef SERIAL_RW
   Serial_Ctrl(SER_RX_RESUME);      /* enable TTL serial RX */
   #endif
@@ -2008,6 +2040,10 @@ cycle_action:
   /* todo: when we got a locked buffer meanwhile? */
   #endif
 
+  #ifdef SERIAL_BITBANG
+  Serial_Ctrl(SER_TIMER_LOCK);     /* free Timer0 for tools */
+  #endif
+
   if (Key == KEY_MAINMENU)         /* run main menu */
   {
     #ifdef SAVE_POWER
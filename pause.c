@@ -26,183 +26,544 @@
 #include "functions.h"        /* external functions */
 
 
+/*
+ *  local variables
+ */
+
+/* clock */
+volatile uint32_t   ClockOverflows = 0; /* Timer2 overflows */
+uint32_t            ClockOffset = 0;    /* compensation for oscillator start-up */
+
+/* soft timers */
+uint32_t            TimerDeadline[TIMERS];   /* deadline (timer cycles) */
+uint32_t            TimerPeriod[TIMERS];     /* period (timer cycles), 0: one-shot */
+uint8_t             TimerActive = 0;         /* active timers (bitmask) */
+
+
 
 /* ************************************************************************
- *   sleep functions
+ *   clock
  * ************************************************************************ */
 
 
 /*
- *  enter MCU sleep mode for a specific time in ms
- *  - valid time 0 - 65535ms
- *  - uses timer2
- *  - don't use this function for time critical stuff!
+ *  start clock
+ *  - uses Timer2 in normal mode with prescaler 1024 (maximum):
+ *      MCU frequency  1MHz    8MHz   16MHz  20MHz
+ *      timer cycle    1024s  128s  64s   51.2s
+ *  - Timer2's overflow interrupt counts the upper bits
+ *  - clock runs all the time and is the time base for MilliSleep()
+ *    and the soft timers
+ *  - the overflow interrupt can be held off for short cycle-timed
+ *    sequences like the ESR measurement (see Clock_Hold())
+ *  - should be called at firmware startup
  */
 
-void MilliSleep(uint16_t Time)
+void Clock_Init(void)
 {
-  uint32_t               Cycles;        /* timer cycles */
-  uint8_t                Timeout;       /* compare value */
-  uint8_t                Flag = 0;      /* interrupt flag */
-  #ifdef SAVE_POWER
-  uint8_t                Mode;          /* sleep mode */
-  #endif
+  TCCR2B = 0;                      /* stop timer */
+  TCCR2A = 0;                      /* normal mode */
+  TCNT2 = 0;                       /* set counter to 0 */
+  ClockOverflows = 0;              /* reset overflow counter */
+  ClockOffset = 0;                 /* reset compensation */
+  TIFR2 = (1 << TOV2) | (1 << OCF2A);     /* clear flags */
+  TIMSK2 = (1 << TOIE2);           /* enable overflow interrupt */
+
+  /* start timer by setting clock prescaler to 1024 */
+  TCCR2B = (1 << CS22) | (1 << CS21) | (1 << CS20);
+}
+
+
+
+/*
+ *  hold clock's overflow interrupt
+ *  - keeps Timer2's ISR out of timing critical measurements
+ *  - only for sections shorter than one overflow period, don't hold
+ *    the clock across probing or tools
+ *  - Timer2 keeps running, Clock_Cycles() folds a pending overflow
+ *  - the clock lags when no clock function is called within one
+ *    overflow period (256 timer cycles, 32ms at 8MHz)
+ */
+
+void Clock_Hold(void)
+{
+  TIMSK2 &= ~(1 << TOIE2);         /* disable overflow interrupt */
+}
+
+
+
+/*
+ *  release clock's overflow interrupt
+ *  - a pending overflow is caught up by the ISR right away
+ */
+
+void Clock_Release(void)
+{
+  TIMSK2 |= (1 << TOIE2);          /* enable overflow interrupt */
+}
+
+
+
+/*
+ *  get time since start of clock in timer cycles
+ *  - resolution: 1024 MCU cycles (128s at 8MHz)
+ *  - includes compensation for oscillator start-up after power save
+ *
+ *  returns:
+ *  - time in timer cycles
+ */
+
+uint32_t Clock_Cycles(void)
+{
+  uint32_t          Cycles;        /* timer cycles */
+  uint8_t           Counter;       /* timer counter */
+  uint8_t           Flags;         /* status register */
+
+  /* get overflows and counter atomically */
+  Flags = SREG;                    /* save status */
+  cli();                           /* disable interrupts */
+
+  /* fold pending overflow while clock is on hold */
+  if (! (TIMSK2 & (1 << TOIE2)) && (TIFR2 & (1 << TOV2)))
+  {
+    ClockOverflows++;              /* one more overflow */
+    TIFR2 = (1 << TOV2);           /* clear flag */
+  }
+
+  Counter = TCNT2;                 /* get counter */
+  Cycles = ClockOverflows;         /* get overflows */
+
+  /* catch pending overflow */
+  if ((TIFR2 & (1 << TOV2)) && (Counter < 255))
+  {
+    Cycles++;
+  }
+  SREG = Flags;                    /* restore status */
+
+  Cycles <<= 8;                    /* overflows are upper bits */
+  Cycles |= Counter;               /* add counter */
+  Cycles += ClockOffset;           /* add compensation */
+
+  return Cycles;
+}
+
+
+
+/*
+ *  get time since start of clock
+ *  - resolution: 1024 MCU cycles (128s at 8MHz)
+ *
+ *  returns:
+ *  - time in ms
+ */
+
+uint32_t Clock_Get(void)
+{
+  uint32_t          Overflows;     /* timer overflows */
+  uint32_t          Time;          /* time in ms */
+  uint8_t           Counter;       /* timer counter */
+
+  Overflows = Clock_Cycles();      /* get timer cycles */
+  Counter = (uint8_t)Overflows;    /* lower 8 bits */
+  Overflows >>= 8;                 /* upper bits */
 
   /*
-   *  calculate stuff
+   *  convert timer cycles into ms:
+   *  - one overflow = 256 * 1024 MCU cycles
+   *  - t = cycles * 1024 / (CPU_FREQ / 1000)
+   *      = cycles * 128 / (CPU_FREQ / 8000)
+   *  - split up overflows to prevent a 32 bit overflow
    */
 
-  /*
-      Using timer prescaler of 1024 (maximum):
-        MCU frequency  1MHz    8MHz   16MHz  20MHz
-        timer cycle    1024s  128s  64s   51.2s
+  #define CLOCK_DIV     (CPU_FREQ / 8000)
 
-      We don't compensate the binary to decimal offset and also not the time
-      required for the processing loop, because it would make things much more
-      complicated and we don't need exact timing here.
-  */
+  Time = (Overflows / CLOCK_DIV) * 32768;
+  Overflows %= CLOCK_DIV;               /* remaining overflows */
+  Overflows *= 32768;                   /* * 256 * 128 */
+  Overflows += (uint16_t)Counter * 128;
+  Time += Overflows / CLOCK_DIV;
 
-  #ifdef SAVE_POWER
-  Mode = Cfg.SleepMode;                 /* get current sleep mode */
-  #endif
+  #undef CLOCK_DIV
 
-  /* calculate required timer cycles (prescaler 1024) */
-  Cycles = Time;                        /* ms * 1024 -> s */
-  Cycles *= MCU_CYCLES_PER_US;          /* timer cycles based on MCU frequency */
+  return Time;
+}
 
-  #ifdef SAVE_POWER
-  if (Mode == SLEEP_MODE_PWR_SAVE)      /* power save mode */
-  {
-    uint32_t        Value;
 
-    /*
-     *  After returning from the power down or power save sleep modes the
-     *  main oscillator needs following start-up times to stabilize:
-     *  - crystal oscillator:  16k cycles
-     *  - ceramic resonator:   1k or 256 cycles
-     *  - internal RC osc.:    6 cycles
-     */
 
-    /* compensate oscillator start-up */
-    Value = Cycles / 256;               /* calculate loop runs */
-    Value++;                            /* fix offset by division */
-    /* multiply with startup cycles equivalent to timer cycles */
-    Value *= (OSC_STARTUP / 1024);      /* overhead cycles */
+/*
+ *  convert time in ms into timer cycles
+ *  - rounds up
+ *
+ *  requires:
+ *  - Time in ms (0 - 65535)
+ *
+ *  returns:
+ *  - timer cycles
+ */
+
+uint32_t Clock_MS2Cycles(uint16_t Time)
+{
+  uint32_t          Cycles;        /* timer cycles */
 
-    if (Cycles > Value)            /* we are able to compensate */
-    {
-      Cycles -= Value;                  /* subtract overhead cycles */
-    }
-    else                           /* no way to compensate */
-    {
-      /* idle mode doesn't require oscillator start-up after wake-up */
-      /* just 6 cycles delay */ 
-      Mode = SLEEP_MODE_IDLE;           /* change sleep mode to Idle */
-    }
-  }
-  #endif
+  /* cycles = t * (CPU_FREQ / 1000) / 1024 = t * (CPU_FREQ / 8000) / 128 */
+  Cycles = Time;
+  Cycles *= (CPU_FREQ / 8000);
+  Cycles += 127;                   /* round up */
+  Cycles /= 128;
 
+  return Cycles;
+}
 
+
+
+/*
+ *  ISR for overflow of Timer2
+ */
+
+ISR(TIMER2_OVF_vect, ISR_BLOCK)
+{
   /*
-   *  set up timer
+   *  hints:
+   *  - the TOV2 interrupt flag is cleared automatically
+   *  - interrupt processing is disabled while this ISR runs
+   *    (no nested interrupts)
    */
 
-  TCCR2B = 0;                      /* stop timer */
-  TCNT2 = 0;                       /* set counter to 0 */
-  TCCR2A = (1 << WGM21);           /* set CTC mode */
-  TIMSK2 = (1 << OCIE2A);          /* enable interrupt for OCR2A match */
+  ClockOverflows++;           /* one more overflow */
+}
+
+
+
+/*
+ *  ISR for match of Timer2's OCR2A (Output Compare Register A)
+ *  - just wakes up the MCU at a deadline
+ */
 
+ISR(TIMER2_COMPA_vect, ISR_BLOCK)
+{
+  /*
+   *  hints:
+   *  - the OCF2A interrupt flag is cleared automatically
+   *  - interrupt processing is disabled while this ISR runs
+   *    (no nested interrupts)
+   */
+
+  TIMSK2 &= ~(1 << OCIE2A);   /* disable match interrupt */
+}
+
+
+
+/* ************************************************************************
+ *   sleep functions
+ * ************************************************************************ */
+
+
+/*
+ *  enter MCU sleep mode until a deadline is reached
+ *  - the clock's overflow interrupt wakes up the MCU every 256 timer
+ *    cycles, OCR2A's match interrupt at the deadline when it's within
+ *    the current overflow period
+ *  - any other interrupt wakes up the MCU too, so we check the time after
+ *    each wake-up and sleep again
+ *  - with UI_KEY_EVENTS it can also return for a pending UI event
+ *  - don't use this function for time critical stuff!
+ *
+ *  requires:
+ *  - Deadline in timer cycles (see Clock_Cycles())
+ *  - Wake: WAKE_DEADLINE (deadline only) or WAKE_EVENT (deadline or event)
+ */
+
+void Clock_Sleep(uint32_t Deadline, uint8_t Wake)
+{
+  uint32_t          Cycles;        /* timer cycles */
+  int32_t           Left;          /* remaining timer cycles */
+  uint8_t           Flag = 0;      /* interrupt flag */
+  uint8_t           Hold;          /* clock on hold */
   #ifdef SAVE_POWER
-  set_sleep_mode(Mode);            /* set sleep mode */
+  uint8_t           Mode;          /* sleep mode */
   #endif
 
   if (SREG & (1 << SREG_I))        /* if interrupts are already enabled */
   {
     Flag = 1;                      /* keep that in mind */
   }
-  else                             /* otherwise */
-  {
-    sei();                         /* enable interrupts */
-  }
+
+  /* overflow interrupt is needed for waking up */
+  Hold = ! (TIMSK2 & (1 << TOIE2));     /* clock on hold? */
+  Clock_Cycles();                       /* fold pending overflow */
+  TIMSK2 |= (1 << TOIE2);               /* enable overflow interrupt */
 
 
   /*
    *  processing loop
-   *  - sleep for several intervals until requested time is reached
+   *  - sleep until deadline is reached
    */
 
-  while (Cycles > 0)
+  while (1)
   {
     wdt_reset();              /* reset watchdog */
 
+    /* interrupts stay disabled until we enter the sleep mode */
+    cli();                    /* disable interrupts */
+
+    /* check time */
+    Cycles = Clock_Cycles();       /* get current time */
+    Left = (int32_t)(Deadline - Cycles);
+    if (Left <= 0) break;          /* deadline reached */
+
+    #ifdef UI_KEY_EVENTS
+    if ((Wake == WAKE_EVENT) && Key_Pending()) break;  /* got event */
+    #endif
+
+    #ifdef SAVE_POWER
+    Mode = Cfg.SleepMode;               /* get current sleep mode */
+
+      #ifdef SERIAL_BITBANG
+      /* bit-bang serial needs Timer0 (clk_IO) while sending or receiving */
+      if (Serial_Flags & (SER_TX_BUSY | SER_RX_BUSY))
+      {
+        Mode = SLEEP_MODE_IDLE;         /* change sleep mode to Idle */
+      }
+      #endif
+
+      #if defined (ONEWIRE_IO_PIN) || defined (ONEWIRE_PROBES)
+      /* OneWire slot engine needs Timer1 (clk_IO) while the bus is busy */
+      if (! OneWire_Ready())
+      {
+        Mode = SLEEP_MODE_IDLE;         /* change sleep mode to Idle */
+      }
+      #endif
+
     /*
-     *  manage timeout
+     *  After returning from the power down or power save sleep modes the
+     *  main oscillator needs following start-up times to stabilize:
+     *  - crystal oscillator:  16k cycles
+     *  - ceramic resonator:   1k or 256 cycles
+     *  - internal RC osc.:    6 cycles
+     *  So we wake up earlier by the start-up time and add it to the clock
+     *  after waking up.
      */
 
-    if (Cycles > 255)         /* prevent 8 bit overflow */
+    if (Mode == SLEEP_MODE_PWR_SAVE)    /* power save mode */
     {
-      Timeout = 255;          /* use maximum */
+      if (Left > (OSC_STARTUP / 1024))  /* we are able to compensate */
+      {
+        Left -= (OSC_STARTUP / 1024);   /* subtract start-up cycles */
+      }
+      else                              /* no way to compensate */
+      {
+        /* idle mode doesn't require oscillator start-up after wake-up */
+        /* just 6 cycles delay */
+        Mode = SLEEP_MODE_IDLE;         /* change sleep mode to Idle */
+      }
     }
-    else                      /* within 8 bit range */
+    #endif
+
+    /* wake-up by OCR2A match if deadline is within current overflow period */
+    Cycles -= ClockOffset;              /* Timer2's time base */
+    if (((Cycles + Left) >> 8) == (Cycles >> 8))
     {
-      Timeout = (uint8_t)Cycles;
+      Cycles += Left;
+      OCR2A = (uint8_t)Cycles;          /* set compare value */
+      TIFR2 = (1 << OCF2A);             /* clear flag */
+      TIMSK2 |= (1 << OCIE2A);          /* enable match interrupt */
     }
 
-    Cycles -= Timeout;        /* update counter */
-    Timeout--;                /* interrupt is triggered by cycle after match */
-    /* todo: what happens if Timeout is 0? */
-
-    /* update timer */
-    OCR2A = Timeout;               /* set compare value (timeout) */
-
-    /* start timer by setting clock prescaler to 1024 */
-    TCCR2B = (1 << CS22) | (1 << CS21) | (1 << CS20);
-
     /*
      *  sleep
-     *  - since any interrupt would wake up the MCU we have to make sure
-     *    that we track the right interrupt
+     *  - sei() executes the next instruction before any pending interrupt,
+     *    i.e. we can't miss the wake-up interrupt
      */
 
-    while (TCCR2B != 0)       /* as long as Timer2 is running */
-    {
-      #ifdef SAVE_POWER
-        /* enter sleep mode to save power */
-        sleep_mode();              /* sleep (again) */
-        /* woken up */
-      #else
-        /* burn MCU cycles while waiting for Timer2 */
-        asm volatile(
-          "nop\n\t"
-          "nop\n\t"
-          ::
-        );
-      #endif
-    }
+    #ifdef SAVE_POWER
+      set_sleep_mode(Mode);        /* set sleep mode */
+      sleep_enable();
+      sei();                       /* enable interrupts */
+      sleep_cpu();                 /* sleep */
+      /* woken up */
+      sleep_disable();
+
+      if (Mode == SLEEP_MODE_PWR_SAVE)  /* power save mode */
+      {
+        /* compensate oscillator start-up */
+        ClockOffset += (OSC_STARTUP / 1024);
+      }
+    #else
+      /* burn MCU cycles while waiting for Timer2 */
+      sei();                       /* enable interrupts */
+      asm volatile(
+        "nop\n\t"
+        "nop\n\t"
+        ::
+      );
+    #endif
   }
 
-  if (Flag == 0)              /* restore former interrupt setting */
+  TIMSK2 &= ~(1 << OCIE2A);        /* disable match interrupt */
+
+  if (Hold)                        /* clock was on hold */
   {
-    cli();                    /* disable interrupts */
+    TIMSK2 &= ~(1 << TOIE2);       /* hold it again */
+  }
+
+  if (Flag)                        /* restore former interrupt setting */
+  {
+    sei();                         /* enable interrupts */
   }
 }
 
 
 
 /*
- *  ISR for match of Timer2's OCR2A (Output Compare Register A)
+ *  enter MCU sleep mode for a specific time in ms
+ *  - valid time 0 - 65535ms
+ *  - based on clock (Timer2)
+ *  - don't use this function for time critical stuff!
  */
 
-ISR(TIMER2_COMPA_vect, ISR_BLOCK)
+void MilliSleep(uint16_t Time)
 {
-  /*
-   *  hints:
-   *  - the OCF2A interrupt flag is cleared automatically
-   *  - interrupt processing is disabled while this ISR runs
-   *    (no nested interrupts)
-   */
+  uint32_t          Deadline;      /* timer cycles */
+
+  Deadline = Clock_Cycles();            /* current time */
+  Deadline += Clock_MS2Cycles(Time);    /* add time */
+
+  Clock_Sleep(Deadline, WAKE_DEADLINE);  /* sleep */
+}
+
+
+
+/* ************************************************************************
+ *   soft timers
+ * ************************************************************************ */
+
+
+/*
+ *  start soft timer
+ *  - timer isn't running in the background, Timer_Expired() checks the
+ *    deadline
+ *
+ *  requires:
+ *  - ID of timer (0 - TIMERS-1)
+ *  - Time in ms (1 - 65535)
+ *  - Mode:
+ *    TIMER_ONESHOT    expire once
+ *    TIMER_PERIODIC   expire every time period
+ */
+
+void Timer_Start(uint8_t ID, uint16_t Time, uint8_t Mode)
+{
+  uint32_t          Cycles;        /* timer cycles */
+
+  Cycles = Clock_MS2Cycles(Time);       /* convert time */
+  TimerDeadline[ID] = Clock_Cycles() + Cycles;
+
+  if (Mode == TIMER_PERIODIC)      /* periodic timer */
+  {
+    TimerPeriod[ID] = Cycles;      /* set period */
+  }
+  else                             /* one-shot timer */
+  {
+    TimerPeriod[ID] = 0;           /* no period */
+  }
 
-  TCCR2B = 0;                 /* stop Timer2 */
+  TimerActive |= (1 << ID);        /* activate timer */
+}
+
+
+
+/*
+ *  stop soft timer
+ *
+ *  requires:
+ *  - ID of timer (0 - TIMERS-1)
+ */
+
+void Timer_Stop(uint8_t ID)
+{
+  TimerActive &= ~(1 << ID);       /* deactivate timer */
+}
+
+
+
+/*
+ *  check if soft timer has expired
+ *  - one-shot timer: stops timer
+ *  - periodic timer: sets next deadline
+ *    (missed periods are signaled by the following calls)
+ *
+ *  requires:
+ *  - ID of timer (0 - TIMERS-1)
+ *
+ *  returns:
+ *  - 0 if not expired or not active
+ *  - 1 if expired
+ */
+
+uint8_t Timer_Expired(uint8_t ID)
+{
+  uint8_t           Flag = 0;      /* return value */
+  int32_t           Left;          /* remaining timer cycles */
+
+  if (TimerActive & (1 << ID))     /* timer active */
+  {
+    Left = (int32_t)(TimerDeadline[ID] - Clock_Cycles());
+
+    if (Left <= 0)                 /* deadline reached */
+    {
+      if (TimerPeriod[ID])         /* periodic timer */
+      {
+        TimerDeadline[ID] += TimerPeriod[ID];     /* next deadline */
+      }
+      else                         /* one-shot timer */
+      {
+        TimerActive &= ~(1 << ID);      /* deactivate timer */
+      }
+
+      Flag = 1;                    /* signal expired timer */
+    }
+  }
+
+  return Flag;
+}
+
+
+
+/*
+ *  enter MCU sleep mode until the next deadline of all active soft
+ *  timers is reached
+ *  - returns immediately if no timer is active
+ *
+ *  requires:
+ *  - Wake: WAKE_DEADLINE (deadline only) or WAKE_EVENT (deadline or
+ *    pending UI event, see Key_Pending())
+ */
+
+void Timer_Sleep(uint8_t Wake)
+{
+  uint8_t           n = 0;         /* counter */
+  uint8_t           Flag = 0;      /* control flag */
+  uint32_t          Deadline = 0;  /* next deadline */
+
+  /* search for next deadline */
+  while (n < TIMERS)
+  {
+    if (TimerActive & (1 << n))    /* timer active */
+    {
+      if ((Flag == 0) || ((int32_t)(TimerDeadline[n] - Deadline) < 0))
+      {
+        Deadline = TimerDeadline[n];    /* new next deadline */
+        Flag = 1;
+      }
+    }
+
+    n++;                           /* next timer */
+  }
+
+  if (Flag)                        /* got deadline */
+  {
+    Clock_Sleep(Deadline, Wake);   /* sleep */
+  }
 }
 
 
@@ -62,9 +62,11 @@
   #define BIT_FE         FE0       /* Frame Error */
   #define BIT_DOR        DOR0      /* Data OverRun */
   #define BIT_UPE        UPE0      /* USART Parity Error */
+  #define BIT_U2X        U2X0      /* Double the USART Transmission Speed */
 
   #define REG_UCSR_B     UCSR0B    /* USART Control and Status Register B */
   #define BIT_RXCIE      RXCIE0    /* RX Complete Interrupt Enable */
+  #define BIT_UDRIE      UDRIE0    /* Data Register Empty Interrupt Enable */
   #define BIT_RXEN       RXEN0     /* Receiver Enable */
   #define BIT_TXEN       TXEN0     /* Transmitter Enable */
   #define BIT_UCSZ_2     UCSZ02    /* USART Character Size 2 */
@@ -83,6 +85,7 @@
   #define REG_UBRR       UBRR0     /* USART Baud Rate Register combined */
 
   #define ISR_USART_RX   USART0_RX_vect      /* ISR */
+  #define ISR_USART_UDRE USART0_UDRE_vect    /* ISR */
 #endif
 
 /* USART1 */
@@ -96,9 +99,11 @@
   #define BIT_FE         FE1       /* Frame Error */
   #define BIT_DOR        DOR1      /* Data OverRun */
   #define BIT_UPE        UPE1      /* USART Parity Error */
+  #define BIT_U2X        U2X1      /* Double the USART Transmission Speed */
 
   #define REG_UCSR_B     UCSR1B    /* USART Control and Status Register B */
   #define BIT_RXCIE      RXCIE1    /* RX Complete Interrupt Enable */
+  #define BIT_UDRIE      UDRIE1    /* Data Register Empty Interrupt Enable */
   #define BIT_RXEN       RXEN1     /* Receiver Enable */
   #define BIT_TXEN       TXEN1     /* Transmitter Enable */
   #define BIT_UCSZ_2     UCSZ12    /* Character Size 0 */
@@ -117,6 +122,27 @@
   #define REG_UBRR       UBRR1     /* USART Baud Rate Register combined */
 
   #define ISR_USART_RX   USART1_RX_vect      /* ISR */
+  #define ISR_USART_UDRE USART1_UDRE_vect    /* ISR */
+#endif
+
+
+/* baud rate settings for hardware USART: UBRR_VALUE and USE_2X */
+#ifdef SERIAL_HARDWARE
+  #define BAUD           SERIAL_BAUD    /* baud rate */
+  #define BAUD_TOL       2              /* max. error: 2% */
+  #include <util/setbaud.h>
+#endif
+
+/* TX buffer */
+#ifdef SERIAL_TX_BUFFER
+  #define TX_MASK        (SERIAL_TX_BUFFER - 1)   /* mask for ring buffer */
+#endif
+
+/* RX queue */
+#ifdef SERIAL_RX_QUEUE
+  #define RX_MASK        (SERIAL_RX_QUEUE - 1)    /* mask for ring buffer */
+  #define RX_XOFF_LEVEL  (SERIAL_RX_QUEUE / 4)    /* send XOFF below */
+  #define RX_XON_LEVEL   (SERIAL_RX_QUEUE / 2)    /* send XON above */
 #endif
 
 
@@ -156,6 +182,172 @@
 
 
 
+/* ************************************************************************
+ *   functions for RX queue
+ * ************************************************************************ */
+
+
+#ifdef SERIAL_RX_QUEUE
+
+/*
+ *  hints:
+ *  - the queue is a ring buffer of 0-terminated lines
+ *  - the RX ISR appends chars to the current line, a newline completes
+ *    the line and sets OP_RX_LOCKED (line available)
+ *  - a line exceeding RX_BUFFER_SIZE or the free space is dropped and
+ *    replaced by a single CHAR_CAN to report the overflow
+ *  - XON/XOFF is sent ahead of the TX buffer
+ */
+
+
+
+/*
+ *  get free space in queue
+ *
+ *  returns:
+ *  - number of free bytes
+ */
+
+uint8_t Serial_QueueFree(void)
+{
+  return (RX_Tail - RX_Head - 1) & RX_MASK;
+}
+
+
+
+/*
+ *  get pending flow control char
+ *  - clears pending flag
+ *
+ *  returns:
+ *  - XON or XOFF
+ */
+
+uint8_t Serial_FlowChar(void)
+{
+  RX_State &= ~RXQ_FLOW;           /* clear pending flag */
+
+  if (RX_State & RXQ_XOFF) return CHAR_XOFF;
+  return CHAR_XON;
+}
+
+
+
+/*
+ *  update flow control state for pausing or resuming RX
+ *  - interrupts have to be disabled
+ *  - XON is sent only when there's enough space
+ *
+ *  requires:
+ *  - Control: SER_RX_PAUSE (stop host) or SER_RX_RESUME (resume host)
+ *
+ *  returns:
+ *  - 1 if XON/XOFF has to be sent
+ *  - 0 if state is unchanged
+ */
+
+uint8_t Serial_UpdateFlow(uint8_t Control)
+{
+  if (Control == SER_RX_PAUSE)          /* stop host */
+  {
+    if (RX_State & RXQ_XOFF) return 0;  /* already stopped */
+    RX_State |= RXQ_XOFF;               /* send XOFF */
+  }
+  else                                  /* resume host */
+  {
+    if (! (RX_State & RXQ_XOFF)) return 0;             /* not stopped */
+    if (Serial_QueueFree() < RX_XON_LEVEL) return 0;   /* queue too full */
+    RX_State &= ~RXQ_XOFF;              /* send XON */
+  }
+
+  RX_State |= RXQ_FLOW;                 /* XON/XOFF pending */
+  return 1;
+}
+
+
+
+/*
+ *  put received char into queue
+ *  - called by RX ISR
+ *  - ignores CR and empty lines
+ *  - sends XOFF when the queue is getting full
+ *
+ *  requires:
+ *  - Char: received char
+ */
+
+void Serial_StoreChar(uint8_t Char)
+{
+  uint8_t           Head;          /* write position */
+  uint8_t           Free;          /* free space */
+
+  if (Char == '\r') return;        /* ignore CR (carriage return) */
+
+  Head = RX_Head;                  /* get write position */
+  Free = Serial_QueueFree();       /* get free space */
+
+  if (Char == '\n')                /* NL (new line) */
+  {
+    if (RX_State & RXQ_DISCARD)    /* line dropped */
+    {
+      RX_State &= ~RXQ_DISCARD;    /* end of dropped line */
+      if (Free < 2) return;        /* no space for marker */
+      RX_Queue[Head] = CHAR_CAN;   /* signal overflow */
+      Head = (Head + 1) & RX_MASK; /* next position */
+    }
+    else if (Head == RX_Start)     /* empty line */
+    {
+      return;
+    }
+
+    RX_Queue[Head] = 0;            /* terminate line */
+    Head = (Head + 1) & RX_MASK;   /* next position */
+    RX_Head = Head;                /* update write position */
+    RX_Start = Head;               /* start of next line */
+    RX_Lines++;                    /* got another line */
+    Cfg.OP_Control |= OP_RX_LOCKED;     /* signal line */
+  }
+  else if (! (RX_State & RXQ_DISCARD))  /* line ok */
+  {
+    /* keep space for terminating 0 and check line length */
+    if ((Free < 2) ||
+        (((Head - RX_Start) & RX_MASK) >= (RX_BUFFER_SIZE - 1)))
+    {
+      RX_Head = RX_Start;          /* drop line */
+      RX_State |= RXQ_DISCARD;     /* and skip rest of line */
+      return;
+    }
+
+    RX_Queue[Head] = Char;         /* copy char to queue */
+    RX_Head = (Head + 1) & RX_MASK;     /* update write position */
+  }
+  /* else: discard char */
+
+  /* stop host when queue is getting full */
+  if ((! (RX_State & RXQ_XOFF)) && (Free <= RX_XOFF_LEVEL))
+  {
+    RX_State |= RXQ_XOFF | RXQ_FLOW;    /* XOFF pending */
+
+    #ifdef SERIAL_BITBANG
+    /* RX keeps Timer0 running, Serial_Timer() schedules TX */
+    if (! (Serial_Flags & SER_TX_BUSY))      /* TX idle */
+    {
+      TX_Bits = 0;                      /* start new char */
+      TX_Time = TCNT0;                  /* right now */
+      Serial_Flags |= SER_TX_BUSY;      /* TX is running */
+    }
+    #endif
+
+    #ifdef SERIAL_HARDWARE
+    REG_UCSR_B |= (1 << BIT_UDRIE);     /* enable UDRE interrupt */
+    #endif
+  }
+}
+
+#endif
+
+
+
 /* ************************************************************************
  *   functions for software USART (bit-banging)
  * ************************************************************************ */
@@ -163,6 +355,71 @@
 
 #ifdef SERIAL_BITBANG
 
+/*
+ *  hints:
+ *  - Timer0 runs in normal mode and OCR0B triggers the next bit
+ *  - TX and RX share the compare channel, the ISR processes all due
+ *    bits and sets OCR0B to the next one
+ *  - Timer0 is stopped when there's nothing to do
+ *  - when some measurement or tool needs Timer0 the timer has to be
+ *    locked by Serial_Ctrl(SER_TIMER_LOCK), TX falls back to busy
+ *    waiting then
+ *  - RX is not possible while Timer0 is locked or RX is paused,
+ *    received chars are lost (with RX queue XOFF stops the host,
+ *    but chars already in flight are lost too)
+ */
+
+
+
+/*
+ *  set baud rate
+ *  - smallest prescaler (8, 64 or 256) giving up to 128 timer ticks per
+ *    bit, the due test in Serial_Timer() needs a bit period of half the
+ *    timer range at most to detect a late ISR
+ *  - change baud rate only when TX and RX are idle
+ *
+ *  requires:
+ *  - Baud: baud rate in bps
+ */
+
+void Serial_SetBaud(uint16_t Baud)
+{
+  uint32_t          Ticks;         /* timer ticks per bit */
+
+  /* timer ticks for prescaler 8 (rounded) */
+  Ticks = ((CPU_FREQ / 8) + (Baud / 2)) / Baud;
+
+  if (Ticks <= 128)                /* fine resolution */
+  {
+    Serial_Clock = (1 << CS01);                   /* prescaler 8 */
+  }
+  else                             /* too many ticks */
+  {
+    /* timer ticks for prescaler 64 (rounded) */
+    Ticks = ((CPU_FREQ / 64) + (Baud / 2)) / Baud;
+
+    if (Ticks <= 128)              /* medium resolution */
+    {
+      Serial_Clock = (1 << CS01) | (1 << CS00);   /* prescaler 64 */
+    }
+    else                           /* still too many ticks */
+    {
+      /* timer ticks for prescaler 256 (rounded) */
+      Ticks = ((CPU_FREQ / 256) + (Baud / 2)) / Baud;
+      if (Ticks > 128) Ticks = 128;               /* limit to half range */
+      Serial_Clock = (1 << CS02);                 /* prescaler 256 */
+    }
+  }
+
+  Serial_Ticks = (uint8_t)Ticks;
+
+  /* delay loops for busy waiting (4 MCU cycles per loop) */
+  Serial_Loops = (CPU_FREQ / 4) / Baud;
+  Serial_Loops -= 3;               /* compensate for bit processing */
+}
+
+
+
 /*
  *  set up serial interface
  *  - TX & RX line
@@ -173,6 +430,8 @@ void Serial_Setup(void)
   SERIAL_DDR |= (1 << SERIAL_TX);       /* set TX pin to output mode */
   SERIAL_PORT |= (1 << SERIAL_TX);      /* preset TX to idle state (high) */
 
+  Serial_SetBaud(SERIAL_BAUD);          /* set default baud rate */
+
   #ifdef SERIAL_RW
   SERIAL_DDR &= ~(1 << SERIAL_RX);      /* set RX pin to input mode */
   REG_PC_MASK |= (1 << SERIAL_RX);      /* set up pin change mask for RX pin */
@@ -189,77 +448,495 @@ void Serial_Setup(void)
 
 
 /*
- *  send byte
- *  - 9600 8N1
+ *  start Timer0 if not running yet
+ *  - interrupts have to be disabled
+ */
+
+void Serial_StartTimer(void)
+{
+  if (! (Serial_Flags & (SER_TX_BUSY | SER_RX_BUSY)))  /* timer stopped */
+  {
+    TCCR0B = 0;                 /* stop timer */
+    TCCR0A = 0;                 /* normal mode (count up) */
+    TCNT0 = 0;                  /* reset counter to 0 */
+    TIFR0 = (1 << OCF0B);       /* clear Output Compare B Match flag */
+    TIMSK0 = (1 << OCIE0B);     /* enable Output Compare B Match interrupt */
+    TCCR0B = Serial_Clock;      /* start timer by setting prescaler */
+  }
+}
+
+
+
+/*
+ *  process due TX and RX bits and schedule next one
+ *  - called by ISR or by polling when interrupts are disabled
+ *  - a bit is due when its time is reached or has passed
+ *    (the next bit is never more than one bit period away, and with
+ *    128 ticks per bit at most a late ISR still sees a passed bit time
+ *    as more than one bit period away)
+ *  - stops Timer0 when there's nothing to do
+ */
+
+void Serial_Timer(void)
+{
+  uint8_t           Flags;         /* busy flags */
+  uint8_t           Now;           /* timer value */
+  uint8_t           Next;          /* time of next bit */
+  uint8_t           Dist;          /* ticks until bit */
+  #ifdef SERIAL_RW
+  uint8_t           Bit;           /* bit flag */
+  #endif
+
+  while (1)
+  {
+    Now = TCNT0;                   /* get current time */
+
+
+    /*
+     *  TX
+     *  - 1 start bit, 8 data bits (LSB first), 1 stop bit
+     */
+
+    if (Serial_Flags & SER_TX_BUSY)
+    {
+      Dist = TX_Time - Now;             /* ticks until next bit */
+
+      if ((Dist == 0) || (Dist > Serial_Ticks))   /* due */
+      {
+        TX_Time += Serial_Ticks;        /* time of next bit */
+
+        if ((TX_Bits == 0) || (TX_Bits == 10))    /* next char */
+        {
+          #ifdef SERIAL_RX_QUEUE
+          if (RX_State & RXQ_FLOW)      /* XON/XOFF pending */
+          {
+            TX_Char = Serial_FlowChar();          /* send it first */
+          }
+          else
+          #endif
+          if (TX_Head == TX_Tail)       /* buffer empty */
+          {
+            Serial_Flags &= ~SER_TX_BUSY;    /* end TX */
+          }
+          else                          /* got another char */
+          {
+            TX_Char = TX_Buffer[TX_Tail];         /* get char */
+            TX_Tail = (TX_Tail + 1) & TX_MASK;    /* next char */
+          }
+
+          if (Serial_Flags & SER_TX_BUSY)         /* got another char */
+          {
+            /* R_PORT & R_DDR / ADC_PORT & ADC_DDR can interfere */
+            SERIAL_DDR |= (1 << SERIAL_TX);       /* set TX to output */
+
+            /* start bit (0/low) */
+            SERIAL_PORT &= ~(1 << SERIAL_TX);     /* clear TX */
+            TX_Bits = 1;
+          }
+        }
+        else if (TX_Bits < 9)           /* data bit */
+        {
+          if (TX_Char & 0b00000001)     /* 1 */
+          {
+            SERIAL_PORT |= (1 << SERIAL_TX);      /* set TX */
+          }
+          else                          /* 0 */
+          {
+            SERIAL_PORT &= ~(1 << SERIAL_TX);     /* clear TX */
+          }
+
+          TX_Char >>= 1;                /* shift right */
+          TX_Bits++;                    /* next bit */
+        }
+        else                            /* stop bit */
+        {
+          /* 1 stop bit (1/high) and stay idle (high) */
+          SERIAL_PORT |= (1 << SERIAL_TX);        /* set TX */
+          TX_Bits++;                    /* signal end of char */
+        }
+      }
+    }
+
+
+    #ifdef SERIAL_RW
+
+    /*
+     *  RX
+     *  - sample bit in the middle of the bit period
+     *  - puts received char into a buffer
+     *  - collects full text line and manages the buffer
+     */
+
+    if (Serial_Flags & SER_RX_BUSY)
+    {
+      Dist = RX_Time - Now;             /* ticks until next bit */
+
+      if ((Dist == 0) || (Dist > Serial_Ticks))   /* due */
+      {
+        RX_Time += Serial_Ticks;        /* time of next bit */
+
+        Bit = SERIAL_PIN & (1 << SERIAL_RX);      /* get bit */
+        RX_Bits++;                                /* got another bit */
+
+        if (RX_Bits == 1)               /* start bit */
+        {
+          /* start bit should be low */
+          if (Bit)                      /* high */
+          {
+            RX_Bits = 0;                /* end RX */
+          }
+        }
+        else if (RX_Bits == 10)         /* stop bit */
+        {
+          /* stop bit should be high */
+          if (Bit == 0)                 /* low */
+          {
+            RX_Bits = 0;                /* end RX */
+          }
+        }
+        else                            /* data bit */
+        {
+          RX_Char >>= 1;                      /* shift right */
+          if (Bit) RX_Char |= 0b10000000;     /* set MSB */   
+        }
+
+        /* manage buffer */
+        if (RX_Bits == 10)              /* got all bits */
+        {
+          #ifdef SERIAL_RX_QUEUE
+          Serial_StoreChar(RX_Char);    /* put char into queue */
+          #else
+          if (! (Cfg.OP_Control & OP_RX_LOCKED))   /* buffer unlocked */
+          {
+            if (RX_Char == '\r')              /* CR (carriage return) */
+            {
+              RX_Char = 0;                    /* terminate string */
+            }
+            else if (RX_Char == '\n')         /* NL (new line) */
+            {
+              RX_Char = 0;                    /* terminate string */
+              if (RX_Pos > 0)                 /* not an empty line */
+              {
+                Cfg.OP_Control |= OP_RX_LOCKED;    /* lock buffer for processing */
+              }
+            }
+            else if (RX_Pos == (RX_BUFFER_SIZE - 1))    /* no control char & overflow */
+            {
+              RX_Char = 0;                              /* terminate string */
+              /* lock buffer & signal overflow */
+              Cfg.OP_Control |= OP_RX_LOCKED | OP_RX_OVERFLOW;
+            }
+
+            RX_Buffer[RX_Pos] = RX_Char;      /* copy to buffer */
+
+            if (RX_Char > 0)                  /* no control char */
+            {
+              RX_Pos++;                       /* next char */
+            }
+          }
+          /* else: drop char */
+          #endif
+
+          RX_Bits = 0;                  /* end RX */
+        }
+
+        /* rearm pin-change interrupt for next char */
+        if (RX_Bits == 0)               /* char done */
+        {
+          Serial_Flags &= ~SER_RX_BUSY;      /* end RX */
+          PCIFR |= (1 << BIT_PC_FLAG);       /* clear pin change interrupt flag */
+          PCICR |= (1 << BIT_PC_IRQ);        /* enable pin change interrupt */
+        }
+      }
+    }
+
+    #endif
+
+
+    /*
+     *  schedule next bit
+     */
+
+    Flags = Serial_Flags & (SER_TX_BUSY | SER_RX_BUSY);
+
+    if (Flags == 0)                /* nothing to do */
+    {
+      TCCR0B = 0;                  /* stop Timer0 */
+      TIMSK0 = 0;                  /* disable Timer0 interrupts */
+      break;                       /* end loop */
+    }
+
+    Next = TX_Time;                /* TX by default */
+
+    #ifdef SERIAL_RW
+    if (Flags & SER_RX_BUSY)       /* RX */
+    {
+      /* take RX when TX is idle or RX comes first */
+      if ((! (Flags & SER_TX_BUSY)) ||
+          ((uint8_t)(RX_Time - Now) < (uint8_t)(TX_Time - Now)))
+      {
+        Next = RX_Time;
+      }
+    }
+    #endif
+
+    OCR0B = Next;                  /* set match value for next bit */
+
+    /* check if we missed the next bit meanwhile */
+    Dist = Next - TCNT0;           /* ticks until next bit */
+    if ((Dist != 0) && (Dist <= Serial_Ticks)) break;    /* still ahead */
+    /* else: process next bit right now */
+  }
+}
+
+
+
+/*
+ *  process due bits when interrupts are disabled
+ */
+
+void Serial_Poll(void)
+{
+  if (TIFR0 & (1 << OCF0B))        /* compare match */
+  {
+    TIFR0 = (1 << OCF0B);          /* clear flag */
+    Serial_Timer();                /* process bits */
+  }
+}
+
+
+
+/*
+ *  send byte by busy waiting
+ *  - when Timer0 is locked for other use
+ *
+ *  requires:
+ *  - Byte: byte to send
+ */
+
+void Serial_SendByte(uint8_t Byte)
+{
+  uint8_t           n = 8;    /* bit counter */
+
+  /* R_PORT & R_DDR / ADC_PORT & ADC_DDR can interfere (input/HiZ) */
+  /* idea: add external pull-up resistor to TX to keep TX high while set to HiZ */
+  SERIAL_DDR |= (1 << SERIAL_TX);       /* set TX pin to output mode */
+  SERIAL_PORT |= (1 << SERIAL_TX);      /* preset TX to idle state (high) */
+
+  /* start bit (0/low) */
+  SERIAL_PORT &= ~(1 << SERIAL_TX);     /* clear TX */
+  _delay_loop_2(Serial_Loops);          /* delay for one bit */
+
+  /* 8 data bits (LSB first) */
+  while (n > 0)
+  {
+    if (Byte & 0b00000001)    /* 1 */
+    {
+      SERIAL_PORT |= (1 << SERIAL_TX);    /* set TX */
+    }
+    else                      /* 0 */
+    {
+      SERIAL_PORT &= ~(1 << SERIAL_TX);   /* clear TX */
+    }
+
+    _delay_loop_2(Serial_Loops);          /* delay for one bit */
+
+    Byte >>= 1;               /* shift right */
+    n--;                      /* next bit */
+  }
+
+  /* 1 stop bit (1/high) and stay idle (high) */
+  SERIAL_PORT |= (1 << SERIAL_TX);      /* set TX */
+  _delay_loop_2(Serial_Loops);          /* delay for one bit */
+}
+
+
+
+/*
+ *  start TX if idle
+ *  - interrupts have to be disabled
+ */
+
+void Serial_StartTX(void)
+{
+  if (! (Serial_Flags & SER_TX_BUSY))   /* TX idle */
+  {
+    Serial_StartTimer();                /* start Timer0 if required */
+    TX_Bits = 0;                        /* start new char */
+    TX_Time = TCNT0;                    /* right now */
+    Serial_Flags |= SER_TX_BUSY;        /* TX is running */
+    Serial_Timer();                     /* send start bit & schedule */
+  }
+}
+
+
+
+/*
+ *  send byte
+ *  - SERIAL_BAUD 8N1 (set by Serial_Setup())
+ *  - puts byte into TX buffer, the Timer0 ISR sends it in the background
+ *  - waits if the buffer is full
+ *  - sends directly by busy waiting when Timer0 is locked
+ *
+ *  requires:
+ *  - Byte: byte to send
+ */
+
+void Serial_WriteByte(uint8_t Byte)
+{
+  uint8_t           Head;          /* write position */
+  uint8_t           Flags;         /* status register */
+
+  if (Serial_Flags & SER_LOCKED)        /* Timer0 locked */
+  {
+    Serial_SendByte(Byte);              /* send by busy waiting */
+    return;
+  }
+
+  Head = (TX_Head + 1) & TX_MASK;       /* next write position */
+
+  /* wait for free space in buffer */
+  while (Head == TX_Tail)
+  {
+    /* we have to poll the timer when interrupts are disabled */
+    if (! (SREG & (1 << SREG_I)))       /* interrupts disabled */
+    {
+      Serial_Poll();                    /* process bits */
+    }
+  }
+
+  TX_Buffer[TX_Head] = Byte;            /* copy byte to buffer */
+  TX_Head = Head;                       /* update write position */
+
+  /* start TX if idle */
+  Flags = SREG;                         /* save status */
+  cli();                                /* disable interrupts */
+  Serial_StartTX();                     /* start TX */
+  SREG = Flags;                         /* restore status */
+}
+
+
+
+/*
+ *  wait until all data is sent
+ *  - e.g. before powering off
+ */
+
+void Serial_Flush(void)
+{
+  while (Serial_Flags & SER_TX_BUSY)    /* TX is running */
+  {
+    /* we have to poll the timer when interrupts are disabled */
+    if (! (SREG & (1 << SREG_I)))       /* interrupts disabled */
+    {
+      Serial_Poll();                    /* process bits */
+    }
+  }
+}
+
+
+
+#ifdef SERIAL_RX_QUEUE
+
+/*
+ *  software flow control (XON/XOFF)
+ *  - sends XON/XOFF ahead of TX buffer if required
+ *  - sends directly by busy waiting when Timer0 is locked
  *
  *  requires:
- *  - Byte: byte to send
+ *  - Control: SER_RX_PAUSE (stop host) or SER_RX_RESUME (resume host)
  */
 
-void Serial_WriteByte(uint8_t Byte)
+void Serial_Flow(uint8_t Control)
 {
-  uint8_t           n = 8;    /* bit counter */
-
-  /* R_PORT & R_DDR / ADC_PORT & ADC_DDR can interfere (input/HiZ) */
-  /* idea: add external pull-up resistor to TX to keep TX high while set to HiZ */
-  Serial_Setup();        /* quick and dirty */
+  uint8_t           Flags;         /* status register */
 
-  /* start bit (0/low) */
-  SERIAL_PORT &= ~(1 << SERIAL_TX);     /* clear TX */
-  wait100us();                          /* delay for 9600bps */
-  wait3us();
+  Flags = SREG;                         /* save status */
+  cli();                                /* disable interrupts */
 
-  /* 8 data bits (LSB first) */
-  while (n > 0)
+  if (Serial_UpdateFlow(Control))       /* XON/XOFF pending */
   {
-    if (Byte & 0b00000001)    /* 1 */
+    if (Serial_Flags & SER_LOCKED)      /* Timer0 locked */
     {
-      SERIAL_PORT |= (1 << SERIAL_TX);    /* set TX */
+      Serial_SendByte(Serial_FlowChar());    /* send by busy waiting */
     }
-    else                      /* 0 */
+    else                                /* Timer0 available */
     {
-      SERIAL_PORT &= ~(1 << SERIAL_TX);   /* clear TX */
+      Serial_StartTX();                 /* start TX */
     }
-
-    wait100us();              /* delay for 9600bps */
-    wait3us();
-
-    Byte >>= 1;               /* shift right */
-    n--;                      /* next bit */
   }
 
-  /* 1 stop bit (1/high) and stay idle (high) */
-  SERIAL_PORT |= (1 << SERIAL_TX);      /* set TX */
-  wait100us();                          /* delay for 9600bps */
-  wait3us();
+  SREG = Flags;                         /* restore status */
 }
 
+#endif
 
 
-#ifdef SERIAL_RW
 
 /*
  *  control serial interface
  *
  *  requires:
  *  - Control: control flag/switch
- *    SER_RX_PAUSE  - pause RX (disable interrupt)
- *    SER_RX_RESUME - resume RX (enable interrupt)
+ *    SER_RX_PAUSE     - pause RX (disable interrupt)
+ *    SER_RX_RESUME    - resume RX (enable interrupt)
+ *    SER_TIMER_LOCK   - free Timer0 for other use
+ *    SER_TIMER_UNLOCK - use Timer0 for serial again
+ *                       (also resumes RX unless paused)
  */
 
 void Serial_Ctrl(uint8_t Control)
 {
+  uint8_t           Flags;         /* status register */
+
   switch (Control)
   {
+    #ifdef SERIAL_RW
     case SER_RX_PAUSE:        /* pause RX */
-      /* todo: send XOFF? */
+      #ifdef SERIAL_RX_QUEUE
+      Serial_Flow(SER_RX_PAUSE);        /* stop host */
+      #endif
+      Flags = SREG;                     /* save status */
+      cli();                            /* disable interrupts */
       PCICR &= ~(1 << BIT_PC_IRQ);      /* disable pin change interrupt */
+      Serial_Flags |= SER_RX_PAUSED;    /* RX paused */
+      SREG = Flags;                     /* restore status */
       break;
 
     case SER_RX_RESUME:       /* resume RX */
+      Flags = SREG;                     /* save status */
+      cli();                            /* disable interrupts */
+      Serial_Flags &= ~SER_RX_PAUSED;   /* RX not paused anymore */
+      SREG = Flags;                     /* restore status */
       PCIFR |= (1 << BIT_PC_FLAG);      /* clear interrupt flag */
       PCICR |= (1 << BIT_PC_IRQ);       /* enable pin change interrupt */
-      /* todo: send XON? */
+      #ifdef SERIAL_RX_QUEUE
+      Serial_Flow(SER_RX_RESUME);       /* resume host */
+      #endif
+      break;
+    #endif
+
+    case SER_TIMER_LOCK:      /* lock Timer0 */
+      Serial_Flush();                   /* send remaining data */
+      Flags = SREG;                     /* save status */
+      cli();                            /* disable interrupts */
+      TCCR0B = 0;                       /* stop Timer0 */
+      TIMSK0 = 0;                       /* disable Timer0 interrupts */
+      /* drop pending RX & lock, keep pause state */
+      Serial_Flags = (Serial_Flags & SER_RX_PAUSED) | SER_LOCKED;
+      SREG = Flags;                     /* restore status */
+      break;
+
+    case SER_TIMER_UNLOCK:    /* unlock Timer0 */
+      Serial_Flags &= ~SER_LOCKED;      /* unlock */
+      #ifdef SERIAL_RW
+      /* a dropped RX has left the pin change interrupt disabled */
+      if (! (Serial_Flags & SER_RX_PAUSED))  /* RX not paused */
+      {
+        PCIFR |= (1 << BIT_PC_FLAG);    /* clear interrupt flag */
+        PCICR |= (1 << BIT_PC_IRQ);     /* enable pin change interrupt */
+      }
+      #endif
       break;
   }
 }
@@ -267,200 +944,67 @@ void Serial_Ctrl(uint8_t Control)
 
 
 /*
- *  ISR for PCIn (Pin Change Interrupt n)
- *  - 9600 8N1
- *  - for detecting start bit of RX
- *  - starts bit sampling by setting up timer
- *  - can't be used when by some measurement/tool needs Timer0
+ *  ISR for match of Timer0's OCR0B (Output Compare Register B)
+ *  - SERIAL_BAUD 8N1
+ *  - TX and RX bits
+ *  - can't be used when some measurement/tool needs Timer0
  */
 
-ISR(ISR_PINCHANGE, ISR_BLOCK)
+ISR(TIMER0_COMPB_vect, ISR_BLOCK)
 {
   /*
    *  hints:
-   *  - the PCIFn flag is cleared automatically
+   *  - the OCF0B interrupt flag is cleared automatically
    *  - interrupt processing is disabled while this ISR runs
    *    (no nested interrupts)
    */
 
-  /* check if RX pin has changed to 0/low (start bit) */
-  if (! (SERIAL_PIN & (1 << SERIAL_RX)))     /* low state */
-  {
-    PCICR &= ~(1 << BIT_PC_IRQ);        /* disable pin change interrupt */
-
-    /* reset variables for new char */
-    RX_Char = 0;
-    RX_Bits = 0;
-
-    /*
-     *  set up Timer0 for sampling first bit (start)
-     *  - normal mode
-     *  - use OCR0B for triggering interrupt
-     *  - 1/2 bit period of 9600bps = 52.08s
-     *  - fixed prescaler = 8
-     *    MCU clock [MHz]:    8    16    20
-     *    timer cycle [s]:   1    0.5   0.4
-     *    cycles for 52s:    52   104   130
-     *  - we don't need high precision, just good enough to sample 10 bits
-     *  - MCU_CYCLE_TIME in 0.1ns
-     *    timer cycles = (52s * 10000) / (MCU_CYCLE_TIME * 8)
-     *  - use delay of 48s for early sampling and to allow some time jittering
-     */
-
-    #define HALF_BIT     480000 / (MCU_CYCLE_TIME * 8)
-
-    //TCCR0B = 0;                 /* stop timer */
-    TCNT0 = 0;                  /* reset counter to 0 */
-    OCR0B = HALF_BIT;           /* set match value for 1/2 bit period */
-    TCCR0A = 0;                 /* normal mode (count up) */
-    TIFR0 = (1 << OCF0B);       /* clear Output Compare B Match flag */
-    TIMSK0 = (1 << OCIE0B);     /* enable Output Compare B Match interrupt */
-    TCCR0B = (1 << CS01);       /* start timer by setting prescaler */
-
-    #undef HALF_BIT
-  }
-  /* else: ignore pin change to 1/high */
+  Serial_Timer();             /* process bits */
 }
 
 
 
+#ifdef SERIAL_RW
+
 /*
- *  ISR for match of Timer0's OCR0B (Output Compare Register B)
- *  - 9600 8N1
- *  - sample RX bits
- *  - can't be used when by some measurement/tool needs Timer0
- *  - puts received char into a buffer
- *  - collects full text line and manages the buffer
+ *  ISR for PCIn (Pin Change Interrupt n)
+ *  - SERIAL_BAUD 8N1
+ *  - for detecting start bit of RX
+ *  - starts bit sampling by scheduling the first bit
+ *  - can't be used when some measurement/tool needs Timer0
  */
 
-ISR(TIMER0_COMPB_vect, ISR_BLOCK)
+ISR(ISR_PINCHANGE, ISR_BLOCK)
 {
-  uint8_t           Bit;           /* bit flag */
-
   /*
    *  hints:
-   *  - the OCF0B interrupt flag is cleared automatically
+   *  - the PCIFn flag is cleared automatically
    *  - interrupt processing is disabled while this ISR runs
    *    (no nested interrupts)
    */
 
-  TCCR0B = 0;                 /* stop Timer0 */
-
-
-  /*
-   *  sample RX bit
-   *  - LSB first
-   */
-
-  Bit = SERIAL_PIN & (1 << SERIAL_RX);       /* get bit */
-  RX_Bits++;                                 /* got another bit */
-
-  if (RX_Bits == 1)           /* start bit */
-  {
-    /* start bit should be low */
-    if (Bit)                  /* high */
-    {
-      RX_Bits = 0;            /* end RX */
-    }
-  }
-  else if (RX_Bits == 10)     /* stop bit */
-  {
-    /* stop bit should be high */
-    if (Bit == 0)             /* low */
-    {
-      RX_Bits = 0;            /* end RX */
-    }
-  }
-  else                        /* data bit */
-  {
-    RX_Char >>= 1;                      /* shift right */
-    if (Bit) RX_Char |= 0b10000000;     /* set MSB */   
-  }
-
-
-  /*
-   *  manage buffer
-   */
+  if (Serial_Flags & SER_LOCKED) return;     /* Timer0 not available */
 
-  if (RX_Bits == 10)          /* got all bits */
+  /* check if RX pin has changed to 0/low (start bit) */
+  if (! (SERIAL_PIN & (1 << SERIAL_RX)))     /* low state */
   {
-    if (! (Cfg.OP_Control & OP_RX_LOCKED))   /* buffer unlocked */
-    {
-      if (RX_Char == '\r')              /* CR (carriage return) */
-      {
-        RX_Char = 0;                    /* terminate string */
-      }
-      else if (RX_Char == '\n')         /* NL (new line) */
-      {
-        RX_Char = 0;                    /* terminate string */
-        if (RX_Pos > 0)                 /* not an empty line */
-        {
-          Cfg.OP_Control |= OP_RX_LOCKED;    /* lock buffer for processing */
-        }
-      }
-      else if (RX_Pos == (RX_BUFFER_SIZE - 1))    /* no control char & overflow */
-      {
-        RX_Char = 0;                              /* terminate string */
-        /* lock buffer & signal overflow */
-        Cfg.OP_Control |= OP_RX_LOCKED | OP_RX_OVERFLOW;
-      }
-
-      RX_Buffer[RX_Pos] = RX_Char;      /* copy to buffer */
-
-      if (RX_Char > 0)                  /* no control char */
-      {
-        RX_Pos++;                       /* next char */
-      }
-    }
-    /* else: drop char */
-
-    RX_Bits = 0;              /* end RX */
-  }
-
+    PCICR &= ~(1 << BIT_PC_IRQ);        /* disable pin change interrupt */
 
-  /*
-   *  rearm pin-change interrupt for next char
-   */
+    /* reset variables for new char */
+    RX_Char = 0;
+    RX_Bits = 0;
 
-  if (RX_Bits == 0)      /* char done, no more bits expected */
-  {
-    TIMSK0 = 0;                    /* disable Timer0 interrupts */
-    PCIFR |= (1 << BIT_PC_FLAG);   /* clear pin change interrupt flag */
-    PCICR |= (1 << BIT_PC_IRQ);    /* enable pin change interrupt */
-  }
-  else                   /* more bits expected */
-  {
     /*
-     *  set up Timer0 for sampling next bit (data or stop)
-     *  - keep basic settings from RX pin change ISR 
-     *  - bit period of 9600bps = 104.1s
-     *  - fixed prescaler = 8 (<=16MHz) or 64 (>16MHz)
-     *    MCU clock [MHz]:    8    16    20
-     *    timer cycle [s]:   1    0.5   3.2
-     *    cycles for 104s:   104  208   32.5
+     *  sample start bit after 1/2 bit period
      *  - we don't need high precision, just good enough to sample 10 bits
-     *  - MCU_CYCLE_TIME in 0.1ns
-     *    timer cycles = (104s * 10000) / (MCU_CYCLE_TIME * prescaler)
-     *  - use a delay of 102s to compensate for the runtime of this ISR
      */
 
-    #if CPU_FREQ <= 16000000       /* <= 16MHz */
-      /* prescaler 8 */
-      #define FULL_BIT        1020000 / (MCU_CYCLE_TIME * 8)
-      #define PRESCALER       (1 << CS01)
-    #else                          /* > 16MHz */
-      /* prescaler 64 */
-      #define FULL_BIT        1020000 / (MCU_CYCLE_TIME * 64)
-      #define PRESCALER       (1 << CS01) | (1 << CS00)
-    #endif
-
-    TCNT0 = 0;                /* reset counter to 0 */
-    OCR0B = FULL_BIT;         /* set match value for bit period */
-    TCCR0B = PRESCALER;       /* start timer by setting prescaler */
-
-    #undef FULL_BIT
-    #undef PRESCALER
+    Serial_StartTimer();                      /* start Timer0 if required */
+    RX_Time = TCNT0 + (Serial_Ticks / 2);     /* middle of start bit */
+    Serial_Flags |= SER_RX_BUSY;              /* RX is running */
+    Serial_Timer();                           /* schedule */
   }
+  /* else: ignore pin change to 1/high */
 }
 
 #endif
@@ -478,20 +1022,27 @@ ISR(TIMER0_COMPB_vect, ISR_BLOCK)
 
 /*
  *  set up serial interface
- *  - 9600 8N1
+ *  - SERIAL_BAUD 8N1
  *  - TX & RX line
  */
 
 void Serial_Setup(void)
 {
   /*
-   *  asynchronous normal mode
+   *  asynchronous normal or double speed mode
    *  - prescaler = (f_MCU / (16 * bps)) - 1
-   *  - 2400bps, 8 data bits, no parity, 1 stop bit
+   *    or for double speed: (f_MCU / (8 * bps)) - 1
+   *  - prescaler and mode are selected by util/setbaud.h
+   *  - SERIAL_BAUD bps, 8 data bits, no parity, 1 stop bit
    *  - overrides normal port operation of Tx pin and Rx pin (if enabled)
    */
 
-  REG_UBRR = (CPU_FREQ / (16UL * 9600)) - 1;
+  REG_UBRR = UBRR_VALUE;
+  #if USE_2X
+    REG_UCSR_A = (1 << BIT_U2X);        /* double speed mode */
+  #else
+    REG_UCSR_A = 0;                     /* normal mode */
+  #endif
   REG_UCSR_C = (1 << BIT_UCSZ_1) | (1 << BIT_UCSZ_0);
 
   #ifdef SERIAL_RW
@@ -511,9 +1062,11 @@ void Serial_Setup(void)
 
 
 
+#ifndef SERIAL_TX_BUFFER
+
 /*
  *  send byte
- *  - 9600 8N1 (set by Serial_Setup())
+ *  - SERIAL_BAUD 8N1 (set by Serial_Setup())
  *
  *  requires:
  *  - Byte: byte to send
@@ -531,12 +1084,198 @@ void Serial_WriteByte(uint8_t Byte)
   REG_UDR = Byte;
 }
 
+#endif
+
+
+
+#ifdef SERIAL_TX_BUFFER
+
+/*
+ *  move next byte from TX buffer to USART
+ *  - for polling when interrupts are disabled
+ *  - TX buffer must not be empty
+ *  - a pending XON/XOFF is sent first
+ */
+
+void Serial_PollByte(void)
+{
+  uint8_t           Tail;          /* read position */
+
+  if (REG_UCSR_A & (1 << BIT_UDRE))     /* USART's data register is empty */
+  {
+    #ifdef SERIAL_RX_QUEUE
+    if (RX_State & RXQ_FLOW)            /* XON/XOFF pending */
+    {
+      REG_UCSR_A = (REG_UCSR_A & (1 << BIT_U2X)) | (1 << BIT_TXC);   /* clear TXC */
+      REG_UDR = Serial_FlowChar();      /* send XON/XOFF */
+      return;
+    }
+    #endif
+
+    Tail = TX_Tail;                     /* get read position */
+    REG_UCSR_A = (REG_UCSR_A & (1 << BIT_U2X)) | (1 << BIT_TXC);   /* clear TXC */
+    REG_UDR = TX_Buffer[Tail];          /* send byte */
+    TX_Tail = (Tail + 1) & TX_MASK;     /* next byte */
+  }
+}
+
+
+
+/*
+ *  send byte
+ *  - SERIAL_BAUD 8N1 (set by Serial_Setup())
+ *  - puts byte into TX buffer, the UDRE ISR sends it in the background
+ *  - waits if the buffer is full
+ *
+ *  requires:
+ *  - Byte: byte to send
+ */
+
+void Serial_WriteByte(uint8_t Byte)
+{
+  uint8_t           Head;          /* write position */
+  uint8_t           Flags;         /* status register */
+
+  Head = (TX_Head + 1) & TX_MASK;       /* next write position */
+
+  /* wait for free space in buffer */
+  while (Head == TX_Tail)
+  {
+    /* we have to send manually when interrupts are disabled */
+    if (! (SREG & (1 << SREG_I)))       /* interrupts disabled */
+    {
+      Serial_PollByte();                /* send next byte */
+    }
+  }
+
+  TX_Buffer[TX_Head] = Byte;            /* copy byte to buffer */
+  TX_Head = Head;                       /* update write position */
+
+  /* enable UDRE interrupt (ISR changes UCSRB also) */
+  Flags = SREG;                         /* save status */
+  cli();                                /* disable interrupts */
+  REG_UCSR_B |= (1 << BIT_UDRIE);       /* enable UDRE interrupt */
+  SREG = Flags;                         /* restore status */
+}
+
+
+
+/*
+ *  wait until all data is sent
+ *  - e.g. before powering off
+ */
+
+void Serial_Flush(void)
+{
+  uint16_t          n;             /* timeout counter */
+
+  /* wait for empty buffer */
+  while (TX_Head != TX_Tail)
+  {
+    /* we have to send manually when interrupts are disabled */
+    if (! (SREG & (1 << SREG_I)))       /* interrupts disabled */
+    {
+      Serial_PollByte();                /* send next byte */
+    }
+  }
+
+  /*
+   *  wait until USART has sent the last byte
+   *  - max. 20 bits (last byte in UDR plus byte in shift register)
+   *  - with a timeout, since TXC stays low when nothing has been sent
+   */
+
+  n = (uint16_t)(2000000UL / SERIAL_BAUD) + 1;  /* 20 bits in steps of 10s */
+  while (! (REG_UCSR_A & (1 << BIT_TXC)))     /* not complete yet */
+  {
+    if (n == 0) break;                  /* timeout */
+    wait10us();                         /* wait 10s */
+    n--;                                /* next round */
+  }
+}
+
+
+
+/*
+ *  ISR for UDREn (USART Data Register Empty n)
+ *  - sends pending XON/XOFF or next byte from TX buffer
+ *  - disables itself when buffer is empty
+ */
+
+ISR(ISR_USART_UDRE, ISR_BLOCK)
+{
+  uint8_t           Tail;          /* read position */
+
+  /*
+   *  hints:
+   *  - the UDREn flag is cleared by writing UDRn
+   *  - interrupt processing is disabled while this ISR runs
+   *    (no nested interrupts)
+   */
+
+  Tail = TX_Tail;                       /* get read position */
+
+  #ifdef SERIAL_RX_QUEUE
+  if (RX_State & RXQ_FLOW)              /* XON/XOFF pending */
+  {
+    REG_UCSR_A = (REG_UCSR_A & (1 << BIT_U2X)) | (1 << BIT_TXC);   /* clear TXC */
+    REG_UDR = Serial_FlowChar();        /* send XON/XOFF first */
+  }
+  else
+  #endif
+  if (Tail != TX_Head)                  /* buffer not empty */
+  {
+    REG_UCSR_A = (REG_UCSR_A & (1 << BIT_U2X)) | (1 << BIT_TXC);   /* clear TXC */
+    REG_UDR = TX_Buffer[Tail];          /* send byte */
+    Tail = (Tail + 1) & TX_MASK;        /* next byte */
+    TX_Tail = Tail;                     /* update read position */
+  }
+
+  if (Tail == TX_Head)                  /* buffer empty */
+  {
+    REG_UCSR_B &= ~(1 << BIT_UDRIE);    /* disable UDRE interrupt */
+  }
+}
+
+#endif
+
 
 
 #ifdef SERIAL_RW
 
+#ifdef SERIAL_RX_QUEUE
+
+/*
+ *  software flow control (XON/XOFF)
+ *  - sends XON/XOFF ahead of TX buffer if required
+ *
+ *  requires:
+ *  - Control: SER_RX_PAUSE (stop host) or SER_RX_RESUME (resume host)
+ */
+
+void Serial_Flow(uint8_t Control)
+{
+  uint8_t           Flags;         /* status register */
+
+  Flags = SREG;                         /* save status */
+  cli();                                /* disable interrupts */
+
+  if (Serial_UpdateFlow(Control))       /* XON/XOFF pending */
+  {
+    REG_UCSR_B |= (1 << BIT_UDRIE);     /* enable UDRE interrupt */
+  }
+
+  SREG = Flags;                         /* restore status */
+}
+
+#endif
+
+
+
 /*
  *  control serial interface
+ *  - with RX queue XOFF stops the host before RX is paused, the USART
+ *    keeps up to two chars still in flight, further chars are lost
  *
  *  requires:
  *  - Control: control flag/switch
@@ -549,13 +1288,17 @@ void Serial_Ctrl(uint8_t Control)
   switch (Control)
   {
     case SER_RX_PAUSE:        /* pause RX */
-      /* todo: send XOFF? */
+      #ifdef SERIAL_RX_QUEUE
+      Serial_Flow(SER_RX_PAUSE);             /* stop host */
+      #endif
       REG_UCSR_B &= ~(1 << BIT_RXCIE);       /* disable RXC interrupt */
       break;
 
     case SER_RX_RESUME:       /* resume RX */
       REG_UCSR_B |= (1 << BIT_RXCIE);        /* enable RXC interrupt */
-      /* todo: send XON? */
+      #ifdef SERIAL_RX_QUEUE
+      Serial_Flow(SER_RX_RESUME);            /* resume host */
+      #endif
       break;
   }
 }
@@ -564,7 +1307,7 @@ void Serial_Ctrl(uint8_t Control)
 
 /*
  *  ISR for RXCn (Receive Complete n)
- *  - 9600 8N1 (set by Serial_Setup())
+ *  - SERIAL_BAUD 8N1 (set by Serial_Setup())
  *  - retrieves received character and puts it into a buffer
  *  - collects full text line and manages the buffer
  */
@@ -586,6 +1329,9 @@ ISR(ISR_USART_RX, ISR_BLOCK)
 
   Char = REG_UDR;                       /* get received char & clear flag */
 
+  #ifdef SERIAL_RX_QUEUE
+  Serial_StoreChar(Char);               /* put char into queue */
+  #else
   if (! (Cfg.OP_Control & OP_RX_LOCKED))     /* buffer unlocked */
   {
     if (Char == '\r')                   /* CR (carriage return) */
@@ -615,6 +1361,7 @@ ISR(ISR_USART_RX, ISR_BLOCK)
     }
   }
   /* else: drop char, otherwise it would block the firmware */
+  #endif
 }
 
 #endif
@@ -700,6 +1447,66 @@ void Serial_NewLine(void)
  * ************************************************************************ */
 
 
+#ifdef SERIAL_RX_QUEUE
+
+/*
+ *  get next line from RX queue
+ *  - copies line to RX_Buffer
+ *  - clears OP_RX_LOCKED when the queue has no more lines
+ *  - resumes host (XON) when there's enough space again
+ *
+ *  returns:
+ *  - OP_RX_LOCKED if a line was copied
+ *    plus OP_RX_OVERFLOW if the line had an overflow
+ *  - 0 if there's no line
+ */
+
+uint8_t Serial_GetLine(void)
+{
+  uint8_t           State = 0;     /* return value */
+  uint8_t           Flags;         /* status register */
+  uint8_t           Tail;          /* read position */
+  uint8_t           n = 0;         /* counter */
+  char              Char;          /* character */
+
+  if (RX_Lines == 0) return State;      /* no line */
+
+  /* copy line (ISR doesn't touch complete lines) */
+  Tail = RX_Tail;                       /* get read position */
+  do
+  {
+    Char = RX_Queue[Tail];              /* get char */
+    RX_Buffer[n] = Char;                /* copy char */
+    Tail = (Tail + 1) & RX_MASK;        /* next char */
+    n++;
+  } while (Char != 0);
+
+  State = OP_RX_LOCKED;                 /* got line */
+  if (RX_Buffer[0] == CHAR_CAN)         /* overflow marker */
+  {
+    RX_Buffer[0] = 0;                   /* clear line */
+    State |= OP_RX_OVERFLOW;            /* signal overflow */
+  }
+
+  /* free line */
+  Flags = SREG;                         /* save status */
+  cli();                                /* disable interrupts */
+  RX_Tail = Tail;                       /* update read position */
+  RX_Lines--;                           /* one line less */
+  if (RX_Lines == 0)                    /* queue empty */
+  {
+    Cfg.OP_Control &= ~OP_RX_LOCKED;    /* no more lines */
+  }
+  SREG = Flags;                         /* restore status */
+
+  Serial_Flow(SER_RX_RESUME);           /* resume host if possible */
+
+  return State;
+}
+
+#endif
+
+
 
 /* ************************************************************************
  *   clean-up of local constants
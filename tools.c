@@ -33,6 +33,51 @@
 
 
 
+/*
+ *  local constants
+ */
+
+/* frequency counter: measurement state */
+#define RECIP_OFF                 0     /* gated measurement */
+#define FREQ_CONT                 1     /* continuous measurement */
+#define RECIP_WAIT                2     /* wait for first edge */
+#define RECIP_RUN                 3     /* timestamp edges */
+
+/* continuous frequency counter: 100ms ticks (Timer1 prescaler 64) */
+#define CONT_TOP       ((100000UL * MCU_CYCLES_PER_US / 64) - 1)
+
+/* reciprocal frequency counter */
+#define RECIP_GATE     (100000UL * MCU_CYCLES_PER_US / 65536)    /* 100ms */
+#define RECIP_TIMEOUT  (3000000UL * MCU_CYCLES_PER_US / 65536)   /* 3s */
+#define RECIP_MAX_FREQ        10000     /* upper limit: 10kHz */
+#define RECIP_MIN_FREQ        9000      /* back to reciprocal below 9kHz */
+
+/* extended frequency counter: prescaler range (with hysteresis) */
+#define DIV_MIN_FREQ          900000    /* prescaler 1:1 below 900kHz */
+#define DIV_MAX_FREQ          1000000   /* prescaler on above 1MHz */
+
+/* event counter: Timer1 clock (prescaler 256) and 200ms ticks */
+#define EVENT_CLOCK    (CPU_FREQ / 256)
+#define EVENT_TICK     (EVENT_CLOCK / 5)
+
+/* extended event counter: timestamp state */
+#define EVENT_OFF                 0     /* no timestamps */
+#define EVENT_WAIT                1     /* wait for first event */
+#define EVENT_RUN                 2     /* timestamp events */
+
+/* DDS signal generator: state */
+#define DDS_OFF                   0     /* not running */
+#define DDS_RUN                   1     /* running */
+
+/* extended event counter: events per count */
+#ifdef EVENT_COUNTER_PRESCALER
+  #define EVENT_DIV    FREQ_COUNTER_PRESCALER
+#else
+  #define EVENT_DIV    1
+#endif
+
+
+
 /*
  *  local variables
  */
@@ -44,10 +89,54 @@
   volatile uint16_t      Pulses;        /* number of pulses */
 #endif
 
+/* reciprocal frequency counter */
+#ifdef HW_FREQ_COUNTER
+volatile uint8_t         FreqState = RECIP_OFF;   /* measurement state */
+volatile uint8_t         FreqEdges;     /* signal periods per timestamp */
+volatile uint16_t        T1_Overflows;  /* Timer1 overflows */
+volatile uint32_t        FirstEdge;     /* timestamp of first edge */
+volatile uint32_t        LastEdge;      /* timestamp of last edge */
+#endif
+
+/* continuous frequency counter */
+#ifdef HW_FREQ_COUNTER_EXT
+uint32_t                 *FreqRing;     /* pulses per tick (FrequencyCounter) */
+volatile uint32_t        FreqLast;      /* pulse counter at last tick */
+volatile uint8_t         FreqSlot;      /* next slot in ring */
+volatile uint8_t         FreqFilled;    /* number of valid slots */
+volatile uint8_t         FreqTick;      /* tick counter */
+#endif
+
 /* time counter */
 #ifdef HW_EVENT_COUNTER
 volatile uint8_t         TimeTicks;     /* tick counter */
-volatile uint16_t        TimeCounter;   /* time counter */
+#endif
+#ifdef EVENT_COUNTER_EXT
+  volatile uint32_t      TimeCounter;   /* time counter */
+#elif defined (HW_EVENT_COUNTER)
+  volatile uint16_t      TimeCounter;   /* time counter */
+#endif
+
+/* extended event counter */
+#ifdef EVENT_COUNTER_EXT
+volatile uint8_t         EventState = EVENT_OFF;  /* timestamp state */
+volatile uint8_t         EventEdges;    /* events per timestamp */
+volatile uint8_t         EventBase;     /* events of current Timer0 cycle */
+volatile uint64_t        EventPulses;   /* events of past Timer0 cycles */
+volatile uint64_t        LastEvents;    /* events at last timestamp */
+volatile uint32_t        FirstSec;      /* first event: seconds */
+volatile uint32_t        FirstFrac;     /* first event: Timer1 cycles */
+volatile uint32_t        LastSec;       /* last event: seconds */
+volatile uint32_t        LastFrac;      /* last event: Timer1 cycles */
+#endif
+
+/* DDS signal generator */
+#ifdef SW_DDS
+volatile uint8_t         DDS_State = DDS_OFF;     /* state */
+volatile uint16_t        DDS_Top;       /* top value (integer part of period) */
+volatile uint32_t        DDS_Frac;      /* fractional part of period */
+uint32_t                 DDS_Phase;     /* phase accumulator (ISR) */
+uint8_t                  DDS_Bitmask;   /* prescaler bitmask */
 #endif
 
 /* sweep function for servo tester */
@@ -108,6 +197,56 @@ void ProbePinout(uint8_t Mode)
 
 
 
+#if defined (SW_DDS) || defined (EVENT_COUNTER_EXT) || defined (SW_DS18B20)
+
+/*
+ *  divide 64 bit value by 32 bit value
+ *  - shift and subtract with a 32 bit remainder
+ *  - avoids 64 bit division of libgcc (__udivdi3)
+ *
+ *  requires:
+ *  - Value: pointer to dividend (replaced by quotient)
+ *  - Divisor: divisor (not 0)
+ *
+ *  returns:
+ *  - remainder
+ */
+
+uint32_t Div64_32(uint64_t *Value, uint32_t Divisor)
+{
+  uint8_t           n = 64;        /* bit counter */
+  uint8_t           Carry;         /* bit #32 of remainder */
+  uint32_t          Rest = 0;      /* remainder */
+  uint64_t          Temp;          /* dividend/quotient */
+
+  Temp = *Value;
+
+  while (n > 0)
+  {
+    /* shift next bit of dividend into remainder */
+    Carry = (uint8_t)(Rest >> 31);
+    Rest <<= 1;
+    if (Temp & 0x8000000000000000ULL) Rest |= 1;
+
+    /* quotient fills up from the right */
+    Temp <<= 1;
+    if (Carry || (Rest >= Divisor))
+    {
+      Rest -= Divisor;
+      Temp |= 1;
+    }
+
+    n--;
+  }
+
+  *Value = Temp;
+  return Rest;
+}
+
+#endif
+
+
+
 /* ************************************************************************
  *   PWM
  * ************************************************************************ */
@@ -1502,165 +1641,582 @@ void SquareWave_SignalGenerator(void)
 
 
 /* ************************************************************************
- *   ESR tool
+ *   DDS signal generator
  * ************************************************************************ */
 
 
-#if defined (SW_ESR) || defined (SW_OLD_ESR)
+#ifdef SW_DDS
 
 /*
- *  ESR tool
- *  - uses probe #1 (pos) and probe #3 (neg) 
+ *  set up output and Timer1 for DDS signal generator
+ *  - uses probe #2 (OC1B) as output
+ *    and probe #1 & probe #3 as ground
+ *  - alternative: dedicated signal output via OC1B
+ *  - frequency has to be set by DDS_Set()
  */
 
-void ESR_Tool(void)
+void DDS_Start(void)
 {
-  uint8_t           Run = 1;       /* control flag */
-  uint8_t           Test;          /* temp. value */
-  Capacitor_Type    *Cap;          /* pointer to cap */
-  uint16_t          ESR;           /* ESR (in 0.01 Ohms) */
-
-  Check.Diodes = 0;                /* disable diode check in cap measurement */
-  Cap = &Caps[0];                  /* pointer to first cap */
+  #ifndef HW_FIXED_SIGNAL_OUTPUT
+  /* probes 1 and 3 are signal ground, probe 2 is signal output */
+  ADC_PORT = 0;                         /* pull down directly: */
+  ADC_DDR = (1 << TP1) | (1 << TP3);    /* probe 1 & 3 */
+  R_DDR = (1 << R_RL_2);                /* enable Rl for probe 2 */
+  R_PORT = 0;                           /* pull down probe 2 initially */
+  #endif
 
-  #ifdef HW_DISCHARGE_RELAY
-  ADC_DDR = (1 << TP_REF);         /* short circuit probes */
+  #ifdef HW_FIXED_SIGNAL_OUTPUT
+  /* dedicated output via OC1B */
+  SIGNAL_PORT &= ~(1 << SIGNAL_OUT);    /* low by default */
+  SIGNAL_DDR |= (1 << SIGNAL_OUT);      /* enable output */
   #endif
 
-  /* show tool info */
-  LCD_Clear();
-  Display_EEString(ESR_str);       /* display: ESR */
-  ProbePinout(PROBES_ESR);         /* show probes used */
-  Display_Char('-');               /* display "no value" */
+  /*
+   *  set up Timer1 like the squarewave generator
+   *  - fast PWM mode 
+   *  - top value by OCR1A
+   *  - OC1B non-inverted output
+   */
 
-  while (Run > 0)
+  TCCR1B = 0;                      /* stop timer */
+  TIMSK1 = 0;                      /* disable interrupts */
+  TCCR1A = (1 << WGM11) | (1 << WGM10) | (1 << COM1B1) | (1 << COM1B0);
+  TCCR1B = (1 << WGM13) | (1 << WGM12);
+
+  DDS_Bitmask = 0;                 /* timer not running yet */
+  DDS_Phase = 0;                   /* reset phase accumulator */
+  DDS_State = DDS_RUN;             /* enable ISR processing */
+}
+
+
+
+/*
+ *  set frequency of DDS signal generator
+ *  - period in timer cycles: f_MCU / (prescaler * f)
+ *  - the integer part of the period sets the top value and the
+ *    fractional part is added to a 32 bit phase accumulator by the
+ *    OCR1A match ISR, a carry extends the next period by one timer cycle
+ *  - the smallest possible prescaler is used for the best resolution
+ *  - keeps the phase when the prescaler doesn't change (sweeps)
+ *
+ *  requires:
+ *  - Freq: frequency in mHz (DDS_MIN_FREQ up to DDS_MAX_FREQ)
+ */
+
+void DDS_Set(uint32_t Freq)
+{
+  uint8_t           Index = 0;          /* prescaler table index */
+  uint8_t           Bitmask;            /* prescaler bitmask */
+  uint16_t          Top;                /* top value */
+  uint32_t          Frac;               /* fractional part of period */
+  uint32_t          Div;                /* prescaler * frequency */
+  uint32_t          Rest;               /* remainder of period */
+  uint64_t          Period;             /* period / fractional part */
+
+  /*
+   *  get smallest prescaler for a period of max. 2^16 - 1 timer cycles
+   *  - divisor stays below 2^27 (DDS_MAX_FREQ with prescaler 1 at most)
+   */
+
+  while (1)
   {
-    /*
-     *  short or long key press -> measure
-     *  two short key presses -> exit tool
-     */
+    Div = eeprom_read_word(&T1_Prescaler_table[Index]);
+    Div *= Freq;
+    Period = CPU_FREQ * 1000ULL;
+    Rest = Div64_32(&Period, Div);
 
-    /* wait for user feedback */
-    Test = TestKey(0, CURSOR_BLINK | CHECK_KEY_TWICE | CHECK_BAT);
+    if ((Period <= 0xFFFF) || (Index >= (NUM_TIMER1 - 1))) break;
+    Index++;                       /* next prescaler */
+  }
 
-    if (Test == KEY_TWICE)              /* two short key presses */
-    {
-      Run = 0;                          /* end loop */
-    }
+  Bitmask = eeprom_read_byte(&T1_Bitmask_table[Index]);
+  Top = (uint16_t)Period - 1;
 
-    /* measure cap */
-    if (Run > 0)                        /* key pressed */
-    {
-      #ifdef HW_DISCHARGE_RELAY
-      ADC_DDR = 0;                      /* remove short circuit */
-      #endif
+  /* fractional part: remainder / divisor * 2^32 */
+  Period = (uint64_t)Rest << 32;
+  Div64_32(&Period, Div);
+  Frac = (uint32_t)Period;
 
-      LCD_ClearLine2();                 /* update line #2 */
-      Display_EEString(Probing_str);    /* display: probing... */
-      MeasureCap(PROBE_1, PROBE_3, 0);  /* probe-1 = Vcc, probe-3 = Gnd */
-      LCD_ClearLine2();                 /* update line #2 */
-      
-      if (Check.Found == COMP_CAPACITOR)     /* found capacitor */
-      {
-        /* show capacitance */
-        Display_Value(Cap->Value, Cap->Scale, 'F');
+  /* update values (ISR accesses 16 bit registers too) */
+  cli();                           /* disable interrupts */
+  DDS_Top = Top;
+  DDS_Frac = Frac;
+  OCR1B = Top / 2;                 /* 50% duty cycle */
+  OCR1A = Top;                     /* top value for frequency */
+  sei();                           /* enable interrupts */
 
-        /* show ESR */
-        Display_Space();
-        ESR = MeasureESR(Cap);
-        if (ESR < UINT16_MAX)           /* got valid ESR */
-        {
-          Display_Value(ESR, -2, LCD_CHAR_OMEGA);
-        }
-        else                            /* no ESR */
-        {
-          Display_Char('-');
-        }
-      }
-      else                                   /* no capacitor */
-      {
-        Display_Char('-');
-      }
+  if (Bitmask != DDS_Bitmask)      /* prescaler has changed */
+  {
+    TCCR1B = (1 << WGM13) | (1 << WGM12);    /* stop timer */
+    TCNT1 = 0;                               /* reset counter */
+    TCCR1B = (1 << WGM13) | (1 << WGM12) | Bitmask;    /* (re)start timer */
+    DDS_Bitmask = Bitmask;
+  }
 
-      #ifdef HW_DISCHARGE_RELAY
-      ADC_DDR = (1 << TP_REF);          /* short circuit probes */
-      #endif
+  /* ISR is needed just for a fractional part */
+  if (Frac)                        /* fractional part */
+  {
+    if (! (TIMSK1 & (1 << OCIE1A)))     /* ISR not enabled yet */
+    {
+      TIFR1 = (1 << OCF1A);             /* clear flag */
+      TIMSK1 = (1 << OCIE1A);           /* enable output compare A match interrupt */
     }
   }
-
-  #ifdef HW_DISCHARGE_RELAY
-  ADC_DDR = 0;                     /* remove short circuit */
-  #endif
+  else                             /* exact period */
+  {
+    TIMSK1 = 0;                         /* disable interrupt */
+  }
 }
 
-#endif
 
 
+/*
+ *  stop DDS signal generator and reset output
+ */
+
+void DDS_Stop(void)
+{
+  TCCR1B = 0;                 /* disable timer */
+  TIMSK1 = 0;                 /* disable interrupts */
+  TCCR1A = 0;                 /* reset flags (also frees PB2) */
+  DDS_State = DDS_OFF;        /* no ISR processing */
+
+  #ifndef HW_FIXED_SIGNAL_OUTPUT
+  R_DDR = 0;                  /* set HiZ mode */
+  ADC_DDR = 0;
+  #endif
 
-/* ************************************************************************
- *   Zener tool
- * ************************************************************************ */
+  #ifdef HW_FIXED_SIGNAL_OUTPUT
+  SIGNAL_DDR &= ~(1 << SIGNAL_OUT);     /* set HiZ mode */
+  #endif
+}
 
 
-#ifdef HW_ZENER
+
+#ifdef HW_KEYS
 
 /*
- *  Zener tool:
- *  - Zener diode voltage measurement hardware option
- *  - uses dedicated analog input (TP_ZENER) with 10:1 voltage divider
- *  - test push button enables boost converter
+ *  DDS signal generator
+ *  - squarewave with fixed frequency or linear frequency sweep
+ *  - settings: start frequency (fixed frequency), stop frequency,
+ *    step size and dwell time
+ *  - output: see DDS_Start()
+ *  - requires additional keys (e.g. rotary encoder) and
+ *    display with more than 5 lines (checked by main menu)
+ *  - requires idle sleep mode to keep timer running when MCU is sleeping
  */
 
-void Zener_Tool(void)
+void DDS_SignalGenerator(void)
 {
-  uint8_t                Run = 1;            /* control flag */
-  uint8_t                Counter;            /* length of key press */
-  uint8_t                Counter2 = 0;       /* time between two key presses */
-  uint16_t               Value;              /* current value */
-  uint16_t               Min = UINT16_MAX;   /* minimal value */
+  uint8_t           Flag;               /* loop control flag */
+  uint8_t           Test;               /* user feedback */
+  uint8_t           Item;               /* UI item */
+  uint8_t           n;                  /* counter */
+  uint8_t           Temp;               /* temp. value */
+  uint16_t          Timeout;            /* key timeout */
+  uint32_t          Freq;               /* current frequency (mHz) */
+  uint32_t          Step;               /* step size */
+  uint32_t          Min;                /* lower limit */
+  uint32_t          Max;                /* upper limit */
+  uint32_t          Value[4];           /* settings */
 
-  /* show info */
+  /* control flags */
+  #define RUN_FLAG            0b00000001     /* run flag */
+  #define SWEEP_FLAG          0b00000010     /* sweep is running */
+  #define UPDATE_FREQ         0b00000100     /* update frequency */
+  #define SHOW_ITEMS          0b00001000     /* show settings */
+
+  /* UI items (index of settings + 1) */
+  #define UI_START            1         /* start/fixed frequency */
+  #define UI_STOP             2         /* stop frequency */
+  #define UI_STEP             3         /* step size */
+  #define UI_DWELL            4         /* dwell time */
+
+  /* defaults */
+  #define DEFAULT_START       1000000   /* 1kHz */
+  #define DEFAULT_STOP        10000000  /* 10kHz */
+  #define DEFAULT_STEP        100000    /* 100Hz */
+  #define DEFAULT_DWELL       100       /* 100ms */
+
+  ShortCircuit(0);                      /* make sure probes are not shorted */
   LCD_Clear();
-  Display_EEString(Zener_str);     /* display: Zener */
-  Display_NextLine();
-  Display_Char('-');               /* display "no value" */
+  Display_EEString_Space(DDS_str);      /* display: DDS Generator */
+  #ifndef HW_FIXED_SIGNAL_OUTPUT
+  ProbePinout(PROBES_PWM);              /* show probes used */
+  #endif
 
-  while (Run > 0)             /* processing loop */
+  DDS_Start();                          /* set up output and timer */
+
+  /* set start values */
+  Value[UI_START - 1] = DEFAULT_START;
+  Value[UI_STOP - 1] = DEFAULT_STOP;
+  Value[UI_STEP - 1] = DEFAULT_STEP;
+  Value[UI_DWELL - 1] = DEFAULT_DWELL;
+  Freq = DEFAULT_START;
+  Item = UI_START;                      /* select start item */
+  Flag = RUN_FLAG | UPDATE_FREQ | SHOW_ITEMS;
+
+
+  /*
+   *  processing loop
+   */
+
+  while (Flag & RUN_FLAG)
   {
-    Counter = 0;              /* reset key press time */
-    MilliSleep(30);           /* delay by 30ms */
-    Counter2++;               /* increase delay time counter */
-    if (Counter2 > 200)       /* prevent overflow & timer (about 6s) */
+    /*
+     *  set and display frequency
+     */
+
+    if (Flag & UPDATE_FREQ)
     {
-      Counter2 = 10;          /* reset counter (above delay for quick key presses) */
-      #ifndef BAT_NONE
-      CheckBattery();         /* and check battery */
-      #endif
+      DDS_Set(Freq);                    /* set frequency */
+
+      /* display frequency (in line #2) */
+      LCD_ClearLine2();
+      Display_FullValue(Freq, 3, 0);
+      Display_EEString(Hertz_str);      /* display: Hz */
+
+      Flag &= ~UPDATE_FREQ;             /* clear flag */
     }
 
+
     /*
-     *  key press triggers measurement
-     *  - also enables boost converter via hardware
-     *  - two short key presses exit tool
+     *  display settings (in lines #3 to #6)
      */
 
-    while (!(BUTTON_PIN & (1 << TEST_BUTTON)))    /* as long as key is pressed */
+    if (Flag & SHOW_ITEMS)
     {
-      /* get voltage (10:1 voltage divider) */
-      Value = ReadU(TP_ZENER);     /* special probe pin */
-      Value /= 10;                 /* scale to 0.1V */
-
-      /* display voltage */
-      if (Counter % 8 == 0)        /* every 8 loop runs (240ms) */
+      n = UI_START;
+      while (n <= UI_DWELL)             /* loop through items */
       {
-        LCD_ClearLine2();        
-        Display_Value(Value, -1, 'V');
-      }
+        LCD_ClearLine(n + 2);
+        LCD_CharPos(1, n + 2);
+        MarkItem(n, Item);              /* mark item if selected */
 
-      /* data hold */
-      if (Counter == 0)            /* first loop run */
-      {
-        Min = UINT16_MAX;          /* reset to default */
+        if (n == UI_DWELL)              /* dwell time */
+        {
+          Display_Char('t');            /* display: t */
+          Display_Space();
+          Display_FullValue(Value[n - 1], 0, 'm');
+          Display_Char('s');            /* display: ms */
+        }
+        else                            /* frequency */
+        {
+          if (n == UI_STEP)             /* step size */
+          {
+            Display_Char('d');          /* display: df */
+            Display_Char('f');
+          }
+          else                          /* start/stop frequency */
+          {
+            Display_Char('f');          /* display: f1/f2 */
+            Display_Char('0' + n);
+          }
+          Display_Space();
+          Display_FullValue(Value[n - 1], 3, 0);
+          Display_EEString(Hertz_str);  /* display: Hz */
+        }
+
+        n++;                            /* next item */
+      }
+
+      Flag &= ~SHOW_ITEMS;              /* clear flag */
+    }
+
+
+    /*
+     *  user feedback
+     *  - timeout for sweep steps
+     */
+
+    Timeout = 0;                        /* no timeout */
+    if (Flag & SWEEP_FLAG) Timeout = Value[UI_DWELL - 1];
+
+    Test = TestKey(Timeout, CHECK_KEY_TWICE | CHECK_BAT);
+
+    if (Test == KEY_TIMEOUT)            /* next sweep step */
+    {
+      Step = Value[UI_STEP - 1];
+
+      if (Value[UI_STOP - 1] >= Value[UI_START - 1])     /* upwards */
+      {
+        Freq += Step;
+        /* restart sweep when passing stop frequency */
+        if (Freq > Value[UI_STOP - 1]) Freq = Value[UI_START - 1];
+      }
+      else                                               /* downwards */
+      {
+        /* restart sweep when passing stop frequency */
+        if (Freq < (Value[UI_STOP - 1] + Step)) Freq = Value[UI_START - 1];
+        else Freq -= Step;
+      }
+
+      Flag |= UPDATE_FREQ;
+    }
+    else if (Test == KEY_SHORT)         /* short key press */
+    {
+      /* select next item */
+      Item++;
+      if (Item > UI_DWELL) Item = UI_START;
+
+      Flag |= SHOW_ITEMS;
+    }
+    else if (Test == KEY_LONG)          /* long key press */
+    {
+      /* start/stop sweep */
+      Flag ^= SWEEP_FLAG;               /* toggle sweep */
+      Freq = Value[UI_START - 1];       /* start frequency */
+
+      Flag |= UPDATE_FREQ;
+    }
+    else if (Test == KEY_TWICE)         /* two short key presses */
+    {
+      Flag = 0;                         /* end loop */
+    }
+    else if ((Test == KEY_RIGHT) || (Test == KEY_LEFT))
+    {
+      n = Item - 1;                     /* index of setting */
+
+      /* limits and step size (0.01% of value) */
+      Min = DDS_MIN_FREQ;
+      Max = DDS_MAX_FREQ;
+      Step = Value[n] / 10000;
+      if (Item == UI_STEP)              /* step size */
+      {
+        Min = 1;                        /* 1mHz */
+      }
+      else if (Item == UI_DWELL)        /* dwell time */
+      {
+        Min = 10;                       /* 10ms */
+        Max = 60000;                    /* 60s */
+        Step = Value[n] / 100;          /* 1% of value */
+      }
+      if (Step == 0) Step = 1;
+
+      /* consider rotary encoder's turning velocity (1-7) */
+      Temp = UI.KeyStep;                /* get velocity */
+      if (Temp > 1)                     /* larger step */
+      {
+        /* step^4: 16 81 256 625 1296 2401 */
+        Temp *= Temp;                   /* ^2 */
+        Step *= Temp;
+        Step *= Temp;                   /* ^2 */
+      }
+
+      if (Test == KEY_RIGHT)            /* increase value */
+      {
+        Value[n] += Step;
+        if (Value[n] > Max) Value[n] = Max;
+      }
+      else                              /* decrease value */
+      {
+        if (Value[n] < (Min + Step)) Value[n] = Min;
+        else Value[n] -= Step;
+      }
+
+      /* fixed frequency follows start frequency */
+      if ((Item == UI_START) && (! (Flag & SWEEP_FLAG)))
+      {
+        Freq = Value[n];
+        Flag |= UPDATE_FREQ;
+      }
+
+      Flag |= SHOW_ITEMS;
+    }
+  }
+
+
+  /*
+   *  clean up
+   */
+
+  DDS_Stop();                      /* stop generator */
+
+  /* local constants */
+  #undef RUN_FLAG
+  #undef SWEEP_FLAG
+  #undef UPDATE_FREQ
+  #undef SHOW_ITEMS
+
+  #undef UI_START
+  #undef UI_STOP
+  #undef UI_STEP
+  #undef UI_DWELL
+
+  #undef DEFAULT_START
+  #undef DEFAULT_STOP
+  #undef DEFAULT_STEP
+  #undef DEFAULT_DWELL
+}
+
+#endif
+
+#endif
+
+
+
+/* ************************************************************************
+ *   ESR tool
+ * ************************************************************************ */
+
+
+#if defined (SW_ESR) || defined (SW_OLD_ESR)
+
+/*
+ *  ESR tool
+ *  - uses probe #1 (pos) and probe #3 (neg) 
+ */
+
+void ESR_Tool(void)
+{
+  uint8_t           Run = 1;       /* control flag */
+  uint8_t           Test;          /* temp. value */
+  Capacitor_Type    *Cap;          /* pointer to cap */
+  uint16_t          ESR;           /* ESR (in 0.01 Ohms) */
+
+  Check.Diodes = 0;                /* disable diode check in cap measurement */
+  Cap = &Caps[0];                  /* pointer to first cap */
+
+  #ifdef HW_DISCHARGE_RELAY
+  ADC_DDR = (1 << TP_REF);         /* short circuit probes */
+  #endif
+
+  /* show tool info */
+  LCD_Clear();
+  Display_EEString(ESR_str);       /* display: ESR */
+  ProbePinout(PROBES_ESR);         /* show probes used */
+  Display_Char('-');               /* display "no value" */
+
+  while (Run > 0)
+  {
+    /*
+     *  short or long key press -> measure
+     *  two short key presses -> exit tool
+     */
+
+    /* wait for user feedback */
+    Test = TestKey(0, CURSOR_BLINK | CHECK_KEY_TWICE | CHECK_BAT);
+
+    if (Test == KEY_TWICE)              /* two short key presses */
+    {
+      Run = 0;                          /* end loop */
+    }
+
+    /* measure cap */
+    if (Run > 0)                        /* key pressed */
+    {
+      #ifdef HW_DISCHARGE_RELAY
+      ADC_DDR = 0;                      /* remove short circuit */
+      #endif
+
+      LCD_ClearLine2();                 /* update line #2 */
+      Display_EEString(Probing_str);    /* display: probing... */
+      MeasureCap(PROBE_1, PROBE_3, 0);  /* probe-1 = Vcc, probe-3 = Gnd */
+      LCD_ClearLine2();                 /* update line #2 */
+      
+      if (Check.Found == COMP_CAPACITOR)     /* found capacitor */
+      {
+        /* show capacitance */
+        Display_Value(Cap->Value, Cap->Scale, 'F');
+
+        /* show ESR */
+        Display_Space();
+        Clock_Hold();                   /* keep clock's ISR out of ESR */
+        ESR = MeasureESR(Cap);
+        Clock_Release();                /* catch up clock */
+        if (ESR < UINT16_MAX)           /* got valid ESR */
+        {
+          Display_Value(ESR, -2, LCD_CHAR_OMEGA);
+        }
+        else                            /* no ESR */
+        {
+          Display_Char('-');
+        }
+      }
+      else                                   /* no capacitor */
+      {
+        Display_Char('-');
+      }
+
+      #ifdef HW_DISCHARGE_RELAY
+      ADC_DDR = (1 << TP_REF);          /* short circuit probes */
+      #endif
+    }
+  }
+
+  #ifdef HW_DISCHARGE_RELAY
+  ADC_DDR = 0;                     /* remove short circuit */
+  #endif
+}
+
+#endif
+
+
+
+/* ************************************************************************
+ *   Zener tool
+ * ************************************************************************ */
+
+
+#ifdef HW_ZENER
+
+/*
+ *  Zener tool:
+ *  - Zener diode voltage measurement hardware option
+ *  - uses dedicated analog input (TP_ZENER) with 10:1 voltage divider
+ *  - test push button enables boost converter
+ */
+
+void Zener_Tool(void)
+{
+  uint8_t                Run = 1;            /* control flag */
+  uint8_t                Counter;            /* length of key press */
+  uint8_t                Counter2 = 0;       /* time between two key presses */
+  uint16_t               Value;              /* current value */
+  uint16_t               Min = UINT16_MAX;   /* minimal value */
+
+  /* show info */
+  LCD_Clear();
+  Display_EEString(Zener_str);     /* display: Zener */
+  Display_NextLine();
+  Display_Char('-');               /* display "no value" */
+
+  while (Run > 0)             /* processing loop */
+  {
+    Counter = 0;              /* reset key press time */
+    MilliSleep(30);           /* delay by 30ms */
+    Counter2++;               /* increase delay time counter */
+    if (Counter2 > 200)       /* prevent overflow & timer (about 6s) */
+    {
+      Counter2 = 10;          /* reset counter (above delay for quick key presses) */
+      #ifndef BAT_NONE
+      CheckBattery();         /* and check battery */
+      #endif
+    }
+
+    /*
+     *  key press triggers measurement
+     *  - also enables boost converter via hardware
+     *  - two short key presses exit tool
+     */
+
+    while (!(BUTTON_PIN & (1 << TEST_BUTTON)))    /* as long as key is pressed */
+    {
+      /* get voltage (10:1 voltage divider) */
+      Value = ReadU(TP_ZENER);     /* special probe pin */
+      Value /= 10;                 /* scale to 0.1V */
+
+      /* display voltage */
+      if (Counter % 8 == 0)        /* every 8 loop runs (240ms) */
+      {
+        LCD_ClearLine2();        
+        Display_Value(Value, -1, 'V');
+      }
+
+      /* data hold */
+      if (Counter == 0)            /* first loop run */
+      {
+        Min = UINT16_MAX;          /* reset to default */
       }
       else if (Counter >= 10)      /* ensure stable voltage */
       {
@@ -1743,6 +2299,17 @@ void Zener_Tool(void)
 
 ISR(TIMER0_OVF_vect, ISR_BLOCK)
 {
+  #ifdef HW_FREQ_COUNTER
+  uint16_t          Ticks;         /* Timer1 counter */
+  uint16_t          Overflows;     /* Timer1 overflows */
+  #endif
+  #ifdef EVENT_COUNTER_EXT
+  uint8_t           Count;         /* Timer0 counter */
+  uint8_t           Tick;          /* tick counter */
+  uint32_t          Seconds;       /* time counter */
+  uint32_t          Frac;          /* Timer1 cycles within second */
+  #endif
+
   /*
    *  hints:
    *  - the TOV0 interrupt flag is cleared automatically
@@ -1750,6 +2317,96 @@ ISR(TIMER0_OVF_vect, ISR_BLOCK)
    *    (no nested interrupts)
    */
 
+  #ifdef HW_FREQ_COUNTER
+  if (FreqState >= RECIP_WAIT)     /* reciprocal measurement */
+  {
+    /*
+     *  Timer0 overflowed with a signal edge: take timestamp
+     *  - Timer1 might have overflowed right before (ISR pending)
+     *  - the timestamp lags behind the edge by the ISR latency, which
+     *    varies by a few MCU cycles (instruction being executed) and
+     *    by the run time of another ISR active at the edge
+     *  - this jitter of the first and last timestamp limits the
+     *    accuracy, not the resolution of the result
+     */
+
+    Ticks = TCNT1;                      /* get Timer1 first */
+    Overflows = T1_Overflows;
+    if ((TIFR1 & (1 << OCF1A)) && (Ticks < 0x8000))
+    {
+      Overflows++;                      /* add pending overflow */
+    }
+
+    /* next overflow after FreqEdges edges (keep edges counted meanwhile) */
+    TCNT0 -= FreqEdges;
+
+    if (FreqState == RECIP_WAIT)        /* first edge */
+    {
+      FirstEdge = ((uint32_t)Overflows << 16) | Ticks;
+      FreqState = RECIP_RUN;            /* timestamp further edges */
+    }
+    else                                /* further edge */
+    {
+      LastEdge = ((uint32_t)Overflows << 16) | Ticks;
+      Pulses += FreqEdges;              /* add periods */
+    }
+
+    return;
+  }
+  #endif
+
+  #ifdef EVENT_COUNTER_EXT
+  if (EventState != EVENT_OFF)     /* extended event counter */
+  {
+    /*
+     *  Timer0 overflowed with an event: take timestamp
+     *  - Timer1 tick might be pending
+     */
+
+    Frac = TCNT1;                       /* get Timer1 first */
+    Tick = TimeTicks;
+    Seconds = TimeCounter;
+    if ((TIFR1 & (1 << OCF1B)) && (Frac < (EVENT_TICK / 2)))
+    {
+      Tick++;                           /* add pending tick */
+      if (Tick >= 5)                    /* next second */
+      {
+        Tick = 0;
+        Seconds++;
+      }
+    }
+    Frac += (uint32_t)Tick * EVENT_TICK;
+
+    /*
+     *  next overflow after EventEdges events
+     *  - keep events counted meanwhile
+     *  - if more events than EventEdges were counted meanwhile Timer0
+     *    won't wrap around, so we have to add a full cycle
+     */
+
+    Count = TCNT0;
+    TCNT0 = Count - EventEdges;
+    EventPulses += EventBase;           /* add events of past cycle */
+    if (Count >= EventEdges) EventPulses += 256;
+    EventBase = EventEdges;             /* events of new cycle */
+
+    if (EventState == EVENT_WAIT)       /* first event */
+    {
+      FirstSec = Seconds;
+      FirstFrac = Frac;
+      EventState = EVENT_RUN;           /* timestamp further events */
+    }
+    else                                /* further event */
+    {
+      LastSec = Seconds;
+      LastFrac = Frac;
+      LastEvents = EventPulses;
+    }
+
+    return;
+  }
+  #endif
+
   Pulses += 256;              /* add overflow to global counter */
 }
 
@@ -1757,15 +2414,25 @@ ISR(TIMER0_OVF_vect, ISR_BLOCK)
 
 
 
-#if defined (HW_FREQ_COUNTER_BASIC) || defined (HW_FREQ_COUNTER_EXT)
+#if defined (HW_FREQ_COUNTER_BASIC) || defined (HW_FREQ_COUNTER_EXT) || defined (SW_DDS)
 
 /*
  *  ISR for match of Timer1's OCR1A (Output Compare Register A)
  *  - for gate time of frequency counter
+ *  - for ticks of continuous measurement
+ *  - for overflows of time base in reciprocal mode
+ *  - for top value of DDS signal generator
  */
 
 ISR(TIMER1_COMPA_vect, ISR_BLOCK)
 {
+  #ifdef HW_FREQ_COUNTER_EXT
+  uint32_t          Count;         /* pulse counter */
+  #endif
+  #ifdef SW_DDS
+  uint32_t          Phase;         /* phase accumulator */
+  #endif
+
   /*
    *  hints:
    *  - the OCF1A interrupt flag is cleared automatically
@@ -1773,12 +2440,254 @@ ISR(TIMER1_COMPA_vect, ISR_BLOCK)
    *    (no nested interrupts)
    */
 
+  #ifdef HW_FREQ_COUNTER_EXT
+  if (FreqState == FREQ_CONT)      /* continuous measurement */
+  {
+    /* get pulse counter (Timer0 might have overflowed right before) */
+    Count = TCNT0;
+    if ((TIFR0 & (1 << TOV0)) && (Count < 128))
+    {
+      Count += 256;                /* add pending overflow */
+    }
+    Count += Pulses;
+
+    /* save pulses of this tick in ring */
+    FreqRing[FreqSlot] = Count - FreqLast;
+    FreqLast = Count;
+    FreqSlot++;                    /* next slot */
+    if (FreqSlot >= FREQ_COUNTER_DEPTH) FreqSlot = 0;
+    if (FreqFilled < FREQ_COUNTER_DEPTH) FreqFilled++;
+    FreqTick++;                    /* signal new tick */
+
+    /* break TestKey() processing */
+    Cfg.OP_Control |= OP_BREAK_KEY;     /* set break signal */
+    return;
+  }
+  #endif
+
+  #ifdef SW_DDS
+  if (DDS_State == DDS_RUN)        /* DDS signal generator */
+  {
+    /*
+     *  add fractional part of period to phase accumulator
+     *  - a carry extends the next period by one timer cycle
+     *  - OCR1A is double buffered and takes effect with next cycle
+     */
+
+    Phase = DDS_Phase + DDS_Frac;
+    if (Phase < DDS_Phase)         /* carry */
+    {
+      OCR1A = DDS_Top + 1;
+    }
+    else                           /* no carry */
+    {
+      OCR1A = DDS_Top;
+    }
+    DDS_Phase = Phase;
+    return;
+  }
+  #endif
+
+  #ifdef HW_FREQ_COUNTER
+  if (FreqState != RECIP_OFF)      /* reciprocal measurement */
+  {
+    T1_Overflows++;                /* another Timer1 cycle */
+
+    /* gate time not reached yet */
+    if (T1_Overflows < RECIP_GATE) return;
+
+    /* no complete period yet, but still within timeout */
+    if ((Pulses == 0) && (T1_Overflows < RECIP_TIMEOUT)) return;
+  }
+
   /* gate time has passed */
   TCCR1B = 0;                 /* disable Timer1 */
   TCCR0B = 0;                 /* disable Timer0 */
 
   /* break TestKey() processing */
   Cfg.OP_Control |= OP_BREAK_KEY;       /* set break signal */
+  #endif
+}
+
+#endif
+
+
+
+#if defined (HW_FREQ_COUNTER_BASIC) || defined (HW_FREQ_COUNTER_EXT)
+
+/*
+ *  start reciprocal frequency measurement
+ *  - Timer0 counts the signal's periods and overflows every FreqEdges
+ *    periods, the ISR takes a timestamp from Timer1 then
+ *  - Timer1 runs with MCU clock, OCR1A match counts its overflows
+ *  - gate time is 100ms, extended up to 3s for very low frequencies
+ *  - the measurement spans an integer number of signal periods
+ *    between first and last timestamp
+ */
+
+void Reciprocal_Start(void)
+{
+  FreqState = RECIP_WAIT;          /* wait for first edge */
+  T1_Overflows = 0;                /* reset Timer1 overflows */
+  Pulses = 0;                      /* reset periods */
+
+  TCNT0 = 0xFF;                    /* Timer0: overflow with next edge */
+  TCNT1 = 0;                       /* Timer1: reset time base */
+  OCR1A = 0xFFFF;                  /* Timer1: match once per cycle */
+  TIFR1 = (1 << OCF1A);            /* clear output compare A match flag */
+  TCCR1B = (1 << CS10);            /* start Timer1: prescaler 1:1 */
+  TCCR0B = (1 << CS02) | (1 << CS01); /* start Timer0: clock source T0 on falling edge */
+}
+
+
+
+/*
+ *  get frequency of reciprocal measurement
+ *  - f = periods * f_MCU / ticks
+ *  - long division to get 6 significant digits without overflow
+ *  - updates FreqEdges for next measurement (about 100 timestamps
+ *    per second), 0 signals a frequency too high for this mode
+ *
+ *  requires:
+ *  - DecPlaces: pointer to decimal places of frequency
+ *
+ *  returns:
+ *  - frequency in Hz scaled by 10^DecPlaces
+ *  - 0 if no complete period was measured
+ */
+
+uint32_t Reciprocal_Frequency(uint8_t *DecPlaces)
+{
+  uint32_t          Value;         /* frequency */
+  uint32_t          Rest;          /* remainder of division */
+  uint32_t          Ticks;         /* MCU cycles */
+  uint8_t           n = 0;         /* counter */
+
+  FreqState = RECIP_OFF;           /* end measurement */
+  *DecPlaces = 0;
+  FreqEdges = 1;                   /* timestamp each edge by default */
+
+  if (Pulses == 0) return 0;       /* no complete period */
+
+  Ticks = LastEdge - FirstEdge;    /* MCU cycles of all periods */
+  Rest = Pulses;
+  Rest *= MCU_CYCLES_PER_US;       /* periods * MCU cycles per s */
+
+  /* f in MHz (integer part) */
+  Value = Rest / Ticks;
+  Rest %= Ticks;
+
+  /* add digits until value is in Hz and has 6 digits */
+  while ((n < 6) || ((Value < 100000) && (n < 12)))
+  {
+    Rest *= 10;
+    Value *= 10;
+    Value += Rest / Ticks;         /* next digit */
+    Rest %= Ticks;
+    n++;
+  }
+
+  if (n > 6) *DecPlaces = n - 6;   /* decimal places */
+
+  /* get integer part for range check */
+  Ticks = Value;
+  n = *DecPlaces;
+  while (n > 0)
+  {
+    Ticks /= 10;
+    n--;
+  }
+
+  if (Ticks >= RECIP_MAX_FREQ)     /* frequency too high */
+  {
+    FreqEdges = 0;                 /* signal range overrun */
+  }
+  else                             /* within range */
+  {
+    /* about 100 timestamps per second */
+    FreqEdges = (Ticks / 100) + 1;
+  }
+
+  return Value;
+}
+
+#endif
+
+
+
+#ifdef HW_FREQ_COUNTER_EXT
+
+/*
+ *  start continuous frequency measurement
+ *  - Timer0 counts pulses without stopping
+ *  - Timer1 generates ticks of 100ms, the ISR saves the pulses of
+ *    each tick in a ring buffer
+ *  - the moving window covers the last FREQ_COUNTER_DEPTH ticks,
+ *    so the result is updated with each tick
+ *
+ *  requires:
+ *  - Ring: pointer to ring buffer (FREQ_COUNTER_DEPTH entries)
+ */
+
+void Continuous_Start(uint32_t *Ring)
+{
+  FreqRing = Ring;                 /* set ring buffer */
+  FreqState = FREQ_CONT;           /* continuous measurement */
+  Pulses = 0;                      /* reset pulse counter */
+  FreqLast = 0;                    /* reset counter at last tick */
+  FreqSlot = 0;                    /* start with first slot */
+  FreqFilled = 0;                  /* no valid slots yet */
+
+  TCNT0 = 0;                       /* Timer0: reset pulse counter */
+  TIFR0 = (1 << TOV0);             /* clear overflow flag */
+  TCNT1 = 0;                       /* Timer1: reset tick counter */
+  OCR1A = CONT_TOP;                /* Timer1: 100ms */
+  TIFR1 = (1 << OCF1A);            /* clear output compare A match flag */
+  /* start Timer1: CTC mode, prescaler 64 */
+  TCCR1B = (1 << WGM12) | (1 << CS11) | (1 << CS10);
+  TCCR0B = (1 << CS02) | (1 << CS01); /* start Timer0: clock source T0 on falling edge */
+}
+
+
+
+/*
+ *  get frequency of moving window
+ *  - f = f-prescaler * pulses / window time
+ *  - 20MHz MCU: 5M pulses per second at maximum, so no overflow
+ *    for f-prescaler * pulses * 10
+ *
+ *  requires:
+ *  - Div: frequency prescaler
+ *
+ *  returns:
+ *  - frequency in Hz
+ */
+
+uint32_t Continuous_Frequency(uint8_t Div)
+{
+  uint32_t          Value = 0;     /* pulses */
+  uint8_t           Ticks;         /* ticks of window */
+  uint8_t           n;             /* counter */
+
+  cli();                           /* disable interrupts */
+
+  Ticks = FreqFilled;              /* valid slots */
+  n = 0;
+  while (n < Ticks)                /* sum up ring */
+  {
+    Value += FreqRing[n];
+    n++;
+  }
+
+  sei();                           /* enable interrupts */
+
+  if (Ticks == 0) return 0;        /* no tick yet */
+
+  Value *= 10;                     /* scale to 1s (100ms ticks) */
+  Value *= Div;                    /* * f-prescaler */
+  Value /= Ticks;                  /* divide by number of ticks */
+
+  return Value;
 }
 
 #endif
@@ -1800,6 +2709,8 @@ void FrequencyCounter(void)
   uint8_t           Old_DDR;            /* old DDR state */
   uint8_t           Index;              /* prescaler table index */
   uint8_t           Bitmask;            /* prescaler bitmask */
+  uint8_t           Recip = 0;          /* reciprocal measurement */
+  uint8_t           DecPlaces;          /* decimal places */
   uint16_t          GateTime;           /* gate time in ms */
   uint16_t          Top;                /* top value for timer */
   uint32_t          Value;              /* temporary value */
@@ -1818,6 +2729,10 @@ void FrequencyCounter(void)
   /*
    *  We use Timer1 for the gate time and Timer0 to count pulses of the
    *  unknown signal. Max. frequency for Timer0 is 1/4 of the MCU clock.
+   *  Below 10kHz we switch to reciprocal measurement: Timer0 triggers
+   *  timestamps of signal edges and Timer1 is the time base. The
+   *  timestamps are taken by an ISR, so their jitter limits the
+   *  accuracy (see TIMER0_OVF_vect).
    */
 
   Flag = RUN_FLAG;            /* enter measurement loop */
@@ -1834,13 +2749,15 @@ void FrequencyCounter(void)
       Frequency
       - f = pulses / gatetime
       - pulses = f * gatetime
+      - reciprocal: f = periods * f_MCU / MCU cycles
 
       range         gate time  prescaler  MCU clock  pulses      
       ----------------------------------------------------------
-      -10kHz           1000ms       1024  > 16MHz    -10k
-                       1000ms        256  <= 16MHz   -10k      
+      -10kHz            100ms          1  all        reciprocal
       10kHz-100kHz      100ms         64  all        1k-10k
       100kHz-            10ms          8  all        1k-(50k)
+
+      back to reciprocal measurement below 9kHz (hysteresis)
    */
 
   /* start values for autoranging (assuming high frequency) */
@@ -1882,13 +2799,21 @@ void FrequencyCounter(void)
     Top = (uint16_t)Value;              /* use lower 16 bit */
 
     /* start timers */
-    Pulses = 0;                         /* reset pulse counter */
     Flag = WAIT_FLAG;                   /* enter waiting loop */
-    TCNT0 = 0;                          /* Timer0: reset pulse counter */
-    TCNT1 = 0;                          /* Timer1: reset gate time counter */
-    OCR1A = Top;                        /* Timer1: set gate time */
-    TCCR1B = Bitmask;                   /* start Timer1: prescaler */
-    TCCR0B = (1 << CS02) | (1 << CS01); /* start Timer0: clock source T0 on falling edge */
+
+    if (Recip)                          /* reciprocal measurement */
+    {
+      Reciprocal_Start();
+    }
+    else                                /* gated measurement */
+    {
+      Pulses = 0;                       /* reset pulse counter */
+      TCNT0 = 0;                        /* Timer0: reset pulse counter */
+      TCNT1 = 0;                        /* Timer1: reset gate time counter */
+      OCR1A = Top;                      /* Timer1: set gate time */
+      TCCR1B = Bitmask;                 /* start Timer1: prescaler */
+      TCCR0B = (1 << CS02) | (1 << CS01); /* start Timer0: clock source T0 on falling edge */
+    }
 
     /* wait for timer1 or key press */
     while (Flag == WAIT_FLAG)
@@ -1921,43 +2846,63 @@ void FrequencyCounter(void)
 
     if (Flag == GATE_FLAG)              /* got measurement */
     {
-      Pulses += TCNT0;                  /* add counter of Timer0 */
-
-      /*
-       *  calculate frequency
-       *  - f = pulses / gatetime
-       *  - 20MHz MCU: 5M pulses per second at maximum
-       *    with 10ms gate time max. 50k pulses
-       */
-
-      Value = Pulses;                   /* number of pulses */
-      Value *= 1000;                    /* scale to ms */
-      Value /= GateTime;                /* divide by gatetime (in ms) */
-      Flag = SHOW_FREQ;                 /* display frequency */
-
-      /* autoranging */
-      if (Pulses > 10000)               /* range overrun */
+      if (Recip)                        /* reciprocal measurement */
       {
-        if (GateTime > 10)              /* upper range limit not reached yet */
+        Value = Reciprocal_Frequency(&DecPlaces);
+
+        if (FreqEdges == 0)             /* range overrun */
         {
-          GateTime /= 10;               /* 1000ms -> 100ms -> 10ms */
-          Index--;                      /* one prescaler step down */
-          #if CPU_FREQ > 16000000 
-          if (Index == 3) Index--;      /* skip 256, use 64 */
-          #endif
+          Recip = 0;                    /* switch to gated measurement */
+          GateTime = 100;               /* 100ms */
+          Index = 2;                    /* prescaler 64:1 */
           Flag = RUN_FLAG;              /* don't display frequency */
         }
+        else if (Value > 0)             /* valid frequency */
+        {
+          Flag = SHOW_FREQ;             /* display frequency */
+        }
       }
-      else if (Pulses < 1000)           /* range underrun */
+      else                              /* gated measurement */
       {
-        if (GateTime < 1000)            /* lower range limit not reached yet */
+        Pulses += TCNT0;                /* add counter of Timer0 */
+
+        /*
+         *  calculate frequency
+         *  - f = pulses / gatetime
+         *  - 20MHz MCU: 5M pulses per second at maximum
+         *    with 10ms gate time max. 50k pulses
+         */
+
+        Value = Pulses;                 /* number of pulses */
+        Value *= 1000;                  /* scale to ms */
+        Value /= GateTime;              /* divide by gatetime (in ms) */
+        Flag = SHOW_FREQ;               /* display frequency */
+
+        /* autoranging */
+        if (Pulses > 10000)             /* range overrun */
         {
-          GateTime *= 10;               /* 1ms -> 10ms -> 100ms -> 1000ms */
-          Index++;                      /* one prescaler step up */
-          #if CPU_FREQ > 16000000 
-          if (Index == 3) Index++;      /* skip 256, use 1024 */
-          #endif
-          Flag = RUN_FLAG;              /* don't display frequency */
+          if (GateTime > 10)            /* upper range limit not reached yet */
+          {
+            GateTime /= 10;             /* 100ms -> 10ms */
+            Index--;                    /* one prescaler step down */
+            Flag = RUN_FLAG;            /* don't display frequency */
+          }
+        }
+        else if (Pulses < 1000)         /* range underrun */
+        {
+          if (GateTime < 100)           /* not 100ms range yet */
+          {
+            GateTime *= 10;             /* 10ms -> 100ms */
+            Index++;                    /* one prescaler step up */
+            Flag = RUN_FLAG;            /* don't display frequency */
+          }
+          else if (Pulses < (RECIP_MIN_FREQ / 10))    /* 100ms range */
+          {
+            /* below 9kHz (hysteresis to RECIP_MAX_FREQ) */
+            Recip = 1;                  /* switch to reciprocal measurement */
+            FreqEdges = 1;              /* timestamp each edge */
+            Flag = RUN_FLAG;            /* don't display frequency */
+          }
         }
       }
     }
@@ -1973,7 +2918,15 @@ void FrequencyCounter(void)
 
     if (Flag == SHOW_FREQ)              /* valid frequency */
     {
-      Display_Value(Value, 0, 0);       /* display frequency */
+      if (Recip)                        /* reciprocal measurement */
+      {
+        /* all digits */
+        Display_FullValue(Value, DecPlaces, 0);   /* display frequency */
+      }
+      else                              /* gated measurement */
+      {
+        Display_Value(Value, 0, 0);     /* display frequency */
+      }
       Display_EEString(Hertz_str);      /* display: Hz */
       Flag = RUN_FLAG;                  /* clear flag */
     }
@@ -1988,8 +2941,11 @@ void FrequencyCounter(void)
    *  clean up
    */
 
+  TCCR1B = 0;                 /* stop Timer1 */
+  TCCR0B = 0;                 /* stop Timer0 */
   TIMSK0 = 0;                 /* disable all interrupts for Timer0 */
   TIMSK1 = 0;                 /* disable all interrupts for Timer1 */
+  FreqState = RECIP_OFF;      /* no special ISR processing */
 
   /* local constants */
   #undef RUN_FLAG
@@ -2031,19 +2987,17 @@ void FrequencyCounter(void)
   uint8_t           Channel;            /* input channel */
   uint8_t           Range;              /* range ID */
   uint8_t           Div = 0;            /* frequency prescaler */
-  uint8_t           Index;              /* prescaler table index */
-  uint8_t           Bitmask = 0;        /* prescaler bitmask */
-  uint16_t          GateTime = 0;       /* gate time in ms */
-  uint16_t          Top = 0;            /* top value for timer */
+  uint8_t           Index;              /* unit char */
+  uint8_t           Tick = 0;           /* last tick */
+  uint8_t           DecPlaces = 0;      /* decimal places */
   unsigned char     *String = NULL;     /* string pointer (EEPROM) */
-  uint32_t          MinPulses = 0;      /* minimim pulses for range */
-  uint32_t          MaxPulses = 0;      /* maximum pulses for range */
-  uint32_t          Value;              /* temporary value */
+  uint32_t          Ring[FREQ_COUNTER_DEPTH];     /* pulses per tick */
+  uint32_t          Value = 0;          /* frequency */
 
   /* control flags */
   #define RUN_FLAG            0b00000001     /* run flag */
-  #define WAIT_FLAG           0b00000010     /* wait flag */
-  #define GATE_FLAG           0b00000100     /* gatetime flag */
+  #define START_FLAG          0b00000010     /* (re)start measurement */
+  #define NEW_DATA            0b00000100     /* got new measurement */
   #define UPDATE_CHANNEL      0b00001000     /* update source channel */
   #define UPDATE_RANGE        0b00010000     /* update measurement range */
   #define SHOW_FREQ           0b00100000     /* display frequency */
@@ -2054,32 +3008,38 @@ void FrequencyCounter(void)
 
 
   /*
-   *  We use Timer1 for the gate time and Timer0 to count pulses of the
-   *  unknown signal. Max. frequency for Timer0 is 1/4 of the MCU clock.
+   *  We use Timer0 to count pulses of the unknown signal and Timer1 as
+   *  time base. Max. frequency for Timer0 is 1/4 of the MCU clock.
+   *  Both timers run continuously: Timer1 generates ticks of 100ms and
+   *  the ISR saves the pulses of each tick in a ring buffer. The
+   *  frequency is derived from a moving window of the last
+   *  FREQ_COUNTER_DEPTH ticks, so it's updated 10 times per second.
+   *  Below 10kHz we switch to reciprocal measurement: Timer0 triggers
+   *  timestamps of signal edges and Timer1 is the time base. The
+   *  timestamps are taken by an ISR, so their jitter limits the
+   *  accuracy (see TIMER0_OVF_vect).
    */
 
   /*
       auto ranging
 
-      Timer1 top value (gate time)
-      - top = gatetime * MCU_cycles / timer prescaler
-      - gate time in s
-      - MCU cycles per s
-      - top max. 2^16 - 1
+      Timer1 top value (tick)
+      - top = ticktime * MCU_cycles / timer prescaler - 1
+      - 100ms with prescaler 64 for all MCU clocks
 
       Frequency
-      - f = f-prescaler * pulses / gatetime
-      - pulses = f * gatetime / f-prescaler
-
-                    gate    timer      MCU       frequency
-      range         time    prescaler  clock     prescaler  pulses     
-      ----------------------------------------------------------------
-      n/a           3000ms       1024  all
-      -100kHz       1000ms       1024  > 16MHz         1:1  -100k
-                    1000ms        256  <= 16MHz        1:1  -100k
-      100kHz-1MHz    100ms         64  all             1:1  10k-100k
-      1MHz-          100ms         64  all            16:1  6250-(500k)
-                     100ms         64  all            32:1  3125-(500k)
+      - f = f-prescaler * pulses / window time
+      - reciprocal: f = periods * f_MCU / MCU cycles
+
+                    window  frequency
+      range         time    prescaler  pulses     
+      ------------------------------------------------------
+      -10kHz         100ms        1:1  reciprocal
+      10kHz-1MHz    -1000ms       1:1  1k-(1M)
+      1MHz-         -1000ms      16:1  6250-(5M)
+                    -1000ms      32:1  3125-(5M)
+
+      switching down to the next lower range below 9kHz or 900kHz
    */
 
   /* set up control lines */
@@ -2087,13 +3047,17 @@ void FrequencyCounter(void)
   /* set to output mode */
   COUNTER_CTRL_DDR |= (1 << COUNTER_CTRL_DIV) | (1 << COUNTER_CTRL_CH0) | (1 << COUNTER_CTRL_CH1);
 
+  /* set up T0 as input */
+  InDir = COUNTER_DDR & (1 << COUNTER_IN);      /* get current direction */
+  COUNTER_DDR &= ~(1 << COUNTER_IN);  /* set to input mode */
+
   /* set up Timer0 (pulse counter) */
   TCCR0A = 0;                      /* normal mode (count up) */
   TIFR0 = (1 << TOV0);             /* clear overflow flag */
   TIMSK0 = (1 << TOIE0);           /* enable overflow interrupt */
 
-  /* set up Timer1 (gate time) */
-  TCCR1A = 0;                      /* normal mode (count up) */
+  /* set up Timer1 (time base) */
+  TCCR1A = 0;                      /* normal/CTC mode */
   TIFR1 = (1 << OCF1A);            /* clear output compare A match flag */
   TIMSK1 = (1 << OCIE1A);          /* enable output compare A match interrupt */
 
@@ -2117,53 +3081,20 @@ void FrequencyCounter(void)
     {
       switch (Range)               /* get range specifics */
       {
-        case 0:     /* -100kHz */
+        case 0:     /* -10kHz (reciprocal) */
           Div = 1;                 /* frequency prescaler 1:1 */
-          #if CPU_FREQ <= 16000000
-          Index = 3;               /* table index 3: 256:1 */
-          #else
-          Index = 4;               /* table index 4: 1024:1 */
-          #endif
-          GateTime = 1000;         /* gate time: 1000ms */
-          MinPulses = 0;           /* lower limit: none */
-          MaxPulses = 100000;      /* upper limit: 100k */
+          FreqEdges = 1;           /* timestamp each edge */
           break;
 
-        case 1:     /* 100kHz-1MHz */
+        case 1:     /* 10kHz-1MHz */
           Div = 1;                 /* frequency prescaler 1:1 */
-          Index = 2;               /* table index 2: 64:1 */
-          GateTime = 100;          /* gate time: 100ms */
-          MinPulses = 10000;       /* lower limit: 10k */
-          MaxPulses = 100000;      /* upper limit: 100k */
           break;
 
         case 2:     /* 1MHz- */
           Div = FREQ_COUNTER_PRESCALER; /* frequency prescaler 16:1 or 32:1 */
-          Index = 2;               /* table index 2: 64:1 */
-          GateTime = 100;          /* gate time: 100ms */
-          #if FREQ_COUNTER_PRESCALER == 16
-          MinPulses = 6250;        /* lower limit: 6250 */
-          #elif FREQ_COUNTER_PRESCALER == 32
-          MinPulses = 3125;        /* lower limit: 3125 */
-          #endif
-          MaxPulses = 0;           /* upper limit: none */
           break;
       }
 
-      /* update Timer1 prescaler */
-      Top = eeprom_read_word(&T1_Prescaler_table[Index]);   /* prescaler value */
-      Bitmask = eeprom_read_byte(&T1_Bitmask_table[Index]); /* prescaler bits */
-
-
-      /* calculate compare value for Timer1 (gate time) */
-      /* top = gatetime * MCU_cycles / timer prescaler */
-      Value = GateTime;                 /* gatetime (in ms) */
-      /* * MCU cycles per s and scale gatetime to s */
-      Value *= (MCU_CYCLES_PER_US * 1000);
-      Value /= Top;                     /* divide by timer prescaler */
-      Top = (uint16_t)Value;            /* use lower 16 bit */
-
-
       /* update frequency counter prescaler */
       if (Div == FREQ_COUNTER_PRESCALER)     /* set 16:1 */
       {
@@ -2174,6 +3105,7 @@ void FrequencyCounter(void)
         COUNTER_CTRL_PORT &= ~(1 << COUNTER_CTRL_DIV);      /* clear bit */
       }
 
+      Flag |= START_FLAG;               /* restart measurement */
       Flag &= ~UPDATE_RANGE;            /* clear flag */
     }  
 
@@ -2203,10 +3135,10 @@ void FrequencyCounter(void)
       }
 
       /* set source channel */
-      InDir = COUNTER_CTRL_PORT;        /* get current state */
-      InDir &= ~((1 << COUNTER_CTRL_CH1) | (1 << COUNTER_CTRL_CH0));  /* clear channel lines */
-      InDir |= Test;                    /* set channel lines */
-      COUNTER_CTRL_PORT = InDir;        /* update port */
+      Index = COUNTER_CTRL_PORT;        /* get current state */
+      Index &= ~((1 << COUNTER_CTRL_CH1) | (1 << COUNTER_CTRL_CH0));  /* clear channel lines */
+      Index |= Test;                    /* set channel lines */
+      COUNTER_CTRL_PORT = Index;        /* update port */
 
       /* display source channel (in line #3) */ 
       LCD_ClearLine(3);
@@ -2215,129 +3147,128 @@ void FrequencyCounter(void)
       Display_Space();
       Display_EEString(String);              /* display channel name */
 
+      Flag |= START_FLAG;               /* restart measurement */
       Flag &= ~UPDATE_CHANNEL;          /* clear flag */
     }
 
 
-    /* set up T0 as input */
-    InDir = COUNTER_DDR & (1 << COUNTER_IN);      /* get current direction */
-    COUNTER_DDR &= ~(1 << COUNTER_IN);  /* set to input mode */
-    wait500us();                        /* settle time */
-
-
-    /* start timers */
-    Flag |= WAIT_FLAG;                  /* enter waiting loop */
-    Pulses = 0;                         /* reset pulse counter */
-    TCNT0 = 0;                          /* Timer0: reset pulse counter */
-    TCNT1 = 0;                          /* Timer1: reset gate time counter */
-    OCR1A = Top;                        /* Timer1: set gate time */
-    TCCR1B = Bitmask;                   /* start Timer1: prescaler */
-    TCCR0B = (1 << CS02) | (1 << CS01); /* start Timer0: clock source T0 on falling edge */
-
-
     /*
-     *  wait for timer1 or user feedback
+     *  (re)start measurement
      */
 
-    while (Flag & WAIT_FLAG)
+    if (Flag & START_FLAG)              /* start measurement */
     {
-      if (TCCR1B == 0)                  /* Timer1 stopped by ISR */
+      /* stop timers */
+      TCCR1B = 0;                       /* stop Timer1 */
+      TCCR0B = 0;                       /* stop Timer0 */
+      wait500us();                      /* settle time */
+
+      if (Range == 0)                   /* reciprocal measurement */
       {
-        Flag = RUN_FLAG | GATE_FLAG;    /* end waiting loop and signal Timer1 event */
+        Reciprocal_Start();
       }
-      else                              /* Timer1 still running */
+      else                              /* continuous measurement */
       {
-        /* wait for user feedback */
-        Test = TestKey(0, CHECK_KEY_TWICE | CHECK_BAT);
-
-        if (Test == KEY_SHORT)          /* short key press */
-        {
-          /* select next source channel */
-          if (Channel < 2) Channel++;             /* next channel */
-          else Channel = 0;                       /* overrun */
-          Flag = RUN_FLAG | UPDATE_CHANNEL;       /* update channel */
-        }
-        else if (Test == KEY_TWICE)     /* two short key presses */
-        {
-          Flag = 0;                     /* end processing loop */
-        }
-        #ifdef HW_KEYS
-        else if (Test == KEY_RIGHT)     /* right key */
-        {
-          if (Channel < 2) Channel++;             /* next channel */
-          else Channel = 0;                       /* overrun */
-          Flag = RUN_FLAG | UPDATE_CHANNEL;       /* update channel */
-        }
-        else if (Test == KEY_LEFT)      /* left key */
-        {
-          if (Channel > 0) Channel--;             /* previous channel */
-          else Channel = 2;                       /* underrun */
-          Flag = RUN_FLAG | UPDATE_CHANNEL;       /* update channel */
-        }
-        #endif
+        Continuous_Start(&Ring[0]);
+        Tick = FreqTick;                /* no new tick yet */
       }
+
+      Flag &= ~START_FLAG;              /* clear flag */
     }
 
-    if (InDir)                     /* restore old setting for T0 */
+
+    /*
+     *  wait for user feedback or Timer1 (via OP_BREAK_KEY)
+     */
+
+    Test = TestKey(0, CHECK_KEY_TWICE | CHECK_BAT);
+
+    if (Test == KEY_SHORT)              /* short key press */
     {
-      COUNTER_DDR |= (1 << COUNTER_IN);      /* set to output mode */
+      /* select next source channel */
+      if (Channel < 2) Channel++;       /* next channel */
+      else Channel = 0;                 /* overrun */
+      Flag |= UPDATE_CHANNEL;           /* update channel */
     }
-
-    Cfg.OP_Control &= ~OP_BREAK_KEY;    /* clear break signal (just in case) */
+    else if (Test == KEY_TWICE)         /* two short key presses */
+    {
+      break;                            /* end processing loop */
+    }
+    #ifdef HW_KEYS
+    else if (Test == KEY_RIGHT)         /* right key */
+    {
+      if (Channel < 2) Channel++;       /* next channel */
+      else Channel = 0;                 /* overrun */
+      Flag |= UPDATE_CHANNEL;           /* update channel */
+    }
+    else if (Test == KEY_LEFT)          /* left key */
+    {
+      if (Channel > 0) Channel--;       /* previous channel */
+      else Channel = 2;                 /* underrun */
+      Flag |= UPDATE_CHANNEL;           /* update channel */
+    }
+    #endif
 
 
     /*
      *  process measurement
      */
 
-    if (Flag & GATE_FLAG)               /* got measurement */
+    if (Range == 0)                     /* reciprocal measurement */
     {
-      Pulses += TCNT0;                  /* add counter of Timer0 */
-
-      /* autoranging */
-      if (Pulses < MinPulses)           /* range underrun */
+      if (TCCR1B == 0)                  /* Timer1 stopped by ISR */
       {
-        if (Range > 0)                  /* not lowest range yet */
+        Value = Reciprocal_Frequency(&DecPlaces);
+
+        if (FreqEdges == 0)             /* range overrun */
         {
-          Range--;                      /* change to lower range */
+          Range++;                      /* change to higher range */
           Flag |= UPDATE_RANGE;         /* set flag for updating range */
         }
-      }
-      else if (Pulses > MaxPulses)      /* range overrun */
-      {
-        if (Range < 2)                  /* not highest range yet */
+        else                            /* within range */
         {
-          Range++;                      /* change to higher range */
-          Flag |= UPDATE_RANGE;         /* set flag for updating range */
+          if (Value > 0) Flag |= SHOW_FREQ;  /* valid frequency */
+          Flag |= NEW_DATA | START_FLAG;     /* display and measure again */
         }
       }
-
-      /* show frequency only when not switching ranges */
-      if (! (Flag & UPDATE_RANGE)) Flag |= SHOW_FREQ;
-
+    }
+    else if (Tick != FreqTick)          /* new tick */
+    {
+      Tick = FreqTick;                  /* update tick */
+      Value = Continuous_Frequency(Div);
 
       /*
-       *  calculate frequency
-       *  - f = pulses * f-prescaler / gatetime
-       *  - 20MHz MCU: 5M pulses per second at maximum
-       *    with 100ms gate time max. 500k pulses
+       *  autoranging
+       *  - switch down 10% below the limit for switching up
+       *    (hysteresis), so a frequency close to a limit doesn't
+       *    toggle between ranges
        */
 
-      if (Div == 1)                     /* f-prescaler 1:1 */
+      if (Range == 1)                   /* 10kHz-1MHz */
       {
-        /* no overflow possible */
-        Pulses *= 1000;                 /* scale to ms */
-        Pulses /= GateTime;             /* divide by gatetime (in ms) */
+        if (Value < RECIP_MIN_FREQ)     /* range underrun */
+        {
+          Range--;                      /* change to lower range */
+          Flag |= UPDATE_RANGE;         /* set flag for updating range */
+        }
+        else if (Value > DIV_MAX_FREQ)  /* range overrun */
+        {
+          Range++;                      /* change to higher range */
+          Flag |= UPDATE_RANGE;         /* set flag for updating range */
+        }
       }
-      else                              /* f-prescaler 16:1 or 32:1 */
+      else                              /* 1MHz- */
       {
-        /* prevent overflow */
-        Pulses *= 100;                  /* scale to 10ms */
-        Pulses *= Div;                  /* * f-prescaler */
-        Pulses /= (GateTime / 10);      /* divide by gatetime (in 10ms) */
+        if (Value < DIV_MIN_FREQ)       /* range underrun */
+        {
+          Range--;                      /* change to lower range */
+          Flag |= UPDATE_RANGE;         /* set flag for updating range */
+        }
       }
 
-      Flag &= ~GATE_FLAG;          /* clear flag */
+      /* show frequency only when not switching ranges */
+      if (! (Flag & UPDATE_RANGE)) Flag |= SHOW_FREQ | NEW_DATA;
+      DecPlaces = 0;                    /* no decimal places */
     }
 
 
@@ -2345,34 +3276,41 @@ void FrequencyCounter(void)
      *  display frequency (in line #2)
      */
 
-    LCD_ClearLine2();                 /* clear line #2 */
-    Display_Char('f');                /* display: f */
-    Display_Space();
-
-    if (Flag & SHOW_FREQ)               /* valid frequency */
+    if (Flag & (NEW_DATA | UPDATE_RANGE))    /* new data or range change */
     {
-      Test = 0;                         /* dot position */
-      Index = 0;                        /* unit char */
+      LCD_ClearLine2();                 /* clear line #2 */
+      Display_Char('f');                /* display: f */
+      Display_Space();
+
+      if (Flag & SHOW_FREQ)             /* valid frequency */
+      {
+        Test = DecPlaces;               /* dot position */
+        Index = 0;                      /* unit char */
+
+        if (Range == 0)                 /* reciprocal measurement */
+        {
+          /* all digits in Hz */
+        }
+        else if (Value >= 1000000)      /* f >= 1MHz */
+        {
+          Test = 6;             /* 10^6 */
+          Index = 'M';          /* M for mega */
+        }
+        else if (Value >= 1000)         /* f >= 1kHz */
+        {
+          Test = 3;             /* 10^3 */
+          Index = 'k';          /* k for kilo */
+        }
 
-      if (Pulses >= 1000000)            /* f >= 1MHz */
-      {
-        Test = 6;             /* 10^6 */
-        Index = 'M';          /* M for mega */
+        Display_FullValue(Value, Test, Index);
+        Display_EEString(Hertz_str);    /* display: "Hz" */
       }
-      else if (Pulses >= 1000)          /* f >= 1kHz */
+      else                              /* invalid frequency */
       {
-        Test = 3;             /* 10^3 */
-        Index = 'k';          /* k for kilo */
+        Display_Char('-');              /* display: no value */
       }
 
-      Display_FullValue(Pulses, Test, Index);
-      Display_EEString(Hertz_str);      /* display: "Hz" */
-
-      Flag &= ~SHOW_FREQ;               /* clear flag */
-    }
-    else                                /* invalid frequency */
-    {
-      Display_Char('-');                /* display: no value */
+      Flag &= ~(NEW_DATA | SHOW_FREQ);  /* clear flags */
     }
   }
 
@@ -2381,8 +3319,16 @@ void FrequencyCounter(void)
    *  clean up
    */
 
+  TCCR1B = 0;                 /* stop Timer1 */
+  TCCR0B = 0;                 /* stop Timer0 */
   TIMSK0 = 0;                 /* disable all interrupts for Timer0 */
   TIMSK1 = 0;                 /* disable all interrupts for Timer1 */
+  FreqState = RECIP_OFF;      /* no special ISR processing */
+
+  if (InDir)                  /* restore old setting for T0 */
+  {
+    COUNTER_DDR |= (1 << COUNTER_IN);   /* set to output mode */
+  }
 
   /* filter control lines which were in input mode */ 
   CtrlDir ^= (1 << COUNTER_CTRL_DIV) | (1 << COUNTER_CTRL_CH0) | (1 << COUNTER_CTRL_CH1);
@@ -2393,8 +3339,8 @@ void FrequencyCounter(void)
   #undef SHOW_FREQ
   #undef UPDATE_RANGE
   #undef UPDATE_CHANNEL
-  #undef GATE_FLAG
-  #undef WAIT_FLAG
+  #undef NEW_DATA
+  #undef START_FLAG
   #undef RUN_FLAG
 }
 
@@ -2405,6 +3351,129 @@ void FrequencyCounter(void)
 #ifdef HW_EVENT_COUNTER
 
 
+#ifdef EVENT_COUNTER_EXT
+
+/*
+ *  get number of events of extended event counter
+ *  - to be called with interrupts disabled
+ *  - Timer0 might have overflowed right before (ISR pending)
+ *
+ *  returns:
+ *  - number of events (counts of Timer0)
+ */
+
+uint64_t GetEvents(void)
+{
+  uint16_t          Count;         /* Timer0 counter */
+
+  Count = TCNT0;                   /* get counter */
+  if ((TIFR0 & (1 << TOV0)) && (Count < 128))
+  {
+    Count += 256;                  /* add pending overflow */
+  }
+
+  /* Timer0 started at 256 - EventBase for the current cycle */
+  Count += EventBase;
+
+  return EventPulses + Count - 256;
+}
+
+
+
+/*
+ *  get event rate based on timestamps of first and last event
+ *  - scales rate to 6 significant digits
+ *
+ *  requires:
+ *  - DecPlaces: pointer to number of decimal places
+ *
+ *  returns:
+ *  - rate in events/s
+ *  - 0 if we don't have two timestamps yet
+ */
+
+uint32_t GetEventRate(uint8_t *DecPlaces)
+{
+  uint8_t           n = 0;         /* decimal places */
+  uint64_t          Events;        /* events between timestamps */
+  uint64_t          Time;          /* time between timestamps */
+
+  /* get timestamps */
+  cli();                           /* disable interrupts */
+  Events = LastEvents;
+  Time = (uint64_t)(LastSec - FirstSec) * EVENT_CLOCK;
+  Time += LastFrac;
+  Time -= FirstFrac;
+  sei();                           /* enable interrupts */
+
+  *DecPlaces = 0;
+  if (Events <= 1) return 0;       /* no second timestamp yet */
+  if (Time == 0) return 0;         /* below resolution */
+
+  /* rate = events / time (first timestamp is event #1) */
+  Events--;
+  Events *= (uint64_t)EVENT_CLOCK * EVENT_DIV;
+
+  /* scale up */
+  while ((n < 6) && (Events < Time * 100000))
+  {
+    Events *= 10;
+    n++;
+  }
+
+  /* 32 bit divisor (dividend is large enough to keep precision) */
+  while (Time > UINT32_MAX)
+  {
+    Time >>= 1;
+    Events >>= 1;
+  }
+
+  Div64_32(&Events, (uint32_t)Time);
+
+  *DecPlaces = n;
+  return (uint32_t)Events;
+}
+
+
+
+/*
+ *  display number of events
+ *  - 64 bit value, split into blocks of 10^9
+ *
+ *  requires:
+ *  - Value: number of events
+ */
+
+void Display_Events(uint64_t Value)
+{
+  uint8_t           n;             /* counter */
+  uint32_t          High;          /* upper block */
+  uint32_t          Low;           /* lower block */
+
+  Low = Div64_32(&Value, 1000000000);
+  High = (uint32_t)Value;
+
+  if (High > 0)                    /* upper block */
+  {
+    Display_FullValue(High, 0, 0);
+
+    /* leading zeros of lower block */
+    ultoa(Low, OutBuffer, 10);
+    n = strlen(OutBuffer);
+    while (n < 9)
+    {
+      Display_Char('0');
+      n++;
+    }
+  }
+
+  Display_FullValue(Low, 0, 0);
+}
+
+#endif
+
+
+
 /*
  *  ISR for match of Timer1's OCR1B (Output Compare Register B)
  *  - for time ticks of event counter
@@ -2457,7 +3526,18 @@ void EventCounter(void)
   unsigned char     *String = NULL;     /* string pointer (EEPROM) */
   uint16_t          TimeTrigger;        /* time limit/trigger */
   uint32_t          EventsTrigger;      /* events limit/trigger */
+  #ifdef EVENT_COUNTER_EXT
+  uint64_t          Events;             /* events */
+  uint64_t          LastSecond = 0;     /* events at last full second */
+  uint32_t          Rate = 0;           /* event rate */
+  uint8_t           DecPlaces = 0;      /* decimal places of rate */
+  uint32_t          Value;              /* temp. value */
+  #else
   uint32_t          Events;             /* events */
+  #endif
+  #ifdef EVENT_COUNTER_PRESCALER
+  uint8_t           CtrlDir;            /* control lines direction */
+  #endif
 
 
   /* control flags */
@@ -2468,6 +3548,7 @@ void EventCounter(void)
   #define START_COUNTING      0b00010000     /* start counting */
   #define MANAGE_COUNTING     0b00100000     /* manage counting */
   #define STOP_COUNTING       0b01000000     /* stop counting */
+  #define SEND_DATA           0b10000000     /* send results via serial */
 
   /* counter mode */
   #define MODE_COUNT          1         /* count events and time (start/stop) */
@@ -2518,7 +3599,7 @@ void EventCounter(void)
    *  - t_tick = 0.2s
    */
 
-  #define TOP       (CPU_FREQ / (5 * 256)) - 1
+  #define TOP       (EVENT_TICK - 1)
 
   /* set up Timer0 (event counter) */
   TCCR0A = 0;                      /* normal mode (count up) */
@@ -2534,6 +3615,18 @@ void EventCounter(void)
 
   /* set up T0 as input (just in case) */
   COUNTER_DDR &= ~(1 << COUNTER_IN);    /* set to input mode */
+
+  #ifdef EVENT_COUNTER_PRESCALER
+  /* set up control lines: buffered frequency input, prescaler */
+  CtrlDir = COUNTER_CTRL_DDR;      /* get current direction */
+  /* set to output mode */
+  COUNTER_CTRL_DDR |= (1 << COUNTER_CTRL_DIV) | (1 << COUNTER_CTRL_CH0) | (1 << COUNTER_CTRL_CH1);
+  Temp = COUNTER_CTRL_PORT;        /* get current state */
+  Temp &= ~((1 << COUNTER_CTRL_CH1) | (1 << COUNTER_CTRL_CH0));   /* channel 00 */
+  Temp |= (1 << COUNTER_CTRL_DIV);      /* enable prescaler */
+  COUNTER_CTRL_PORT = Temp;        /* update port */
+  #endif
+
   wait500us();                          /* settle time */
 
   /* set start values */
@@ -2561,11 +3654,25 @@ void EventCounter(void)
     if (Flag & START_COUNTING)
     {
       /* reset counters */
+      #ifdef EVENT_COUNTER_EXT
+      EventPulses = 0;             /* event counter (ISR) */
+      LastEvents = 0;              /* no timestamp yet */
+      EventEdges = 1;              /* timestamp each event */
+      EventBase = 1;               /* overflow with first event */
+      EventState = EVENT_WAIT;     /* wait for first event */
+      LastSecond = 0;
+      Rate = 0;
+      #else
       Pulses = 0;                  /* pulse counter (ISR) */
+      #endif
       Events = 0;                  /* total value for events */
       TimeTicks = 0;               /* counter for ticks */
       TimeCounter = 0;             /* total value for time (s) */
+      #ifdef EVENT_COUNTER_EXT
+      TCNT0 = 256 - 1;             /* Timer0: overflow with first event */
+      #else
       TCNT0 = 0;                   /* Timer0: reset event/pulse counter */
+      #endif
       TCNT1 = 0;                   /* Timer1: reset time counter */      
 
       /* start counters */
@@ -2591,6 +3698,12 @@ void EventCounter(void)
       /* time counters are managed by ISR */
 
       /* events: get current value */
+      #ifdef EVENT_COUNTER_EXT
+      cli();                            /* disable interrupts */
+      Events = GetEvents();             /* get counts */
+      sei();                            /* enable interrupts */
+      Events *= EVENT_DIV;              /* consider prescaler */
+      #else
       Events = Pulses;                  /* get pulses */
       Events += TCNT0;                  /* add counter */
 
@@ -2601,6 +3714,7 @@ void EventCounter(void)
         /* reached maximum */
         Flag |= STOP_COUNTING;          /* stop counting */
       }
+      #endif
 
       /* manage trigger */
       if (CounterMode == MODE_TIME)          /* time mode */
@@ -2624,6 +3738,18 @@ void EventCounter(void)
       if (TimeTicks == 0)               /* full second */
       { 
         Show |= SHOW_EVENTS | SHOW_TIME;     /* show events and time */
+
+        #ifdef EVENT_COUNTER_EXT
+        /* adapt events per timestamp to about 100 timestamps/s */
+        Value = (uint32_t)(Events - LastSecond);     /* events of last second */
+        LastSecond = Events;
+        Value /= EVENT_DIV * 100;
+        if (Value > 254) Value = 254;
+        EventEdges = Value + 1;         /* 1-255 */
+
+        Rate = GetEventRate(&DecPlaces);     /* update rate */
+        Flag |= SEND_DATA;              /* send results */
+        #endif
       }
     }
 
@@ -2638,6 +3764,17 @@ void EventCounter(void)
       TCCR1B = 0;                  /* disable Timer1 */
       TCCR0B = 0;                  /* disable Timer0 */
 
+      #ifdef EVENT_COUNTER_EXT
+      /* get final results */
+      cli();                       /* disable interrupts */
+      Events = GetEvents();        /* get counts */
+      EventState = EVENT_OFF;      /* no further timestamps */
+      sei();                       /* enable interrupts */
+      Events *= EVENT_DIV;         /* consider prescaler */
+      Rate = GetEventRate(&DecPlaces);
+      Flag |= SEND_DATA;           /* send results */
+      #endif
+
       /* flags are reset later on to allow output of results */
 
       /* display current values for events and time */
@@ -2698,8 +3835,28 @@ void EventCounter(void)
       else                         /* counting */
       {
         /* display events counter */
+        #ifdef EVENT_COUNTER_EXT
+        Display_Events(Events);
+        #else
         Display_FullValue(Events, 0, 0);
+        #endif
+      }
+
+      #ifdef EVENT_COUNTER_EXT
+      /* display event rate (in line #6) */
+      LCD_ClearLine(6);                      /* clear line #6 */
+      LCD_CharPos(1, 6);                     /* go to start of line #6 */
+      if (! (Flag & IDLE_FLAG))    /* counting */
+      {
+        Display_Char('f');                   /* display: f */
+        Display_Space();
+        if (Rate > 0)                        /* got rate */
+        {
+          Display_FullValue(Rate, DecPlaces, 0);
+          Display_EEString(Hertz_str);       /* display: Hz */
+        }
       }
+      #endif
     }
 
 
@@ -2731,6 +3888,28 @@ void EventCounter(void)
     }
 
 
+    /*
+     *  send results via serial
+     */
+
+    #if defined (EVENT_COUNTER_EXT) && defined (UI_SERIAL_COMMANDS)
+    if (Flag & SEND_DATA)          /* new results */
+    {
+      /* send: <time>;<events>;<rate> */
+      Display_LCD2Serial();                  /* switch output to serial */
+      Display_FullValue(TimeCounter, 0, 0);
+      Display_Char(';');
+      Display_Events(Events);
+      Display_Char(';');
+      if (Rate > 0) Display_FullValue(Rate, DecPlaces, 0);
+      Serial_NewLine();
+      Display_Serial2LCD();                  /* switch output back to LCD */
+    }
+    #endif
+
+    Flag &= ~SEND_DATA;            /* clear flag */
+
+
     /*
      *  stop counting (part 2)
      */
@@ -2974,6 +4153,16 @@ void EventCounter(void)
   /* timers */
   TIMSK0 = 0;                 /* disable all interrupts for Timer0 */
   TIMSK1 = 0;                 /* disable all interrupts for Timer1 */
+  #ifdef EVENT_COUNTER_EXT
+  EventState = EVENT_OFF;     /* no special ISR processing */
+  #endif
+
+  #ifdef EVENT_COUNTER_PRESCALER
+  /* filter control lines which were in input mode */ 
+  CtrlDir ^= (1 << COUNTER_CTRL_DIV) | (1 << COUNTER_CTRL_CH0) | (1 << COUNTER_CTRL_CH1);
+  CtrlDir &= (1 << COUNTER_CTRL_DIV) | (1 << COUNTER_CTRL_CH0) | (1 << COUNTER_CTRL_CH1);
+  COUNTER_CTRL_DDR &= ~CtrlDir;         /* set former direction */
+  #endif
 
   /* local constants */
   #undef TOP
@@ -2985,6 +4174,7 @@ void EventCounter(void)
   #undef START_COUNTING
   #undef MANAGE_COUNTING
   #undef STOP_COUNTING
+  #undef SEND_DATA
 
   #undef MODE_COUNT
   #undef MODE_TIME
@@ -3600,8 +4790,56 @@ void OptoCoupler_Tool(void)
 
 #ifdef SW_DS18B20
 
+/*
+ *  DS18B20: display temperature
+ *
+ *  requires:
+ *  - Value: temperature with 4 decimal places
+ *  - Bits: resolution (9-12 bits -> 1-4 decimal places)
+ *  - Unit: 1 to display unit, 0 for plain value
+ */
+
+void DS18B20_Display(int32_t Value, uint8_t Bits, uint8_t Unit)
+{
+  uint8_t           n;             /* counter */
+
+  /* remove decimal places not covered by resolution */
+  n = 12 - Bits;                   /* 0-3 */
+  while (n > 0)
+  {
+    Value /= 10;                   /* one decimal place less */
+    n--;                           /* next digit */
+  }
+
+  Display_SignedFullValue(Value, Bits - 8, 0);
+
+  if (Unit)                        /* display unit */
+  {
+    /* todo: add degree symbol to bitmap fonts */ 
+    Display_Char('\xb0');
+    #ifdef UI_FAHRENHEIT
+      Display_Char('F');           /* display: F (Fahrenheit) */
+    #else
+      Display_Char('C');           /* display: C (Celsius) */
+    #endif
+  }
+}
+
+
+
 /*
  *  temperature sensor DS18B20
+ *  - supports multiple sensors on the bus (up to DS18B20_SENSORS)
+ *  - all sensors convert in parallel, so reading N sensors takes a
+ *    single conversion time
+ *  - converts continuously and keeps min/max/average of each sensor
+ *  - polls the conversion status between checks of the test key,
+ *    so the UI stays responsive during conversion
+ *  - one sensor per line, starting with line #2
+ *  - user interface
+ *    - short key press: next view (current, min, max, average)
+ *    - long key press: next resolution (9-12 bits), resets statistics
+ *    - two short key presses: exit tool
  *
  *  returns:
  *  - 1 on success
@@ -3610,14 +4848,54 @@ void OptoCoupler_Tool(void)
 
 uint8_t DS18B20_Tool(void)
 {
-  uint8_t           Flag = 1;      /* control flag */
+  uint8_t           Flag;          /* control flags */
+  uint8_t           State;         /* bus processing state */
   uint8_t           Test;          /* key / feedback */
-  uint8_t           Bits;          /* bit depth */
+  uint8_t           Bits;          /* resolution */
+  uint8_t           View;          /* values to display */
+  uint8_t           Sensors = 0;   /* number of sensors found */
+  uint8_t           Lines;         /* max. number of sensors */
+  uint8_t           n;             /* counter */
+  uint8_t           Timeout = 0;   /* timeout counter */
   int8_t            Scale;         /* temperature scale 10^x */
   int32_t           Value;         /* temperature value */
-  #ifdef UI_FAHRENHEIT
-  int32_t           Temp;          /* temporary value */
-  #endif
+  uint64_t          Avg;           /* magnitude of sum / average */
+  uint32_t          Samples = 0;   /* sample counter */
+  unsigned char     *String;       /* string pointer (EEPROM) */
+  uint8_t           ROM_Codes[DS18B20_SENSORS * 8];  /* ROM codes */
+  int32_t           Current[DS18B20_SENSORS];  /* current temperature */
+  int32_t           Lowest[DS18B20_SENSORS];   /* min. temperature */
+  int32_t           Highest[DS18B20_SENSORS];  /* max. temperature */
+  int64_t           Sum[DS18B20_SENSORS];      /* sum of temperatures */
+  uint32_t          Count[DS18B20_SENSORS];    /* number of readings */
+  uint8_t           Res[DS18B20_SENSORS];      /* resolution of reading */
+
+  /* control flags */
+  #define RUN_FLAG            0b00000001     /* run flag */
+  #define NEW_BITS            0b00000010     /* set new resolution */
+  #define RESET_STATS         0b00000100     /* reset statistics */
+  #define SHOW_TITLE          0b00001000     /* display title and view */
+  #define SHOW_VALUES         0b00010000     /* display temperatures */
+  #define SEND_DATA           0b00100000     /* send results via serial */
+
+  /* bus processing */
+  #define STATE_SEARCH        1         /* search for sensors */
+  #define STATE_CONVERT       2         /* start conversion */
+  #define STATE_WAIT          3         /* wait for conversion to finish */
+
+  /* view */
+  #define VIEW_CURRENT        0         /* current temperature */
+  #define VIEW_MIN            1         /* min. temperature */
+  #define VIEW_MAX            2         /* max. temperature */
+  #define VIEW_AVG            3         /* average temperature */
+
+  /* timing (in key check cycles) */
+  #define CHECK_TIME          25        /* 25ms per cycle */
+  #define CONV_TIMEOUT        40        /* 1000ms (> 750ms) */
+  #define SEARCH_TIMEOUT      20        /* 500ms */
+
+  /* no valid reading */
+  #define NO_VALUE            INT32_MIN
 
   #ifdef ONEWIRE_PROBES 
   /* inform user about pinout and check for external pull-up resistor */
@@ -3629,74 +4907,316 @@ uint8_t DS18B20_Tool(void)
   }
   #endif
 
-  LCD_ClearLine2();                     /* clear line #2 */
-  Display_EEString(Start_str);          /* display: Start */
+  /* max. number of sensors: one per line (lines #2 and up) */
+  Lines = UI.CharMax_Y - 1;
+  if (Lines > DS18B20_SENSORS) Lines = DS18B20_SENSORS;
+
+  /* set start values */
+  Bits = DS18B20_RESOLUTION;            /* default resolution */
+  View = VIEW_CURRENT;                  /* current temperature */
+  State = STATE_SEARCH;                 /* search for sensors first */
+  Flag = RUN_FLAG | SHOW_TITLE;
 
 
   /*
    *  processing loop
    */
 
-  while (Flag)
+  while (Flag & RUN_FLAG)
   {
-    /* user input */
+    /*
+     *  search for sensors
+     */
 
-    /* wait for user input */
-    Test = TestKey(0, CURSOR_BLINK | CHECK_KEY_TWICE | CHECK_BAT);
+    if ((State == STATE_SEARCH) && (Timeout == 0))
+    {
+      /* clear lines of sensors */
+      n = 0;
+      while (n < Lines)
+      {
+        LCD_ClearLine(n + 2);           /* clear line */
+        n++;                            /* next line */
+      }
 
-    if (Test == KEY_TWICE)         /* two short key presses */
+      Sensors = DS18B20_Search(ROM_Codes, Lines);
+
+      if (Sensors)                 /* found sensor(s) */
+      {
+        State = STATE_CONVERT;     /* start conversion */
+        Flag |= NEW_BITS;          /* set resolution */
+      }
+      else                         /* no sensor */
+      {
+        LCD_CharPos(1, 2);         /* start of line #2 */
+        Display_Char('-');         /* display n/a */
+        Timeout = SEARCH_TIMEOUT;  /* try again later */
+      }
+    }
+
+
+    /*
+     *  manage conversion
+     */
+
+    if (State == STATE_CONVERT)
+    {
+      if (Flag & NEW_BITS)         /* change resolution */
+      {
+        n = 0;
+        while (n < Sensors)
+        {
+          DS18B20_SetResolution(&ROM_Codes[n * 8], Bits);
+          n++;                          /* next sensor */
+        }
+
+        Flag &= ~NEW_BITS;              /* clear flag */
+        Flag |= RESET_STATS;            /* reset statistics */
+      }
+
+      /* start conversion for all sensors */
+      if (DS18B20_StartConversion())    /* ok */
+      {
+        State = STATE_WAIT;        /* wait for conversion */
+        Timeout = CONV_TIMEOUT;
+      }
+      else                              /* bus error */
+      {
+        State = STATE_SEARCH;      /* search again */
+        Timeout = 0;               /* right away */
+      }
+    }
+    else if (State == STATE_WAIT)
     {
-      Flag = 0;                    /* end loop */
+      if (DS18B20_CheckConversion())    /* conversion finished */
+      {
+        /* get temperatures */
+        n = 0;
+        while (n < Sensors)
+        {
+          Value = NO_VALUE;        /* reset value */
+
+          if (DS18B20_ReadTemperature(&ROM_Codes[n * 8], &Value, &Scale, &Test))
+          {
+            /* sensor might have rejected new resolution */
+            Res[n] = Test;         /* save resolution */
+
+            /* normalize to 4 decimal places (Scale: -1 to -4) */
+            while (Scale > -4)
+            {
+              Value *= 10;         /* one decimal place more */
+              Scale--;             /* update scale too */
+            }
+
+            #ifdef UI_FAHRENHEIT
+            /*
+             *  convert \xb0C to \xb0F
+             *  - T[\xb0F] = T[\xb0C] * 9/5 + 32
+             */
+
+            Value *= 9;
+            Value /= 5;
+            Value += 320000;       /* offset (4 decimal places) */
+            #endif
+
+            /* update statistics */
+            if ((Count[n] == 0) || (Value < Lowest[n])) Lowest[n] = Value;
+            if ((Count[n] == 0) || (Value > Highest[n])) Highest[n] = Value;
+            Sum[n] += Value;
+            Count[n]++;
+          }
+
+          Current[n] = Value;      /* save temperature */
+          n++;                     /* next sensor */
+        }
+
+        Samples++;                 /* one more */
+        Flag |= SHOW_VALUES | SEND_DATA;
+        State = STATE_CONVERT;     /* next conversion */
+      }
+      else if (Timeout == 0)            /* conversion timed out */
+      {
+        State = STATE_SEARCH;      /* search again (right away) */
+      }
     }
 
-    LCD_ClearLine2();                   /* clear line #2 */
 
-    if (Flag)            /* ok to proceed */
+    /*
+     *  reset statistics
+     */
+
+    if (Flag & RESET_STATS)
+    {
+      n = 0;
+      while (n < DS18B20_SENSORS)
+      {
+        Current[n] = NO_VALUE;          /* no reading yet */
+        Res[n] = Bits;                  /* requested resolution */
+        Sum[n] = 0;
+        Count[n] = 0;
+        n++;                            /* next sensor */
+      }
+
+      Samples = 0;                      /* reset sample counter */
+      Flag &= ~RESET_STATS;             /* clear flag */
+      Flag |= SHOW_VALUES;              /* update display */
+    }
+
+
+    /*
+     *  display title and view (line #1)
+     */
+
+    if (Flag & SHOW_TITLE)
     {
-      /* get temperature from DS18B20 (in C) */
-      Test = DS18B20_ReadTemperature(&Value, &Scale, &Bits);
+      LCD_ClearLine(1);
+      LCD_CharPos(1, 1);
+      Display_EEString(DS18B20_str);    /* display: DS18B20 */
 
-      if (Test)                    /* got temperature */
+      String = NULL;
+      if (View == VIEW_MIN) String = (unsigned char *)Min_str;
+      else if (View == VIEW_MAX) String = (unsigned char *)Max_str;
+      else if (View == VIEW_AVG) String = (unsigned char *)Avg_str;
+
+      if (String)                  /* statistics */
       {
-        /* Scale should be -1 to -4: 1-4 decimal places */
-        Scale = -Scale;
+        Display_Space();
+        Display_EEString(String);       /* display view */
+      }
 
-        #ifdef UI_FAHRENHEIT
-        /*
-         *  convert C to F
-         *  - T[F] = T[C] * 9/5 + 32
-         */
+      Flag &= ~SHOW_TITLE;              /* clear flag */
+    }
+
+
+    /*
+     *  display temperatures (lines #2 and up)
+     */
 
-        Value *= 9;
-        Value /= 5;
-        Temp = 32;            /* offset */
+    if ((Flag & SHOW_VALUES) && (State != STATE_SEARCH))
+    {
+      n = 0;
+      while (n < Sensors)
+      {
+        LCD_ClearLine(n + 2);
+        LCD_CharPos(1, n + 2);          /* start of line */
 
-        /* scale offset to match temperature's scale */
-        Test = Scale;         /* decimal places */
-        while (Test > 0)
+        if (Sensors > 1)                /* multiple sensors */
         {
-          Temp *= 10;         /* scale by 10^1 */
-          Test--;             /* next digit */
+          Display_Char('1' + n);        /* display: sensor number */
+          Display_Space();
         }
-        Value += Temp;        /* add scaled offset */
-        #endif
 
-        /* todo: add degree symbol to bitmap fonts */ 
-        Display_SignedFullValue(Value, Scale, '');
+        /* get value to display */
+        Value = Current[n];
+        if (Count[n] > 0)               /* valid statistics */
+        {
+          if (View == VIEW_MIN) Value = Lowest[n];
+          else if (View == VIEW_MAX) Value = Highest[n];
+          else if (View == VIEW_AVG)
+          {
+            /* divide magnitude to avoid signed 64 bit division */
+            if (Sum[n] < 0) Avg = -Sum[n];
+            else Avg = Sum[n];
+            Div64_32(&Avg, Count[n]);
+            Value = (int32_t)Avg;
+            if (Sum[n] < 0) Value = -Value;
+          }
+        }
 
-        #ifdef UI_FAHRENHEIT
-          Display_Char('F');       /* display: F (Fahrenheit) */
-        #else
-          Display_Char('C');       /* display: C (Celsius) */
-        #endif
+        if (Value != NO_VALUE)          /* valid temperature */
+        {
+          DS18B20_Display(Value, Res[n], 1);
+        }
+        else                            /* some error */
+        {
+          Display_Char('-');            /* display n/a */
+        }
+
+        n++;                            /* next sensor */
       }
-      else                         /* some error */
+    }
+
+    Flag &= ~SHOW_VALUES;               /* clear flag */
+
+
+    /*
+     *  send results via serial
+     */
+
+    #ifdef UI_SERIAL_COMMANDS
+    if (Flag & SEND_DATA)          /* new results */
+    {
+      /* send: <sample>;<temperature #1>;<temperature #2>;... */
+      Display_LCD2Serial();                  /* switch output to serial */
+      Display_FullValue(Samples, 0, 0);
+      n = 0;
+      while (n < Sensors)
       {
-        Display_Char('-');         /* display n/a */
+        Display_Char(';');
+        if (Current[n] != NO_VALUE) DS18B20_Display(Current[n], Res[n], 0);
+        n++;                                 /* next sensor */
       }
+      Serial_NewLine();
+      Display_Serial2LCD();                  /* switch output back to LCD */
+    }
+    #endif
+
+    Flag &= ~SEND_DATA;            /* clear flag */
+
+
+    /*
+     *  user feedback
+     *  - short timeout for polling the conversion status
+     */
+
+    Test = TestKey(CHECK_TIME, CHECK_KEY_TWICE | CHECK_BAT);
+
+    if (Timeout > 0) Timeout--;    /* update timeout counter */
+
+    if (Test == KEY_SHORT)              /* short key press */
+    {
+      /* next view */
+      View++;
+      if (View > VIEW_AVG) View = VIEW_CURRENT;
+
+      Flag |= SHOW_TITLE | SHOW_VALUES;
+    }
+    else if (Test == KEY_LONG)          /* long key press */
+    {
+      /* next resolution (applied with next conversion) */
+      Bits++;
+      if (Bits > 12) Bits = 9;
+
+      Flag |= NEW_BITS;
+    }
+    else if (Test == KEY_TWICE)         /* two short key presses */
+    {
+      Flag = 0;                         /* end loop */
     }
   }
 
+  /* clean up */
+  #undef RUN_FLAG
+  #undef NEW_BITS
+  #undef RESET_STATS
+  #undef SHOW_TITLE
+  #undef SHOW_VALUES
+  #undef SEND_DATA
+
+  #undef STATE_SEARCH
+  #undef STATE_CONVERT
+  #undef STATE_WAIT
+
+  #undef VIEW_CURRENT
+  #undef VIEW_MIN
+  #undef VIEW_MAX
+  #undef VIEW_AVG
+
+  #undef CHECK_TIME
+  #undef CONV_TIMEOUT
+  #undef SEARCH_TIMEOUT
+
+  #undef NO_VALUE
+
   return 1;                   /* signal success */
 }
 
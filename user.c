@@ -35,6 +35,65 @@
 #define DIR_NONE         0b00000000     /* no turn or error */
 #define DIR_RESET        0b00000001     /* reset state */
 
+#ifdef UI_KEY_EVENTS
+
+/* key events */
+#define KEY_QUEUE_SIZE   8              /* size of event queue (2^n) */
+#define KEY_EVENT_TEST   50             /* event: test key pressed */
+
+/* pin change interrupt for test key and rotary encoder */
+#define KEY_PC_TEST      (BUTTON_PCINT % 8)      /* test key */
+#ifdef HW_ENCODER
+  #define KEY_PC_A       (ENCODER_PCINT_A % 8)   /* encoder A signal */
+  #define KEY_PC_B       (ENCODER_PCINT_B % 8)   /* encoder B signal */
+#endif
+
+#if (BUTTON_PCINT >= 0) && (BUTTON_PCINT <= 7)
+  #define KEY_PC_IRQ          PCIE0     /* Pin Change Interrupt Enable 0 */
+  #define KEY_PC_MASK         PCMSK0    /* Pin Change Mask Register 0 */
+  #define ISR_KEY_PINCHANGE   PCINT0_vect    /* ISR */
+#endif
+
+#if (BUTTON_PCINT >= 8) && (BUTTON_PCINT <= 15)
+  #define KEY_PC_IRQ          PCIE1     /* Pin Change Interrupt Enable 1 */
+  #define KEY_PC_MASK         PCMSK1    /* Pin Change Mask Register 1 */
+  #define ISR_KEY_PINCHANGE   PCINT1_vect    /* ISR */
+#endif
+
+#if (BUTTON_PCINT >= 16) && (BUTTON_PCINT <= 23)
+  #define KEY_PC_IRQ          PCIE2     /* Pin Change Interrupt Enable 2 */
+  #define KEY_PC_MASK         PCMSK2    /* Pin Change Mask Register 2 */
+  #define ISR_KEY_PINCHANGE   PCINT2_vect    /* ISR */
+#endif
+
+#if (BUTTON_PCINT >= 24) && (BUTTON_PCINT <= 31)
+  #define KEY_PC_IRQ          PCIE3     /* Pin Change Interrupt Enable 3 */
+  #define KEY_PC_MASK         PCMSK3    /* Pin Change Mask Register 3 */
+  #define ISR_KEY_PINCHANGE   PCINT3_vect    /* ISR */
+#endif
+
+#endif
+
+
+
+/*
+ *  local variables
+ */
+
+#ifdef UI_KEY_EVENTS
+/* event queue (filled by ISR) */
+volatile uint8_t    KeyQueue[KEY_QUEUE_SIZE];     /* events */
+volatile uint8_t    KeyHead = 0;        /* write index (ISR) */
+volatile uint8_t    KeyTail = 0;        /* read index */
+uint8_t             KeyArm = 0;         /* release counter for test key */
+
+#ifdef HW_ENCODER
+/* rotary encoder (managed by ISR) */
+volatile uint8_t    EncAB;              /* last AB state */
+volatile int8_t     EncCount = 0;       /* Gray code pulses (+: right) */
+#endif
+#endif
+
 
 
 /* ************************************************************************
@@ -205,7 +264,237 @@ uint8_t EEStringLength(const unsigned char *String)
  * ************************************************************************ */
 
 
-#ifdef HW_ENCODER 
+#ifdef UI_KEY_EVENTS
+
+/*
+ *  add event to queue
+ *  - called by ISR
+ *  - drops event if queue is full
+ *
+ *  requires:
+ *  - Event: key event
+ */
+
+void Key_PutEvent(uint8_t Event)
+{
+  uint8_t           Next;          /* next write index */
+
+  Next = KeyHead + 1;
+  Next &= (KEY_QUEUE_SIZE - 1);    /* wrap around */
+
+  if (Next != KeyTail)             /* queue not full */
+  {
+    KeyQueue[KeyHead] = Event;     /* save event */
+    KeyHead = Next;                /* update write index */
+  }
+}
+
+
+
+/*
+ *  get next event from queue
+ *
+ *  returns:
+ *  - KEY_NONE for empty queue
+ *  - key event
+ */
+
+uint8_t Key_GetEvent(void)
+{
+  uint8_t           Event = KEY_NONE;   /* return value */
+  uint8_t           Tail;               /* read index */
+
+  Tail = KeyTail;                  /* get read index */
+
+  if (Tail != KeyHead)             /* got event */
+  {
+    Event = KeyQueue[Tail];        /* get event */
+    Tail++;
+    Tail &= (KEY_QUEUE_SIZE - 1);  /* wrap around */
+    KeyTail = Tail;                /* update read index */
+  }
+
+  return Event;
+}
+
+
+
+/*
+ *  check for pending UI event
+ *  - key event in queue, pen-down event of touch screen, received
+ *    command line or break signal
+ *  - wake-up condition for Timer_Sleep(WAKE_EVENT)
+ *
+ *  returns:
+ *  - 0 for no pending event
+ *  - 1 for pending event
+ */
+
+uint8_t Key_Pending(void)
+{
+  uint8_t           Flag = 0;      /* return value */
+
+  if (KeyTail != KeyHead)          /* key event */
+  {
+    Flag = 1;
+  }
+  #ifdef HW_TOUCH
+  else if (TouchEvent)             /* pen-down event */
+  {
+    Flag = 1;
+  }
+  #endif
+  else if (Cfg.OP_Control & (OP_BREAK_KEY | OP_RX_LOCKED))
+  {
+    Flag = 1;                      /* break signal or command */
+  }
+
+  return Flag;
+}
+
+
+
+/*
+ *  re-arm test key after release
+ *  - ISR disarms test key after a key press to ignore bouncing
+ *  - requires released key for two consecutive calls (debouncing)
+ */
+
+void Key_ArmTestKey(void)
+{
+  if (KEY_PC_MASK & (1 << KEY_PC_TEST))   /* already armed */
+  {
+    return;
+  }
+
+  if (BUTTON_PIN & (1 << TEST_BUTTON))    /* test key released */
+  {
+    KeyArm++;                           /* increase counter */
+
+    if (KeyArm >= 2)                    /* stable */
+    {
+      KEY_PC_MASK |= (1 << KEY_PC_TEST);     /* enable pin change */
+      KeyArm = 0;                       /* reset counter */
+    }
+  }
+  else                                  /* test key pressed */
+  {
+    KeyArm = 0;                         /* reset counter */
+  }
+}
+
+
+
+/*
+ *  set up event-driven input
+ *  - pin change interrupt for test key and rotary encoder
+ *  - test key and encoder require dedicated IO pins
+ */
+
+void Key_Init(void)
+{
+  #ifdef HW_ENCODER
+  uint8_t           Temp;          /* port state */
+
+  /* set encoder's A & B pins to input */
+  ENCODER_DDR &= ~((1 << ENCODER_A) | (1 << ENCODER_B));
+
+  /* get current AB state */
+  Temp = ENCODER_PIN;
+  EncAB = 0;
+  if (Temp & (1 << ENCODER_A)) EncAB = 0b00000010;
+  if (Temp & (1 << ENCODER_B)) EncAB |= 0b00000001;
+
+  /* enable pin change for A & B */
+  KEY_PC_MASK |= (1 << KEY_PC_A) | (1 << KEY_PC_B);
+  #endif
+
+  /* test key: armed when released */
+  if (BUTTON_PIN & (1 << TEST_BUTTON))     /* test key released */
+  {
+    KEY_PC_MASK |= (1 << KEY_PC_TEST);     /* enable pin change */
+  }
+
+  PCICR |= (1 << KEY_PC_IRQ);      /* enable pin change interrupt */
+}
+
+
+
+/*
+ *  ISR for pin change of test key and rotary encoder
+ *  - test key: signals key press and disarms pin change
+ *    (re-armed by Key_ArmTestKey() after release)
+ *  - rotary encoder: decodes Gray code, bouncing pulses cancel
+ *    each other out by the up/down counter
+ */
+
+ISR(ISR_KEY_PINCHANGE, ISR_BLOCK)
+{
+  #ifdef HW_ENCODER
+  uint8_t           Temp;          /* temporary value */
+  uint8_t           AB = 0;        /* new AB state */
+  #endif
+
+  /* test push button (low active) */
+  if (KEY_PC_MASK & (1 << KEY_PC_TEST))    /* armed */
+  {
+    if (! (BUTTON_PIN & (1 << TEST_BUTTON)))    /* key pressed */
+    {
+      KEY_PC_MASK &= ~(1 << KEY_PC_TEST);  /* disarm until release */
+      Key_PutEvent(KEY_EVENT_TEST);        /* signal key press */
+    }
+  }
+
+  #ifdef HW_ENCODER
+  /* get A & B signals */
+  Temp = ENCODER_PIN;
+  if (Temp & (1 << ENCODER_A)) AB = 0b00000010;
+  if (Temp & (1 << ENCODER_B)) AB |= 0b00000001;
+
+  if (AB != EncAB)                 /* signals changed */
+  {
+    /* check if only one bit has changed (Gray code) */
+    Temp = AB ^ EncAB;             /* get bit difference */
+    if (Temp != 0b00000011)        /* valid change */
+    {
+      /* determine direction */
+      /* Gray code: 00 01 11 10 */
+      Temp = 0b10001101;           /* expected values for a right turn */
+      Temp >>= (EncAB * 2);        /* get expected value by shifting */
+      Temp &= 0b00000011;          /* select value */
+
+      if (Temp == AB)              /* turn to the right */
+      {
+        EncCount++;
+
+        if (EncCount >= ENCODER_PULSES)     /* reached step */
+        {
+          EncCount = 0;
+          Key_PutEvent(KEY_RIGHT);
+        }
+      }
+      else                         /* turn to the left */
+      {
+        EncCount--;
+
+        if (EncCount <= -ENCODER_PULSES)    /* reached step */
+        {
+          EncCount = 0;
+          Key_PutEvent(KEY_LEFT);
+        }
+      }
+    }
+
+    EncAB = AB;                    /* save new state */
+  }
+  #endif
+}
+
+#endif
+
+
+
+#if defined (HW_ENCODER) && ! defined (UI_KEY_EVENTS)
 
 /*
  *  read rotary encoder
@@ -560,6 +849,11 @@ uint8_t ReadTouchScreen(void)
  *    (e.g. set by an interrupt handler to deal with an infinite timeout)
  *  - optional auto-power-off for auto-hold mode (signaled by OP_PWR_TIMEOUT
  *    via Cfg.OP_Control) 
+ *  - timeout, battery check, blinking cursor and auto-power-off are
+ *    managed by soft timers
+ *  - with UI_KEY_EVENTS the test key and the rotary encoder are taken
+ *    from the event queue filled by the pin change ISR, and the MCU
+ *    sleeps until the next event or soft timer deadline
  *
  *  requires:
  *  - Timeout in ms 
@@ -603,21 +897,21 @@ uint8_t TestKey(uint16_t Timeout, uint8_t Mode)
   #ifdef UI_KEY_HINTS
   uint8_t           Pos = 0;            /* X position for text */
   #endif
+  #ifdef UI_KEY_EVENTS
+  uint8_t           Event;              /* key event */
+  uint8_t           Poll = 0;           /* polling tick */
+  #endif
 
   /*
    *  init
    */
 
-  #ifdef HW_ENCODER
+  #if defined (HW_ENCODER) && ! defined (UI_KEY_EVENTS)
     /* rotary encoder: sample each 2.5ms (1ms would be ideal) */
     #define DELAY_TICK   2         /* 2ms + 0.5ms for ReadEncoder() */
-    #define DELAY_500    200       /* ticks for 500ms */
-    #define DELAY_100    40        /* ticks for 100ms */
   #else
-    /* just the test key */
+    /* just the test key (or events) */
     #define DELAY_TICK   5         /* 5ms */
-    #define DELAY_500    100       /* ticks for 500ms */
-    #define DELAY_100    20        /* ticks for 100ms */
   #endif
 
   #ifdef HW_ENCODER
@@ -625,6 +919,9 @@ uint8_t TestKey(uint16_t Timeout, uint8_t Mode)
   UI.EncDir = DIR_RESET;      /* resets also UI.EncState and .EncTicks */
   UI.EncPulses = 0;
   Timeout2 = 50;
+    #ifdef UI_KEY_EVENTS
+    UI.EncTicks = 0;          /* reset time counter */
+    #endif
   #endif
 
   #ifdef HW_KEYS
@@ -679,6 +976,16 @@ uint8_t TestKey(uint16_t Timeout, uint8_t Mode)
     LCD_Cursor(1);            /* enable cursor on display */
   }
 
+  /* start soft timers */
+  if (Timeout > 0)            /* timeout enabled */
+  {
+    Timer_Start(TIMER_KEY_TIMEOUT, Timeout, TIMER_ONESHOT);
+  }
+  #ifndef BAT_NONE
+  Timer_Start(TIMER_KEY_100MS, 100, TIMER_PERIODIC);
+  #endif
+  Timer_Start(TIMER_KEY_500MS, 500, TIMER_PERIODIC);
+
 
   /*
    *  wait for user feedback or timeout
@@ -689,11 +996,7 @@ uint8_t TestKey(uint16_t Timeout, uint8_t Mode)
     /* take care about feedback timeout */
     if (Timeout > 0)               /* timeout enabled */
     {
-      if (Timeout > DELAY_TICK)    /* some time left */
-      {
-        Timeout -= DELAY_TICK;     /* decrease timeout */
-      }
-      else                         /* timeout */
+      if (Timer_Expired(TIMER_KEY_TIMEOUT))  /* timeout */
       {
         Run = 0;                   /* end loop */
       }
@@ -705,13 +1008,27 @@ uint8_t TestKey(uint16_t Timeout, uint8_t Mode)
      *  - push button is low active
      */
 
+    #ifdef UI_KEY_EVENTS
+    Event = Key_GetEvent();        /* get next event */
+    Test = 1;                      /* default: not pressed */
+    if (Event == KEY_EVENT_TEST) Test = 0;   /* test key pressed */
+    #else
     Test = BUTTON_PIN & (1 << TEST_BUTTON);  /* get button status */
+    #endif
 
     if (Test == 0)            /* test button pressed */
     {
       Ticks = 0;              /* reset counter */
       MilliSleep(30);         /* time to debounce */
 
+      #ifdef UI_KEY_EVENTS
+      /* drop stale event (key pressed while someone polled it directly) */
+      if (BUTTON_PIN & (1 << TEST_BUTTON))   /* key released */
+      {
+        continue;                            /* next loop run */
+      }
+      #endif
+
       while (Run)             /* detect how long key is pressed */
       {
         Test = BUTTON_PIN & (1 << TEST_BUTTON);   /* get button status */
@@ -801,7 +1118,17 @@ uint8_t TestKey(uint16_t Timeout, uint8_t Mode)
        */
 
       #ifdef HW_ENCODER
+      #ifdef UI_KEY_EVENTS
+      /* step from event queue */
+      Test = KEY_NONE;
+      if ((Event == KEY_RIGHT) || (Event == KEY_LEFT))
+      {
+        Test = Event;              /* got step */
+        if (UI.EncTicks == 0) UI.EncTicks = 1;    /* start time counter */
+      }
+      #else
       Test = ReadEncoder();        /* read rotary encoder */
+      #endif
 
       if (Test)                    /* got user input */
       {
@@ -869,10 +1196,57 @@ uint8_t TestKey(uint16_t Timeout, uint8_t Mode)
        *  timing
        */
 
-      /* delay for next loop run */
-      MilliSleep(DELAY_TICK);           /* wait a little bit */
+      #ifdef UI_KEY_EVENTS
+      /*
+       *  sleep until next event or deadline
+       *  - polling tick only while the test key waits for re-arming,
+       *    the encoder's velocity detection runs or for the inc/dec keys
+       *  - touch screen wakes us up by its pen-down event
+       */
+
+      #ifdef HW_INCDEC_KEYS
+      Test = 1;                              /* polled inputs */
+      #else
+      Test = ! (KEY_PC_MASK & (1 << KEY_PC_TEST));    /* key disarmed */
+        #ifdef HW_ENCODER
+        if (UI.EncTicks > 0) Test = 1;       /* velocity detection */
+        #endif
+      #endif
+
+      if (Test)                         /* polling required */
+      {
+        if (! Poll)                     /* tick not running */
+        {
+          Timer_Start(TIMER_KEY_POLL, DELAY_TICK, TIMER_PERIODIC);
+          Poll = 1;
+        }
+      }
+      else if (Poll)                    /* tick not required anymore */
+      {
+        Timer_Stop(TIMER_KEY_POLL);
+        Poll = 0;
+      }
 
-      Ticks++;                          /* increase counter */
+      Timer_Sleep(WAKE_EVENT);          /* sleep until event or deadline */
+
+      if (Timer_Expired(TIMER_KEY_POLL))     /* polling tick */
+      {
+        Key_ArmTestKey();               /* re-arm test key after release */
+
+        #ifdef HW_ENCODER
+        /* time counter for turning velocity (2.5ms units) */
+        if ((UI.EncTicks > 0) && (UI.EncTicks < 249))
+        {
+          UI.EncTicks += 2;             /* add 5ms */
+        }
+        #endif
+      }
+      #else
+      /* delay for next loop run */
+      Timer_Start(TIMER_KEY_POLL, DELAY_TICK, TIMER_ONESHOT);
+      Timer_Sleep(WAKE_DEADLINE);       /* sleep until next deadline */
+      Timer_Stop(TIMER_KEY_POLL);       /* we know it's expired */
+      #endif
 
       #ifndef BAT_NONE
       /*
@@ -880,7 +1254,7 @@ uint8_t TestKey(uint16_t Timeout, uint8_t Mode)
        *  - for battery monitoring
        */
 
-      if (Ticks % DELAY_100 == 0)       /* every 100ms */
+      if (Timer_Expired(TIMER_KEY_100MS))    /* every 100ms */
       {
         if (Cfg.BatTimer > 1)           /* timeout not zero yet */
         {
@@ -904,10 +1278,8 @@ uint8_t TestKey(uint16_t Timeout, uint8_t Mode)
        *  - also for optional auto power-off
        */
 
-      if (Ticks == DELAY_500)           /* every 500ms */
+      if (Timer_Expired(TIMER_KEY_500MS))    /* every 500ms */
       {
-        Ticks = 0;                      /* reset counter */
-
         /* blinking cursor */
         if (Mode & CURSOR_BLINK)        /* blinking cursor enabled */
         {
@@ -960,6 +1332,14 @@ uint8_t TestKey(uint16_t Timeout, uint8_t Mode)
     LCD_Cursor(0);            /* disable cursor on display */
   }
 
+  /* stop soft timers */
+  #ifdef UI_KEY_EVENTS
+  Timer_Stop(TIMER_KEY_POLL);
+  #endif
+  Timer_Stop(TIMER_KEY_TIMEOUT);
+  Timer_Stop(TIMER_KEY_100MS);
+  Timer_Stop(TIMER_KEY_500MS);
+
   #ifdef UI_KEY_HINTS
   if (Pos)                    /* show key hint */
   {
@@ -981,7 +1361,6 @@ uint8_t TestKey(uint16_t Timeout, uint8_t Mode)
   }
   #endif
 
-  #undef DELAY_500
   #undef DELAY_TICK
 
   return Key;
@@ -1544,8 +1923,14 @@ uint8_t PresentMainMenu(void)
     #define ITEM_21      0
   #endif
 
-  #define MENU_ITEMS (ITEM_0 + ITEM_6 + ITEM_7 + ITEM_8 + ITEM_9 + ITEM_10 + ITEM_11 + ITEM_12 + ITEM_13 + ITEM_14 + ITEM_15 + ITEM_16 + ITEM_17 + ITEM_18 + ITEM_19 + ITEM_20 + ITEM_21)
-//  #define MENU_ITEMS     22             /* worst case */
+  #if defined (SW_DDS) && defined (HW_KEYS)
+    #define ITEM_22      1
+  #else
+    #define ITEM_22      0
+  #endif
+
+  #define MENU_ITEMS (ITEM_0 + ITEM_6 + ITEM_7 + ITEM_8 + ITEM_9 + ITEM_10 + ITEM_11 + ITEM_12 + ITEM_13 + ITEM_14 + ITEM_15 + ITEM_16 + ITEM_17 + ITEM_18 + ITEM_19 + ITEM_20 + ITEM_21 + ITEM_22)
+//  #define MENU_ITEMS     23             /* worst case */
 
   uint8_t           Item = 0;           /* item number */
   uint8_t           ID;                 /* ID of selected item */
@@ -1568,6 +1953,14 @@ uint8_t PresentMainMenu(void)
   MenuID[Item] = 7;
   Item++;
   #endif
+  #if defined (SW_DDS) && defined (HW_KEYS)
+  if (UI.CharMax_Y > 5)                      /* more than 5 lines */
+  {
+    MenuItem[Item] = (void *)DDS_str;        /* DDS Signal Generator */
+    MenuID[Item] = 22;
+    Item++;
+  }
+  #endif
   #ifdef HW_ZENER
   MenuItem[Item] = (void *)Zener_str;        /* Zener tool */
   MenuID[Item] = 8;  
@@ -1821,6 +2214,12 @@ void MainMenu(void)
       EventCounter();
       break;
     #endif
+
+    #if defined (SW_DDS) && defined (HW_KEYS)
+    case 22:             /* DDS signal generator */
+      DDS_SignalGenerator();
+      break;
+    #endif
   }
 
   /* display result */
@@ -1841,6 +2240,18 @@ void MainMenu(void)
 /* source management */
 #undef USER_C
 
+/* key events */
+#ifdef UI_KEY_EVENTS
+  #undef KEY_QUEUE_SIZE
+  #undef KEY_EVENT_TEST
+  #undef KEY_PC_TEST
+  #undef KEY_PC_A
+  #undef KEY_PC_B
+  #undef KEY_PC_IRQ
+  #undef KEY_PC_MASK
+  #undef ISR_KEY_PINCHANGE
+#endif
+
 
 
 /* ************************************************************************
@@ -78,11 +78,23 @@
     const unsigned char SquareWave_str[] EEMEM = "Square Wave";
   #endif
 
+  #if defined (SW_DDS) && defined (HW_KEYS)
+    const unsigned char DDS_str[] EEMEM = "DDS Generator";
+  #endif
+
   #ifdef HW_ZENER
     const unsigned char Zener_str[] EEMEM = "Zener";
+  #endif
+
+  #if defined (HW_ZENER) || defined (SW_DS18B20)
     const unsigned char Min_str[] EEMEM = "Min";
   #endif
 
+  #ifdef SW_DS18B20
+    const unsigned char Max_str[] EEMEM = "Max";
+    const unsigned char Avg_str[] EEMEM = "Avg";
+  #endif
+
   #ifdef HW_FREQ_COUNTER
     const unsigned char FreqCounter_str[] EEMEM = "Freq. Counter";
   #endif
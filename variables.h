@@ -25,6 +25,10 @@
   #include "colors.h"
 #endif
 
+#ifndef CMD_HASH_H
+  #include "cmd_hash.h"
+#endif
+
 
 
 /* ************************************************************************
@@ -46,12 +50,35 @@
 
   /* buffers */
   char              OutBuffer[OUT_BUFFER_SIZE];   /* output buffer */
+  #ifdef SERIAL_TX_BUFFER
+  uint8_t           TX_Buffer[SERIAL_TX_BUFFER];  /* serial TX buffer */
+  volatile uint8_t  TX_Head = 0;                  /* write position */
+  volatile uint8_t  TX_Tail = 0;                  /* read position */
+  #endif
+  #ifdef SERIAL_BITBANG
+  volatile uint8_t  Serial_Flags = SER_RX_PAUSED;  /* bit-bang serial state */
+  uint8_t           Serial_Ticks;            /* timer ticks per bit */
+  uint8_t           Serial_Clock;            /* timer prescaler bits */
+  uint16_t          Serial_Loops;            /* delay loops per bit */
+  uint8_t           TX_Char;                 /* TX char (bit buffer) */
+  uint8_t           TX_Bits;                 /* bit counter for TX char */
+  uint8_t           TX_Time;                 /* timer value for next TX bit */
+  #endif
   #ifdef SERIAL_RW
   char              RX_Buffer[RX_BUFFER_SIZE];    /* serial RX buffer */
   uint8_t           RX_Pos = 0;                   /* position in buffer */
+    #ifdef SERIAL_RX_QUEUE
+    uint8_t           RX_Queue[SERIAL_RX_QUEUE];  /* queue of RX lines */
+    volatile uint8_t  RX_Head = 0;           /* write position */
+    volatile uint8_t  RX_Tail = 0;           /* read position */
+    volatile uint8_t  RX_Start = 0;          /* start of current line */
+    volatile uint8_t  RX_Lines = 0;          /* number of complete lines */
+    volatile uint8_t  RX_State = 0;          /* state of queue */
+    #endif
     #ifdef SERIAL_BITBANG
     uint8_t         RX_Char;                 /* RX char (bit buffer) */
     uint8_t         RX_Bits;                 /* bit counter for RX char */
+    uint8_t         RX_Time;                 /* timer value for next RX bit */
     #endif
   #endif
 
@@ -62,6 +89,7 @@
 
   #ifdef HW_TOUCH
   Touch_Type        Touch;                   /* touch screen adjustment offsets */
+  volatile uint8_t  TouchEvent = 0;          /* pen-down event (ISR for /PEN_IRQ) */
   #endif
 
   /* probing */
@@ -219,6 +247,120 @@
     const unsigned char IR_SIRC_20_str[] EEMEM = "SIRC-20";
   #endif
 
+  #if defined (SW_IR_RECEIVER) || defined (HW_IR_RECEIVER)
+    /*
+     *  protocol table (flash)
+     *  - name, start pulse, pause, alt. pause, start timing, items,
+     *    {skip, modulation, tS, t0, t1, timing}, bits, flags,
+     *    special, parameter, tag, {fields}
+     */
+
+    const IR_Proto_Type IR_Proto_Table[] PROGMEM = {
+      /* NEC: 16 bit address if not inverted */
+      {IR_NEC_str, 179, 89, 0, IR_START(IR_RELAX_LONG, IR_RELAX_LONG), 0,
+       {2, IR_MOD_PXM, 11, 11, 33, IR_STD_TOLER}, 32, IR_LSB,
+       IR_SPEC_INV, 0, 0, {1, 16, 17, 8, IR_NO_FIELD}},
+      #ifdef SW_IR_RX_EXTRA
+      /* Sanyo: same start and timing as NEC */
+      {IR_Sanyo_str, 179, 89, 0, IR_START(IR_RELAX_LONG, IR_RELAX_LONG), 0,
+       {2, IR_MOD_PXM, 11, 11, 33, IR_STD_TOLER}, 42, IR_LSB,
+       IR_SPEC_NONE, 0, 0, {1, 13, 27, 8, IR_NO_FIELD}},
+      #endif
+      /* NEC repeat sequence */
+      {IR_NEC_str, 179, 45, 0, IR_START(IR_RELAX_LONG, IR_STD_TOLER), 3,
+       {2, IR_MOD_NONE, 11, 0, 0, IR_STD_TOLER}, 0, IR_LSB,
+       IR_SPEC_NONE, 0, 'R', {IR_NO_FIELD, IR_NO_FIELD, IR_NO_FIELD}},
+      /* Proton: sync pause between address and command */
+      {IR_Proton_str, 162, 80, 0, IR_START(IR_RELAX_LONG, IR_STD_TOLER), 37,
+       {2, IR_MOD_PXM, 11, 11, 30, IR_STD_TOLER}, 17, IR_LSB | IR_LOCK,
+       IR_SPEC_SYNC, 17, 0, {1, 8, 10, 8, IR_NO_FIELD}},
+      /* JVC: standard and alternative start pulse */
+      {IR_JVC_str, 168, 84, 0, IR_START(IR_STD_TOLER, IR_STD_TOLER), 0,
+       {2, IR_MOD_PXM, 11, 11, 32, IR_STD_TOLER}, 16, IR_LSB,
+       IR_SPEC_NONE, 0, 0, {1, 8, 9, 8, IR_NO_FIELD}},
+      {IR_JVC_str, 184, 84, 0, IR_START(IR_RELAX_LONG, IR_STD_TOLER), 0,
+       {2, IR_MOD_PXM, 11, 11, 32, IR_STD_TOLER}, 16, IR_LSB,
+       IR_SPEC_NONE, 0, 0, {1, 8, 9, 8, IR_NO_FIELD}},
+      /* Matsushita: C6D6 and C5D6 */
+      {IR_Matsushita_str, 70, 70, 0, IR_START(IR_STD_TOLER, IR_STD_TOLER), 0,
+       {2, IR_MOD_PXM, 17, 17, 52, IR_RELAX_LONG}, 24, IR_LSB | IR_LOCK,
+       IR_SPEC_NONE, 0, '6', {1, 6, 7, 6, IR_NO_FIELD}},
+      #ifdef SW_IR_RX_EXTRA
+      {IR_Matsushita_str, 70, 70, 0, IR_START(IR_STD_TOLER, IR_STD_TOLER), 0,
+       {2, IR_MOD_PXM, 17, 17, 52, IR_RELAX_LONG}, 22, IR_LSB | IR_LOCK,
+       IR_SPEC_NONE, 0, '5', {1, 5, 6, 6, IR_NO_FIELD}},
+      #endif
+      /* Kaseikyo: manufacturer:system-product:function */
+      {IR_Kaseikyo_str, 70, 34, 0, IR_START(IR_STD_TOLER, IR_STD_TOLER), 0,
+       {2, IR_MOD_PXM, 8, 8, 26, IR_RELAX_SHORT}, 48, IR_LSB | IR_LOCK,
+       IR_SPEC_NIBBLE, 21, 0, {1, 16, 25, 8, 33, 8}},
+      #ifdef SW_IR_RX_EXTRA
+      /* RCA: repeat delay is shorter than sample timeout */
+      {IR_RCA_str, 79, 79, 0, IR_START(IR_RELAX_LONG, IR_RELAX_LONG), 0,
+       {2, IR_MOD_PXM, 10, 20, 40, IR_RELAX_SHORT}, 24, IR_MSB,
+       IR_SPEC_TRUNC, 49, 0, {1, 4, 5, 8, IR_NO_FIELD}},
+      #endif
+      /* Motorola: start/end packet is all 1s */
+      {IR_Motorola_str, 11, 52, 0, IR_START(IR_STD_TOLER, IR_STD_TOLER), 0,
+       {2, IR_MOD_BIPHASE | IR_THOMAS, 11, 0, 0, IR_STD_TOLER}, 10, IR_LSB,
+       IR_SPEC_FRAME, 0b111111111, 0, {2, 9, IR_NO_FIELD, IR_NO_FIELD}},
+      #ifdef SW_IR_RX_EXTRA
+      /* IR60: same start and timing as Motorola, start/end packet is 62 */
+      {IR_IR60_str, 11, 52, 0, IR_START(IR_STD_TOLER, IR_STD_TOLER), 0,
+       {2, IR_MOD_BIPHASE | IR_THOMAS, 11, 0, 0, IR_STD_TOLER}, 7, IR_LSB,
+       IR_SPEC_FRAME, 62, 0, {2, 6, IR_NO_FIELD, IR_NO_FIELD}},
+      /* Thomson: no start */
+      {IR_Thomson_str, 10, 40, 90, IR_START(IR_STD_TOLER, IR_STD_TOLER), 0,
+       {0, IR_MOD_PXM, 10, 40, 90, IR_RELAX_SHORT}, 12, IR_LSB,
+       IR_SPEC_NONE, 0, 0, {1, 4, 6, 7, IR_NO_FIELD}},
+      #endif
+      /* Samsung */
+      {IR_Samsung_str, 89, 89, 0, IR_START(IR_STD_TOLER, IR_STD_TOLER), 0,
+       {2, IR_MOD_PXM, 11, 11, 34, IR_STD_TOLER}, 32, IR_LSB | IR_LOCK,
+       IR_SPEC_NONE, 0, 0, {1, 8, 17, 8, IR_NO_FIELD}},
+      /* SIRC: PWM starting with first pause, command:address(:extended) */
+      {IR_SIRC_str, 48, 12, 0, IR_START(IR_STD_TOLER, IR_STD_TOLER), 0,
+       {1, IR_MOD_PXM, 12, 12, 24, IR_STD_TOLER}, 12, IR_LSB | IR_LOCK | IR_TAG_BITS,
+       IR_SPEC_NONE, 0, 0, {1, 7, 8, 5, IR_NO_FIELD}},
+      {IR_SIRC_str, 48, 12, 0, IR_START(IR_STD_TOLER, IR_STD_TOLER), 0,
+       {1, IR_MOD_PXM, 12, 12, 24, IR_STD_TOLER}, 15, IR_LSB | IR_LOCK | IR_TAG_BITS,
+       IR_SPEC_NONE, 0, 0, {1, 7, 8, 8, IR_NO_FIELD}},
+      {IR_SIRC_str, 48, 12, 0, IR_START(IR_STD_TOLER, IR_STD_TOLER), 0,
+       {1, IR_MOD_PXM, 12, 12, 24, IR_STD_TOLER}, 20, IR_LSB | IR_LOCK | IR_TAG_BITS,
+       IR_SPEC_NONE, 0, 0, {1, 7, 8, 5, 13, 8}},
+      #ifdef SW_IR_RX_EXTRA
+      /* RECS80 standard: no start */
+      {IR_RECS80_str, 4, 149, 0, IR_START(IR_STD_TOLER, IR_RELAX_LONG), 0,
+       {0, IR_MOD_PXM, 4, 98, 149, IR_RELAX_SHORT | IR_RELAX_LONG}, 11, IR_MSB,
+       IR_SPEC_NONE, 0, 0, {3, 3, 6, 6, IR_NO_FIELD}},
+      /* RECS80 extended: skip both halves of start */
+      {IR_RECS80_str, 4, 173, 0, IR_START(IR_STD_TOLER, IR_RELAX_LONG), 27,
+       {4, IR_MOD_PXM, 4, 98, 149, IR_RELAX_SHORT | IR_RELAX_LONG}, 11, IR_MSB,
+       IR_SPEC_NONE, 0, 'x', {2, 4, 6, 6, IR_NO_FIELD}},
+      #endif
+      /* Sharp: no start, second packet is inverted */
+      {IR_Sharp_str, 6, 14, 35, IR_START(IR_STD_TOLER, IR_STD_TOLER), 0,
+       {0, IR_MOD_PXM, 6, 14, 35, IR_STD_TOLER}, 15, IR_LSB | IR_LOCK,
+       IR_SPEC_PAIR, 0, 0, {1, 5, 6, 8, IR_NO_FIELD}},
+      /* RC-5: start bits are part of data */
+      {IR_RC5_str, 17, 17, 0, IR_START(IR_STD_TOLER, IR_STD_TOLER), 0,
+       {0, IR_MOD_BIPHASE | IR_IEEE | IR_PRE_PAUSE, 17, 0, 0, IR_STD_TOLER}, 14, IR_MSB | IR_LOCK,
+       IR_SPEC_NONE, 0, 0, {4, 5, 9, 6, IR_NO_FIELD}},
+      #ifdef SW_IR_RX_EXTRA
+      /* uPD1986C: no start, 8 time slots */
+      {IR_uPD1986C_str, 22, 22, 0, IR_START(IR_STD_TOLER, IR_STD_TOLER), 0,
+       {0, IR_MOD_PPM, 22, 8, 0, IR_STD_TOLER}, 8, IR_LSB,
+       IR_SPEC_NONE, 0, 0, {4, 5, IR_NO_FIELD, IR_NO_FIELD}},
+      #endif
+      /* RC-6: toggle bit with double timing */
+      {IR_RC6_str, 53, 17, 0, IR_START(IR_STD_TOLER, IR_STD_TOLER), 0,
+       {2, IR_MOD_BIPHASE | IR_THOMAS, 8, 0, 0, IR_RELAX_SHORT}, 21, IR_MSB | IR_LOCK,
+       IR_SPEC_TOGGLE, 8, 0, {6, 8, 14, 8, IR_NO_FIELD}},
+      /* end of table */
+      {0, 0, 0, 0, 0, 0, {0, 0, 0, 0, 0, 0}, 0, 0, 0, 0, 0, {0, 0, 0, 0, 0, 0}}
+    };
+  #endif
+
   #ifdef SW_OPTO_COUPLER
     const unsigned char If_str[] EEMEM = "If";
     const unsigned char t_on_str[] EEMEM = "t_on";
@@ -256,85 +398,83 @@
     const unsigned char Cmd_BJT_str[] EEMEM = "BJT";
     const unsigned char Cmd_SYM_str[] EEMEM = "SYM";
 
-    /* commands */
-    const unsigned char Cmd_VER_str[] EEMEM = "VER";
-    const unsigned char Cmd_PROBE_str[] EEMEM = "PROBE";
-    const unsigned char Cmd_OFF_str[] EEMEM = "OFF";
-    const unsigned char Cmd_COMP_str[] EEMEM = "COMP";
-    const unsigned char Cmd_MSG_str[] EEMEM = "MSG";
-    const unsigned char Cmd_QTY_str[] EEMEM = "QTY";
-    const unsigned char Cmd_NEXT_str[] EEMEM = "NEXT";
-    const unsigned char Cmd_TYPE_str[] EEMEM = "TYPE";
-    const unsigned char Cmd_HINT_str[] EEMEM = "HINT";
-    const unsigned char Cmd_PIN_str[] EEMEM = "PIN";
-    const unsigned char Cmd_R_str[] EEMEM = "R";
-    const unsigned char Cmd_C_str[] EEMEM = "C";
-    #ifdef SW_INDUCTOR
-    const unsigned char Cmd_L_str[] EEMEM = "L";
-    #endif
-    #if defined (SW_ESR) || defined (SW_OLD_ESR)
-    const unsigned char Cmd_ESR_str[] EEMEM = "ESR";
-    #endif
-    const unsigned char Cmd_V_F_str[] EEMEM = "V_F";
-    const unsigned char Cmd_V_F2_str[] EEMEM = "V_F2";
-    const unsigned char Cmd_C_D_str[] EEMEM = "C_D";
-    const unsigned char Cmd_R_BE_str[] EEMEM = "R_BE";
-    const unsigned char Cmd_h_FE_str[] EEMEM = "h_FE";
-    #ifdef SW_REVERSE_HFE
-    const unsigned char Cmd_h_FE_r_str[] EEMEM = "h_FE_r";
-    #endif
-    const unsigned char Cmd_V_BE_str[] EEMEM = "V_BE";
-    const unsigned char Cmd_I_CEO_str[] EEMEM = "I_CEO";
-    const unsigned char Cmd_V_TH_str[] EEMEM = "V_th";
-    const unsigned char Cmd_C_GS_str[] EEMEM = "C_GS";
-    const unsigned char Cmd_R_DS_str[] EEMEM = "R_DS";
-    const unsigned char Cmd_I_DSS_str[] EEMEM = "I_DSS";
-    const unsigned char Cmd_C_GE_str[] EEMEM = "C_GE";
-    const unsigned char Cmd_V_T_str[] EEMEM = "V_T";
-
-    /* command reference table */
-    const Cmd_Type Cmd_Table[] EEMEM = {
-      {CMD_VER, Cmd_VER_str},
-      {CMD_PROBE, Cmd_PROBE_str},
-      {CMD_OFF, Cmd_OFF_str},
-      {CMD_COMP, Cmd_COMP_str},
-      {CMD_MSG, Cmd_MSG_str},
-      {CMD_QTY, Cmd_QTY_str},
-      {CMD_NEXT, Cmd_NEXT_str},
-      {CMD_TYPE, Cmd_TYPE_str},
-      {CMD_HINT, Cmd_HINT_str},
-      {CMD_PIN, Cmd_PIN_str},
-      {CMD_R, Cmd_R_str},
-      {CMD_C, Cmd_C_str},
+    /* command names (flash), indexed by ID */
+    const char Cmd_Name[CMD_IDS][CMD_LENGTH + 1] PROGMEM = {
+      CMD_ENTRY(CMD_VER, "VER"),
+      CMD_ENTRY(CMD_PROBE, "PROBE"),
+      CMD_ENTRY(CMD_OFF, "OFF"),
+      CMD_ENTRY(CMD_COMP, "COMP"),
+      CMD_ENTRY(CMD_MSG, "MSG"),
+      CMD_ENTRY(CMD_QTY, "QTY"),
+      CMD_ENTRY(CMD_NEXT, "NEXT"),
+      CMD_ENTRY(CMD_TYPE, "TYPE"),
+      CMD_ENTRY(CMD_HINT, "HINT"),
+      CMD_ENTRY(CMD_PIN, "PIN"),
+      CMD_ENTRY(CMD_R, "R"),
+      CMD_ENTRY(CMD_C, "C"),
+      #ifdef SW_INDUCTOR
+      CMD_ENTRY(CMD_L, "L"),
+      #endif
+      #if defined (SW_ESR) || defined (SW_OLD_ESR)
+      CMD_ENTRY(CMD_ESR, "ESR"),
+      #endif
+      CMD_ENTRY(CMD_I_L, "I_l"),
+      CMD_ENTRY(CMD_V_F, "V_F"),
+      CMD_ENTRY(CMD_V_F2, "V_F2"),
+      CMD_ENTRY(CMD_C_D, "C_D"),
+      CMD_ENTRY(CMD_I_R, "I_R"),
+      CMD_ENTRY(CMD_R_BE, "R_BE"),
+      CMD_ENTRY(CMD_H_FE, "h_FE"),
+      #ifdef SW_REVERSE_HFE
+      CMD_ENTRY(CMD_H_FE_R, "h_FE_r"),
+      #endif
+      CMD_ENTRY(CMD_V_BE, "V_BE"),
+      CMD_ENTRY(CMD_I_CEO, "I_CEO"),
+      CMD_ENTRY(CMD_V_TH, "V_th"),
+      CMD_ENTRY(CMD_C_GS, "C_GS"),
+      CMD_ENTRY(CMD_R_DS, "R_DS"),
+      CMD_ENTRY(CMD_I_DSS, "I_DSS"),
+      CMD_ENTRY(CMD_C_GE, "C_GE"),
+      CMD_ENTRY(CMD_V_GT, "V_GT"),
+      CMD_ENTRY(CMD_V_T, "V_T"),
+      #ifdef SW_UJT
+      CMD_ENTRY(CMD_R_BB, "R_BB"),
+      #endif
+      CMD_ENTRY(CMD_DUMP, "DUMP"),
+      #ifdef UI_SERIAL_BINARY
+      CMD_ENTRY(CMD_BIN, "BIN"),
+      #endif
+      #ifdef UI_SERIAL_STREAM
+      CMD_ENTRY(CMD_STREAM, "STREAM"),
+      #endif
+      #if defined (UI_SERIAL_STREAM) && defined (SW_DDS)
+      CMD_ENTRY(CMD_SWEEP, "SWEEP"),
+      #endif
+    };
+
+    /* command IDs by hash slot (flash, see cmd_hash.h) */
+    const uint8_t Cmd_Slot[CMD_SLOTS] PROGMEM = {CMD_SLOT_TABLE};
+
+    /* probing commands in order of DUMP (flash) */
+    const uint8_t Cmd_Dump[] PROGMEM = {
+      CMD_COMP, CMD_MSG, CMD_QTY, CMD_TYPE, CMD_HINT, CMD_PIN,
+      CMD_R, CMD_C,
       #ifdef SW_INDUCTOR
-      {CMD_L, Cmd_L_str},
+      CMD_L,
       #endif
       #if defined (SW_ESR) || defined (SW_OLD_ESR)
-      {CMD_ESR, Cmd_ESR_str},
+      CMD_ESR,
       #endif
-      {CMD_I_L, I_leak_str},
-      {CMD_V_F, Cmd_V_F_str},
-      {CMD_V_F2, Cmd_V_F2_str},
-      {CMD_C_D, Cmd_C_D_str},
-      {CMD_I_R, I_R_str},
-      {CMD_R_BE, Cmd_R_BE_str},
-      {CMD_H_FE, Cmd_h_FE_str},
+      CMD_I_L, CMD_V_F, CMD_V_F2, CMD_C_D, CMD_I_R, CMD_R_BE, CMD_H_FE,
       #ifdef SW_REVERSE_HFE
-      {CMD_H_FE_R, Cmd_h_FE_r_str},
+      CMD_H_FE_R,
       #endif
-      {CMD_V_BE, Cmd_V_BE_str},
-      {CMD_I_CEO, Cmd_I_CEO_str},
-      {CMD_V_TH, Cmd_V_TH_str},
-      {CMD_C_GS, Cmd_C_GS_str},
-      {CMD_R_DS, Cmd_R_DS_str},
-      {CMD_I_DSS, Cmd_I_DSS_str},
-      {CMD_C_GE, Cmd_C_GE_str},
-      {CMD_V_GT, V_GT_str},
-      {CMD_V_T, Cmd_V_T_str},
+      CMD_V_BE, CMD_I_CEO, CMD_V_TH, CMD_C_GS, CMD_R_DS, CMD_I_DSS,
+      CMD_C_GE, CMD_V_GT, CMD_V_T,
       #ifdef SW_UJT
-      {CMD_R_BB, R_BB_str},
+      CMD_R_BB,
       #endif
-      {0, 0}
+      CMD_NONE
     };
   #endif
 
@@ -367,7 +507,7 @@
   const uint16_t Inductor_table[NUM_INDUCTOR] EEMEM = {4481, 3923, 3476, 3110, 2804, 2544, 2321, 2128, 1958, 1807, 1673, 1552, 1443, 1343, 1252, 1169, 1091, 1020, 953, 890, 831, 775, 721, 670, 621, 574, 527, 481, 434, 386, 334, 271};
   #endif
 
-  #if defined (HW_FREQ_COUNTER) || defined (SW_SQUAREWAVE)
+  #if defined (HW_FREQ_COUNTER) || defined (SW_SQUAREWAVE) || defined (SW_DDS)
   /* Timer1 prescalers and corresponding bitmasks */
   const uint16_t T1_Prescaler_table[NUM_TIMER1] EEMEM = {1, 8, 64, 256, 1024};
   const uint8_t T1_Bitmask_table[NUM_TIMER1] EEMEM = {(1 << CS10), (1 << CS11), (1 << CS11) | (1 << CS10), (1 << CS12), (1 << CS12) | (1 << CS10)};
@@ -411,12 +551,35 @@
 
   /* buffers */
   extern char            OutBuffer[];        /* output buffer */
+  #ifdef SERIAL_TX_BUFFER
+  extern uint8_t         TX_Buffer[];        /* serial TX buffer */
+  extern volatile uint8_t  TX_Head;          /* write position */
+  extern volatile uint8_t  TX_Tail;          /* read position */
+  #endif
+  #ifdef SERIAL_BITBANG
+  extern volatile uint8_t  Serial_Flags;     /* state of bit-bang serial */
+  extern uint8_t         Serial_Ticks;       /* timer ticks per bit */
+  extern uint8_t         Serial_Clock;       /* timer prescaler bits */
+  extern uint16_t        Serial_Loops;       /* delay loops per bit */
+  extern uint8_t         TX_Char;            /* TX char (bit buffer) */
+  extern uint8_t         TX_Bits;            /* bit counter for TX char */
+  extern uint8_t         TX_Time;            /* timer value for next TX bit */
+  #endif
   #ifdef SERIAL_RW
   extern char            RX_Buffer[];        /* serial RX buffer */
   extern uint8_t         RX_Pos;             /* position in buffer */
+    #ifdef SERIAL_RX_QUEUE
+    extern uint8_t       RX_Queue[];         /* queue of RX lines */
+    extern volatile uint8_t  RX_Head;        /* write position */
+    extern volatile uint8_t  RX_Tail;        /* read position */
+    extern volatile uint8_t  RX_Start;       /* start of current line */
+    extern volatile uint8_t  RX_Lines;       /* number of complete lines */
+    extern volatile uint8_t  RX_State;       /* state of queue */
+    #endif
     #ifdef SERIAL_BITBANG
     extern uint8_t       RX_Char;            /* RX char (bit buffer) */
     extern uint8_t       RX_Bits;            /* bit counter for RX char */
+    extern uint8_t       RX_Time;            /* timer value for next RX bit */
     #endif
   #endif
 
@@ -427,6 +590,7 @@
 
   #ifdef HW_TOUCH
   extern Touch_Type      Touch;              /* touch screen adjustment offsets */
+  extern volatile uint8_t  TouchEvent;       /* pen-down event */
   #endif
 
   /* probing */
@@ -559,11 +723,23 @@
     extern const unsigned char SquareWave_str[];
   #endif
 
+  #if defined (SW_DDS) && defined (HW_KEYS)
+    extern const unsigned char DDS_str[];
+  #endif
+
   #ifdef HW_ZENER
     extern const unsigned char Zener_str[];
+  #endif
+
+  #if defined (HW_ZENER) || defined (SW_DS18B20)
     extern const unsigned char Min_str[];
   #endif
 
+  #ifdef SW_DS18B20
+    extern const unsigned char Max_str[];
+    extern const unsigned char Avg_str[];
+  #endif
+
   #ifdef HW_FREQ_COUNTER
     extern const unsigned char FreqCounter_str[];
   #endif
@@ -630,6 +806,11 @@
     extern const unsigned char IR_SIRC_20_str[];
   #endif
 
+  #if defined (SW_IR_RECEIVER) || defined (HW_IR_RECEIVER)
+    /* protocol table (flash) */
+    extern const IR_Proto_Type IR_Proto_Table[];
+  #endif
+
   #ifdef SW_OPTO_COUPLER
     extern const unsigned char OptoCoupler_str[];
     extern const unsigned char None_str[];
@@ -685,41 +866,10 @@
     extern const unsigned char Cmd_BJT_str[];
     extern const unsigned char Cmd_SYM_str[];
 
-    /* commands */
-    extern const unsigned char Cmd_VER_str[];
-    extern const unsigned char Cmd_PROBE_str[];
-    extern const unsigned char Cmd_OFF_str[];
-    extern const unsigned char Cmd_COMP_str[];
-    extern const unsigned char Cmd_MSG_str[];
-    extern const unsigned char Cmd_QTY_str[];
-    extern const unsigned char Cmd_NEXT_str[];
-    extern const unsigned char Cmd_TYPE_str[];
-    extern const unsigned char Cmd_HINT_str[];
-    extern const unsigned char Cmd_PIN_str[];
-    extern const unsigned char Cmd_R_str[];
-    extern const unsigned char Cmd_C_str[];
-    #ifdef SW_INDUCTOR
-    extern const unsigned char Cmd_L_str[];
-    #endif
-    #if defined (SW_ESR) || defined (SW_OLD_ESR)
-    extern const unsigned char Cmd_ESR_str[];
-    #endif
-    extern const unsigned char Cmd_V_F_str[];
-    extern const unsigned char Cmd_V_F2_str[];
-    extern const unsigned char Cmd_C_D_str[];
-    extern const unsigned char Cmd_R_BE_str[];
-    extern const unsigned char Cmd_h_FE_str[];
-    extern const unsigned char Cmd_V_BE_str[];
-    extern const unsigned char Cmd_I_CEO_str[];
-    extern const unsigned char Cmd_V_TH_str[];
-    extern const unsigned char Cmd_C_GS_str[];
-    extern const unsigned char Cmd_R_DS_str[];
-    extern const unsigned char Cmd_I_DSS_str[];
-    extern const unsigned char Cmd_C_GE_str[];
-    extern const unsigned char Cmd_V_T_str[];
-
-    /* command reference table */
-    extern const Cmd_Type Cmd_Table[];
+    /* command table (flash) */
+    extern const char Cmd_Name[][CMD_LENGTH + 1];
+    extern const uint8_t Cmd_Slot[];
+    extern const uint8_t Cmd_Dump[];
   #endif
 
 
@@ -748,7 +898,7 @@
   extern const uint16_t Inductor_table[];
   #endif
 
-  #if defined (HW_FREQ_COUNTER) || defined (SW_SQUAREWAVE)
+  #if defined (HW_FREQ_COUNTER) || defined (SW_SQUAREWAVE) || defined (SW_DDS)
   /* Timer1 prescalers and corresponding bitmasks */
   extern const uint16_t T1_Prescaler_table[];
   extern const uint8_t T1_Bitmask_table[];